@@ -1,35 +1,79 @@
 #include "application.h"
 
-#include <stdlib.h>
-
+#include "mem_plan.h"
+#include "persist.h"
+#include "power.h"
+#include "prof.h"
 #include "reservoir.h"
+#include "stream.h"
+
+#define STREAM_SAMPLE_RATE (1000)
+// ms between stream reports
+#define STREAM_REPORT_PERIOD (1000)
+#define TRAINING_SAMPLES (960)
+// solve rows per unit of retraining work
+#define RETRAIN_ROWS (1)
+// cycles kept free before the next stream block on top of the worst unit seen
+#define RETRAIN_MARGIN (2000)
+
+#define RETRAIN_IDLE 0
+#define RETRAIN_ACCUMULATE 1
+#define RETRAIN_SOLVE 2
+
+extern const f32_t __training_data[];
 
-extern const VAL_T __training_data[];
+static mat_memory_t mem = {
+    .memory_alloc = mem_plan_alloc,
+    .memory_free = mem_plan_free,
+};
+static reservoir_t res = {
+    .mem = &mem,
+    .n_in_nodes = RES_N_IN_NODES,
+    .n_res_nodes = RES_N_RES_NODES,
+    .n_out_nodes = RES_N_OUT_NODES,
+    .leak_rate = 0.02f,
+};
+static uint32_t report_tick = 0;
+#if defined(LOW_POWER)
+static unsigned report_samples = 0;
+#endif
+#if defined(PROFILE)
+static UART_HandleTypeDef *console = NULL;
+#endif
+#if !defined(INFERENCE_ONLY)
+// retraining on the blue button, advanced between stream blocks
+static unsigned retrain_state = RETRAIN_IDLE;
+static unsigned retrain_sample = 0;
+static MAT_T retrain_nodes; // training state, predict keeps res.res_nodes
+static train_job_t retrain_job;
+static uint32_t retrain_unit_max = 0;
+#endif
 
 static void print_res_head(reservoir_t *res, char *label) {
   if(label) {
 	  LOG("%s\r\n", label);
   }
   LOG("res->in_weights: %f %f %f %f\r\n",
-      *MAT(res->in_weights, 0, 0),
-      *MAT(res->in_weights, 0, 1),
-      *MAT(res->in_weights, 0, 2),
-      *MAT(res->in_weights, 0, 3));
+      IN_WEIGHT(res, 0, 0),
+      IN_WEIGHT(res, 0, 1),
+      IN_WEIGHT(res, 0, 2),
+      IN_WEIGHT(res, 0, 3));
   LOG("res->res_weights: %f %f %f %f\r\n",
-      *MAT(res->res_weights, 0, 0),
-      *MAT(res->res_weights, 0, 1),
-      *MAT(res->res_weights, 0, 2),
-      *MAT(res->res_weights, 0, 3));
+      RES_WEIGHT(res, 0, 0),
+      RES_WEIGHT(res, 0, 1),
+      RES_WEIGHT(res, 0, 2),
+      RES_WEIGHT(res, 0, 3));
   LOG("res->out_weights: %f %f %f %f\r\n",
       *MAT(res->out_weights, 0, 0),
       *MAT(res->out_weights, 0, 1),
       *MAT(res->out_weights, 0, 2),
       *MAT(res->out_weights, 0, 3));
   LOG("res->res_nodes: %f %f %f %f\r\n",
-      *MAT(res->res_nodes, 0, 0),
-      *MAT(res->res_nodes, 0, 1),
-      *MAT(res->res_nodes, 0, 2),
-      *MAT(res->res_nodes, 0, 3));
+      VAL_TO_F32(*MAT(res->res_nodes, 0, 0)),
+      VAL_TO_F32(*MAT(res->res_nodes, 0, 1)),
+      VAL_TO_F32(*MAT(res->res_nodes, 0, 2)),
+      VAL_TO_F32(*MAT(res->res_nodes, 0, 3)));
+#if !defined(INFERENCE_ONLY)
   LOG("res->x: %f %f %f %f\r\n",
       *MAT(res->x, 0, 0),
       *MAT(res->x, 0, 1),
@@ -40,34 +84,138 @@ static void print_res_head(reservoir_t *res, char *label) {
       *MAT(res->y, 0, 1),
       *MAT(res->y, 0, 2),
       *MAT(res->y, 0, 3));
+#endif
+}
+
+#if !defined(INFERENCE_ONLY)
+static int feed_training_sample(unsigned i, MAT_T *state) {
+  MAT_T training_data;
+  MAT_NEW(NULL, &training_data, 1, 1);
+#if defined(PRECISION_Q15)
+  VAL_T sample;
+  training_data.data = &sample;
+  arm_float_to_q15((f32_t *) __training_data + i, &sample, 1);
+#else
+  training_data.data = (VAL_T *) __training_data + i;
+#endif
+  return train_accumulate(&res, &res.x, &res.y, state, &training_data, NULL, 0);
 }
 
-void application_init(UART_HandleTypeDef *uart) {
+// one bounded piece of retraining: a sample of Gram accumulation or RETRAIN_ROWS rows of the solve
+static void retrain_unit() {
+  switch(retrain_state) {
+  case RETRAIN_ACCUMULATE:
+    if(feed_training_sample(retrain_sample, &retrain_nodes) < 0) {
+      LOG("retrain failed\r\n");
+      train_reset(&res);
+      retrain_state = RETRAIN_IDLE;
+    } else if(++retrain_sample == TRAINING_SAMPLES) {
+      if(train_job_start(&res, &retrain_job, RESET_XY) < 0) {
+        LOG("retrain failed\r\n");
+        train_reset(&res);
+        retrain_state = RETRAIN_IDLE;
+      } else {
+        retrain_state = RETRAIN_SOLVE;
+      }
+    }
+    break;
+  case RETRAIN_SOLVE:
+    if(train_job_step(&res, &retrain_job, RETRAIN_ROWS)) {
+      LOG("retrained (unit max %u cycles)\r\n", (unsigned) retrain_unit_max);
+      // the erase stalls the loop for less than one stream block, the other half of the buffer covers it
+      if(persist_save(&res, 0) < 0) {
+        LOG("persist failed\r\n");
+      }
+      retrain_state = RETRAIN_IDLE;
+    }
+    break;
+  }
+  if(retrain_state == RETRAIN_IDLE) {
+    MAT_DESTROY(&mem, &retrain_nodes);
+  }
+}
+
+// cooperative scheduler, units run only while the stream has slack for them
+static void retrain_slice() {
+  if(retrain_state == RETRAIN_IDLE) {
+    // blue button, active low
+    if(HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_13) != GPIO_PIN_RESET) {
+      return;
+    }
+    if(MAT_NEW(&mem, &retrain_nodes, 1, res.n_res_nodes) < 0) {
+      return;
+    }
+    MAT_ZEROS(&retrain_nodes);
+    retrain_sample = 0;
+    retrain_state = RETRAIN_ACCUMULATE;
+  }
+  while(retrain_state != RETRAIN_IDLE && stream_slack() > 2 * retrain_unit_max + RETRAIN_MARGIN) {
+    uint32_t start = DWT->CYCCNT;
+    retrain_unit();
+    uint32_t cycles = DWT->CYCCNT - start;
+    if(cycles > retrain_unit_max) {
+      retrain_unit_max = cycles;
+    }
+  }
+}
+#endif
+
+#if defined(PROFILE)
+// 'p' on the console dumps the cycle profile, 'r' clears it. polled, the log owns the UART interrupt
+static void prof_console() {
+  if(__HAL_UART_GET_FLAG(console, UART_FLAG_ORE)) {
+    __HAL_UART_CLEAR_OREFLAG(console);
+  }
+  if(!__HAL_UART_GET_FLAG(console, UART_FLAG_RXNE)) {
+    return;
+  }
+  switch((char) (console->Instance->RDR & 0xff)) {
+  case 'p':
+    PROF_DUMP();
+    break;
+  case 'r':
+    PROF_RESET();
+    LOG("prof: reset\r\n");
+    break;
+  }
+}
+#endif
+
+void application_init(UART_HandleTypeDef *uart, ADC_HandleTypeDef *adc, TIM_HandleTypeDef *tim) {
   LOG_INIT(uart);
+  PROF_INIT();
+#if defined(PROFILE)
+  console = uart;
+#endif
 
-  mat_memory_t mem = {
-      .memory_alloc = (void *(*)(unsigned)) malloc,
-      .memory_free = (void (*)(void *)) free,
-  };
-  reservoir_t res = {
-      .mem = &mem,
-      .n_in_nodes = 1,
-      .n_res_nodes = 100,
-      .n_out_nodes = 1,
-      .leak_rate = 0.02f,
-  };
   // init
   init(&res);
   print_res_head(&res, "INIT");
-  // train
-  MAT_T training_data;
-  MAT_NEW(NULL, &training_data, 1, 1);
-  for(unsigned i = 0; i < 960; i++) {
-    training_data.data = __training_data + i;
-    train_feed_data(&res, &training_data);
+#if !defined(INFERENCE_ONLY)
+  if(persist_load(&res) >= 0) {
+    print_res_head(&res, "LOADED");
+  } else {
+    // train
+    for(unsigned i = 0; i < TRAINING_SAMPLES; i++) {
+      feed_training_sample(i, &res.res_nodes);
+    }
+    train_compute_weight(&res, RESET_XY);
+    print_res_head(&res, "TRAINED");
+    if(persist_save(&res, PERSIST_STATE) < 0) {
+      LOG("persist failed\r\n");
+    }
+  }
+#endif
+
+  // stream
+  if(stream_start(&res, adc, tim, STREAM_SAMPLE_RATE) < 0) {
+    LOG("stream start failed\r\n");
+    return;
   }
-  train_compute_weight(&res, RESET_XY);
-  print_res_head(&res, "TRAINED");
+  report_tick = HAL_GetTick();
+#if defined(LOW_POWER)
+  power_init();
+#endif
 
   // for indicating activity (turn on green LED on board)
   HAL_GPIO_WritePin(GPIOA, GPIO_PIN_5, 1);
@@ -75,6 +223,39 @@ void application_init(UART_HandleTypeDef *uart) {
 
 // application main loop
 void application_loop() {
+  stream_process();
+#if !defined(INFERENCE_ONLY)
+  retrain_slice();
+#endif
+#if defined(PROFILE)
+  prof_console();
+#endif
+  if(HAL_GetTick() - report_tick >= STREAM_REPORT_PERIOD) {
+    stream_stats_t stats;
+    stream_stats(&stats);
+    report_tick += STREAM_REPORT_PERIOD;
+    LOG("stream: %u Hz, %u samples, %u/%u cycles (max %u), %u overruns\r\n",
+        stats.sample_rate, stats.n_samples, stats.cycles_last, stats.budget, stats.cycles_max, stats.overruns);
+#if defined(LOW_POWER)
+    power_stats_t power;
+    power_window(&power);
+    unsigned n = stats.n_samples - report_samples;
+    report_samples = stats.n_samples;
+    LOG("power: %.1f%% active, %u sleeps, %u active cycles/prediction, %.1f nJ/prediction\r\n",
+        power.window_cycles ? 100.0f * power.active_cycles / power.window_cycles : 0.0f, power.n_sleeps,
+        n ? (unsigned) (power.active_cycles / n) : 0, power_energy_per_prediction(&power, n));
+#endif
+  }
+#if defined(LOW_POWER)
+#if !defined(INFERENCE_ONLY)
+  // retraining spends the slack between blocks instead
+  if(retrain_state == RETRAIN_IDLE) {
+    power_idle();
+  }
+#else
+  power_idle();
+#endif
+#endif
 }
 
 // application tick (10ms timer handler)
@@ -5,7 +5,7 @@
 
 #include "application_log.h"
 
-void application_init(UART_HandleTypeDef *uart);
+void application_init(UART_HandleTypeDef *uart, ADC_HandleTypeDef *adc, TIM_HandleTypeDef *tim);
 void application_loop();
 void application_tick();
 
@@ -1,13 +1,96 @@
 #include "application_log.h"
 
+#include <stdarg.h>
+
 UART_HandleTypeDef *_log_uart = NULL;
 
+// head and tail are free running, only the producer writes head and only the DMA path writes tail
+static char _log_buffer[LOG_BUFFER_SIZE];
+static volatile unsigned _log_head = 0;
+static volatile unsigned _log_tail = 0;
+static volatile unsigned _log_sending = 0; // bytes of the DMA transfer in flight
+static log_stats_t _log_stats_ = {0};
+
+// starts a DMA transfer of the contiguous part after tail unless one is in flight,
+// runs with interrupts masked because it is entered from both the producer and the completion interrupt
+static void _log_kick() {
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  unsigned head = _log_head;
+  unsigned tail = _log_tail;
+  if(_log_sending == 0 && head != tail) {
+    unsigned offset = tail & (LOG_BUFFER_SIZE - 1);
+    unsigned len = head - tail;
+    if(len > LOG_BUFFER_SIZE - offset) {
+      len = LOG_BUFFER_SIZE - offset;
+    }
+    if(HAL_UART_Transmit_DMA(_log_uart, (uint8_t *) _log_buffer + offset, len) == HAL_OK) {
+      _log_sending = len;
+    }
+  }
+  __set_PRIMASK(primask);
+}
+
 void _log_init(UART_HandleTypeDef *log_uart) {
   _log_uart = log_uart;
 }
 
-void _log(const char *buf) {
-  if(_log_uart != NULL) {
-    HAL_UART_Transmit(_log_uart, (uint8_t *) buf, strlen(buf), 0xffff);
+void _log(const char *format, ...) {
+  char line[LINE_MAX];
+  va_list args;
+  if(_log_uart == NULL) {
+    return;
+  }
+  va_start(args, format);
+  int n = vsnprintf(line, LINE_MAX, format, args);
+  va_end(args);
+  if(n < 0) {
+    return;
+  }
+  if(n >= LINE_MAX) {
+    _log_stats_.truncated_lines++;
+    n = LINE_MAX - 1;
+  }
+  unsigned head = _log_head;
+  if(LOG_BUFFER_SIZE - (head - _log_tail) < (unsigned) n) {
+    _log_stats_.dropped_lines++;
+    _log_stats_.dropped_bytes += n;
+    return;
+  }
+  for(int i = 0; i < n; i++) {
+    _log_buffer[(head + i) & (LOG_BUFFER_SIZE - 1)] = line[i];
+  }
+  // the data has to be in memory before the DMA path can see the new head
+  __DMB();
+  _log_head = head + n;
+  _log_kick();
+}
+
+void _log_flush() {
+  while(_log_uart != NULL && _log_tail != _log_head) {
+    // in case a transfer failed to start
+    _log_kick();
+  }
+}
+
+void _log_stats(log_stats_t *stats) {
+  *stats = _log_stats_;
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
+  if(huart == _log_uart) {
+    _log_tail += _log_sending;
+    _log_sending = 0;
+    _log_kick();
+  }
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+  if(huart == _log_uart) {
+    // give up the bytes in flight rather than stalling the log
+    _log_stats_.tx_errors++;
+    _log_tail += _log_sending;
+    _log_sending = 0;
+    _log_kick();
   }
 }
@@ -6,17 +6,28 @@
 
 #include "stm32l4xx_hal.h"
 
-#define LINE_MAX (64)
+#define LINE_MAX (128)
+// must be a power of two
+#define LOG_BUFFER_SIZE (2048)
+
+// lines are formatted into a ring buffer and sent with UART TX DMA,
+// a line that does not fit is dropped whole and counted.
+// LOG is single producer: call it from thread context only, not from interrupts.
+typedef struct {
+  unsigned dropped_lines;
+  unsigned dropped_bytes;
+  unsigned truncated_lines; // longer than LINE_MAX - 1
+  unsigned tx_errors;       // DMA transfers given up, written from the interrupt only
+} log_stats_t;
 
 void _log_init(UART_HandleTypeDef *log_uart);
-void _log(const char *buf);
+void _log(const char *format, ...) __attribute__((format(printf, 1, 2)));
+// blocks until the ring buffer is drained
+void _log_flush();
+void _log_stats(log_stats_t *stats);
 
 #define LOG_INIT(UART) _log_init(UART)
-#define LOG(...) \
-do { \
-  char _buf[LINE_MAX];\
-  snprintf(_buf, LINE_MAX, __VA_ARGS__);\
-  _log(_buf); \
-} while(0)
+#define LOG(...) _log(__VA_ARGS__)
+#define LOG_FLUSH() _log_flush()
 
 #endif /* APP_CMSIS_APPLICATION_LOG_H_ */
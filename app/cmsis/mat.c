@@ -1,4 +1,5 @@
 #include "mat.h"
+#include "prof.h"
 
 #include <math.h>
 #include <stdlib.h>
@@ -6,6 +7,128 @@
 
 //#define CHECK_ARGS
 
+static inline f32_t _f16_to_f32(f16_t h) {
+#if defined(__ARM_FP16_FORMAT_IEEE)
+  // VCVTB.F32.F16 on Cortex-M4 FPU (needs -mfp16-format=ieee)
+  union {
+    f16_t u;
+    __fp16 h;
+  } v = { h };
+  return (f32_t) v.h;
+#else
+  union {
+    f32_t f;
+    uint32_t u;
+  } v;
+  uint32_t sign = (uint32_t) (h & 0x8000) << 16;
+  uint32_t exp = (h >> 10) & 0x1f;
+  uint32_t man = h & 0x3ff;
+  if(exp == 0x1f) {
+    // inf or nan
+    v.u = sign | 0x7f800000 | (man << 13);
+  } else if(exp != 0) {
+    v.u = sign | ((exp + 112) << 23) | (man << 13);
+  } else if(man != 0) {
+    // subnormal, renormalize
+    exp = 113;
+    while(!(man & 0x400)) {
+      man <<= 1;
+      exp--;
+    }
+    v.u = sign | (exp << 23) | ((man & 0x3ff) << 13);
+  } else {
+    v.u = sign;
+  }
+  return v.f;
+#endif
+}
+
+static inline f16_t _f32_to_f16(f32_t f) {
+#if defined(__ARM_FP16_FORMAT_IEEE)
+  union {
+    __fp16 h;
+    f16_t u;
+  } v = { (__fp16) f };
+  return v.u;
+#else
+  union {
+    f32_t f;
+    uint32_t u;
+  } v = { f };
+  uint32_t sign = (v.u >> 16) & 0x8000;
+  uint32_t abs = v.u & 0x7fffffff;
+  uint32_t r, rem, half, shift;
+  if(abs >= 0x7f800000) {
+    // inf or nan
+    return sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0);
+  }
+  if(abs >= 0x477ff000) {
+    // rounds to inf
+    return sign | 0x7c00;
+  }
+  if(abs < 0x33000000) {
+    // rounds to zero
+    return sign;
+  }
+  if(abs < 0x38800000) {
+    // subnormal
+    shift = 126 - (abs >> 23);
+    abs = (abs & 0x7fffff) | 0x800000;
+    r = abs >> shift;
+    rem = abs & ((1u << shift) - 1);
+    half = 1u << (shift - 1);
+  } else {
+    r = (abs - 0x38000000) >> 13;
+    rem = abs & 0x1fff;
+    half = 0x1000;
+  }
+  // round to nearest even
+  if(rem > half || (rem == half && (r & 1))) {
+    r++;
+  }
+  return sign | r;
+#endif
+}
+
+static inline f32_t _bf16_to_f32(bf16_t h) {
+  union {
+    f32_t f;
+    uint32_t u;
+  } v;
+  v.u = (uint32_t) h << 16;
+  return v.f;
+}
+
+static inline bf16_t _f32_to_bf16(f32_t f) {
+  union {
+    f32_t f;
+    uint32_t u;
+  } v = { f };
+  if((v.u & 0x7fffffff) > 0x7f800000) {
+    // keep nan quiet
+    return (v.u >> 16) | 0x40;
+  }
+  // round to nearest even
+  v.u += 0x7fff + ((v.u >> 16) & 1);
+  return v.u >> 16;
+}
+
+f32_t f16_to_f32(f16_t h) {
+  return _f16_to_f32(h);
+}
+
+f16_t f32_to_f16(f32_t f) {
+  return _f32_to_f16(f);
+}
+
+f32_t bf16_to_f32(bf16_t h) {
+  return _bf16_to_f32(h);
+}
+
+bf16_t f32_to_bf16(f32_t f) {
+  return _f32_to_bf16(f);
+}
+
 int mat_f32_new(mat_memory_t *mem, mat_f32_t *a, unsigned n, unsigned m) {
   a->t = 0;
   a->n = n;
@@ -47,6 +170,7 @@ int mat_f32_transpose(mat_f32_t *at, mat_f32_t *a) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_TRANSPOSE);
   arm_matrix_instance_f32 _at, _a;
   arm_mat_init_f32(&_at, at->n, at->m, at->data);
   arm_mat_init_f32(&_a, a->n, a->m, a->data);
@@ -54,6 +178,7 @@ int mat_f32_transpose(mat_f32_t *at, mat_f32_t *a) {
   at->t = 0;
   at->n = a->m;
   at->m = a->n;
+  PROF_END(PROF_MAT_TRANSPOSE);
   return 0;
 }
 
@@ -72,6 +197,7 @@ int mat_f32_sum(mat_f32_t *c, mat_f32_t *a, mat_f32_t *b) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_SUM);
   arm_matrix_instance_f32 _c, _a, _b;
   c->t = 0;
   arm_mat_init_f32(&_c, c->n, c->m, c->data);
@@ -80,6 +206,7 @@ int mat_f32_sum(mat_f32_t *c, mat_f32_t *a, mat_f32_t *b) {
   if(arm_mat_add_f32(&_a, &_b, &_c) < 0) {
     return -1;
   }
+  PROF_END(PROF_MAT_SUM);
   return 0;
 }
 
@@ -111,6 +238,7 @@ int mat_f32_product(mat_f32_t *c, mat_f32_t *a, mat_f32_t *b) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_PRODUCT);
   arm_matrix_instance_f32 _c, _a, _b;
   c->t = 0;
   arm_mat_init_f32(&_c, c->n, c->m, c->data);
@@ -119,6 +247,7 @@ int mat_f32_product(mat_f32_t *c, mat_f32_t *a, mat_f32_t *b) {
   if(arm_mat_mult_f32(&_a, &_b, &_c) < 0) {
     return -1;
   }
+  PROF_END(PROF_MAT_PRODUCT);
   return 0;
 }
 
@@ -131,6 +260,7 @@ int mat_f32_mul(mat_f32_t *c, mat_f32_t *a, float l) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_MUL);
   arm_matrix_instance_f32 _c, _a;
   c->t = 0;
   arm_mat_init_f32(&_c, c->n, c->m, c->data);
@@ -138,6 +268,7 @@ int mat_f32_mul(mat_f32_t *c, mat_f32_t *a, float l) {
   if(arm_mat_scale_f32(&_a, l, &_c) < 0) {
     return -1;
   }
+  PROF_END(PROF_MAT_MUL);
   return 0;
 }
 
@@ -167,6 +298,7 @@ int mat_f32_inv(mat_f32_t *inv_a, mat_f32_t *a) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_INV);
   arm_matrix_instance_f32 _inv_a, _a;
   inv_a->t = 0;
   arm_mat_init_f32(&_inv_a, inv_a->n, inv_a->m, inv_a->data);
@@ -174,6 +306,7 @@ int mat_f32_inv(mat_f32_t *inv_a, mat_f32_t *a) {
   if(arm_mat_inverse_f32(&_a, &_inv_a) < 0) {
     return -1;
   }
+  PROF_END(PROF_MAT_INV);
   return 0;
 }
 
@@ -230,6 +363,340 @@ float mat_f32_max_abs_eigenval(mat_f32_t *a, mat_f32_t *x, mat_f32_t *y, unsigne
   return lambda;
 }
 
+// c = (a @ sign(b)) * l, sign(b) applied by flipping the sign bit of a (no multiplies)
+int mat_f32_sign_product(mat_f32_t *c, mat_f32_t *a, mat_sign_t *b, float l) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_WPRODUCT);
+  // one lane mask per bit of a sign word, the per-word loop then vectorises as a blend
+  uint32_t lane[32];
+  for(unsigned k = 0; k < 32; k++) {
+    lane[k] = (uint32_t) 1 << k;
+  }
+  unsigned m_words = c->m / 32 * 32;
+  mat_f32_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f32_t *row = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      f32_t v = *MAT(*a, n, p);
+      f32_t neg_v = -v;
+      uint32_t *sign = _MAT_SIGN_WORD(*b, p, 0);
+      for(unsigned m = 0; m < m_words; m += 32) {
+        uint32_t word = sign[m / 32];
+        for(unsigned k = 0; k < 32; k++) {
+          row[m + k] += (word & lane[k]) ? neg_v : v;
+        }
+      }
+      for(unsigned m = m_words; m < c->m; m++) {
+        row[m] += MAT_SIGN(*b, p, m) ? neg_v : v;
+      }
+    }
+  }
+  PROF_END(PROF_MAT_WPRODUCT);
+  return mat_f32_mul(c, c, l);
+}
+
+// c = a @ b, b is converted from storage precision on load
+int mat_f32_f16_product(mat_f32_t *c, mat_f32_t *a, mat_f16_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(b->t) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_WPRODUCT);
+  mat_f32_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f32_t *cn = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      float ap = *MAT(*a, n, p);
+      f16_t *bp = _MAT(*b, p, 0);
+      unsigned m = 0;
+      for(; m < c->m; m++) {
+        cn[m] += ap * _f16_to_f32(bp[m]);
+      }
+    }
+  }
+  PROF_END(PROF_MAT_WPRODUCT);
+  return 0;
+}
+
+int mat_f16_from_f32(mat_f16_t *dst, mat_f32_t *src) {
+  dst->t = 0;
+  for(unsigned n = 0; n < dst->n; n++) {
+    for(unsigned m = 0; m < dst->m; m++) {
+      *_MAT(*dst, n, m) = _f32_to_f16(*MAT(*src, n, m));
+    }
+  }
+  return 0;
+}
+
+// c = a @ b, b is converted from storage precision on load
+int mat_f32_bf16_product(mat_f32_t *c, mat_f32_t *a, mat_bf16_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(b->t) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_WPRODUCT);
+  mat_f32_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f32_t *cn = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      float ap = *MAT(*a, n, p);
+      bf16_t *bp = _MAT(*b, p, 0);
+      unsigned m = 0;
+      for(; m < c->m; m++) {
+        cn[m] += ap * _bf16_to_f32(bp[m]);
+      }
+    }
+  }
+  PROF_END(PROF_MAT_WPRODUCT);
+  return 0;
+}
+
+int mat_bf16_from_f32(mat_bf16_t *dst, mat_f32_t *src) {
+  dst->t = 0;
+  for(unsigned n = 0; n < dst->n; n++) {
+    for(unsigned m = 0; m < dst->m; m++) {
+      *_MAT(*dst, n, m) = _f32_to_bf16(*MAT(*src, n, m));
+    }
+  }
+  return 0;
+}
+
+int mat_q15_new(mat_memory_t *mem, mat_q15_t *a, unsigned n, unsigned m) {
+  a->t = 0;
+  a->n = n;
+  a->m = m;
+  if(mem && mem->memory_alloc) {
+    a->data = (q15_t *) mem->memory_alloc(sizeof(q15_t) * n * m);
+    if(a->data == NULL) {
+      return -1;
+    }
+  } else {
+    a->data = NULL;
+  }
+  return 0;
+}
+
+void mat_q15_destroy(mat_memory_t *mem, mat_q15_t *a) {
+  if(mem && mem->memory_free) {
+    mem->memory_free(a->data);
+    a->data = NULL;
+  }
+}
+
+int mat_q15_copy(mat_q15_t *dst, mat_q15_t *src) {
+  memcpy(dst->data, src->data, sizeof(q15_t) * dst->n * dst->m);
+  return 0;
+}
+
+int mat_q15_zeros(mat_q15_t *a) {
+  memset(a->data, 0, sizeof(q15_t) * a->n * a->m);
+  return 0;
+}
+
+static inline q15_t _sat_q15(q63_t v) {
+  return v > 0x7fff ? 0x7fff : v < -0x8000 ? -0x8000 : (q15_t) v;
+}
+
+int mat_q15_sum(mat_q15_t *c, mat_q15_t *a, mat_q15_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != a->m) {
+    return -1;
+  }
+  if(c->n != b->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_SUM);
+  c->t = 0;
+  if((c->n == 1 || c->m == 1) || (!a->t && !b->t)) {
+    arm_add_q15(a->data, b->data, c->data, c->n * c->m);
+  } else {
+    for(unsigned n = 0; n < c->n; n++) {
+      for(unsigned m = 0; m < c->m; m++) {
+        *_MAT(*c, n, m) = _sat_q15((q31_t) *MAT(*a, n, m) + *MAT(*b, n, m));
+      }
+    }
+  }
+  PROF_END(PROF_MAT_SUM);
+  return 0;
+}
+
+// c = a @ b, saturated, b is expected to be stored transposed (b->t) so each column is a dot product
+int mat_q15_product(mat_q15_t *c, mat_q15_t *a, mat_q15_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(a->t) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_PRODUCT);
+  q63_t r;
+  c->t = 0;
+  for(unsigned n = 0; n < c->n; n++) {
+    for(unsigned m = 0; m < c->m; m++) {
+      if(b->t) {
+        arm_dot_prod_q15(_MAT(*a, n, 0), _MAT_T(*b, 0, m), a->m, &r);
+      } else {
+        r = 0;
+        for(unsigned p = 0; p < a->m; p++) {
+          r += (q31_t) *_MAT(*a, n, p) * *_MAT(*b, p, m);
+        }
+      }
+      // round, truncation would bias the leaky state update
+      *_MAT(*c, n, m) = _sat_q15((r + 0x4000) >> 15);
+    }
+  }
+  PROF_END(PROF_MAT_PRODUCT);
+  return 0;
+}
+
+// c = a @ b with f32 b (out_weights), saturated
+int mat_q15_f32_product(mat_q15_t *c, mat_q15_t *a, mat_f32_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_WPRODUCT);
+  c->t = 0;
+  for(unsigned n = 0; n < c->n; n++) {
+    for(unsigned m = 0; m < c->m; m++) {
+      float r = 0.0f;
+      for(unsigned p = 0; p < a->m; p++) {
+        r += *MAT(*a, n, p) * *MAT(*b, p, m);
+      }
+      // a is in q15 units already, so r is the q15 result
+      *_MAT(*c, n, m) = _sat_q15((q63_t) (r + (r < 0.0f ? -0.5f : 0.5f)));
+    }
+  }
+  PROF_END(PROF_MAT_WPRODUCT);
+  return 0;
+}
+
+int mat_q15_mul(mat_q15_t *c, mat_q15_t *a, float l) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != a->m) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_MUL);
+  unsigned shift = 15;
+  while((l >= 1.0f || l < -1.0f) && shift > 0) {
+    l /= 2.0f;
+    shift--;
+  }
+  q31_t fract = _sat_q15((q63_t) (l * 32768.0f + (l < 0.0f ? -0.5f : 0.5f)));
+  c->t = a->t;
+  for(unsigned i = 0; i < c->n * c->m; i++) {
+    // round, truncation would bias the leaky state update
+    *(c->data + i) = _sat_q15(((q31_t) *(a->data + i) * fract + (1 << (shift - 1))) >> shift);
+  }
+  PROF_END(PROF_MAT_MUL);
+  return 0;
+}
+
+int mat_f32_from_q15(mat_f32_t *dst, mat_q15_t *src) {
+  dst->t = src->t;
+  arm_q15_to_float(src->data, dst->data, dst->n * dst->m);
+  return 0;
+}
+
+// tanh over [-1, 1) in 256 steps, linearly interpolated
+static const q15_t _q15_tanh_table[257] = {
+  -24956, -24848, -24738, -24628, -24516, -24402, -24287, -24171,
+  -24054, -23935, -23815, -23694, -23571, -23447, -23321, -23194,
+  -23066, -22936, -22804, -22672, -22538, -22402, -22265, -22126,
+  -21986, -21845, -21702, -21557, -21411, -21264, -21115, -20965,
+  -20813, -20659, -20504, -20348, -20189, -20030, -19869, -19706,
+  -19542, -19376, -19209, -19040, -18870, -18698, -18525, -18350,
+  -18173, -17995, -17816, -17634, -17452, -17268, -17082, -16895,
+  -16706, -16516, -16324, -16131, -15936, -15740, -15542, -15343,
+  -15143, -14941, -14737, -14532, -14326, -14118, -13909, -13698,
+  -13486, -13273, -13058, -12842, -12625, -12406, -12186, -11965,
+  -11743, -11519, -11294, -11068, -10840, -10612, -10382, -10151,
+  -9919, -9686, -9452, -9217, -8980, -8743, -8505, -8266,
+  -8025, -7784, -7542, -7300, -7056, -6811, -6566, -6320,
+  -6073, -5825, -5577, -5328, -5079, -4829, -4578, -4327,
+  -4075, -3823, -3570, -3317, -3063, -2809, -2555, -2300,
+  -2045, -1790, -1535, -1279, -1024, -768, -512, -256,
+  0, 256, 512, 768, 1024, 1279, 1535, 1790,
+  2045, 2300, 2555, 2809, 3063, 3317, 3570, 3823,
+  4075, 4327, 4578, 4829, 5079, 5328, 5577, 5825,
+  6073, 6320, 6566, 6811, 7056, 7300, 7542, 7784,
+  8025, 8266, 8505, 8743, 8980, 9217, 9452, 9686,
+  9919, 10151, 10382, 10612, 10840, 11068, 11294, 11519,
+  11743, 11965, 12186, 12406, 12625, 12842, 13058, 13273,
+  13486, 13698, 13909, 14118, 14326, 14532, 14737, 14941,
+  15143, 15343, 15542, 15740, 15936, 16131, 16324, 16516,
+  16706, 16895, 17082, 17268, 17452, 17634, 17816, 17995,
+  18173, 18350, 18525, 18698, 18870, 19040, 19209, 19376,
+  19542, 19706, 19869, 20030, 20189, 20348, 20504, 20659,
+  20813, 20965, 21115, 21264, 21411, 21557, 21702, 21845,
+  21986, 22126, 22265, 22402, 22538, 22672, 22804, 22936,
+  23066, 23194, 23321, 23447, 23571, 23694, 23815, 23935,
+  24054, 24171, 24287, 24402, 24516, 24628, 24738, 24848,
+  24956
+};
+
+q15_t q15_tanh(q15_t a) {
+  unsigned i = ((q31_t) a + 0x8000) >> 8;
+  q31_t frac = a & 0xff;
+  return _q15_tanh_table[i] + (((_q15_tanh_table[i + 1] - _q15_tanh_table[i]) * frac) >> 8);
+}
+
 int mat_f64_new(mat_memory_t *sup, mat_f64_t *a, unsigned n, unsigned m) {
   a->t = 0;
   a->n = n;
@@ -253,7 +720,7 @@ void mat_f64_destroy(mat_memory_t *mem, mat_f64_t *a) {
 }
 
 int mat_f64_copy(mat_f64_t *dst, mat_f64_t *src) {
-  memcpy(dst->data, src->data, sizeof(f32_t) * dst->n * dst->m);
+  memcpy(dst->data, src->data, sizeof(f64_t) * dst->n * dst->m);
   return 0;
 }
 
@@ -271,10 +738,12 @@ int mat_f64_transpose(mat_f64_t *at, mat_f64_t *a) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_TRANSPOSE);
   mat_f64_copy(at, a);
   at->t = !a->t;
   at->n = a->m;
   at->m = a->n;
+  PROF_END(PROF_MAT_TRANSPOSE);
   return 0;
 }
 
@@ -293,6 +762,7 @@ int mat_f64_sum(mat_f64_t *c, mat_f64_t *a, mat_f64_t *b) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_SUM);
   for(;;) {
     if(c->n == 1 || c->m == 1) {
       for(unsigned i = 0; i < c->n * c->m; i++) {
@@ -333,6 +803,7 @@ int mat_f64_sum(mat_f64_t *c, mat_f64_t *a, mat_f64_t *b) {
       break;
     }
   }
+  PROF_END(PROF_MAT_SUM);
   return 0;
 }
 
@@ -363,6 +834,7 @@ int mat_f64_product(mat_f64_t *c, mat_f64_t *a, mat_f64_t *b) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_PRODUCT);
   c->t = 0;
   for(;;) {
     if(!a->t && !b->t) {
@@ -410,6 +882,7 @@ int mat_f64_product(mat_f64_t *c, mat_f64_t *a, mat_f64_t *b) {
       break;
     }
   }
+  PROF_END(PROF_MAT_PRODUCT);
   return 0;
 }
 
@@ -422,9 +895,11 @@ int mat_f64_mul(mat_f64_t *c, mat_f64_t *a, double l) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_MUL);
   for(unsigned i = 0; i < c->n * c->m; i++) {
     *(c->data + i) = *(a->data + i) * l;
   }
+  PROF_END(PROF_MAT_MUL);
   return 0;
 }
 
@@ -454,6 +929,7 @@ int mat_f64_inv(mat_f64_t *inv_a, mat_f64_t *a) {
     return -1;
   }
 #endif
+  PROF_BEGIN(PROF_MAT_INV);
   double temp;
   mat_f64_identity(inv_a, 1.0f);
   if(a->t) {
@@ -491,6 +967,7 @@ int mat_f64_inv(mat_f64_t *inv_a, mat_f64_t *a) {
       }
     }
   }
+  PROF_END(PROF_MAT_INV);
   return 0;
 }
 
@@ -547,6 +1024,204 @@ double mat_f64_max_abs_eigenval(mat_f64_t *a, mat_f64_t *x, mat_f64_t *y, unsign
   return lambda;
 }
 
+// c = (a @ sign(b)) * l, sign(b) applied by flipping the sign bit of a (no multiplies)
+int mat_f64_sign_product(mat_f64_t *c, mat_f64_t *a, mat_sign_t *b, double l) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_WPRODUCT);
+  // one lane mask per bit of a sign word, the per-word loop then vectorises as a blend
+  uint32_t lane[32];
+  for(unsigned k = 0; k < 32; k++) {
+    lane[k] = (uint32_t) 1 << k;
+  }
+  unsigned m_words = c->m / 32 * 32;
+  mat_f64_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f64_t *row = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      f64_t v = *MAT(*a, n, p);
+      f64_t neg_v = -v;
+      uint32_t *sign = _MAT_SIGN_WORD(*b, p, 0);
+      for(unsigned m = 0; m < m_words; m += 32) {
+        uint32_t word = sign[m / 32];
+        for(unsigned k = 0; k < 32; k++) {
+          row[m + k] += (word & lane[k]) ? neg_v : v;
+        }
+      }
+      for(unsigned m = m_words; m < c->m; m++) {
+        row[m] += MAT_SIGN(*b, p, m) ? neg_v : v;
+      }
+    }
+  }
+  PROF_END(PROF_MAT_WPRODUCT);
+  return mat_f64_mul(c, c, l);
+}
+
+// c = a @ b, b is converted from storage precision on load
+int mat_f64_f16_product(mat_f64_t *c, mat_f64_t *a, mat_f16_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(b->t) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_WPRODUCT);
+  mat_f64_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f64_t *cn = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      double ap = *MAT(*a, n, p);
+      f16_t *bp = _MAT(*b, p, 0);
+      unsigned m = 0;
+      for(; m < c->m; m++) {
+        cn[m] += ap * _f16_to_f32(bp[m]);
+      }
+    }
+  }
+  PROF_END(PROF_MAT_WPRODUCT);
+  return 0;
+}
+
+int mat_f16_from_f64(mat_f16_t *dst, mat_f64_t *src) {
+  dst->t = 0;
+  for(unsigned n = 0; n < dst->n; n++) {
+    for(unsigned m = 0; m < dst->m; m++) {
+      *_MAT(*dst, n, m) = _f32_to_f16(*MAT(*src, n, m));
+    }
+  }
+  return 0;
+}
+
+// c = a @ b, b is converted from storage precision on load
+int mat_f64_bf16_product(mat_f64_t *c, mat_f64_t *a, mat_bf16_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(b->t) {
+    return -1;
+  }
+#endif
+  PROF_BEGIN(PROF_MAT_WPRODUCT);
+  mat_f64_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f64_t *cn = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      double ap = *MAT(*a, n, p);
+      bf16_t *bp = _MAT(*b, p, 0);
+      unsigned m = 0;
+      for(; m < c->m; m++) {
+        cn[m] += ap * _bf16_to_f32(bp[m]);
+      }
+    }
+  }
+  PROF_END(PROF_MAT_WPRODUCT);
+  return 0;
+}
+
+int mat_bf16_from_f64(mat_bf16_t *dst, mat_f64_t *src) {
+  dst->t = 0;
+  for(unsigned n = 0; n < dst->n; n++) {
+    for(unsigned m = 0; m < dst->m; m++) {
+      *_MAT(*dst, n, m) = _f32_to_bf16(*MAT(*src, n, m));
+    }
+  }
+  return 0;
+}
+
+int mat_sign_new(mat_memory_t *mem, mat_sign_t *a, unsigned n, unsigned m) {
+  a->n = n;
+  a->m = m;
+  if(mem && mem->memory_alloc) {
+    a->data = (uint32_t *) mem->memory_alloc(sizeof(uint32_t) * n * MAT_SIGN_WORDS(m));
+    if(a->data == NULL) {
+      return -1;
+    }
+  } else {
+    a->data = NULL;
+  }
+  return 0;
+}
+
+void mat_sign_destroy(mat_memory_t *mem, mat_sign_t *a) {
+  if(mem && mem->memory_free) {
+    mem->memory_free(a->data);
+    a->data = NULL;
+  }
+}
+
+int mat_sign_zeros(mat_sign_t *a) {
+  memset(a->data, 0, sizeof(uint32_t) * a->n * MAT_SIGN_WORDS(a->m));
+  return 0;
+}
+
+int mat_f16_new(mat_memory_t *mem, mat_f16_t *a, unsigned n, unsigned m) {
+  a->t = 0;
+  a->n = n;
+  a->m = m;
+  if(mem && mem->memory_alloc) {
+    a->data = (f16_t *) mem->memory_alloc(sizeof(f16_t) * n * m);
+    if(a->data == NULL) {
+      return -1;
+    }
+  } else {
+    a->data = NULL;
+  }
+  return 0;
+}
+
+void mat_f16_destroy(mat_memory_t *mem, mat_f16_t *a) {
+  if(mem && mem->memory_free) {
+    mem->memory_free(a->data);
+    a->data = NULL;
+  }
+}
+
+int mat_bf16_new(mat_memory_t *mem, mat_bf16_t *a, unsigned n, unsigned m) {
+  a->t = 0;
+  a->n = n;
+  a->m = m;
+  if(mem && mem->memory_alloc) {
+    a->data = (bf16_t *) mem->memory_alloc(sizeof(bf16_t) * n * m);
+    if(a->data == NULL) {
+      return -1;
+    }
+  } else {
+    a->data = NULL;
+  }
+  return 0;
+}
+
+void mat_bf16_destroy(mat_memory_t *mem, mat_bf16_t *a) {
+  if(mem && mem->memory_free) {
+    mem->memory_free(a->data);
+    a->data = NULL;
+  }
+}
+
 #if 0
 #include <stdio.h>
 #include <stdlib.h>
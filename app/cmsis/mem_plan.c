@@ -0,0 +1,73 @@
+#include "mem_plan.h"
+
+#include <stdint.h>
+
+typedef struct {
+  uint32_t size; // bytes after the header
+  uint32_t used;
+} mem_block_t;
+
+typedef struct {
+  uint8_t *base;
+  uint32_t size;
+  unsigned ready;
+} mem_pool_t;
+
+// one spare header keeps an empty plan valid
+static uint8_t _hot[MEM_PLAN_HOT_SIZE + sizeof(mem_block_t)] __attribute__((section(".ram2"), aligned(8)));
+static uint8_t _bulk[MEM_PLAN_BULK_SIZE + sizeof(mem_block_t)] __attribute__((aligned(8)));
+
+static mem_pool_t _hot_pool = { _hot, sizeof(_hot), 0 };
+static mem_pool_t _bulk_pool = { _bulk, sizeof(_bulk), 0 };
+
+#define _BLOCK_NEXT(B) ((mem_block_t *) ((uint8_t *) ((B) + 1) + (B)->size))
+
+// first fit, free neighbours are merged while searching
+static void *_pool_alloc(mem_pool_t *pool, uint32_t size) {
+  mem_block_t *end = (mem_block_t *) (pool->base + pool->size);
+  if(!pool->ready) {
+    // .ram2 is not zeroed at startup
+    mem_block_t *b = (mem_block_t *) pool->base;
+    b->size = pool->size - sizeof(mem_block_t);
+    b->used = 0;
+    pool->ready = 1;
+  }
+  size = (size + 7) & ~7;
+  for(mem_block_t *b = (mem_block_t *) pool->base; b < end; b = _BLOCK_NEXT(b)) {
+    if(b->used) {
+      continue;
+    }
+    for(mem_block_t *next = _BLOCK_NEXT(b); next < end && !next->used; next = _BLOCK_NEXT(b)) {
+      b->size += sizeof(mem_block_t) + next->size;
+    }
+    if(b->size < size) {
+      continue;
+    }
+    if(b->size >= size + sizeof(mem_block_t) + 8) {
+      mem_block_t *rest = (mem_block_t *) ((uint8_t *) (b + 1) + size);
+      rest->size = b->size - size - sizeof(mem_block_t);
+      rest->used = 0;
+      b->size = size;
+    }
+    b->used = 1;
+    return b + 1;
+  }
+  return NULL;
+}
+
+void *mem_plan_alloc(unsigned size) {
+  void *p = NULL;
+  if(size <= MEM_PLAN_ROW) {
+    p = _pool_alloc(&_hot_pool, size);
+  }
+  if(p == NULL) {
+    p = _pool_alloc(&_bulk_pool, size);
+  }
+  return p;
+}
+
+void mem_plan_free(void *p) {
+  if(p != NULL) {
+    ((mem_block_t *) p - 1)->used = 0;
+  }
+}
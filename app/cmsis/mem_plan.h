@@ -0,0 +1,57 @@
+#ifndef APP_CMSIS_MEM_PLAN_H_
+#define APP_CMSIS_MEM_PLAN_H_
+
+#include "reservoir.h"
+
+// reservoir configuration the plan is made for
+#define RES_N_IN_NODES (1)
+#define RES_N_RES_NODES (100)
+#define RES_N_OUT_NODES (1)
+
+// every allocation is 8 byte aligned behind an 8 byte header
+#define MEM_PLAN_BLOCK(X) ((((X) + 7) & ~7) + 8)
+// per-step buffers are at most two state rows (train_accumulate of one sample), they go to SRAM2
+#define MEM_PLAN_ROW (2 * RES_N_RES_NODES * (sizeof(ACC_VAL_T) > sizeof(VAL_T) ? sizeof(ACC_VAL_T) : sizeof(VAL_T)))
+#define MEM_PLAN_HOT(X) ((X) <= MEM_PLAN_ROW ? MEM_PLAN_BLOCK(X) : 0)
+#define MEM_PLAN_BULK(X) ((X) <= MEM_PLAN_ROW ? 0 : MEM_PLAN_BLOCK(X))
+#define MEM_PLAN_MAX(A, B) ((A) > (B) ? (A) : (B))
+
+#define MEM_PLAN_STATE (sizeof(VAL_T) * RES_N_RES_NODES)
+#define MEM_PLAN_OUT (sizeof(ACC_VAL_T) * RES_N_RES_NODES * RES_N_OUT_NODES)
+#define MEM_PLAN_GRAM (sizeof(ACC_VAL_T) * RES_N_RES_NODES * RES_N_RES_NODES)
+
+#if defined(INFERENCE_ONLY) && defined(ADAPT_ONLINE)
+// res_nodes, scratch and the out_weights adapt() updates
+#define MEM_PLAN_SIZE(P) (2 * P(MEM_PLAN_STATE) + P(MEM_PLAN_OUT))
+#elif defined(INFERENCE_ONLY)
+// res_nodes and scratch, out_weights are in flash
+#define MEM_PLAN_SIZE(P) (2 * P(MEM_PLAN_STATE))
+#else
+// resident: res_nodes and the retrain state, out_weights, y and the weights of a train job, x
+#define MEM_PLAN_RESIDENT(P) (2 * P(MEM_PLAN_STATE) + 3 * P(MEM_PLAN_OUT) + P(MEM_PLAN_GRAM))
+// transient, one at a time from the main loop
+#define MEM_PLAN_PREDICT(P) (2 * P(MEM_PLAN_STATE))
+#if defined(PRECISION_Q15)
+#define MEM_PLAN_FEED_ACC(P) (P(sizeof(ACC_VAL_T) * RES_N_RES_NODES) + P(sizeof(ACC_VAL_T) * RES_N_OUT_NODES))
+#else
+#define MEM_PLAN_FEED_ACC(P) (0)
+#endif
+// train_accumulate of one sample with train_fold
+#define MEM_PLAN_FEED(P) (P(2 * MEM_PLAN_STATE) + P(MEM_PLAN_STATE) + MEM_PLAN_FEED_ACC(P) + \
+    P(sizeof(ACC_VAL_T) * RES_N_RES_NODES) + P(MEM_PLAN_GRAM) + P(MEM_PLAN_OUT))
+// train_compute_weight with reset
+#define MEM_PLAN_SOLVE(P) (P(MEM_PLAN_GRAM))
+// READOUT_QR needs less than the normal equations
+#define MEM_PLAN_SIZE(P) (MEM_PLAN_RESIDENT(P) + \
+    MEM_PLAN_MAX(MEM_PLAN_PREDICT(P), MEM_PLAN_MAX(MEM_PLAN_FEED(P), MEM_PLAN_SOLVE(P))))
+#endif
+
+// pool sizes, a configuration that does not fit fails at link time (region RAM or RAM2 overflowed)
+#define MEM_PLAN_HOT_SIZE MEM_PLAN_SIZE(MEM_PLAN_HOT)
+#define MEM_PLAN_BULK_SIZE MEM_PLAN_SIZE(MEM_PLAN_BULK)
+
+// mat_memory_t functions over the static pools: per-step buffers from SRAM2, matrices from the bulk arena
+void *mem_plan_alloc(unsigned size);
+void mem_plan_free(void *p);
+
+#endif /* APP_CMSIS_MEM_PLAN_H_ */
@@ -0,0 +1,194 @@
+#include "persist.h"
+
+#include <string.h>
+
+// from the linker script, page aligned and within one bank
+extern uint8_t _spersist[];
+extern uint8_t _epersist[];
+
+#define PERSIST_ALIGN_UP(X, A) (((X) + (A) - 1) & ~((A) - 1))
+
+typedef struct {
+  uint32_t out_size;   // bytes of out_weights
+  uint32_t state_off;  // payload offset of res_nodes, double word aligned for programming
+  uint32_t state_size; // bytes of res_nodes
+  uint32_t slot_size;  // pages for the largest record
+  uint32_t n_slots;
+} persist_layout_t;
+
+static void _layout(reservoir_t *res, persist_layout_t *l) {
+  l->out_size = sizeof(ACC_VAL_T) * res->n_res_nodes * res->n_out_nodes;
+  l->state_off = PERSIST_ALIGN_UP(l->out_size, 8);
+  l->state_size = sizeof(VAL_T) * res->n_res_nodes;
+  l->slot_size = PERSIST_ALIGN_UP(sizeof(persist_header_t) + l->state_off + l->state_size, FLASH_PAGE_SIZE);
+  l->n_slots = (_epersist - _spersist) / l->slot_size;
+}
+
+static uint32_t _payload_size(persist_layout_t *l, unsigned flags) {
+  return flags & PERSIST_STATE ? l->state_off + l->state_size : l->out_size;
+}
+
+// hardware CRC unit in its reset configuration (CRC-32 polynomial, all ones initial value).
+// word writes are not equivalent to byte writes, so both sides feed the same pieces from the same alignment.
+static void _crc_reset() {
+  __HAL_RCC_CRC_CLK_ENABLE();
+  CRC->CR = CRC_CR_RESET;
+}
+
+static void _crc_feed(const void *data, uint32_t size) {
+  const uint8_t *p = data;
+  for(; size && ((uint32_t) p & 3); size--) {
+    *(volatile uint8_t *) &CRC->DR = *p++;
+  }
+  for(; size >= 4; size -= 4, p += 4) {
+    CRC->DR = *(const uint32_t *) p;
+  }
+  for(; size; size--) {
+    *(volatile uint8_t *) &CRC->DR = *p++;
+  }
+}
+
+static uint32_t _weights_crc(reservoir_t *res) {
+  _crc_reset();
+#if defined(SIGN_IN_WEIGHTS)
+  _crc_feed(res->in_weights.data, sizeof(uint32_t) * res->n_in_nodes * MAT_SIGN_WORDS(res->n_res_nodes));
+  _crc_feed(&res->in_scale, sizeof(res->in_scale));
+#else
+  _crc_feed(res->in_weights.data, sizeof(WVAL_T) * res->n_in_nodes * res->n_res_nodes);
+#endif
+  _crc_feed(res->res_weights.data, sizeof(WVAL_T) * res->n_res_nodes * res->n_res_nodes);
+  return CRC->DR;
+}
+
+static uint32_t _record_crc(const persist_header_t *h, const void *out, const void *state, persist_layout_t *l) {
+  persist_header_t copy = *h;
+  copy.crc = 0;
+  _crc_reset();
+  _crc_feed(&copy, sizeof(copy));
+  _crc_feed(out, l->out_size);
+  if(h->flags & PERSIST_STATE) {
+    _crc_feed(state, l->state_size);
+  }
+  return CRC->DR;
+}
+
+static void _header(persist_header_t *h, reservoir_t *res, uint32_t weights_crc) {
+  memset(h, 0, sizeof(*h));
+  h->magic = PERSIST_MAGIC;
+  h->version = PERSIST_VERSION;
+  h->acc_size = sizeof(ACC_VAL_T);
+  h->val_size = sizeof(VAL_T);
+  h->n_in_nodes = res->n_in_nodes;
+  h->n_res_nodes = res->n_res_nodes;
+  h->n_out_nodes = res->n_out_nodes;
+  h->weights_crc = weights_crc;
+}
+
+// newest valid record for res, NULL if there is none
+static const persist_header_t *_newest(reservoir_t *res, persist_layout_t *l, uint32_t weights_crc, unsigned *slot) {
+  const persist_header_t *newest = NULL;
+  persist_header_t expect;
+  _header(&expect, res, weights_crc);
+  for(unsigned i = 0; i < l->n_slots; i++) {
+    const persist_header_t *h = (const persist_header_t *) (_spersist + i * l->slot_size);
+    const uint8_t *payload = (const uint8_t *) (h + 1);
+    if(h->magic != expect.magic || h->version != expect.version ||
+        h->acc_size != expect.acc_size || h->val_size != expect.val_size ||
+        h->n_in_nodes != expect.n_in_nodes || h->n_res_nodes != expect.n_res_nodes ||
+        h->n_out_nodes != expect.n_out_nodes || h->weights_crc != expect.weights_crc) {
+      continue;
+    }
+    if(h->size != _payload_size(l, h->flags)) {
+      continue;
+    }
+    if(h->crc != _record_crc(h, payload, payload + l->state_off, l)) {
+      continue;
+    }
+    // seq wraps
+    if(newest == NULL || (int32_t) (h->seq - newest->seq) > 0) {
+      newest = h;
+      *slot = i;
+    }
+  }
+  return newest;
+}
+
+static int _program(uint32_t addr, const void *data, uint32_t size) {
+  const uint8_t *p = data;
+  for(uint32_t off = 0; off < size; off += 8) {
+    uint64_t dw = UINT64_MAX;
+    memcpy(&dw, p + off, size - off < 8 ? size - off : 8);
+    if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_DOUBLEWORD, addr + off, dw) != HAL_OK) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int persist_save(reservoir_t *res, unsigned flags) {
+  int ret = -1;
+  persist_layout_t l;
+  persist_header_t h;
+  _layout(res, &l);
+  if(l.n_slots < 2) {
+    // the newest record must survive erasing the next slot
+    return -1;
+  }
+  uint32_t weights_crc = _weights_crc(res);
+  unsigned slot = 0;
+  const persist_header_t *newest = _newest(res, &l, weights_crc, &slot);
+  _header(&h, res, weights_crc);
+  h.flags = flags;
+  h.size = _payload_size(&l, flags);
+  if(newest != NULL) {
+    slot = (slot + 1) % l.n_slots;
+    h.seq = newest->seq + 1;
+  }
+  h.crc = _record_crc(&h, res->out_weights.data, res->res_nodes.data, &l);
+  uint32_t addr = (uint32_t) (_spersist + slot * l.slot_size);
+  FLASH_EraseInitTypeDef erase = {
+      .TypeErase = FLASH_TYPEERASE_PAGES,
+      .Banks = addr - FLASH_BASE < FLASH_BANK_SIZE ? FLASH_BANK_1 : FLASH_BANK_2,
+      .Page = ((addr - FLASH_BASE) % FLASH_BANK_SIZE) / FLASH_PAGE_SIZE,
+      .NbPages = l.slot_size / FLASH_PAGE_SIZE,
+  };
+  uint32_t page_error;
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_ALL_ERRORS);
+  if(HAL_FLASHEx_Erase(&erase, &page_error) != HAL_OK) {
+    goto fail;
+  }
+  // header last, an interrupted save leaves no header behind
+  addr += sizeof(h);
+  if(_program(addr, res->out_weights.data, l.out_size) < 0) {
+    goto fail;
+  }
+  if(flags & PERSIST_STATE) {
+    if(_program(addr + l.state_off, res->res_nodes.data, l.state_size) < 0) {
+      goto fail;
+    }
+  }
+  if(_program(addr - sizeof(h), &h, sizeof(h)) < 0) {
+    goto fail;
+  }
+  ret = 0;
+fail:
+  HAL_FLASH_Lock();
+  return ret;
+}
+
+int persist_load(reservoir_t *res) {
+  persist_layout_t l;
+  unsigned slot;
+  _layout(res, &l);
+  const persist_header_t *h = _newest(res, &l, _weights_crc(res), &slot);
+  if(h == NULL) {
+    return -1;
+  }
+  const uint8_t *payload = (const uint8_t *) (h + 1);
+  memcpy(res->out_weights.data, payload, l.out_size);
+  if(h->flags & PERSIST_STATE) {
+    memcpy(res->res_nodes.data, payload + l.state_off, l.state_size);
+  }
+  return h->flags;
+}
@@ -0,0 +1,37 @@
+#ifndef APP_CMSIS_PERSIST_H_
+#define APP_CMSIS_PERSIST_H_
+
+#include "stm32l4xx_hal.h"
+
+#include "reservoir.h"
+
+#define PERSIST_MAGIC (0x52504552) // "REPR"
+#define PERSIST_VERSION (1)
+
+// flags
+#define PERSIST_STATE (1) // res_nodes follow out_weights
+
+// records live in page aligned slots of the PERSIST region of the linker script,
+// each save goes to the slot after the newest one so erases rotate over all pages
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t seq;          // the valid record with the highest seq is loaded
+  uint32_t flags;
+  uint32_t acc_size;     // sizeof(ACC_VAL_T)
+  uint32_t val_size;     // sizeof(VAL_T)
+  uint32_t n_in_nodes;
+  uint32_t n_res_nodes;
+  uint32_t n_out_nodes;
+  uint32_t weights_crc;  // in_weights and res_weights the readout was trained for
+  uint32_t size;         // payload bytes
+  uint32_t crc;          // header (with crc 0) and payload
+} persist_header_t;
+
+// programs out_weights (and res_nodes with PERSIST_STATE) into the next slot.
+// erasing stalls the caller for about 22 ms per page, bank 1 code keeps running from flash meanwhile
+int persist_save(reservoir_t *res, unsigned flags);
+// copies the newest valid record for res into out_weights (and res_nodes), returns its flags or -1
+int persist_load(reservoir_t *res);
+
+#endif /* APP_CMSIS_PERSIST_H_ */
@@ -0,0 +1,58 @@
+#include "power.h"
+
+#include "stream.h"
+
+static uint32_t _window_tick = 0;
+static uint32_t _wake_at = 0;
+static uint32_t _active = 0;
+static unsigned _sleeps = 0;
+
+void power_init() {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  // the core does not fetch while sleeping, interrupt handlers run after the clock is back
+  __HAL_RCC_FLASH_CLK_SLEEP_DISABLE();
+  _window_tick = HAL_GetTick();
+  _wake_at = DWT->CYCCNT;
+  _active = 0;
+  _sleeps = 0;
+}
+
+void power_idle() {
+  // a DMA completion between the check and WFI stays pending and ends WFI right away
+  __disable_irq();
+  if(stream_pending()) {
+    __enable_irq();
+    return;
+  }
+  // the cycle counter may stop while the core clock is gated, so only awake spans are measured
+  _active += DWT->CYCCNT - _wake_at;
+  HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+  _wake_at = DWT->CYCCNT;
+  _sleeps++;
+  __enable_irq();
+}
+
+void power_window(power_stats_t *stats) {
+  uint32_t now = DWT->CYCCNT;
+  uint32_t tick = HAL_GetTick();
+  _active += now - _wake_at;
+  _wake_at = now;
+  // the window length comes from SysTick, which keeps counting in Sleep mode
+  stats->window_cycles = (tick - _window_tick) * (SystemCoreClock / 1000);
+  stats->active_cycles = _active < stats->window_cycles ? _active : stats->window_cycles;
+  stats->n_sleeps = _sleeps;
+  _window_tick = tick;
+  _active = 0;
+  _sleeps = 0;
+}
+
+float power_energy_per_prediction(power_stats_t *stats, unsigned n) {
+  if(n == 0) {
+    return 0.0f;
+  }
+  // uA/MHz * V * cycles = pJ
+  float pj = ((float) POWER_RUN_UA_PER_MHZ * stats->active_cycles +
+      (float) POWER_SLEEP_UA_PER_MHZ * (stats->window_cycles - stats->active_cycles)) * POWER_VDD;
+  return pj / 1000.0f / n;
+}
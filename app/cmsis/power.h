@@ -0,0 +1,27 @@
+#ifndef APP_CMSIS_POWER_H_
+#define APP_CMSIS_POWER_H_
+
+#include "stm32l4xx_hal.h"
+
+// typical supply current per MHz at 80 MHz from flash (datasheet), for the energy estimate only
+#define POWER_RUN_UA_PER_MHZ (120)
+#define POWER_SLEEP_UA_PER_MHZ (30)
+#define POWER_VDD (3.3f)
+
+typedef struct {
+  uint32_t window_cycles; // core clock cycles since the last power_window
+  uint32_t active_cycles; // of those, awake
+  unsigned n_sleeps;
+} power_stats_t;
+
+// starts the cycle counter and the first window
+void power_init();
+// sleeps (WFI) until the next interrupt unless a stream block is pending, call from the main loop when it has
+// nothing else to do. TIM6, ADC and DMA keep running in Sleep mode; Stop modes would stop them
+void power_idle();
+// closes the current window into stats and starts the next one
+void power_window(power_stats_t *stats);
+// estimated energy in nJ of a window, split over n predictions
+float power_energy_per_prediction(power_stats_t *stats, unsigned n);
+
+#endif /* APP_CMSIS_POWER_H_ */
@@ -0,0 +1,55 @@
+#include "prof.h"
+
+#if defined(PROFILE)
+#if defined(PROF_ICOUNT)
+#include <stdio.h>
+#include <string.h>
+#define PROF_LOG(...) printf(__VA_ARGS__)
+#define PROF_UNIT "instructions"
+#else
+#include "application_log.h"
+#define PROF_LOG(...) LOG(__VA_ARGS__)
+#define PROF_UNIT "cycles"
+#endif
+
+static const char *PROF_NAMES[PROF_N_SITES] = {
+    "predict",
+    "node_state",
+    "readout",
+    "gram",
+    "inverse",
+    "solve_step",
+    "mat_product",
+    "mat_wproduct",
+    "mat_sum",
+    "mat_mul",
+    "mat_transpose",
+    "mat_inv",
+};
+
+prof_site_t prof_sites[PROF_N_SITES];
+
+#if !defined(PROF_ICOUNT)
+void prof_init() {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  prof_reset();
+}
+#endif
+
+void prof_reset() {
+  memset(prof_sites, 0, sizeof(prof_sites));
+}
+
+void prof_dump() {
+  PROF_LOG("prof: site calls min mean max (" PROF_UNIT ")\r\n");
+  for(unsigned i = 0; i < PROF_N_SITES; i++) {
+    prof_site_t *s = &prof_sites[i];
+    if(s->calls == 0) {
+      continue;
+    }
+    PROF_LOG("prof: %s %u %u %u %u\r\n", PROF_NAMES[i], (unsigned) s->calls, (unsigned) s->min,
+        (unsigned) (s->total / s->calls), (unsigned) s->max);
+  }
+}
+#endif
@@ -0,0 +1,74 @@
+#ifndef APP_CMSIS_PROF_H_
+#define APP_CMSIS_PROF_H_
+
+// call sites, PROF_NAMES in prof.c follows the same order
+// phases of reservoir.c
+#define PROF_PREDICT 0     // predict
+#define PROF_NODE_STATE 1  // state update of predict and training
+#define PROF_READOUT 2     // READOUT_PRODUCT of predict
+#define PROF_GRAM 3        // train_fold
+#define PROF_INVERSE 4     // ACC_MAT_INV of train_compute_weight
+#define PROF_SOLVE_STEP 5  // train_job_step
+// kernels of mat.c, all precisions of a kernel share a site
+#define PROF_MAT_PRODUCT 6
+#define PROF_MAT_WPRODUCT 7 // products with b in storage precision (sign, f16, bf16, f32 readout of q15)
+#define PROF_MAT_SUM 8
+#define PROF_MAT_MUL 9
+#define PROF_MAT_TRANSPOSE 10
+#define PROF_MAT_INV 11
+#define PROF_N_SITES 12
+
+#if defined(PROFILE)
+#if defined(PROF_ICOUNT)
+#include <stdint.h>
+// retired instructions, from SysTick under qemu -icount (qemu/mps2_an386)
+uint32_t prof_count();
+#define PROF_COUNT() prof_count()
+#else
+#include "stm32l4xx_hal.h"
+#define PROF_COUNT() (DWT->CYCCNT)
+#endif
+
+typedef struct {
+  uint32_t calls;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+} prof_site_t;
+
+extern prof_site_t prof_sites[PROF_N_SITES];
+
+// starts the counter and clears all sites
+void prof_init();
+void prof_reset();
+// one LOG line per site that was called
+void prof_dump();
+
+static inline void prof_record(unsigned site, uint32_t cycles) {
+  prof_site_t *s = &prof_sites[site];
+  if(s->calls == 0 || cycles < s->min) {
+    s->min = cycles;
+  }
+  if(cycles > s->max) {
+    s->max = cycles;
+  }
+  s->calls++;
+  s->total += cycles;
+}
+
+// sites are recorded from thread context only, an enclosing site includes the recording of nested ones.
+// calls that fail before PROF_END are not counted
+#define PROF_BEGIN(SITE) uint32_t _prof_start_##SITE = PROF_COUNT()
+#define PROF_END(SITE) prof_record(SITE, PROF_COUNT() - _prof_start_##SITE)
+#define PROF_INIT() prof_init()
+#define PROF_RESET() prof_reset()
+#define PROF_DUMP() prof_dump()
+#else
+#define PROF_BEGIN(SITE)
+#define PROF_END(SITE)
+#define PROF_INIT()
+#define PROF_RESET()
+#define PROF_DUMP()
+#endif
+
+#endif /* APP_CMSIS_PROF_H_ */
@@ -0,0 +1,140 @@
+#include "stream.h"
+
+#include <string.h>
+
+// 12 bit right aligned conversion to [-1, 1)
+#if defined(PRECISION_Q15)
+#define ADC_TO_VAL(V) ((q15_t) (((int32_t) (V) - 2048) << 4))
+#elif defined(PRECISION_F64)
+#define ADC_TO_VAL(V) (((f64_t) (V) - 2048.0) * (1.0 / 2048.0))
+#else
+#define ADC_TO_VAL(V) (((f32_t) (V) - 2048.0f) * (1.0f / 2048.0f))
+#endif
+
+VAL_T stream_out[STREAM_OUT_SIZE];
+
+static reservoir_t *_res = NULL;
+static ADC_HandleTypeDef *_adc = NULL;
+static TIM_HandleTypeDef *_tim = NULL;
+static uint16_t _adc_buffer[2 * STREAM_BLOCK_SIZE];
+// block k lives in half k & 1, _filled counts blocks completed by the DMA, _processed the ones predicted
+static volatile unsigned _filled = 0;
+static volatile uint32_t _filled_at = 0; // cycle count at the last completion
+static unsigned _processed = 0;
+static stream_stats_t _stats;
+
+int stream_start(reservoir_t *res, ADC_HandleTypeDef *adc, TIM_HandleTypeDef *tim, unsigned sample_rate) {
+  if(res->n_in_nodes != 1 || res->n_out_nodes != 1) {
+    return -1;
+  }
+  if(sample_rate == 0 || sample_rate > STREAM_TIMER_CLOCK) {
+    return -1;
+  }
+  _res = res;
+  _adc = adc;
+  _tim = tim;
+  _filled = 0;
+  _processed = 0;
+  memset(&_stats, 0, sizeof(_stats));
+  _stats.sample_rate = sample_rate;
+  _stats.budget = SystemCoreClock / sample_rate;
+  // cycle counter
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  _filled_at = DWT->CYCCNT;
+  __HAL_TIM_SET_AUTORELOAD(tim, STREAM_TIMER_CLOCK / sample_rate - 1);
+  if(HAL_ADCEx_Calibration_Start(adc, ADC_SINGLE_ENDED) != HAL_OK) {
+    return -1;
+  }
+  if(HAL_ADC_Start_DMA(adc, (uint32_t *) _adc_buffer, 2 * STREAM_BLOCK_SIZE) != HAL_OK) {
+    return -1;
+  }
+  if(HAL_TIM_Base_Start(tim) != HAL_OK) {
+    HAL_ADC_Stop_DMA(adc);
+    return -1;
+  }
+  return 0;
+}
+
+void stream_stop() {
+  if(_res == NULL) {
+    return;
+  }
+  HAL_TIM_Base_Stop(_tim);
+  HAL_ADC_Stop_DMA(_adc);
+  _res = NULL;
+}
+
+void stream_process() {
+  MAT_T data, predicted;
+  VAL_T sample;
+  if(_res == NULL) {
+    return;
+  }
+  MAT_NEW(NULL, &data, 1, 1);
+  MAT_NEW(NULL, &predicted, 1, 1);
+  data.data = &sample;
+  while(_processed != _filled) {
+    unsigned k = _processed;
+    if(_filled - k > 1) {
+      // lapped, the oldest pending blocks are gone
+      _stats.overruns += _filled - k - 1;
+      k = _filled - 1;
+    }
+    uint16_t *block = _adc_buffer + (k & 1) * STREAM_BLOCK_SIZE;
+    uint32_t block_start = DWT->CYCCNT;
+    for(unsigned i = 0; i < STREAM_BLOCK_SIZE; i++) {
+      uint32_t start = DWT->CYCCNT;
+      sample = ADC_TO_VAL(block[i]);
+      predicted.data = stream_out + (_stats.n_samples & (STREAM_OUT_SIZE - 1));
+      predict(_res, &predicted, &data);
+      _stats.n_samples++;
+      uint32_t cycles = DWT->CYCCNT - start;
+      if(cycles > _stats.cycles_max) {
+        _stats.cycles_max = cycles;
+      }
+    }
+    _stats.cycles_last = (DWT->CYCCNT - block_start) / STREAM_BLOCK_SIZE;
+    // the DMA is back in this half once block k + 1 is complete
+    if(_filled - k >= 2) {
+      _stats.overruns++;
+    }
+    _processed = k + 1;
+  }
+}
+
+void stream_stats(stream_stats_t *stats) {
+  *stats = _stats;
+}
+
+unsigned stream_pending() {
+  return _res != NULL ? _filled - _processed : 0;
+}
+
+unsigned stream_slack() {
+  if(_res == NULL) {
+    // no deadline
+    return UINT32_MAX;
+  }
+  if(_processed != _filled) {
+    return 0;
+  }
+  uint32_t elapsed = DWT->CYCCNT - _filled_at;
+  uint32_t period = STREAM_BLOCK_SIZE * _stats.budget;
+  return elapsed < period ? period - elapsed : 0;
+}
+
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc) {
+  if(hadc == _adc) {
+    _filled_at = DWT->CYCCNT;
+    _filled++;
+  }
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc) {
+  if(hadc == _adc) {
+    _filled_at = DWT->CYCCNT;
+    _filled++;
+  }
+}
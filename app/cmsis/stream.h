@@ -0,0 +1,39 @@
+#ifndef APP_CMSIS_STREAM_H_
+#define APP_CMSIS_STREAM_H_
+
+#include "stm32l4xx_hal.h"
+
+#include "reservoir.h"
+
+// samples per half of the ADC DMA buffer
+#define STREAM_BLOCK_SIZE (32)
+// must be a power of two
+#define STREAM_OUT_SIZE (256)
+// counter clock of the trigger timer
+#define STREAM_TIMER_CLOCK (1000000)
+
+typedef struct {
+  unsigned sample_rate;
+  unsigned budget;      // cycles per sample at sample_rate
+  unsigned n_samples;   // samples predicted
+  unsigned overruns;    // blocks the DMA overwrote before or while they were processed
+  unsigned cycles_last; // cycles per sample, averaged over the last block
+  unsigned cycles_max;  // worst single sample
+} stream_stats_t;
+
+// predictions, the newest is stream_out[(n_samples - 1) & (STREAM_OUT_SIZE - 1)]
+extern VAL_T stream_out[STREAM_OUT_SIZE];
+
+// adc converts one channel on the TRGO of tim (counting at STREAM_TIMER_CLOCK) into a circular DMA buffer,
+// res needs n_in_nodes == n_out_nodes == 1
+int stream_start(reservoir_t *res, ADC_HandleTypeDef *adc, TIM_HandleTypeDef *tim, unsigned sample_rate);
+void stream_stop();
+// runs predict on the blocks the DMA finished since the last call, call from the main loop
+void stream_process();
+void stream_stats(stream_stats_t *stats);
+// blocks the DMA completed that stream_process has not run yet
+unsigned stream_pending();
+// cycles left until the DMA completes the next block, 0 while a block waits for stream_process
+unsigned stream_slack();
+
+#endif /* APP_CMSIS_STREAM_H_ */
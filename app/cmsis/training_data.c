@@ -1,5 +1,5 @@
 #include "reservoir.h"
-const VAL_T __training_data[] = {
+const f32_t __training_data[] = {
   0.000000,
   0.028287,
   0.056547,
@@ -0,0 +1,211 @@
+#include "accum.h"
+#include "checkpoint.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifndef INFERENCE_ONLY
+
+static void _accum_header(accum_header_t *h, reservoir_t *res) {
+  memset(h, 0, sizeof(*h));
+  memcpy(h->magic, ACCUM_MAGIC, sizeof(h->magic));
+  h->version = ACCUM_VERSION;
+  h->header_size = sizeof(*h);
+  h->acc_size = sizeof(ACC_VAL_T);
+  h->readout_form = READOUT_FORM;
+  h->n_in_nodes = res->n_in_nodes;
+  h->n_res_nodes = res->n_res_nodes;
+  h->n_out_nodes = res->n_out_nodes;
+  h->n_samples = res->n_samples;
+  h->weights_hash = checkpoint_weights_hash(res);
+}
+
+int accum_export(reservoir_t *res, const char *path) {
+  if(res->external_weights) {
+    return -1;
+  }
+  accum_header_t h;
+  _accum_header(&h, res);
+  size_t x_size = (size_t) res->n_res_nodes * res->n_res_nodes;
+  size_t y_size = (size_t) res->n_res_nodes * res->n_out_nodes;
+  FILE *fp = fopen(path, "wb");
+  if(fp == NULL) {
+    return -1;
+  }
+  if(fwrite(&h, sizeof(h), 1, fp) != 1 ||
+      fwrite(res->x.data, sizeof(ACC_VAL_T), x_size, fp) != x_size ||
+      fwrite(res->y.data, sizeof(ACC_VAL_T), y_size, fp) != y_size) {
+    fclose(fp);
+    return -1;
+  }
+  return fclose(fp) == 0 ? 0 : -1;
+}
+
+// heap: n_res_nodes * (n_res_nodes + n_out_nodes) (add)
+static int _accum_load(reservoir_t *res, const char *path, unsigned add) {
+  int ret = -1;
+  accum_header_t h, expect;
+  ACC_MAT_T x, y;
+  x.data = NULL;
+  y.data = NULL;
+  size_t x_size = (size_t) res->n_res_nodes * res->n_res_nodes;
+  size_t y_size = (size_t) res->n_res_nodes * res->n_out_nodes;
+  FILE *fp = fopen(path, "rb");
+  if(fp == NULL) {
+    return -1;
+  }
+  if(fread(&h, sizeof(h), 1, fp) != 1) {
+    goto fail;
+  }
+  _accum_header(&expect, res);
+  expect.n_samples = h.n_samples;
+  if(memcmp(&h, &expect, sizeof(h)) != 0) {
+    goto fail;
+  }
+  if(add) {
+    if(ACC_MAT_NEW(res->mem, &x, res->n_res_nodes, res->n_res_nodes) < 0) {
+      goto fail;
+    }
+    if(ACC_MAT_NEW(res->mem, &y, res->n_res_nodes, res->n_out_nodes) < 0) {
+      goto fail;
+    }
+  } else {
+    x = res->x;
+    y = res->y;
+  }
+  if(fread(x.data, sizeof(ACC_VAL_T), x_size, fp) != x_size ||
+      fread(y.data, sizeof(ACC_VAL_T), y_size, fp) != y_size) {
+    goto fail;
+  }
+  if(add && train_merge(res, &res->x, &res->y, &x, &y) < 0) {
+    goto fail;
+  }
+  res->n_samples = add ? res->n_samples + h.n_samples : h.n_samples;
+  ret = 0;
+fail:
+  if(add) {
+    ACC_MAT_DESTROY(res->mem, &x);
+    ACC_MAT_DESTROY(res->mem, &y);
+  }
+  fclose(fp);
+  return ret;
+}
+
+int accum_import(reservoir_t *res, const char *path) {
+  if(res->external_weights) {
+    return -1;
+  }
+  return _accum_load(res, path, 0);
+}
+
+int accum_merge(reservoir_t *res, const char *path) {
+  if(res->external_weights) {
+    return -1;
+  }
+  return _accum_load(res, path, 1);
+}
+
+// wait for n children, fails if any of them failed
+static int _wait_children(unsigned n) {
+  int ret = 0, status;
+  for(unsigned i = 0; i < n; i++) {
+    if(wait(&status) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      ret = -1;
+    }
+  }
+  return ret;
+}
+
+// children work on their copy of res, the parent's accumulators are left untouched
+int accum_reduce(reservoir_t *res, const char **paths, unsigned n) {
+  if(res->external_weights) {
+    return -1;
+  }
+  fflush(NULL);
+  for(unsigned step = 1; step < n; step *= 2) {
+    unsigned n_children = 0;
+    int ret = 0;
+    for(unsigned i = 0; i + step < n; i += 2 * step) {
+      pid_t pid = fork();
+      if(pid < 0) {
+        ret = -1;
+        break;
+      }
+      if(pid == 0) {
+        if(accum_import(res, paths[i]) < 0 ||
+            accum_merge(res, paths[i + step]) < 0 ||
+            accum_export(res, paths[i]) < 0) {
+          _exit(1);
+        }
+        _exit(0);
+      }
+      n_children++;
+    }
+    if(_wait_children(n_children) < 0 || ret < 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+// heap: (FILENAME_MAX + sizeof(char *)) * n_workers
+int train_fork(reservoir_t *res, MAT_T *series, unsigned n_series, unsigned n_workers, const char *dir) {
+  if(res->external_weights || n_workers == 0) {
+    return -1;
+  }
+  unsigned n_children = 0;
+  int ret = 0;
+  char (*names)[FILENAME_MAX] = res->mem->memory_alloc(FILENAME_MAX * n_workers);
+  const char **paths = res->mem->memory_alloc(sizeof(char *) * n_workers);
+  if(names == NULL || paths == NULL) {
+    ret = -1;
+    goto oom_fail;
+  }
+  for(unsigned w = 0; w < n_workers; w++) {
+    snprintf(names[w], sizeof(names[w]), "%s/accum.%u.bin", dir, w);
+    paths[w] = names[w];
+  }
+  fflush(NULL);
+  for(unsigned w = 0; w < n_workers; w++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      ret = -1;
+      break;
+    }
+    if(pid == 0) {
+      // partials start from zeros, the ridge term is added once by the parent
+      train_reset(res);
+      ACC_MAT_ZEROS(&res->x);
+      ACC_MAT_ZEROS(&res->y);
+      for(unsigned s = w; s < n_series; s += n_workers) {
+        // every series starts from a zero state
+        MAT_ZEROS(&res->res_nodes);
+        MAT_T batch;
+        MAT_NEW(NULL, &batch, 0, series[s].m);
+        for(unsigned n = 0; n < series[s].n; n += batch.n) {
+          batch.n = series[s].n - n < ACCUM_BATCH_SIZE ? series[s].n - n : ACCUM_BATCH_SIZE;
+          batch.data = series[s].data + (size_t) series[s].m * n;
+          if(train_feed_data(res, &batch) < 0) {
+            _exit(1);
+          }
+        }
+      }
+      _exit(accum_export(res, paths[w]) < 0 ? 1 : 0);
+    }
+    n_children++;
+  }
+  if(_wait_children(n_children) < 0 || ret < 0 || accum_reduce(res, paths, n_workers) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  train_reset(res);
+  ret = accum_merge(res, paths[0]);
+oom_fail:
+  res->mem->memory_free(names);
+  res->mem->memory_free(paths);
+  return ret;
+}
+
+#endif
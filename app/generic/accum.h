@@ -0,0 +1,42 @@
+#ifndef APP_GENERIC_ACCUM_H_
+#define APP_GENERIC_ACCUM_H_
+
+#include "reservoir.h"
+
+#include <stdint.h>
+
+#define ACCUM_MAGIC "RACC"
+#define ACCUM_VERSION 1
+
+#define ACCUM_BATCH_SIZE 256
+
+// partial accumulators (x, y, n_samples) of a reservoir, file layout: header, x, y.
+// partials from separate processes over separate series combine with train_merge.
+// a path under /dev/shm keeps the exchange in shared memory.
+typedef struct {
+  char magic[4];
+  uint32_t version;
+  uint32_t header_size;
+  uint32_t acc_size;      // sizeof(ACC_VAL_T)
+  uint32_t readout_form;  // READOUT_FORM_NORMAL or READOUT_FORM_QR
+  uint32_t n_in_nodes;
+  uint32_t n_res_nodes;
+  uint32_t n_out_nodes;
+  uint32_t n_samples;
+  uint64_t weights_hash;
+} accum_header_t;
+
+int accum_export(reservoir_t *res, const char *path);
+// replace x, y and n_samples of res with the partial in path
+int accum_import(reservoir_t *res, const char *path);
+// add the partial in path to x, y and n_samples of res
+int accum_merge(reservoir_t *res, const char *path);
+// pairwise tree reduction of paths[0..n-1] into paths[0], one forked process per pair at each level
+int accum_reduce(reservoir_t *res, const char **paths, unsigned n);
+
+// feeds series round-robin to n_workers forked processes (res_nodes reset per series),
+// reduces their partials in dir and merges the result into a reset res, ready for train_compute_weight.
+// n_workers must be at least 1.
+int train_fork(reservoir_t *res, MAT_T *series, unsigned n_series, unsigned n_workers, const char *dir);
+
+#endif /* APP_GENERIC_ACCUM_H_ */
@@ -0,0 +1,116 @@
+#include "checkpoint.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifndef INFERENCE_ONLY
+
+// FNV-1a
+static uint64_t _hash(uint64_t h, const void *data, size_t size) {
+  const uint8_t *p = data;
+  for(size_t i = 0; i < size; i++) {
+    h ^= p[i];
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+uint64_t checkpoint_weights_hash(reservoir_t *res) {
+  uint64_t h = 0xcbf29ce484222325ULL;
+#if defined(SIGN_IN_WEIGHTS)
+  h = _hash(h, res->in_weights.data, sizeof(uint32_t) * res->n_in_nodes * MAT_SIGN_WORDS(res->n_res_nodes));
+  h = _hash(h, &res->in_scale, sizeof(res->in_scale));
+#else
+  h = _hash(h, res->in_weights.data, sizeof(WVAL_T) * res->n_in_nodes * res->n_res_nodes);
+#endif
+  h = _hash(h, res->res_weights.data, sizeof(WVAL_T) * res->n_res_nodes * res->n_res_nodes);
+  return h;
+}
+
+static void _checkpoint_header(checkpoint_header_t *h, reservoir_t *res) {
+  memset(h, 0, sizeof(*h));
+  memcpy(h->magic, CHECKPOINT_MAGIC, sizeof(h->magic));
+  h->version = CHECKPOINT_VERSION;
+  h->header_size = sizeof(*h);
+  h->acc_size = sizeof(ACC_VAL_T);
+  h->val_size = sizeof(VAL_T);
+  h->readout_form = READOUT_FORM;
+  h->n_in_nodes = res->n_in_nodes;
+  h->n_res_nodes = res->n_res_nodes;
+  h->n_out_nodes = res->n_out_nodes;
+  h->leak_rate = res->leak_rate;
+  h->n_samples = res->n_samples;
+  h->weights_hash = checkpoint_weights_hash(res);
+}
+
+// written to a temporary file and renamed, so an interrupted save keeps the previous checkpoint
+int checkpoint_save(reservoir_t *res, const char *path) {
+  if(res->external_weights) {
+    return -1;
+  }
+  char tmp_path[FILENAME_MAX];
+  if(snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path) >= (int) sizeof(tmp_path)) {
+    return -1;
+  }
+  checkpoint_header_t h;
+  _checkpoint_header(&h, res);
+  size_t x_size = (size_t) res->n_res_nodes * res->n_res_nodes;
+  size_t y_size = (size_t) res->n_res_nodes * res->n_out_nodes;
+  FILE *fp = fopen(tmp_path, "wb");
+  if(fp == NULL) {
+    return -1;
+  }
+  if(fwrite(&h, sizeof(h), 1, fp) != 1 ||
+      fwrite(res->x.data, sizeof(ACC_VAL_T), x_size, fp) != x_size ||
+      fwrite(res->y.data, sizeof(ACC_VAL_T), y_size, fp) != y_size ||
+      fwrite(res->res_nodes.data, sizeof(VAL_T), res->n_res_nodes, fp) != res->n_res_nodes) {
+    fclose(fp);
+    remove(tmp_path);
+    return -1;
+  }
+  if(fclose(fp) != 0 || rename(tmp_path, path) != 0) {
+    remove(tmp_path);
+    return -1;
+  }
+  return 0;
+}
+
+int checkpoint_restore(reservoir_t *res, const char *path) {
+  if(res->external_weights) {
+    return -1;
+  }
+  checkpoint_header_t h, expect;
+  _checkpoint_header(&expect, res);
+  size_t x_size = (size_t) res->n_res_nodes * res->n_res_nodes;
+  size_t y_size = (size_t) res->n_res_nodes * res->n_out_nodes;
+  FILE *fp = fopen(path, "rb");
+  if(fp == NULL) {
+    return -1;
+  }
+  if(fread(&h, sizeof(h), 1, fp) != 1) {
+    goto fail;
+  }
+  // everything but the sample count has to match the running reservoir
+  expect.n_samples = h.n_samples;
+  if(memcmp(&h, &expect, sizeof(h)) != 0) {
+    goto fail;
+  }
+  if(fread(res->x.data, sizeof(ACC_VAL_T), x_size, fp) != x_size ||
+      fread(res->y.data, sizeof(ACC_VAL_T), y_size, fp) != y_size ||
+      fread(res->res_nodes.data, sizeof(VAL_T), res->n_res_nodes, fp) != res->n_res_nodes) {
+    // do not leave partially restored accumulators behind
+    ACC_MAT_ZEROS(&res->x);
+    ACC_MAT_ZEROS(&res->y);
+    MAT_ZEROS(&res->res_nodes);
+    res->n_samples = 0;
+    goto fail;
+  }
+  res->n_samples = h.n_samples;
+  fclose(fp);
+  return 0;
+fail:
+  fclose(fp);
+  return -1;
+}
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef APP_GENERIC_CHECKPOINT_H_
+#define APP_GENERIC_CHECKPOINT_H_
+
+#include "reservoir.h"
+
+#include <stdint.h>
+
+#define CHECKPOINT_MAGIC "RCKP"
+#define CHECKPOINT_VERSION 1
+
+// file layout: header, x, y, res_nodes
+typedef struct {
+  char magic[4];
+  uint32_t version;
+  uint32_t header_size;
+  uint32_t acc_size;      // sizeof(ACC_VAL_T)
+  uint32_t val_size;      // sizeof(VAL_T)
+  uint32_t readout_form;  // READOUT_FORM_NORMAL or READOUT_FORM_QR
+  uint32_t n_in_nodes;
+  uint32_t n_res_nodes;
+  uint32_t n_out_nodes;
+  float leak_rate;
+  uint32_t n_samples;
+  uint64_t weights_hash;  // accumulators are only valid for the same in_weights and res_weights
+} checkpoint_header_t;
+
+// snapshot of the training accumulators (x, y, n_samples) and the carried res_nodes.
+// to add new data: checkpoint_restore, train_feed_data with the new data only, checkpoint_save.
+int checkpoint_save(reservoir_t *res, const char *path);
+// res must be initialised with the same dims and weights as when the checkpoint was saved
+int checkpoint_restore(reservoir_t *res, const char *path);
+
+// fingerprint of in_weights and res_weights
+uint64_t checkpoint_weights_hash(reservoir_t *res);
+
+#endif /* APP_GENERIC_CHECKPOINT_H_ */
@@ -1,8 +1,14 @@
 #include "reservoir.h"
+#include "model.h"
+#ifdef QUANTIZE_I8
+#include "quant.h"
+#endif
 
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #define DEBUG_PRINT
 
@@ -12,15 +18,15 @@ static inline void print_res_head(reservoir_t *res, char *label) {
     printf("%s\n", label);
   }
   printf("res->in_weights: %f %f %f %f\n",
-      *MAT(res->in_weights, 0, 0),
-      *MAT(res->in_weights, 0, 1),
-      *MAT(res->in_weights, 0, 2),
-      *MAT(res->in_weights, 0, 3));
+      IN_WEIGHT(res, 0, 0),
+      IN_WEIGHT(res, 0, 1),
+      IN_WEIGHT(res, 0, 2),
+      IN_WEIGHT(res, 0, 3));
   printf("res->res_weights: %f %f %f %f\n",
-      *MAT(res->res_weights, 0, 0),
-      *MAT(res->res_weights, 0, 1),
-      *MAT(res->res_weights, 0, 2),
-      *MAT(res->res_weights, 0, 3));
+      RES_WEIGHT(res, 0, 0),
+      RES_WEIGHT(res, 0, 1),
+      RES_WEIGHT(res, 0, 2),
+      RES_WEIGHT(res, 0, 3));
   printf("res->out_weights: %f %f %f %f\n",
       *MAT(res->out_weights, 0, 0),
       *MAT(res->out_weights, 0, 1),
@@ -31,16 +37,20 @@ static inline void print_res_head(reservoir_t *res, char *label) {
       *MAT(res->res_nodes, 0, 1),
       *MAT(res->res_nodes, 0, 2),
       *MAT(res->res_nodes, 0, 3));
-  printf("res->x: %f %f %f %f\n",
-      *MAT(res->x, 0, 0),
-      *MAT(res->x, 0, 1),
-      *MAT(res->x, 0, 2),
-      *MAT(res->x, 0, 3));
-  printf("res->y: %f %f %f %f\n",
-      *MAT(res->y, 0, 0),
-      *MAT(res->y, 0, 1),
-      *MAT(res->y, 0, 2),
-      *MAT(res->y, 0, 3));
+#ifndef INFERENCE_ONLY
+  if(!res->external_weights) {
+    printf("res->x: %f %f %f %f\n",
+        *MAT(res->x, 0, 0),
+        *MAT(res->x, 0, 1),
+        *MAT(res->x, 0, 2),
+        *MAT(res->x, 0, 3));
+    printf("res->y: %f %f %f %f\n",
+        *MAT(res->y, 0, 0),
+        *MAT(res->y, 0, 1),
+        *MAT(res->y, 0, 2),
+        *MAT(res->y, 0, 3));
+  }
+#endif
 #endif
 }
 
@@ -53,8 +63,29 @@ static inline void print_res_head(reservoir_t *res, char *label) {
 #define TRAINING_BATCH_SIZE 10
 #define PREDICTION_DATA_SIZE 640
 
+// usage: reservoir [-c out_weights.c] [model]
+//   -c writes the trained out_weights as C source for INFERENCE_ONLY builds (app/out_weights.c)
+// an INFERENCE_ONLY build takes no arguments
 int main(int argc, char** argv) {
   FILE *fp;
+#ifdef INFERENCE_ONLY
+  if(argc > 1) {
+    fprintf(stderr, "usage: %s (INFERENCE_ONLY, nothing to train, load or write)\n", argv[0]);
+    return -1;
+  }
+#else
+  const char *out_weights_path = NULL;
+  int opt;
+  while((opt = getopt(argc, argv, "c:")) != -1) {
+    switch(opt) {
+    case 'c':
+      out_weights_path = optarg;
+      break;
+    default:
+      return -1;
+    }
+  }
+#endif
   mat_memory_t mem = {
       .memory_alloc = (void *(*)(unsigned)) malloc,
       .memory_free = (void (*)(void *)) free,
@@ -66,31 +97,102 @@ int main(int argc, char** argv) {
       .n_out_nodes = 1,
       .leak_rate = 0.02f,
   };
-  // init
+  model_t model = { .addr = NULL };
+#ifdef INFERENCE_ONLY
+  // out_weights are compiled in (app/out_weights.c), nothing to train or load
   init(&res);
   print_res_head(&res, "INIT");
+#else
+  // init, or load a trained model if one is given and exists.
+  // a model file that exists but cannot be loaded is not overwritten by a retrained one
+  const char *model_path = optind < argc ? argv[optind] : NULL;
+  errno = 0;
+  if(model_path && model_load(&res, &model, model_path) == 0) {
+    print_res_head(&res, "LOADED");
+  } else if(model_path && errno != ENOENT) {
+    fprintf(stderr, "cannot load %s\n", model_path);
+    return -1;
+  } else {
+    init(&res);
+    print_res_head(&res, "INIT");
+  }
+#endif
   // load data + train
+#ifndef INFERENCE_ONLY
   MAT_T training_data;
   if(MAT_NEW(res.mem, &training_data, TRAINING_BATCH_SIZE, 1) < 0) {
     goto error;
   }
+#endif
   char buf[INPUT_FILE_LINE_MAX];
   fp = fopen(INPUT_FILE_NAME, "r");
   if(fp == NULL) {
     goto error;
   }
   VAL_T data;
+#ifdef INFERENCE_ONLY
+  // no training, the state is driven by the same samples through predict
+  VAL_T warmup;
+  MAT_T warmup_data, warmup_predicted;
+  MAT_NEW(NULL, &warmup_data, 1, 1);
+  MAT_NEW(NULL, &warmup_predicted, 1, 1);
+  warmup_data.data = &data;
+  warmup_predicted.data = &warmup;
+  while(fgets(buf, sizeof(buf), fp)) {
+    data = strtod(buf, NULL);
+    predict(&res, &warmup_predicted, &warmup_data);
+  }
+#else
   for(unsigned i = 0; fgets(buf, sizeof(buf), fp);) {
     data = strtod(buf, NULL);
+    if(model.addr) {
+      // trained already, only the last sample is needed to start prediction
+      continue;
+    }
     *MAT(training_data, i, 0) = data;
     if(++i >= TRAINING_BATCH_SIZE) {
       train_feed_data(&res, &training_data);
       i = 0;
     }
   }
-  train_compute_weight(&res, RESET_XY);
+#endif
   fclose(fp);
-  print_res_head(&res, "TRAINED");
+#ifndef INFERENCE_ONLY
+  if(!model.addr) {
+    train_compute_weight(&res, RESET_XY);
+    print_res_head(&res, "TRAINED");
+    if(model_path && model_save(&res, model_path) < 0) {
+      goto error;
+    }
+    if(out_weights_path && model_save_c(&res, out_weights_path) < 0) {
+      goto error;
+    }
+  }
+#endif
+#ifdef QUANTIZE_I8
+  // quantize + calibrate with training data
+  quant_t q;
+  if(quant_init(&q, &res) < 0) {
+    goto error;
+  }
+  MAT_T calibration_data;
+  if(MAT_NEW(res.mem, &calibration_data, TRAINING_DATA_SIZE, 1) < 0) {
+    goto error;
+  }
+  fp = fopen(INPUT_FILE_NAME, "r");
+  if(fp == NULL) {
+    goto error;
+  }
+  for(unsigned i = 0; i < TRAINING_DATA_SIZE && fgets(buf, sizeof(buf), fp); i++) {
+    *MAT(calibration_data, i, 0) = strtod(buf, NULL);
+  }
+  fclose(fp);
+  quant_calibrate(&q, &res, &calibration_data);
+  float nrmse = 0.0f;
+  quant_nrmse(&q, &res, &calibration_data, &nrmse);
+  printf("QUANTIZED\nnrmse (int8 vs f32): %f\n", nrmse);
+  MAT_DESTROY(res.mem, &calibration_data);
+#endif
   // predict + save
   MAT_T predicted_data;
   if(MAT_NEW(res.mem, &predicted_data, 1, 1) < 0) {
@@ -106,16 +208,29 @@ int main(int argc, char** argv) {
     goto error;
   }
   for(unsigned i = 0; i < PREDICTION_DATA_SIZE; i++) {
+#ifdef QUANTIZE_I8
+    quant_predict(&q, &predicted_data, &prev_data);
+#else
     predict(&res, &predicted_data, &prev_data);
+#endif
     fprintf(fp, "%f\n", *MAT(predicted_data, 0, 0));
     *MAT(prev_data, 0, 0) = *MAT(predicted_data, 0, 0);
   }
   fclose(fp);
   // done
-  deinit(&res);
+#ifdef QUANTIZE_I8
+  quant_deinit(&q);
+#endif
+  if(model.addr) {
+    model_unload(&res, &model);
+  } else {
+    deinit(&res);
+  }
   return 0;
 error:
+#ifndef INFERENCE_ONLY
   MAT_DESTROY(res.mem, &training_data);
+#endif
   MAT_DESTROY(res.mem, &predicted_data);
   MAT_DESTROY(res.mem, &prev_data);
   return -1;
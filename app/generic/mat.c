@@ -4,8 +4,123 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__F16C__) || defined(__AVX2__) || defined(__AVXVNNI__) || defined(__AVX512VNNI__)
+#include <immintrin.h>
+#endif
+
+#if defined(__AVXVNNI__)
+#define _DPBUSD(ACC, A, B) _mm256_dpbusd_avx_epi32(ACC, A, B)
+#elif defined(__AVX512VNNI__) && defined(__AVX512VL__)
+#define _DPBUSD(ACC, A, B) _mm256_dpbusd_epi32(ACC, A, B)
+#endif
+
 //#define CHECK_ARGS
 
+static inline f32_t _f16_to_f32(f16_t h) {
+  union {
+    f32_t f;
+    uint32_t u;
+  } v;
+  uint32_t sign = (uint32_t) (h & 0x8000) << 16;
+  uint32_t exp = (h >> 10) & 0x1f;
+  uint32_t man = h & 0x3ff;
+  if(exp == 0x1f) {
+    // inf or nan
+    v.u = sign | 0x7f800000 | (man << 13);
+  } else if(exp != 0) {
+    v.u = sign | ((exp + 112) << 23) | (man << 13);
+  } else if(man != 0) {
+    // subnormal, renormalize
+    exp = 113;
+    while(!(man & 0x400)) {
+      man <<= 1;
+      exp--;
+    }
+    v.u = sign | (exp << 23) | ((man & 0x3ff) << 13);
+  } else {
+    v.u = sign;
+  }
+  return v.f;
+}
+
+static inline f16_t _f32_to_f16(f32_t f) {
+  union {
+    f32_t f;
+    uint32_t u;
+  } v = { f };
+  uint32_t sign = (v.u >> 16) & 0x8000;
+  uint32_t abs = v.u & 0x7fffffff;
+  uint32_t r, rem, half, shift;
+  if(abs >= 0x7f800000) {
+    // inf or nan
+    return sign | 0x7c00 | (abs > 0x7f800000 ? 0x200 : 0);
+  }
+  if(abs >= 0x477ff000) {
+    // rounds to inf
+    return sign | 0x7c00;
+  }
+  if(abs < 0x33000000) {
+    // rounds to zero
+    return sign;
+  }
+  if(abs < 0x38800000) {
+    // subnormal
+    shift = 126 - (abs >> 23);
+    abs = (abs & 0x7fffff) | 0x800000;
+    r = abs >> shift;
+    rem = abs & ((1u << shift) - 1);
+    half = 1u << (shift - 1);
+  } else {
+    r = (abs - 0x38000000) >> 13;
+    rem = abs & 0x1fff;
+    half = 0x1000;
+  }
+  // round to nearest even
+  if(rem > half || (rem == half && (r & 1))) {
+    r++;
+  }
+  return sign | r;
+}
+
+static inline f32_t _bf16_to_f32(bf16_t h) {
+  union {
+    f32_t f;
+    uint32_t u;
+  } v;
+  v.u = (uint32_t) h << 16;
+  return v.f;
+}
+
+static inline bf16_t _f32_to_bf16(f32_t f) {
+  union {
+    f32_t f;
+    uint32_t u;
+  } v = { f };
+  if((v.u & 0x7fffffff) > 0x7f800000) {
+    // keep nan quiet
+    return (v.u >> 16) | 0x40;
+  }
+  // round to nearest even
+  v.u += 0x7fff + ((v.u >> 16) & 1);
+  return v.u >> 16;
+}
+
+f32_t f16_to_f32(f16_t h) {
+  return _f16_to_f32(h);
+}
+
+f16_t f32_to_f16(f32_t f) {
+  return _f32_to_f16(f);
+}
+
+f32_t bf16_to_f32(bf16_t h) {
+  return _bf16_to_f32(h);
+}
+
+bf16_t f32_to_bf16(f32_t f) {
+  return _f32_to_bf16(f);
+}
+
 int mat_f32_new(mat_memory_t *mem, mat_f32_t *a, unsigned n, unsigned m) {
   a->t = 0;
   a->n = n;
@@ -325,6 +440,143 @@ float mat_f32_max_abs_eigenval(mat_f32_t *a, mat_f32_t *x, mat_f32_t *y, unsigne
   return lambda;
 }
 
+// c = (a @ sign(b)) * l, sign(b) applied by flipping the sign bit of a (no multiplies)
+int mat_f32_sign_product(mat_f32_t *c, mat_f32_t *a, mat_sign_t *b, float l) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+#endif
+  // one lane mask per bit of a sign word, the per-word loop then vectorises as a blend
+  uint32_t lane[32];
+  for(unsigned k = 0; k < 32; k++) {
+    lane[k] = (uint32_t) 1 << k;
+  }
+  unsigned m_words = c->m / 32 * 32;
+  mat_f32_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f32_t *row = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      f32_t v = *MAT(*a, n, p);
+      f32_t neg_v = -v;
+      uint32_t *sign = _MAT_SIGN_WORD(*b, p, 0);
+      for(unsigned m = 0; m < m_words; m += 32) {
+        uint32_t word = sign[m / 32];
+        for(unsigned k = 0; k < 32; k++) {
+          row[m + k] += (word & lane[k]) ? neg_v : v;
+        }
+      }
+      for(unsigned m = m_words; m < c->m; m++) {
+        row[m] += MAT_SIGN(*b, p, m) ? neg_v : v;
+      }
+    }
+  }
+  return mat_f32_mul(c, c, l);
+}
+
+// c = a @ b, b is converted from storage precision on load
+int mat_f32_f16_product(mat_f32_t *c, mat_f32_t *a, mat_f16_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(b->t) {
+    return -1;
+  }
+#endif
+  mat_f32_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f32_t *cn = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      float ap = *MAT(*a, n, p);
+      f16_t *bp = _MAT(*b, p, 0);
+      unsigned m = 0;
+#if defined(__F16C__)
+      __m256 va = _mm256_set1_ps(ap);
+      for(; m + 8 <= c->m; m += 8) {
+        __m256 vb = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *) (bp + m)));
+        _mm256_storeu_ps(cn + m, _mm256_add_ps(_mm256_loadu_ps(cn + m), _mm256_mul_ps(va, vb)));
+      }
+#endif
+      for(; m < c->m; m++) {
+        cn[m] += ap * _f16_to_f32(bp[m]);
+      }
+    }
+  }
+  return 0;
+}
+
+int mat_f16_from_f32(mat_f16_t *dst, mat_f32_t *src) {
+  dst->t = 0;
+  for(unsigned n = 0; n < dst->n; n++) {
+    for(unsigned m = 0; m < dst->m; m++) {
+      *_MAT(*dst, n, m) = _f32_to_f16(*MAT(*src, n, m));
+    }
+  }
+  return 0;
+}
+
+// c = a @ b, b is converted from storage precision on load
+int mat_f32_bf16_product(mat_f32_t *c, mat_f32_t *a, mat_bf16_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(b->t) {
+    return -1;
+  }
+#endif
+  mat_f32_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f32_t *cn = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      float ap = *MAT(*a, n, p);
+      bf16_t *bp = _MAT(*b, p, 0);
+      unsigned m = 0;
+#if defined(__AVX2__)
+      __m256 va = _mm256_set1_ps(ap);
+      for(; m + 8 <= c->m; m += 8) {
+        __m256i vh = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) (bp + m)));
+        __m256 vb = _mm256_castsi256_ps(_mm256_slli_epi32(vh, 16));
+        _mm256_storeu_ps(cn + m, _mm256_add_ps(_mm256_loadu_ps(cn + m), _mm256_mul_ps(va, vb)));
+      }
+#endif
+      for(; m < c->m; m++) {
+        cn[m] += ap * _bf16_to_f32(bp[m]);
+      }
+    }
+  }
+  return 0;
+}
+
+int mat_bf16_from_f32(mat_bf16_t *dst, mat_f32_t *src) {
+  dst->t = 0;
+  for(unsigned n = 0; n < dst->n; n++) {
+    for(unsigned m = 0; m < dst->m; m++) {
+      *_MAT(*dst, n, m) = _f32_to_bf16(*MAT(*src, n, m));
+    }
+  }
+  return 0;
+}
+
 int mat_f64_new(mat_memory_t *sup, mat_f64_t *a, unsigned n, unsigned m) {
   a->t = 0;
   a->n = n;
@@ -348,7 +600,7 @@ void mat_f64_destroy(mat_memory_t *mem, mat_f64_t *a) {
 }
 
 int mat_f64_copy(mat_f64_t *dst, mat_f64_t *src) {
-  memcpy(dst->data, src->data, sizeof(f32_t) * dst->n * dst->m);
+  memcpy(dst->data, src->data, sizeof(f64_t) * dst->n * dst->m);
   return 0;
 }
 
@@ -642,6 +894,267 @@ double mat_f64_max_abs_eigenval(mat_f64_t *a, mat_f64_t *x, mat_f64_t *y, unsign
   return lambda;
 }
 
+// c = (a @ sign(b)) * l, sign(b) applied by flipping the sign bit of a (no multiplies)
+int mat_f64_sign_product(mat_f64_t *c, mat_f64_t *a, mat_sign_t *b, double l) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+#endif
+  // one lane mask per bit of a sign word, the per-word loop then vectorises as a blend
+  uint32_t lane[32];
+  for(unsigned k = 0; k < 32; k++) {
+    lane[k] = (uint32_t) 1 << k;
+  }
+  unsigned m_words = c->m / 32 * 32;
+  mat_f64_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f64_t *row = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      f64_t v = *MAT(*a, n, p);
+      f64_t neg_v = -v;
+      uint32_t *sign = _MAT_SIGN_WORD(*b, p, 0);
+      for(unsigned m = 0; m < m_words; m += 32) {
+        uint32_t word = sign[m / 32];
+        for(unsigned k = 0; k < 32; k++) {
+          row[m + k] += (word & lane[k]) ? neg_v : v;
+        }
+      }
+      for(unsigned m = m_words; m < c->m; m++) {
+        row[m] += MAT_SIGN(*b, p, m) ? neg_v : v;
+      }
+    }
+  }
+  return mat_f64_mul(c, c, l);
+}
+
+// c = a @ b, b is converted from storage precision on load
+int mat_f64_f16_product(mat_f64_t *c, mat_f64_t *a, mat_f16_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(b->t) {
+    return -1;
+  }
+#endif
+  mat_f64_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f64_t *cn = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      double ap = *MAT(*a, n, p);
+      f16_t *bp = _MAT(*b, p, 0);
+      unsigned m = 0;
+      for(; m < c->m; m++) {
+        cn[m] += ap * _f16_to_f32(bp[m]);
+      }
+    }
+  }
+  return 0;
+}
+
+int mat_f16_from_f64(mat_f16_t *dst, mat_f64_t *src) {
+  dst->t = 0;
+  for(unsigned n = 0; n < dst->n; n++) {
+    for(unsigned m = 0; m < dst->m; m++) {
+      *_MAT(*dst, n, m) = _f32_to_f16(*MAT(*src, n, m));
+    }
+  }
+  return 0;
+}
+
+// c = a @ b, b is converted from storage precision on load
+int mat_f64_bf16_product(mat_f64_t *c, mat_f64_t *a, mat_bf16_t *b) {
+#ifdef CHECK_ARGS
+  if(c->n != a->n) {
+    return -1;
+  }
+  if(c->m != b->m) {
+    return -1;
+  }
+  if(a->m != b->n) {
+    return -1;
+  }
+  if(b->t) {
+    return -1;
+  }
+#endif
+  mat_f64_zeros(c);
+  for(unsigned n = 0; n < c->n; n++) {
+    f64_t *cn = _MAT(*c, n, 0);
+    for(unsigned p = 0; p < a->m; p++) {
+      double ap = *MAT(*a, n, p);
+      bf16_t *bp = _MAT(*b, p, 0);
+      unsigned m = 0;
+      for(; m < c->m; m++) {
+        cn[m] += ap * _bf16_to_f32(bp[m]);
+      }
+    }
+  }
+  return 0;
+}
+
+int mat_bf16_from_f64(mat_bf16_t *dst, mat_f64_t *src) {
+  dst->t = 0;
+  for(unsigned n = 0; n < dst->n; n++) {
+    for(unsigned m = 0; m < dst->m; m++) {
+      *_MAT(*dst, n, m) = _f32_to_bf16(*MAT(*src, n, m));
+    }
+  }
+  return 0;
+}
+
+int mat_sign_new(mat_memory_t *mem, mat_sign_t *a, unsigned n, unsigned m) {
+  a->n = n;
+  a->m = m;
+  if(mem && mem->memory_alloc) {
+    a->data = (uint32_t *) mem->memory_alloc(sizeof(uint32_t) * n * MAT_SIGN_WORDS(m));
+    if(a->data == NULL) {
+      return -1;
+    }
+  } else {
+    a->data = NULL;
+  }
+  return 0;
+}
+
+void mat_sign_destroy(mat_memory_t *mem, mat_sign_t *a) {
+  if(mem && mem->memory_free) {
+    mem->memory_free(a->data);
+    a->data = NULL;
+  }
+}
+
+int mat_sign_zeros(mat_sign_t *a) {
+  memset(a->data, 0, sizeof(uint32_t) * a->n * MAT_SIGN_WORDS(a->m));
+  return 0;
+}
+
+int mat_f16_new(mat_memory_t *mem, mat_f16_t *a, unsigned n, unsigned m) {
+  a->t = 0;
+  a->n = n;
+  a->m = m;
+  if(mem && mem->memory_alloc) {
+    a->data = (f16_t *) mem->memory_alloc(sizeof(f16_t) * n * m);
+    if(a->data == NULL) {
+      return -1;
+    }
+  } else {
+    a->data = NULL;
+  }
+  return 0;
+}
+
+void mat_f16_destroy(mat_memory_t *mem, mat_f16_t *a) {
+  if(mem && mem->memory_free) {
+    mem->memory_free(a->data);
+    a->data = NULL;
+  }
+}
+
+int mat_bf16_new(mat_memory_t *mem, mat_bf16_t *a, unsigned n, unsigned m) {
+  a->t = 0;
+  a->n = n;
+  a->m = m;
+  if(mem && mem->memory_alloc) {
+    a->data = (bf16_t *) mem->memory_alloc(sizeof(bf16_t) * n * m);
+    if(a->data == NULL) {
+      return -1;
+    }
+  } else {
+    a->data = NULL;
+  }
+  return 0;
+}
+
+void mat_bf16_destroy(mat_memory_t *mem, mat_bf16_t *a) {
+  if(mem && mem->memory_free) {
+    mem->memory_free(a->data);
+    a->data = NULL;
+  }
+}
+
+int mat_i8_new(mat_memory_t *mem, mat_i8_t *a, unsigned n, unsigned m) {
+  a->n = n;
+  a->m = m;
+  a->data = NULL;
+  a->scale = NULL;
+  if(mem && mem->memory_alloc) {
+    a->data = (int8_t *) mem->memory_alloc(sizeof(int8_t) * n * m);
+    if(a->data == NULL) {
+      return -1;
+    }
+    a->scale = (f32_t *) mem->memory_alloc(sizeof(f32_t) * n);
+    if(a->scale == NULL) {
+      mem->memory_free(a->data);
+      a->data = NULL;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+void mat_i8_destroy(mat_memory_t *mem, mat_i8_t *a) {
+  if(mem && mem->memory_free) {
+    mem->memory_free(a->data);
+    mem->memory_free(a->scale);
+    a->data = NULL;
+    a->scale = NULL;
+  }
+}
+
+int32_t i8_dot_product(const int8_t *a, const int8_t *b, unsigned n) {
+  int32_t sum = 0;
+  unsigned i = 0;
+#if defined(_DPBUSD)
+  __m256i acc = _mm256_setzero_si256();
+  for(; i + 32 <= n; i += 32) {
+    __m256i va = _mm256_loadu_si256((const __m256i *) (a + i));
+    __m256i vb = _mm256_loadu_si256((const __m256i *) (b + i));
+    // dpbusd multiplies unsigned by signed, so move the sign of a onto b
+    acc = _DPBUSD(acc, _mm256_abs_epi8(va), _mm256_sign_epi8(vb, va));
+  }
+  __m128i acc128 = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+  acc128 = _mm_hadd_epi32(acc128, acc128);
+  acc128 = _mm_hadd_epi32(acc128, acc128);
+  sum = _mm_cvtsi128_si32(acc128);
+#endif
+  for(; i < n; i++) {
+    sum += (int32_t) a[i] * b[i];
+  }
+  return sum;
+}
+
+// quantize x to q with given scale (0 picks max(|x|) / 127), returns scale used
+f32_t i8_quantize(int8_t *q, const f32_t *x, unsigned n, f32_t scale) {
+  if(scale <= 0.0f) {
+    for(unsigned i = 0; i < n; i++) {
+      if(fabsf(x[i]) > scale) {
+        scale = fabsf(x[i]);
+      }
+    }
+    scale = scale > 0.0f ? scale / 127.0f : 1.0f;
+  }
+  f32_t inv = 1.0f / scale;
+  for(unsigned i = 0; i < n; i++) {
+    f32_t v = roundf(x[i] * inv);
+    q[i] = v > 127.0f ? 127 : v < -127.0f ? -127 : (int8_t) v;
+  }
+  return scale;
+}
+
 #if 0
 #include <stdio.h>
 #include <stdlib.h>
@@ -1,8 +1,12 @@
 #ifndef APP_GENERIC_MAT_H_
 #define APP_GENERIC_MAT_H_
 
+#include <stdint.h>
+
 typedef float f32_t;
 typedef double f64_t;
+typedef uint16_t f16_t;  // IEEE 754 binary16, storage only
+typedef uint16_t bf16_t; // bfloat16, storage only
 
 typedef struct {
   void *(*memory_alloc)(unsigned);
@@ -23,10 +27,62 @@ typedef struct {
   unsigned t;
 } mat_f64_t;
 
+typedef struct {
+  f16_t *data;
+  unsigned n;
+  unsigned m;
+  unsigned t;
+} mat_f16_t;
+
+typedef struct {
+  bf16_t *data;
+  unsigned n;
+  unsigned m;
+  unsigned t;
+} mat_bf16_t;
+
+// int8 matrix quantized per row: value(n, m) = data(n, m) * scale(n)
+typedef struct {
+  int8_t *data;
+  f32_t *scale;
+  unsigned n;
+  unsigned m;
+} mat_i8_t;
+
+// packed sign matrix: bit set means negative, each row padded to 32 bits
+typedef struct {
+  uint32_t *data;
+  unsigned n;
+  unsigned m;
+} mat_sign_t;
+
 #define _MAT(A, N, M) ((A).data + (A).m * N + M)
 #define _MAT_T(A, N, M) ((A).data + (A).n * M + N)
 #define MAT(A, N, M) ((A).t ? _MAT_T(A, N, M) : _MAT(A, N, M))
 
+#define MAT_SIGN_WORDS(M) (((M) + 31) / 32)
+#define _MAT_SIGN_WORD(A, N, M) ((A).data + MAT_SIGN_WORDS((A).m) * (N) + (M) / 32)
+#define MAT_SIGN(A, N, M) ((*_MAT_SIGN_WORD(A, N, M) >> ((M) % 32)) & 1)
+#define MAT_SIGN_SET(A, N, M) (*_MAT_SIGN_WORD(A, N, M) |= (uint32_t) 1 << ((M) % 32))
+
+int mat_i8_new(mat_memory_t *mem, mat_i8_t *a, unsigned n, unsigned m);
+void mat_i8_destroy(mat_memory_t *mem, mat_i8_t *a);
+int32_t i8_dot_product(const int8_t *a, const int8_t *b, unsigned n);
+f32_t i8_quantize(int8_t *q, const f32_t *x, unsigned n, f32_t scale);
+
+int mat_sign_new(mat_memory_t *mem, mat_sign_t *a, unsigned n, unsigned m);
+void mat_sign_destroy(mat_memory_t *mem, mat_sign_t *a);
+int mat_sign_zeros(mat_sign_t *a);
+
+f32_t f16_to_f32(f16_t h);
+f16_t f32_to_f16(f32_t f);
+f32_t bf16_to_f32(bf16_t h);
+bf16_t f32_to_bf16(f32_t f);
+int mat_f16_new(mat_memory_t *mem, mat_f16_t *a, unsigned n, unsigned m);
+void mat_f16_destroy(mat_memory_t *mem, mat_f16_t *a);
+int mat_bf16_new(mat_memory_t *mem, mat_bf16_t *a, unsigned n, unsigned m);
+void mat_bf16_destroy(mat_memory_t *mem, mat_bf16_t *a);
+
 int mat_f32_new(mat_memory_t *mem, mat_f32_t *a, unsigned n, unsigned m);
 void mat_f32_destroy(mat_memory_t *mem, mat_f32_t *a);
 int mat_f32_copy(mat_f32_t *dst, mat_f32_t *src);
@@ -41,6 +97,11 @@ int mat_f32_inv(mat_f32_t *inv_a, mat_f32_t *a);
 f32_t f32_random_normal(float mu, float sigma);
 void mat_f32_random_normal(mat_f32_t *c, float mu, float sigma);
 float mat_f32_max_abs_eigenval(mat_f32_t *a, mat_f32_t *x, mat_f32_t *y, unsigned lim);
+int mat_f32_sign_product(mat_f32_t *c, mat_f32_t *a, mat_sign_t *b, float l);
+int mat_f32_f16_product(mat_f32_t *c, mat_f32_t *a, mat_f16_t *b);
+int mat_f32_bf16_product(mat_f32_t *c, mat_f32_t *a, mat_bf16_t *b);
+int mat_f16_from_f32(mat_f16_t *dst, mat_f32_t *src);
+int mat_bf16_from_f32(mat_bf16_t *dst, mat_f32_t *src);
 
 int mat_f64_new(mat_memory_t *mem, mat_f64_t *a, unsigned n, unsigned m);
 void mat_f64_destroy(mat_memory_t *mem, mat_f64_t *a);
@@ -56,6 +117,11 @@ int mat_f64_inv(mat_f64_t *inv_a, mat_f64_t *a);
 f64_t f64_random_normal(double mu, double sigma);
 void mat_f64_random_normal(mat_f64_t *c, double mu, double sigma);
 double mat_f64_max_abs_eigenval(mat_f64_t *a, mat_f64_t *x, mat_f64_t *y, unsigned lim);
+int mat_f64_sign_product(mat_f64_t *c, mat_f64_t *a, mat_sign_t *b, double l);
+int mat_f64_f16_product(mat_f64_t *c, mat_f64_t *a, mat_f16_t *b);
+int mat_f64_bf16_product(mat_f64_t *c, mat_f64_t *a, mat_bf16_t *b);
+int mat_f16_from_f64(mat_f16_t *dst, mat_f64_t *src);
+int mat_bf16_from_f64(mat_bf16_t *dst, mat_f64_t *src);
 
 #if defined(PRECISION_F32)
 #define MAT_NEW(...) mat_f32_new(__VA_ARGS__)
@@ -72,9 +138,11 @@ double mat_f64_max_abs_eigenval(mat_f64_t *a, mat_f64_t *x, mat_f64_t *y, unsign
 #define RANDOM_NORMAL(...) f32_random_normal(__VA_ARGS__)
 #define MAT_RANDOM_NORMAL(...) mat_f32_random_normal(__VA_ARGS__)
 #define MAT_MAX_ABS_EIGENVAL(...) mat_f32_max_abs_eigenval(__VA_ARGS__)
+#define MAT_SIGN_PRODUCT(...) mat_f32_sign_product(__VA_ARGS__)
 #elif defined(PRECISION_F64)
 #define MAT_NEW(...) mat_f64_new(__VA_ARGS__)
 #define MAT_DESTROY(...) mat_f64_destroy(__VA_ARGS__)
+#define MAT_COPY(...) mat_f64_copy(__VA_ARGS__)
 #define MAT_ZEROS(...) mat_f64_zeros(__VA_ARGS__)
 #define MAT_TRANS(...) mat_f64_transpose(__VA_ARGS__)
 #define MAT_SUM(...) mat_f64_sum(__VA_ARGS__)
@@ -86,6 +154,40 @@ double mat_f64_max_abs_eigenval(mat_f64_t *a, mat_f64_t *x, mat_f64_t *y, unsign
 #define RANDOM_NORMAL(...) f64_random_normal(__VA_ARGS__)
 #define MAT_RANDOM_NORMAL(...) mat_f64_random_normal(__VA_ARGS__)
 #define MAT_MAX_ABS_EIGENVAL(...) mat_f64_max_abs_eigenval(__VA_ARGS__)
+#define MAT_SIGN_PRODUCT(...) mat_f64_sign_product(__VA_ARGS__)
+#elif defined(PRECISION_Q15)
+#error "PRECISION_Q15 is only supported by the CMSIS backend"
+#endif
+
+// storage precision of weight matrices, independent of compute precision
+#if defined(STORAGE_F16)
+#define WVAL_T f16_t
+#define WMAT_T mat_f16_t
+#define WVAL_FROM(V) f32_to_f16(V)
+#define WVAL_TO(V) f16_to_f32(V)
+#define WMAT_NEW(...) mat_f16_new(__VA_ARGS__)
+#define WMAT_DESTROY(...) mat_f16_destroy(__VA_ARGS__)
+#if defined(PRECISION_F32)
+#define WMAT_PRODUCT(...) mat_f32_f16_product(__VA_ARGS__)
+#define WMAT_STORE(...) mat_f16_from_f32(__VA_ARGS__)
+#elif defined(PRECISION_F64)
+#define WMAT_PRODUCT(...) mat_f64_f16_product(__VA_ARGS__)
+#define WMAT_STORE(...) mat_f16_from_f64(__VA_ARGS__)
+#endif
+#elif defined(STORAGE_BF16)
+#define WVAL_T bf16_t
+#define WMAT_T mat_bf16_t
+#define WVAL_FROM(V) f32_to_bf16(V)
+#define WVAL_TO(V) bf16_to_f32(V)
+#define WMAT_NEW(...) mat_bf16_new(__VA_ARGS__)
+#define WMAT_DESTROY(...) mat_bf16_destroy(__VA_ARGS__)
+#if defined(PRECISION_F32)
+#define WMAT_PRODUCT(...) mat_f32_bf16_product(__VA_ARGS__)
+#define WMAT_STORE(...) mat_bf16_from_f32(__VA_ARGS__)
+#elif defined(PRECISION_F64)
+#define WMAT_PRODUCT(...) mat_f64_bf16_product(__VA_ARGS__)
+#define WMAT_STORE(...) mat_bf16_from_f64(__VA_ARGS__)
+#endif
 #endif
 
 #endif /* APP_GENERIC_MAT_H_ */
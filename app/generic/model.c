@@ -0,0 +1,204 @@
+#include "model.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(PRECISION_F64)
+#define MODEL_PRECISION MODEL_PRECISION_F64
+#else
+#define MODEL_PRECISION MODEL_PRECISION_F32
+#endif
+
+#if defined(STORAGE_F16)
+#define MODEL_STORAGE MODEL_STORAGE_F16
+#elif defined(STORAGE_BF16)
+#define MODEL_STORAGE MODEL_STORAGE_BF16
+#else
+#define MODEL_STORAGE MODEL_STORAGE_DENSE
+#endif
+
+#if defined(SIGN_IN_WEIGHTS)
+#define MODEL_IN_STORAGE MODEL_STORAGE_SIGN
+#else
+#define MODEL_IN_STORAGE MODEL_STORAGE
+#endif
+
+#define MODEL_ALIGN_UP(X) (((X) + MODEL_ALIGN - 1) & ~((uint64_t) MODEL_ALIGN - 1))
+
+static void _model_header(model_header_t *h, reservoir_t *res) {
+  memset(h, 0, sizeof(*h));
+  memcpy(h->magic, MODEL_MAGIC, sizeof(h->magic));
+  h->version = MODEL_VERSION;
+  h->header_size = sizeof(*h);
+  h->precision = MODEL_PRECISION;
+  h->in_storage = MODEL_IN_STORAGE;
+  h->res_storage = MODEL_STORAGE;
+  h->topology = MODEL_TOPOLOGY_DENSE;
+  h->n_in_nodes = res->n_in_nodes;
+  h->n_res_nodes = res->n_res_nodes;
+  h->n_out_nodes = res->n_out_nodes;
+  h->leak_rate = res->leak_rate;
+#if defined(SIGN_IN_WEIGHTS)
+  h->in_scale = res->in_scale;
+  h->size[MODEL_BLOCK_IN_WEIGHTS] = sizeof(uint32_t) * res->n_in_nodes * MAT_SIGN_WORDS(res->n_res_nodes);
+#else
+  h->in_t = res->in_weights.t;
+  h->size[MODEL_BLOCK_IN_WEIGHTS] = sizeof(WVAL_T) * res->n_in_nodes * res->n_res_nodes;
+#endif
+  h->res_t = res->res_weights.t;
+  h->size[MODEL_BLOCK_RES_WEIGHTS] = sizeof(WVAL_T) * res->n_res_nodes * res->n_res_nodes;
+  h->size[MODEL_BLOCK_OUT_WEIGHTS] = sizeof(*res->out_weights.data) * res->n_res_nodes * res->n_out_nodes;
+  h->size[MODEL_BLOCK_RES_NODES] = sizeof(VAL_T) * res->n_res_nodes;
+  uint64_t offset = MODEL_ALIGN_UP(sizeof(*h));
+  for(unsigned i = 0; i < MODEL_N_BLOCKS; i++) {
+    h->offset[i] = offset;
+    offset = MODEL_ALIGN_UP(offset + h->size[i]);
+  }
+}
+
+int model_save(reservoir_t *res, const char *path) {
+  model_header_t h;
+  _model_header(&h, res);
+  const void *blocks[MODEL_N_BLOCKS] = {
+    res->in_weights.data,
+    res->res_weights.data,
+    res->out_weights.data,
+    res->res_nodes.data,
+  };
+  static const char pad[MODEL_ALIGN];
+  FILE *fp = fopen(path, "wb");
+  if(fp == NULL) {
+    return -1;
+  }
+  uint64_t pos = 0;
+  if(fwrite(&h, sizeof(h), 1, fp) != 1) {
+    goto io_fail;
+  }
+  pos += sizeof(h);
+  for(unsigned i = 0; i < MODEL_N_BLOCKS; i++) {
+    if(fwrite(pad, 1, h.offset[i] - pos, fp) != h.offset[i] - pos) {
+      goto io_fail;
+    }
+    if(fwrite(blocks[i], 1, h.size[i], fp) != h.size[i]) {
+      goto io_fail;
+    }
+    pos = h.offset[i] + h.size[i];
+  }
+  return fclose(fp) == 0 ? 0 : -1;
+io_fail:
+  fclose(fp);
+  return -1;
+}
+
+static int _model_check(const model_header_t *h, size_t size) {
+  if(size < sizeof(*h) || memcmp(h->magic, MODEL_MAGIC, sizeof(h->magic)) != 0) {
+    return -1;
+  }
+  if(h->version != MODEL_VERSION || h->header_size != sizeof(*h)) {
+    return -1;
+  }
+  if(h->precision != MODEL_PRECISION || h->in_storage != MODEL_IN_STORAGE ||
+      h->res_storage != MODEL_STORAGE || h->topology != MODEL_TOPOLOGY_DENSE) {
+    return -1;
+  }
+  for(unsigned i = 0; i < MODEL_N_BLOCKS; i++) {
+    if(h->offset[i] % MODEL_ALIGN != 0 || h->offset[i] + h->size[i] > size) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+int model_load(reservoir_t *res, model_t *model, const char *path) {
+  struct stat st;
+  int fd = open(path, O_RDONLY);
+  if(fd < 0) {
+    return -1;
+  }
+  if(fstat(fd, &st) < 0) {
+    close(fd);
+    return -1;
+  }
+  model->size = st.st_size;
+  model->addr = mmap(NULL, model->size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if(model->addr == MAP_FAILED) {
+    model->addr = NULL;
+    return -1;
+  }
+  const model_header_t *h = model->addr;
+  if(_model_check(h, model->size) < 0) {
+    goto fail;
+  }
+  // set up a copy, res is only replaced once the model is loaded
+  reservoir_t loaded = *res;
+  model_header_t expect;
+  loaded.n_in_nodes = h->n_in_nodes;
+  loaded.n_res_nodes = h->n_res_nodes;
+  loaded.n_out_nodes = h->n_out_nodes;
+  loaded.leak_rate = h->leak_rate;
+  _model_header(&expect, &loaded);
+  if(memcmp(expect.size, h->size, sizeof(h->size)) != 0) {
+    goto fail;
+  }
+  char *base = model->addr;
+  // point weights at the mapped pages
+#if defined(SIGN_IN_WEIGHTS)
+  mat_sign_new(NULL, &loaded.in_weights, loaded.n_in_nodes, loaded.n_res_nodes);
+  loaded.in_weights.data = (uint32_t *) (base + h->offset[MODEL_BLOCK_IN_WEIGHTS]);
+  loaded.in_scale = h->in_scale;
+#else
+  WMAT_NEW(NULL, &loaded.in_weights, loaded.n_in_nodes, loaded.n_res_nodes);
+  loaded.in_weights.data = (WVAL_T *) (base + h->offset[MODEL_BLOCK_IN_WEIGHTS]);
+  loaded.in_weights.t = h->in_t;
+#endif
+  WMAT_NEW(NULL, &loaded.res_weights, loaded.n_res_nodes, loaded.n_res_nodes);
+  loaded.res_weights.data = (WVAL_T *) (base + h->offset[MODEL_BLOCK_RES_WEIGHTS]);
+  loaded.res_weights.t = h->res_t;
+  ACC_MAT_NEW(NULL, &loaded.out_weights, loaded.n_res_nodes, loaded.n_out_nodes);
+  loaded.out_weights.data = (ACC_VAL_T *) (base + h->offset[MODEL_BLOCK_OUT_WEIGHTS]);
+  loaded.external_weights = 1;
+  if(init(&loaded) < 0) {
+    goto fail;
+  }
+  memcpy(loaded.res_nodes.data, base + h->offset[MODEL_BLOCK_RES_NODES], h->size[MODEL_BLOCK_RES_NODES]);
+  *res = loaded;
+  return 0;
+fail:
+  munmap(model->addr, model->size);
+  model->addr = NULL;
+  return -1;
+}
+
+void model_unload(reservoir_t *res, model_t *model) {
+  deinit(res);
+  munmap(model->addr, model->size);
+  model->addr = NULL;
+}
+
+int model_save_c(reservoir_t *res, const char *path) {
+  FILE *fp = fopen(path, "w");
+  if(fp == NULL) {
+    return -1;
+  }
+  // enough digits to round trip
+  int digits = sizeof(ACC_VAL_T) == sizeof(double) ? 17 : 9;
+  fprintf(fp, "#include \"reservoir.h\"\n");
+  fprintf(fp, "#if defined(INFERENCE_ONLY)\n");
+  fprintf(fp, "const ACC_VAL_T __out_weights[] = {\n");
+  for(unsigned n = 0; n < res->n_res_nodes; n++) {
+    for(unsigned k = 0; k < res->n_out_nodes; k++) {
+      if(n > 0 || k > 0) {
+        fprintf(fp, ",\n");
+      }
+      fprintf(fp, "  %.*g", digits, (double) *MAT(res->out_weights, n, k));
+    }
+  }
+  fprintf(fp, "\n};\n");
+  fprintf(fp, "#endif\n");
+  return fclose(fp) == 0 ? 0 : -1;
+}
@@ -0,0 +1,66 @@
+#ifndef APP_GENERIC_MODEL_H_
+#define APP_GENERIC_MODEL_H_
+
+#include "reservoir.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MODEL_MAGIC "RMDL"
+#define MODEL_VERSION 1
+#define MODEL_ALIGN 64
+
+#define MODEL_PRECISION_F32 1
+#define MODEL_PRECISION_F64 2
+
+#define MODEL_STORAGE_DENSE 0
+#define MODEL_STORAGE_F16 1
+#define MODEL_STORAGE_BF16 2
+#define MODEL_STORAGE_SIGN 3 // in_weights only
+
+#define MODEL_TOPOLOGY_DENSE 0
+
+enum {
+  MODEL_BLOCK_IN_WEIGHTS,
+  MODEL_BLOCK_RES_WEIGHTS,
+  MODEL_BLOCK_OUT_WEIGHTS,
+  MODEL_BLOCK_RES_NODES,
+  MODEL_N_BLOCKS,
+};
+
+// file layout: header, then MODEL_N_BLOCKS blocks each aligned to MODEL_ALIGN bytes
+typedef struct {
+  char magic[4];
+  uint32_t version;
+  uint32_t header_size;
+  uint32_t precision;     // element type of out_weights and res_nodes
+  uint32_t in_storage;
+  uint32_t res_storage;
+  uint32_t topology;
+  uint32_t n_in_nodes;
+  uint32_t n_res_nodes;
+  uint32_t n_out_nodes;
+  float leak_rate;
+  float in_scale;         // MODEL_STORAGE_SIGN only
+  uint32_t in_t;          // transposed flags of in_weights and res_weights
+  uint32_t res_t;
+  uint64_t offset[MODEL_N_BLOCKS];
+  uint64_t size[MODEL_N_BLOCKS];
+} model_header_t;
+
+// mapped model file, weights of the reservoir point into it
+typedef struct {
+  void *addr;
+  size_t size;
+} model_t;
+
+int model_save(reservoir_t *res, const char *path);
+// maps the file read-only and sets up res (mem, dims, weights), res_nodes is copied to the heap.
+// res is left untouched if the model cannot be loaded
+int model_load(reservoir_t *res, model_t *model, const char *path);
+void model_unload(reservoir_t *res, model_t *model);
+
+// writes out_weights as C source defining __out_weights for INFERENCE_ONLY firmware
+int model_save_c(reservoir_t *res, const char *path);
+
+#endif /* APP_GENERIC_MODEL_H_ */
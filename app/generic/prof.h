@@ -0,0 +1,11 @@
+#ifndef APP_GENERIC_PROF_H_
+#define APP_GENERIC_PROF_H_
+
+// cycle profiling is on target only (app/cmsis/prof.h)
+#define PROF_BEGIN(SITE)
+#define PROF_END(SITE)
+#define PROF_INIT()
+#define PROF_RESET()
+#define PROF_DUMP()
+
+#endif /* APP_GENERIC_PROF_H_ */
@@ -0,0 +1,229 @@
+#include "quant.h"
+
+#include <math.h>
+#include <string.h>
+
+// quantize row n of the transposed weights, w(m) = weight(m, n)
+static void _quantize_row(mat_i8_t *q, unsigned n, f32_t *w) {
+  q->scale[n] = i8_quantize(q->data + q->m * n, w, q->m, 0.0f);
+}
+
+// heap: max(n_in_nodes, n_res_nodes) while quantizing
+int quant_init(quant_t *q, reservoir_t *res) {
+  mat_f32_t row;
+  row.data = NULL;
+  q->mem = res->mem;
+  q->n_in_nodes = res->n_in_nodes;
+  q->n_res_nodes = res->n_res_nodes;
+  q->n_out_nodes = res->n_out_nodes;
+  q->leak_rate = res->leak_rate;
+  q->in_scale = 1.0f / 127.0f;
+  q->res_scale = 1.0f / 127.0f;
+  // quant_deinit on the fail path frees whatever was allocated so far
+  q->in_weights.data = NULL;
+  q->in_weights.scale = NULL;
+  q->res_weights.data = NULL;
+  q->res_weights.scale = NULL;
+  q->out_weights.data = NULL;
+  q->out_weights.scale = NULL;
+  q->res_nodes.data = NULL;
+  q->in_q = NULL;
+  q->res_q = NULL;
+  if(mat_i8_new(q->mem, &q->in_weights, q->n_res_nodes, q->n_in_nodes) < 0) {
+    goto oom_fail;
+  }
+  if(mat_i8_new(q->mem, &q->res_weights, q->n_res_nodes, q->n_res_nodes) < 0) {
+    goto oom_fail;
+  }
+  if(mat_i8_new(q->mem, &q->out_weights, q->n_out_nodes, q->n_res_nodes) < 0) {
+    goto oom_fail;
+  }
+  if(mat_f32_new(q->mem, &q->res_nodes, 1, q->n_res_nodes) < 0) {
+    goto oom_fail;
+  }
+  q->in_q = q->mem->memory_alloc(sizeof(int8_t) * q->n_in_nodes);
+  if(q->in_q == NULL) {
+    goto oom_fail;
+  }
+  q->res_q = q->mem->memory_alloc(sizeof(int8_t) * q->n_res_nodes);
+  if(q->res_q == NULL) {
+    goto oom_fail;
+  }
+  if(mat_f32_new(q->mem, &row, 1, q->n_in_nodes > q->n_res_nodes ? q->n_in_nodes : q->n_res_nodes) < 0) {
+    goto oom_fail;
+  }
+  f32_t *w = row.data;
+  for(unsigned n = 0; n < q->n_res_nodes; n++) {
+    for(unsigned m = 0; m < q->n_in_nodes; m++) {
+      w[m] = IN_WEIGHT(res, m, n);
+    }
+    _quantize_row(&q->in_weights, n, w);
+    for(unsigned m = 0; m < q->n_res_nodes; m++) {
+      w[m] = RES_WEIGHT(res, m, n);
+    }
+    _quantize_row(&q->res_weights, n, w);
+  }
+  for(unsigned n = 0; n < q->n_out_nodes; n++) {
+    for(unsigned m = 0; m < q->n_res_nodes; m++) {
+      w[m] = *MAT(res->out_weights, m, n);
+    }
+    _quantize_row(&q->out_weights, n, w);
+  }
+  for(unsigned m = 0; m < q->n_res_nodes; m++) {
+    *(q->res_nodes.data + m) = *(res->res_nodes.data + m);
+  }
+  mat_f32_destroy(q->mem, &row);
+  return 0;
+oom_fail:
+  mat_f32_destroy(q->mem, &row);
+  quant_deinit(q);
+  return -1;
+}
+
+void quant_deinit(quant_t *q) {
+  mat_i8_destroy(q->mem, &q->in_weights);
+  mat_i8_destroy(q->mem, &q->res_weights);
+  mat_i8_destroy(q->mem, &q->out_weights);
+  mat_f32_destroy(q->mem, &q->res_nodes);
+  q->mem->memory_free(q->in_q);
+  q->mem->memory_free(q->res_q);
+  q->in_q = NULL;
+  q->res_q = NULL;
+}
+
+// run the f32 path over data and take input and res_nodes scales from the observed ranges
+// heap: n_res_nodes + n_out_nodes + heap of predict()
+int quant_calibrate(quant_t *q, reservoir_t *res, MAT_T *data) {
+  int ret = 0;
+  MAT_T saved, predicted, _data;
+  predicted.data = NULL;
+  if(MAT_NEW(q->mem, &saved, 1, q->n_res_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  if(MAT_NEW(q->mem, &predicted, 1, q->n_out_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  MAT_COPY(&saved, &res->res_nodes);
+  MAT_NEW(NULL, &_data, 1, q->n_in_nodes);
+  f32_t in_max = 0.0f, res_max = 0.0f;
+  for(unsigned n = 0; n < data->n; n++) {
+    _data.data = data->data + n * q->n_in_nodes;
+    for(unsigned i = 0; i < q->n_in_nodes; i++) {
+      if(fabsf(*(_data.data + i)) > in_max) {
+        in_max = fabsf(*(_data.data + i));
+      }
+    }
+    if(predict(res, &predicted, &_data) < 0) {
+      ret = -1;
+      break;
+    }
+    for(unsigned i = 0; i < q->n_res_nodes; i++) {
+      if(fabsf(*(res->res_nodes.data + i)) > res_max) {
+        res_max = fabsf(*(res->res_nodes.data + i));
+      }
+    }
+  }
+  if(in_max > 0.0f) {
+    q->in_scale = in_max / 127.0f;
+  }
+  if(res_max > 0.0f) {
+    q->res_scale = res_max / 127.0f;
+  }
+  MAT_COPY(&res->res_nodes, &saved);
+  for(unsigned i = 0; i < q->n_res_nodes; i++) {
+    *(q->res_nodes.data + i) = *(saved.data + i);
+  }
+oom_fail:
+  MAT_DESTROY(q->mem, &saved);
+  MAT_DESTROY(q->mem, &predicted);
+  return ret;
+}
+
+// NRMSE of int8 predictions against the f32 path over data, both started from the current state
+// heap: n_res_nodes * 2 + n_out_nodes * 2 + heap of predict()
+int quant_nrmse(quant_t *q, reservoir_t *res, MAT_T *data, float *nrmse) {
+  int ret = 0;
+  MAT_T saved, saved_q, expected, predicted, _data;
+  saved_q.data = NULL;
+  expected.data = NULL;
+  predicted.data = NULL;
+  if(MAT_NEW(q->mem, &saved, 1, q->n_res_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  if(MAT_NEW(q->mem, &saved_q, 1, q->n_res_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  if(MAT_NEW(q->mem, &expected, 1, q->n_out_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  if(MAT_NEW(q->mem, &predicted, 1, q->n_out_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  MAT_COPY(&saved, &res->res_nodes);
+  for(unsigned i = 0; i < q->n_res_nodes; i++) {
+    *(saved_q.data + i) = *(q->res_nodes.data + i);
+  }
+  MAT_NEW(NULL, &_data, 1, q->n_in_nodes);
+  double err = 0.0, sum = 0.0, sum2 = 0.0;
+  unsigned count = 0;
+  for(unsigned n = 0; n < data->n; n++) {
+    _data.data = data->data + n * q->n_in_nodes;
+    if(predict(res, &expected, &_data) < 0) {
+      ret = -1;
+      break;
+    }
+    quant_predict(q, &predicted, &_data);
+    for(unsigned i = 0; i < q->n_out_nodes; i++) {
+      double e = *(expected.data + i);
+      err += (*(predicted.data + i) - e) * (*(predicted.data + i) - e);
+      sum += e;
+      sum2 += e * e;
+      count++;
+    }
+  }
+  if(count > 0) {
+    double var = sum2 / count - (sum / count) * (sum / count);
+    *nrmse = var > 0.0 ? sqrt(err / count / var) : sqrt(err / count);
+  }
+  MAT_COPY(&res->res_nodes, &saved);
+  for(unsigned i = 0; i < q->n_res_nodes; i++) {
+    *(q->res_nodes.data + i) = *(saved_q.data + i);
+  }
+oom_fail:
+  MAT_DESTROY(q->mem, &saved);
+  MAT_DESTROY(q->mem, &saved_q);
+  MAT_DESTROY(q->mem, &expected);
+  MAT_DESTROY(q->mem, &predicted);
+  return ret;
+}
+
+int quant_predict(quant_t *q, MAT_T *predicted, MAT_T *data) {
+  f32_t *res_nodes = q->res_nodes.data;
+  // re-quantize input and res_nodes with calibrated scales
+  for(unsigned i = 0; i < q->n_in_nodes; i++) {
+    f32_t v = *(data->data + i);
+    i8_quantize(q->in_q + i, &v, 1, q->in_scale);
+  }
+  i8_quantize(q->res_q, res_nodes, q->n_res_nodes, q->res_scale);
+  // res_nodes is only read through res_q from here, so update it in place
+  for(unsigned n = 0; n < q->n_res_nodes; n++) {
+    f32_t next = i8_dot_product(q->in_weights.data + q->n_in_nodes * n, q->in_q, q->n_in_nodes)
+        * q->in_weights.scale[n] * q->in_scale;
+    next += i8_dot_product(q->res_weights.data + q->n_res_nodes * n, q->res_q, q->n_res_nodes)
+        * q->res_weights.scale[n] * q->res_scale;
+    next = next * q->leak_rate + res_nodes[n] * (1.0f - q->leak_rate);
+    res_nodes[n] = tanhf(next);
+  }
+  i8_quantize(q->res_q, res_nodes, q->n_res_nodes, q->res_scale);
+  for(unsigned n = 0; n < q->n_out_nodes; n++) {
+    *(predicted->data + n) = i8_dot_product(q->out_weights.data + q->n_res_nodes * n, q->res_q, q->n_res_nodes)
+        * q->out_weights.scale[n] * q->res_scale;
+  }
+  return 0;
+}
@@ -0,0 +1,31 @@
+#ifndef APP_GENERIC_QUANT_H_
+#define APP_GENERIC_QUANT_H_
+
+#include "reservoir.h"
+
+// int8 inference copy of a trained reservoir
+typedef struct {
+  mat_memory_t *mem;
+  unsigned n_in_nodes;
+  unsigned n_res_nodes;
+  unsigned n_out_nodes;
+  float leak_rate;
+  mat_i8_t in_weights;  // heap: n_res_nodes * n_in_nodes (transposed, scale per res node)
+  mat_i8_t res_weights; // heap: n_res_nodes * n_res_nodes (transposed, scale per res node)
+  mat_i8_t out_weights; // heap: n_out_nodes * n_res_nodes (transposed, scale per out node)
+  f32_t in_scale;       // calibrated input scale
+  f32_t res_scale;      // calibrated res_nodes scale
+  mat_f32_t res_nodes;  // heap: sizeof(f32_t) * 1 * n_res_nodes
+  int8_t *in_q;         // heap: n_in_nodes
+  int8_t *res_q;        // heap: n_res_nodes
+} quant_t;
+
+int quant_init(quant_t *q, reservoir_t *res);
+void quant_deinit(quant_t *q);
+
+int quant_calibrate(quant_t *q, reservoir_t *res, MAT_T *data);
+int quant_nrmse(quant_t *q, reservoir_t *res, MAT_T *data, float *nrmse);
+
+int quant_predict(quant_t *q, MAT_T *predicted, MAT_T *data);
+
+#endif /* APP_GENERIC_QUANT_H_ */
@@ -0,0 +1,205 @@
+#include "state_cache.h"
+#include "checkpoint.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef INFERENCE_ONLY
+
+#define _STATE_SIZE(H) ((H)->format == STATE_CACHE_F16 ? sizeof(f16_t) : sizeof(VAL_T))
+#define _RECORD(C, N) ((char *) (C)->addr + STATE_CACHE_ALIGN + (size_t) (C)->header->record_size * (N))
+
+static void _state_cache_header(state_cache_header_t *h, reservoir_t *res, unsigned format) {
+  memset(h, 0, sizeof(*h));
+  memcpy(h->magic, STATE_CACHE_MAGIC, sizeof(h->magic));
+  h->version = STATE_CACHE_VERSION;
+  h->header_size = sizeof(*h);
+  h->val_size = sizeof(VAL_T);
+  h->format = format;
+  h->n_in_nodes = res->n_in_nodes;
+  h->n_res_nodes = res->n_res_nodes;
+  h->record_size = (sizeof(VAL_T) * res->n_in_nodes + _STATE_SIZE(h) * res->n_res_nodes + 7) & ~7u;
+  h->weights_hash = checkpoint_weights_hash(res);
+}
+
+static int _state_cache_map(state_cache_t *cache, uint64_t capacity) {
+  size_t size = STATE_CACHE_ALIGN + (size_t) cache->header->record_size * capacity;
+  if(cache->addr) {
+    munmap(cache->addr, cache->size);
+    cache->addr = NULL;
+  }
+  if(ftruncate(cache->fd, size) < 0) {
+    return -1;
+  }
+  void *addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, cache->fd, 0);
+  if(addr == MAP_FAILED) {
+    return -1;
+  }
+  cache->addr = addr;
+  cache->size = size;
+  cache->capacity = capacity;
+  cache->header = addr;
+  return 0;
+}
+
+int state_cache_create(state_cache_t *cache, reservoir_t *res, const char *path, unsigned format) {
+  state_cache_header_t h;
+  _state_cache_header(&h, res, format);
+  cache->addr = NULL;
+  cache->writable = 1;
+  cache->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if(cache->fd < 0) {
+    return -1;
+  }
+  cache->header = &h;
+  if(_state_cache_map(cache, STATE_CACHE_INITIAL_ROWS) < 0) {
+    close(cache->fd);
+    return -1;
+  }
+  memcpy(cache->header, &h, sizeof(h));
+  return 0;
+}
+
+int state_cache_open(state_cache_t *cache, reservoir_t *res, const char *path) {
+  struct stat st;
+  state_cache_header_t expect;
+  cache->writable = 0;
+  cache->fd = open(path, O_RDONLY);
+  if(cache->fd < 0) {
+    return -1;
+  }
+  if(fstat(cache->fd, &st) < 0 || (size_t) st.st_size < STATE_CACHE_ALIGN) {
+    goto fail;
+  }
+  cache->size = st.st_size;
+  cache->addr = mmap(NULL, cache->size, PROT_READ, MAP_SHARED, cache->fd, 0);
+  if(cache->addr == MAP_FAILED) {
+    goto fail;
+  }
+  cache->header = cache->addr;
+  _state_cache_header(&expect, res, cache->header->format);
+  expect.n_rows = cache->header->n_rows;
+  cache->capacity = (cache->size - STATE_CACHE_ALIGN) / expect.record_size;
+  if(memcmp(cache->header, &expect, sizeof(expect)) != 0 || cache->header->n_rows > cache->capacity) {
+    munmap(cache->addr, cache->size);
+    goto fail;
+  }
+  return 0;
+fail:
+  close(cache->fd);
+  return -1;
+}
+
+void state_cache_close(state_cache_t *cache) {
+  size_t size = STATE_CACHE_ALIGN + (size_t) cache->header->record_size * cache->header->n_rows;
+  munmap(cache->addr, cache->size);
+  if(cache->writable) {
+    // drop the unused capacity
+    ftruncate(cache->fd, size);
+  }
+  close(cache->fd);
+  cache->addr = NULL;
+}
+
+// heap: n_res_nodes * (STATE_CACHE_BATCH_SIZE + 1) + n_res_nodes
+int state_cache_collect(state_cache_t *cache, reservoir_t *res, MAT_T *data) {
+  int ret = 0;
+  state_cache_header_t *h = cache->header;
+  MAT_T states, batch;
+  if(!cache->writable) {
+    return -1;
+  }
+  if(MAT_NEW(res->mem, &states, STATE_CACHE_BATCH_SIZE + 1, res->n_res_nodes) < 0) {
+    return -1;
+  }
+  MAT_NEW(NULL, &batch, 0, data->m);
+  for(unsigned n = 0; n < data->n; n += batch.n) {
+    batch.n = data->n - n < STATE_CACHE_BATCH_SIZE ? data->n - n : STATE_CACHE_BATCH_SIZE;
+    batch.data = data->data + (size_t) data->m * n;
+    if(h->n_rows + batch.n > cache->capacity) {
+      if(_state_cache_map(cache, cache->capacity * 2 + batch.n) < 0) {
+        ret = -1;
+        break;
+      }
+      h = cache->header;
+    }
+    if(train_collect_states(res, &states, &res->res_nodes, &batch) < 0) {
+      ret = -1;
+      break;
+    }
+    for(unsigned i = 0; i < batch.n; i++) {
+      char *record = _RECORD(cache, h->n_rows + i);
+      VAL_T *state = states.data + res->n_res_nodes * (i + 1);
+      memcpy(record, batch.data + (size_t) data->m * i, sizeof(VAL_T) * res->n_in_nodes);
+      record += sizeof(VAL_T) * res->n_in_nodes;
+      if(h->format == STATE_CACHE_F16) {
+        f16_t *dst = (f16_t *) record;
+        for(unsigned j = 0; j < res->n_res_nodes; j++) {
+          dst[j] = f32_to_f16((f32_t) state[j]);
+        }
+      } else {
+        memcpy(record, state, sizeof(VAL_T) * res->n_res_nodes);
+      }
+    }
+    h->n_rows += batch.n;
+  }
+  MAT_DESTROY(res->mem, &states);
+  return ret;
+}
+
+// heap: (n_res_nodes + n_in_nodes) * STATE_CACHE_BATCH_SIZE + train_fold
+int state_cache_gram(state_cache_t *cache, reservoir_t *res, uint64_t from, uint64_t to, unsigned horizon) {
+  if(res->external_weights) {
+    return -1;
+  }
+  int ret = 0;
+  state_cache_header_t *h = cache->header;
+  ACC_MAT_T states, targets;
+  states.data = NULL;
+  targets.data = NULL;
+  // targets are cached inputs
+  if(res->n_out_nodes != res->n_in_nodes) {
+    return -1;
+  }
+  if(to + horizon > h->n_rows) {
+    to = h->n_rows > horizon ? h->n_rows - horizon : 0;
+  }
+  if(ACC_MAT_NEW(res->mem, &states, STATE_CACHE_BATCH_SIZE, res->n_res_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  if(ACC_MAT_NEW(res->mem, &targets, STATE_CACHE_BATCH_SIZE, res->n_in_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  for(uint64_t n = from; n < to; n += states.n) {
+    unsigned rows = to - n < STATE_CACHE_BATCH_SIZE ? to - n : STATE_CACHE_BATCH_SIZE;
+    states.n = targets.n = rows;
+    for(unsigned i = 0; i < rows; i++) {
+      const char *record = _RECORD(cache, n + i);
+      const char *state = record + sizeof(VAL_T) * res->n_in_nodes;
+      memcpy(targets.data + res->n_in_nodes * i, _RECORD(cache, n + i + horizon), sizeof(VAL_T) * res->n_in_nodes);
+      if(h->format == STATE_CACHE_F16) {
+        for(unsigned j = 0; j < res->n_res_nodes; j++) {
+          *MAT(states, i, j) = f16_to_f32(((const f16_t *) state)[j]);
+        }
+      } else {
+        memcpy(states.data + res->n_res_nodes * i, state, sizeof(VAL_T) * res->n_res_nodes);
+      }
+    }
+    if(train_fold(res, &res->x, &res->y, &states, &targets) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+    res->n_samples += rows;
+  }
+oom_fail:
+  ACC_MAT_DESTROY(res->mem, &states);
+  ACC_MAT_DESTROY(res->mem, &targets);
+  return ret;
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef APP_GENERIC_STATE_CACHE_H_
+#define APP_GENERIC_STATE_CACHE_H_
+
+#include "reservoir.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define STATE_CACHE_MAGIC "RSTC"
+#define STATE_CACHE_VERSION 1
+#define STATE_CACHE_ALIGN 64
+#define STATE_CACHE_BATCH_SIZE 256
+#define STATE_CACHE_INITIAL_ROWS 1024
+
+#define STATE_CACHE_DENSE 0 // states in VAL_T
+#define STATE_CACHE_F16 1   // states in f16
+
+// file layout: header, then one record per time step at STATE_CACHE_ALIGN:
+// input (n_in_nodes VAL_T), state after that input (n_res_nodes VAL_T or f16), padding to 8 bytes
+typedef struct {
+  char magic[4];
+  uint32_t version;
+  uint32_t header_size;
+  uint32_t val_size;      // sizeof(VAL_T)
+  uint32_t format;
+  uint32_t n_in_nodes;
+  uint32_t n_res_nodes;
+  uint32_t record_size;
+  uint64_t n_rows;
+  uint64_t weights_hash;
+} state_cache_header_t;
+
+typedef struct {
+  void *addr;
+  size_t size;
+  int fd;
+  unsigned writable;
+  uint64_t capacity;      // rows that fit in the mapping
+  state_cache_header_t *header;
+} state_cache_t;
+
+// collection: create, collect any number of times, close
+int state_cache_create(state_cache_t *cache, reservoir_t *res, const char *path, unsigned format);
+// advances res->res_nodes over data like train_feed_data and appends inputs and states instead of accumulating
+int state_cache_collect(state_cache_t *cache, reservoir_t *res, MAT_T *data);
+// maps an existing cache read-only, it has to come from a reservoir with the same dims and weights
+int state_cache_open(state_cache_t *cache, reservoir_t *res, const char *path);
+void state_cache_close(state_cache_t *cache);
+
+// accumulate the states of rows [from, to) with the input horizon rows ahead as target into x and y,
+// horizon 0 gives what train_feed_data would have accumulated. call it for several ranges to build
+// cross-validation folds, then train_compute_weight.
+int state_cache_gram(state_cache_t *cache, reservoir_t *res, uint64_t from, uint64_t to, unsigned horizon);
+
+#endif /* APP_GENERIC_STATE_CACHE_H_ */
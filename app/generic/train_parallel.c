@@ -0,0 +1,303 @@
+#include "train_parallel.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+
+#ifndef INFERENCE_ONLY
+
+typedef struct {
+  reservoir_t *res;
+  MAT_T *series;
+  unsigned n_series;
+  unsigned washout;
+  unsigned first;
+  unsigned step;
+  MAT_T *init_state; // initial state of every series, zeros if NULL
+  ACC_MAT_T x;       // heap: sizeof(ACC_VAL_T) * n_res_nodes * n_res_nodes
+  ACC_MAT_T y;       // heap: sizeof(ACC_VAL_T) * n_res_nodes * n_out_nodes
+  MAT_T state;       // heap: sizeof(VAL_T) * 1 * n_res_nodes
+  unsigned n_samples;
+  int ret;
+} train_worker_t;
+
+// feed data rows [from, to) in batches, the first washout rows only advance the state
+static int _feed(reservoir_t *res, ACC_MAT_T *x, ACC_MAT_T *y, MAT_T *state, MAT_T *data,
+    unsigned from, unsigned to, unsigned washout, unsigned *n_samples) {
+  MAT_T batch;
+  MAT_NEW(NULL, &batch, 0, data->m);
+  for(unsigned n = from; n < to; n += batch.n) {
+    batch.n = to - n < TRAIN_PARALLEL_BATCH_SIZE ? to - n : TRAIN_PARALLEL_BATCH_SIZE;
+    batch.data = data->data + (size_t) data->m * n;
+    // washout left in this batch
+    unsigned _washout = from + washout > n ? from + washout - n : 0;
+    if(train_accumulate(res, x, y, state, &batch, NULL, _washout) < 0) {
+      return -1;
+    }
+    if(n_samples) {
+      *n_samples += batch.n > _washout ? batch.n - _washout : 0;
+    }
+  }
+  return 0;
+}
+
+static void *_train_worker(void *arg) {
+  train_worker_t *w = arg;
+  for(unsigned s = w->first; s < w->n_series; s += w->step) {
+    if(w->init_state) {
+      MAT_COPY(&w->state, w->init_state);
+    } else {
+      MAT_ZEROS(&w->state);
+    }
+    if(_feed(w->res, &w->x, &w->y, &w->state, &w->series[s], 0, w->series[s].n, w->washout, &w->n_samples) < 0) {
+      w->ret = -1;
+      return NULL;
+    }
+  }
+  return NULL;
+}
+
+typedef struct {
+  reservoir_t *res;
+  train_worker_t *dst;
+  train_worker_t *src;
+  int ret;
+} train_merge_t;
+
+static void *_train_merger(void *arg) {
+  train_merge_t *m = arg;
+  m->ret = train_merge(m->res, &m->dst->x, &m->dst->y, &m->src->x, &m->src->y);
+  return NULL;
+}
+
+// pairwise tree reduction of the worker partials into workers[0], the pairs of a level run in parallel
+// heap: (sizeof(train_merge_t) + sizeof(pthread_t)) * (n_workers / 2 + 1)
+static int _reduce_workers(reservoir_t *res, train_worker_t *workers, unsigned n_workers) {
+  int ret = 0;
+  train_merge_t *merges = res->mem->memory_alloc(sizeof(train_merge_t) * (n_workers / 2 + 1));
+  pthread_t *threads = res->mem->memory_alloc(sizeof(pthread_t) * (n_workers / 2 + 1));
+  if(merges == NULL || threads == NULL) {
+    ret = -1;
+    goto oom_fail;
+  }
+  for(unsigned step = 1; step < n_workers && ret == 0; step *= 2) {
+    unsigned n_merges = 0, n_started = 0;
+    for(unsigned i = 0; i + step < n_workers; i += 2 * step) {
+      merges[n_merges].res = res;
+      merges[n_merges].dst = &workers[i];
+      merges[n_merges].src = &workers[i + step];
+      merges[n_merges].ret = 0;
+      n_merges++;
+    }
+    for(; n_started < n_merges; n_started++) {
+      if(pthread_create(&threads[n_started], NULL, _train_merger, &merges[n_started]) != 0) {
+        ret = -1;
+        break;
+      }
+    }
+    for(unsigned t = 0; t < n_started; t++) {
+      pthread_join(threads[t], NULL);
+      if(merges[t].ret < 0) {
+        ret = -1;
+      }
+    }
+  }
+oom_fail:
+  res->mem->memory_free(merges);
+  res->mem->memory_free(threads);
+  return ret;
+}
+
+// run workers on one thread each and reduce their partials into res,
+// final_state (if any) receives the last state of the last worker
+// heap: sizeof(pthread_t) * n_workers + the worker partials
+static int _train_workers(reservoir_t *res, train_worker_t *workers, unsigned n_workers, MAT_T *final_state) {
+  int ret = 0;
+  pthread_t *threads = NULL;
+  unsigned n_started = 0;
+  for(unsigned t = 0; t < n_workers; t++) {
+    train_worker_t *w = &workers[t];
+    w->res = res;
+    w->n_samples = 0;
+    w->ret = 0;
+    w->x.data = NULL;
+    w->y.data = NULL;
+    w->state.data = NULL;
+  }
+  for(unsigned t = 0; t < n_workers; t++) {
+    train_worker_t *w = &workers[t];
+    if(ACC_MAT_NEW(res->mem, &w->x, res->n_res_nodes, res->n_res_nodes) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+    if(ACC_MAT_NEW(res->mem, &w->y, res->n_res_nodes, res->n_out_nodes) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+    if(MAT_NEW(res->mem, &w->state, 1, res->n_res_nodes) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+    ACC_MAT_ZEROS(&w->x);
+    ACC_MAT_ZEROS(&w->y);
+  }
+  threads = res->mem->memory_alloc(sizeof(pthread_t) * n_workers);
+  if(threads == NULL) {
+    ret = -1;
+    goto oom_fail;
+  }
+  for(; n_started < n_workers; n_started++) {
+    if(pthread_create(&threads[n_started], NULL, _train_worker, &workers[n_started]) != 0) {
+      ret = -1;
+      break;
+    }
+  }
+  for(unsigned t = 0; t < n_started; t++) {
+    pthread_join(threads[t], NULL);
+  }
+  if(ret < 0) {
+    goto oom_fail;
+  }
+  for(unsigned t = 0; t < n_workers; t++) {
+    if(workers[t].ret < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+  }
+  if(_reduce_workers(res, workers, n_workers) < 0 ||
+      train_merge(res, &res->x, &res->y, &workers[0].x, &workers[0].y) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  for(unsigned t = 0; t < n_workers; t++) {
+    res->n_samples += workers[t].n_samples;
+  }
+  if(final_state) {
+    MAT_COPY(final_state, &workers[n_workers - 1].state);
+  }
+oom_fail:
+  for(unsigned t = 0; t < n_workers; t++) {
+    ACC_MAT_DESTROY(res->mem, &workers[t].x);
+    ACC_MAT_DESTROY(res->mem, &workers[t].y);
+    MAT_DESTROY(res->mem, &workers[t].state);
+  }
+  res->mem->memory_free(threads);
+  return ret;
+}
+
+// heap: sizeof(train_worker_t) * n_threads + _train_workers
+int train_parallel(reservoir_t *res, MAT_T *series, unsigned n_series, unsigned washout, unsigned n_threads) {
+  if(res->external_weights || n_threads == 0) {
+    return -1;
+  }
+  // a thread without a series would only add an empty partial
+  if(n_threads > n_series && n_series > 0) {
+    n_threads = n_series;
+  }
+  train_worker_t *workers = res->mem->memory_alloc(sizeof(train_worker_t) * n_threads);
+  if(workers == NULL) {
+    return -1;
+  }
+  for(unsigned t = 0; t < n_threads; t++) {
+    workers[t].series = series;
+    workers[t].n_series = n_series;
+    workers[t].washout = washout;
+    workers[t].first = t;
+    workers[t].step = n_threads;
+    workers[t].init_state = NULL;
+  }
+  int ret = _train_workers(res, workers, n_threads, NULL);
+  res->mem->memory_free(workers);
+  return ret;
+}
+
+// chunk c covers rows [_chunk_start(c), _chunk_start(c + 1))
+static unsigned _chunk_start(MAT_T *data, unsigned n_chunks, unsigned c) {
+  return (unsigned) ((unsigned long long) data->n * c / n_chunks);
+}
+
+// at most one chunk per row, so no chunk is empty
+static unsigned _chunk_count(MAT_T *data, unsigned n_chunks) {
+  return n_chunks > data->n && data->n > 0 ? data->n : n_chunks;
+}
+
+// heap: (sizeof(train_worker_t) + sizeof(MAT_T)) * n_chunks + _train_workers
+int train_parallel_chunks(reservoir_t *res, MAT_T *data, unsigned n_chunks, unsigned overlap) {
+  if(res->external_weights || n_chunks == 0) {
+    return -1;
+  }
+  int ret = -1;
+  n_chunks = _chunk_count(data, n_chunks);
+  train_worker_t *workers = res->mem->memory_alloc(sizeof(train_worker_t) * n_chunks);
+  MAT_T *chunks = res->mem->memory_alloc(sizeof(MAT_T) * n_chunks);
+  if(workers == NULL || chunks == NULL) {
+    goto oom_fail;
+  }
+  for(unsigned c = 0; c < n_chunks; c++) {
+    unsigned start = _chunk_start(data, n_chunks, c);
+    unsigned end = _chunk_start(data, n_chunks, c + 1);
+    // the first chunk continues from the carried state, the others warm up from zeros
+    unsigned warmup = c == 0 ? 0 : (start < overlap ? start : overlap);
+    MAT_NEW(NULL, &chunks[c], end - start + warmup, data->m);
+    chunks[c].data = data->data + (size_t) data->m * (start - warmup);
+    workers[c].series = &chunks[c];
+    workers[c].n_series = 1;
+    workers[c].washout = warmup;
+    workers[c].first = 0;
+    workers[c].step = 1;
+    workers[c].init_state = c == 0 ? &res->res_nodes : NULL;
+  }
+  ret = _train_workers(res, workers, n_chunks, &res->res_nodes);
+oom_fail:
+  res->mem->memory_free(workers);
+  res->mem->memory_free(chunks);
+  return ret;
+}
+
+// heap: n_res_nodes * 2 (and what train_accumulate needs to advance the state)
+int train_chunk_divergence(reservoir_t *res, MAT_T *data, unsigned n_chunks, unsigned overlap, float *divergence) {
+  if(n_chunks == 0) {
+    return -1;
+  }
+  int ret = 0;
+  MAT_T seq, warm;
+  warm.data = NULL;
+  n_chunks = _chunk_count(data, n_chunks);
+  if(MAT_NEW(res->mem, &seq, 1, res->n_res_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  if(MAT_NEW(res->mem, &warm, 1, res->n_res_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  // the accumulators are not touched as everything is washout
+  MAT_COPY(&seq, &res->res_nodes);
+  *divergence = 0.0f;
+  for(unsigned c = 1; c < n_chunks; c++) {
+    unsigned prev = _chunk_start(data, n_chunks, c - 1);
+    unsigned start = _chunk_start(data, n_chunks, c);
+    unsigned from = start < overlap ? 0 : start - overlap;
+    if(_feed(res, &res->x, &res->y, &seq, data, prev, start, start - prev, NULL) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+    MAT_ZEROS(&warm);
+    if(_feed(res, &res->x, &res->y, &warm, data, from, start, start - from, NULL) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+    for(unsigned i = 0; i < res->n_res_nodes; i++) {
+      float d = fabsf(VAL_TO_F32(*MAT(seq, 0, i)) - VAL_TO_F32(*MAT(warm, 0, i)));
+      if(d > *divergence) {
+        *divergence = d;
+      }
+    }
+  }
+oom_fail:
+  MAT_DESTROY(res->mem, &seq);
+  MAT_DESTROY(res->mem, &warm);
+  return ret;
+}
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef APP_GENERIC_TRAIN_PARALLEL_H_
+#define APP_GENERIC_TRAIN_PARALLEL_H_
+
+#include "reservoir.h"
+
+#define TRAIN_PARALLEL_BATCH_SIZE 256
+
+// accumulates independent series into x and y of res on n_threads threads.
+// every series starts from a zero state and its first washout samples are not accumulated.
+// series are assigned round-robin, so the result does not depend on scheduling.
+// n_threads must be at least 1 and is capped at n_series.
+int train_parallel(reservoir_t *res, MAT_T *series, unsigned n_series, unsigned washout, unsigned n_threads);
+
+// collects one long series as n_chunks chunks on n_chunks threads. every chunk but the first is
+// started overlap samples early from a zero state, the overlap only warms up the state.
+// res_nodes is the initial state of the first chunk and is updated to the last state of the last chunk.
+// n_chunks must be at least 1 and is capped at the number of rows of data.
+int train_parallel_chunks(reservoir_t *res, MAT_T *data, unsigned n_chunks, unsigned overlap);
+// max abs difference between the warmed up and the sequential state at the chunk boundaries,
+// for tuning overlap. res_nodes, x and y are left untouched.
+int train_chunk_divergence(reservoir_t *res, MAT_T *data, unsigned n_chunks, unsigned overlap, float *divergence);
+
+#endif /* APP_GENERIC_TRAIN_PARALLEL_H_ */
@@ -0,0 +1,105 @@
+#include "reservoir.h"
+#if defined(INFERENCE_ONLY)
+const ACC_VAL_T __out_weights[] = {
+  0.177776873,
+  0.102482319,
+  -0.224706471,
+  0.326974034,
+  -2.1251893,
+  1.15114415,
+  0.315957367,
+  1.31630468,
+  0.22878015,
+  1.18110526,
+  -0.354612887,
+  0.559558153,
+  -1.87970209,
+  -0.185309291,
+  1.84083319,
+  1.35580945,
+  0.599296689,
+  -1.50851369,
+  0.178012967,
+  -0.105352283,
+  0.853442788,
+  1.98687029,
+  -2.58982325,
+  -0.734188557,
+  -3.30821967,
+  0.064414978,
+  -0.502613187,
+  0.466772974,
+  0.771190643,
+  2.16356039,
+  -0.289691269,
+  1.42985201,
+  0.0246630907,
+  -1.39556599,
+  -1.84954906,
+  -0.174923837,
+  0.252025247,
+  -0.522074819,
+  -0.481187344,
+  1.53350925,
+  -0.616613686,
+  1.08788288,
+  2.66345978,
+  -0.260156155,
+  0.26854372,
+  -0.387141347,
+  0.670891523,
+  -0.190547526,
+  -0.199619353,
+  -0.168231964,
+  0.0368179083,
+  -1.39552903,
+  0.364834428,
+  -0.0698699951,
+  0.00457453728,
+  -0.538052917,
+  1.09335482,
+  -0.363279104,
+  -1.70055151,
+  0.577476621,
+  2.37174964,
+  0.554565787,
+  -0.0689789653,
+  -0.0819094181,
+  -0.609327316,
+  -0.15696907,
+  -0.0556659102,
+  -1.22651637,
+  -0.141371131,
+  0.0417361259,
+  1.12141752,
+  1.0039444,
+  -1.4379828,
+  -0.649801612,
+  -1.07220197,
+  -0.626536369,
+  -0.167100728,
+  -1.0355891,
+  0.148042917,
+  0.837457657,
+  0.821142554,
+  -0.112774551,
+  1.2935437,
+  -0.0417156219,
+  1.19610333,
+  0.0583384037,
+  -0.0130939484,
+  -0.649444401,
+  -0.536419034,
+  0.186732054,
+  -0.605018616,
+  -0.818253994,
+  0.495678425,
+  -0.533395231,
+  0.648499727,
+  -1.17565238,
+  0.683813155,
+  -0.083974123,
+  1.1063484,
+  1.14099121
+};
+#endif
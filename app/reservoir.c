@@ -1,14 +1,46 @@
 #include "reservoir.h"
+#include "prof.h"
 
 #ifdef CONST_WEIGHTS
-extern const VAL_T __in_weights[];
-extern const VAL_T __res_weights[];
+#if defined(PRECISION_Q15)
+// stored transposed, so every column is one dot product
+#define __IN_WEIGHTS __in_weights_q15
+#define __RES_WEIGHTS __res_weights_q15
+#define CONST_WEIGHTS_T 1
+#elif defined(STORAGE_F16)
+#define __IN_WEIGHTS __in_weights_f16
+#define __RES_WEIGHTS __res_weights_f16
+#elif defined(STORAGE_BF16)
+#define __IN_WEIGHTS __in_weights_bf16
+#define __RES_WEIGHTS __res_weights_bf16
+#else
+#define __IN_WEIGHTS __in_weights
+#define __RES_WEIGHTS __res_weights
+#endif
+#ifndef CONST_WEIGHTS_T
+#define CONST_WEIGHTS_T 0
+#endif
+#if defined(SIGN_IN_WEIGHTS)
+extern const uint32_t __in_sign_weights[];
+#else
+extern const WVAL_T __IN_WEIGHTS[];
+#endif
+extern const WVAL_T __RES_WEIGHTS[];
+#if defined(INFERENCE_ONLY)
+extern const ACC_VAL_T __out_weights[];
+#endif
 #endif
 
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
 
+#if defined(SIGN_IN_WEIGHTS)
+#define IN_MAT_DESTROY(...) mat_sign_destroy(__VA_ARGS__)
+#else
+#define IN_MAT_DESTROY(...) WMAT_DESTROY(__VA_ARGS__)
+#endif
+
 #if defined(PRECISION_F32)
 static inline float activate(float a) {
   return tanhf(a);
@@ -17,109 +49,227 @@ static inline float activate(float a) {
 static inline double activate(double a) {
   return tanh(a);
 }
+#elif defined(PRECISION_Q15)
+static inline q15_t activate(q15_t a) {
+  return q15_tanh(a);
+}
 #endif
 
+#define IN_WEIGHTS_SCALE 0.1
+#define READOUT_RIDGE 0.1
+
+#if defined(PRECISION_F64)
+#define ACC_SQRT(V) sqrt(V)
+#else
+#define ACC_SQRT(V) sqrtf(V)
+#endif
+
+#ifndef CONST_WEIGHTS
 static void _init_in_weights(reservoir_t *res) {
+#if defined(SIGN_IN_WEIGHTS)
+  mat_sign_zeros(&res->in_weights);
+  for(unsigned n = 0; n < res->in_weights.n; n++) {
+    for(unsigned m = 0; m < res->in_weights.m; m++) {
+      if(RANDOM_NORMAL(0.0, 1.0) < 0.0) {
+        MAT_SIGN_SET(res->in_weights, n, m);
+      }
+    }
+  }
+#else
   for(unsigned n = 0; n < res->in_weights.n; n++) {
     for(unsigned m = 0; m < res->in_weights.m; m++) {
-      *_MAT(res->in_weights, n, m) = RANDOM_NORMAL(0.0, 1.0) < 0.0 ? -0.1 : 0.1;
+      *_MAT(res->in_weights, n, m) = WVAL_FROM(RANDOM_NORMAL(0.0, 1.0) < 0.0 ? -IN_WEIGHTS_SCALE : IN_WEIGHTS_SCALE);
     }
   }
+#endif
 }
 
-static void _init_res_weights(reservoir_t *res, MAT_T *temp1, MAT_T *temp2) {
-  MAT_RANDOM_NORMAL(&res->res_weights, 0.0, 1.0);
-  SPECTRAL_RADIUS_T spectral_radius = MAT_MAX_ABS_EIGENVAL(&res->res_weights, temp1, temp2, 100);
-  MAT_MUL(&res->res_weights, &res->res_weights, 1.0 / spectral_radius);
+static void _init_res_weights(reservoir_t *res, MAT_T *w, MAT_T *temp1, MAT_T *temp2) {
+  MAT_RANDOM_NORMAL(w, 0.0, 1.0);
+  SPECTRAL_RADIUS_T spectral_radius = MAT_MAX_ABS_EIGENVAL(w, temp1, temp2, 100);
+  MAT_MUL(w, w, 1.0 / spectral_radius);
 }
+#endif
 
+#ifndef INFERENCE_ONLY
 static void _init_xy(reservoir_t *res) {
-  MAT_ZEROS(&res->x);
-  MAT_ZEROS(&res->y);
+  ACC_MAT_ZEROS(&res->x);
+  ACC_MAT_ZEROS(&res->y);
+#if defined(READOUT_QR)
+  // R of the ridge rows sqrt(READOUT_RIDGE) I
+  for(unsigned i = 0; i < res->n_res_nodes; i++) {
+    *MAT(res->x, i, i) = ACC_SQRT((ACC_VAL_T) READOUT_RIDGE);
+  }
+#endif
+  res->n_samples = 0;
 }
+#endif
 
-int init(reservoir_t *res) {
+static int _new_weights(reservoir_t *res) {
+#if defined(SIGN_IN_WEIGHTS)
+  res->in_scale = IN_WEIGHTS_SCALE;
 #ifndef CONST_WEIGHTS
-  MAT_T temp1, temp2;
+  if(mat_sign_new(res->mem, &res->in_weights, res->n_in_nodes, res->n_res_nodes) < 0) {
+    return -1;
+  }
+#else
+  mat_sign_new(NULL, &res->in_weights, res->n_in_nodes, res->n_res_nodes);
+  res->in_weights.data = (uint32_t *) __in_sign_weights;
 #endif
+#else
 #ifndef CONST_WEIGHTS
-  if(MAT_NEW(res->mem, &res->in_weights, res->n_in_nodes, res->n_res_nodes) < 0) {
-    goto oom_fail;
+  if(WMAT_NEW(res->mem, &res->in_weights, res->n_in_nodes, res->n_res_nodes) < 0) {
+    return -1;
   }
 #else
-  MAT_NEW(NULL, &res->in_weights, res->n_in_nodes, res->n_res_nodes);
-  res->in_weights.data = (VAL_T *) __in_weights;
+  WMAT_NEW(NULL, &res->in_weights, res->n_in_nodes, res->n_res_nodes);
+  res->in_weights.data = (WVAL_T *) __IN_WEIGHTS;
+  res->in_weights.t = CONST_WEIGHTS_T;
+#endif
 #endif
-  if(MAT_NEW(res->mem, &res->res_nodes, 1, res->n_res_nodes) < 0) {
-    goto oom_fail;
-  }
 #ifndef CONST_WEIGHTS
-  if(MAT_NEW(res->mem, &res->res_weights, res->n_res_nodes, res->n_res_nodes) < 0) {
-    goto oom_fail;
+  if(WMAT_NEW(res->mem, &res->res_weights, res->n_res_nodes, res->n_res_nodes) < 0) {
+    return -1;
   }
 #else
-  MAT_NEW(NULL, &res->res_weights, res->n_res_nodes, res->n_res_nodes);
-  res->res_weights.data = (VAL_T *) __res_weights;
+  WMAT_NEW(NULL, &res->res_weights, res->n_res_nodes, res->n_res_nodes);
+  res->res_weights.data = (WVAL_T *) __RES_WEIGHTS;
+  res->res_weights.t = CONST_WEIGHTS_T;
 #endif
-  if(MAT_NEW(res->mem, &res->out_weights, res->n_res_nodes, res->n_out_nodes) < 0) {
-    goto oom_fail;
-  }
-  if(MAT_NEW(res->mem, &res->x, res->n_res_nodes, res->n_res_nodes) < 0) {
-    goto oom_fail;
-  }
-  if(MAT_NEW(res->mem, &res->y, res->n_res_nodes, res->n_in_nodes) < 0) {
-    goto oom_fail;
+#if !defined(INFERENCE_ONLY) || defined(ADAPT_ONLINE)
+  if(ACC_MAT_NEW(res->mem, &res->out_weights, res->n_res_nodes, res->n_out_nodes) < 0) {
+    return -1;
   }
+#if defined(INFERENCE_ONLY)
+  // adapt() updates them, so the trained out_weights leave flash
+  memcpy(res->out_weights.data, __out_weights, sizeof(ACC_VAL_T) * res->n_res_nodes * res->n_out_nodes);
+#endif
+#else
+  ACC_MAT_NEW(NULL, &res->out_weights, res->n_res_nodes, res->n_out_nodes);
+  res->out_weights.data = (ACC_VAL_T *) __out_weights;
+#endif
+  return 0;
+}
+
+static void _destroy_weights(reservoir_t *res) {
+#ifndef CONST_WEIGHTS
+  IN_MAT_DESTROY(res->mem, &res->in_weights);
+  WMAT_DESTROY(res->mem, &res->res_weights);
+#endif
+#if !defined(INFERENCE_ONLY) || defined(ADAPT_ONLINE)
+  ACC_MAT_DESTROY(res->mem, &res->out_weights);
+#endif
+}
+
+#ifndef INFERENCE_ONLY
+// needs x and y allocated as temporary buffers
+static void _init_weights(reservoir_t *res) {
+#ifndef CONST_WEIGHTS
+  MAT_T temp1, temp2;
+#endif
   srandom(0);
   // initialize in_weights
 #ifndef CONST_WEIGHTS
   _init_in_weights(res);
 #endif
-  // initialize res_nodes
-  MAT_ZEROS(&res->res_nodes);
   // initialize res_weights
 #ifndef CONST_WEIGHTS
+#if defined(STORAGE_F16) || defined(STORAGE_BF16)
+  // generate in compute precision with x as staging, then narrow to storage precision
+  MAT_NEW(NULL, &temp1, 1, res->n_res_nodes);
+  temp1.data = res->y.data;
+  MAT_NEW(NULL, &temp2, 1, res->n_res_nodes);
+  temp2.data = res->out_weights.data;
+  _init_res_weights(res, &res->x, &temp1, &temp2);
+  WMAT_STORE(&res->res_weights, &res->x);
+#else
   MAT_NEW(NULL, &temp1, 1, res->n_res_nodes);
   temp1.data = res->x.data;
   MAT_NEW(NULL, &temp2, 1, res->n_res_nodes);
   temp2.data = res->y.data;
-  _init_res_weights(res, &temp1, &temp2);
+  _init_res_weights(res, &res->res_weights, &temp1, &temp2);
+#endif
 #endif
   // out_weights
-  MAT_ZEROS(&res->out_weights);
+  ACC_MAT_ZEROS(&res->out_weights);
+}
+#endif
+
+int init(reservoir_t *res) {
+  if(!res->external_weights) {
+    if(_new_weights(res) < 0) {
+      goto oom_fail;
+    }
+  }
+  if(MAT_NEW(res->mem, &res->res_nodes, 1, res->n_res_nodes) < 0) {
+    goto oom_fail;
+  }
+#if defined(INFERENCE_ONLY)
+  if(MAT_NEW(res->mem, &res->scratch, 1, res->n_res_nodes) < 0) {
+    goto oom_fail;
+  }
+#else
+  // a loaded model cannot be trained, no x and y
+  if(res->external_weights) {
+    ACC_MAT_NEW(NULL, &res->x, res->n_res_nodes, res->n_res_nodes);
+    ACC_MAT_NEW(NULL, &res->y, res->n_res_nodes, res->n_out_nodes);
+    res->n_samples = 0;
+  } else {
+    if(ACC_MAT_NEW(res->mem, &res->x, res->n_res_nodes, res->n_res_nodes) < 0) {
+      goto oom_fail;
+    }
+    if(ACC_MAT_NEW(res->mem, &res->y, res->n_res_nodes, res->n_out_nodes) < 0) {
+      goto oom_fail;
+    }
+    _init_weights(res);
+  }
+#endif
+  // initialize res_nodes
+  MAT_ZEROS(&res->res_nodes);
+#ifndef INFERENCE_ONLY
   // x and y
-  _init_xy(res);
+  if(!res->external_weights) {
+    _init_xy(res);
+  }
+#endif
   return 0;
 oom_fail:
-#ifndef CONST_WEIGHTS
-  MAT_DESTROY(res->mem, &res->in_weights);
-#endif
+  if(!res->external_weights) {
+    _destroy_weights(res);
+  }
   MAT_DESTROY(res->mem, &res->res_nodes);
-#ifndef CONST_WEIGHTS
-  MAT_DESTROY(res->mem, &res->res_weights);
+#if defined(INFERENCE_ONLY)
+  MAT_DESTROY(res->mem, &res->scratch);
+#else
+  ACC_MAT_DESTROY(res->mem, &res->x);
+  ACC_MAT_DESTROY(res->mem, &res->y);
 #endif
-  MAT_DESTROY(res->mem, &res->out_weights);
-  MAT_DESTROY(res->mem, &res->x);
-  MAT_DESTROY(res->mem, &res->y);
   return -1;
 }
 
 void deinit(reservoir_t *res) {
-#ifndef CONST_WEIGHTS
-  MAT_DESTROY(res->mem, &res->in_weights);
-#endif
+  if(!res->external_weights) {
+    _destroy_weights(res);
+  }
   MAT_DESTROY(res->mem, &res->res_nodes);
-#ifndef CONST_WEIGHTS
-  MAT_DESTROY(res->mem, &res->res_weights);
+#if defined(INFERENCE_ONLY)
+  MAT_DESTROY(res->mem, &res->scratch);
+#else
+  ACC_MAT_DESTROY(res->mem, &res->x);
+  ACC_MAT_DESTROY(res->mem, &res->y);
 #endif
-  MAT_DESTROY(res->mem, &res->out_weights);
-  MAT_DESTROY(res->mem, &res->x);
-  MAT_DESTROY(res->mem, &res->y);
 }
 
+#ifndef INFERENCE_ONLY
+
 static void _get_next_node_state(reservoir_t *res, MAT_T *temp, MAT_T *next, MAT_T *curr, MAT_T *data) {
-  MAT_PRODUCT(next, data, &res->in_weights);
-  MAT_PRODUCT(temp, curr, &res->res_weights);
+  PROF_BEGIN(PROF_NODE_STATE);
+#if defined(SIGN_IN_WEIGHTS)
+  MAT_SIGN_PRODUCT(next, data, &res->in_weights, res->in_scale);
+#else
+  WMAT_PRODUCT(next, data, &res->in_weights);
+#endif
+  WMAT_PRODUCT(temp, curr, &res->res_weights);
   MAT_SUM(next, next, temp);
   MAT_MUL(next, next, res->leak_rate);
   MAT_MUL(temp, curr, 1.0 - res->leak_rate);
@@ -127,78 +277,281 @@ static void _get_next_node_state(reservoir_t *res, MAT_T *temp, MAT_T *next, MAT
   for(unsigned i = 0; i < next->m; i++) {
     *(next->data + i) = activate(*(next->data + i));
   }
+  PROF_END(PROF_NODE_STATE);
 }
 
-// heap: n_res_nodes * n_data + n_res_nodes * n_res_nodes + n_res_nodes * n_in_nodes
-int train_feed_data(reservoir_t *res, MAT_T *data) {
+// states row n + 1 is the state after data row n, row 0 holds the initial state
+static void _collect_states(reservoir_t *res, VAL_T *temp, MAT_T *states, MAT_T *data) {
+  MAT_T _curr, _next, _data, _temp;
+  MAT_NEW(NULL, &_curr, 1, res->n_res_nodes);
+  MAT_NEW(NULL, &_next, 1, res->n_res_nodes);
+  MAT_NEW(NULL, &_data, 1, res->n_in_nodes);
+  MAT_NEW(NULL, &_temp, 1, res->n_res_nodes);
+  _temp.data = temp;
+  for(unsigned n = 0; n < data->n; n++) {
+    _curr.data = states->data + res->n_res_nodes * n;
+    _next.data = states->data + res->n_res_nodes * (n + 1);
+    _data.data = data->data + n * res->n_in_nodes;
+    _get_next_node_state(res, &_temp, &_next, &_curr, &_data);
+  }
+}
+
+// heap: n_res_nodes
+int train_collect_states(reservoir_t *res, MAT_T *states, MAT_T *state, MAT_T *data) {
+  MAT_T temp;
+  if(MAT_NEW(res->mem, &temp, 1, res->n_res_nodes) < 0) {
+    return -1;
+  }
+  memcpy(states->data, state->data, sizeof(VAL_T) * res->n_res_nodes);
+  _collect_states(res, temp.data, states, data);
+  memcpy(state->data, states->data + res->n_res_nodes * data->n, sizeof(VAL_T) * res->n_res_nodes);
+  MAT_DESTROY(res->mem, &temp);
+  return 0;
+}
+
+#if defined(READOUT_QR)
+// givens rotations of the row (a, b) into the upper triangular r and z, a and b are destroyed
+static void _qr_fold_row(ACC_MAT_T *r, ACC_MAT_T *z, ACC_VAL_T *a, ACC_VAL_T *b) {
+  for(unsigned i = 0; i < r->n; i++) {
+    if(a[i] == 0) {
+      continue;
+    }
+    ACC_VAL_T r_ii = *MAT(*r, i, i);
+    ACC_VAL_T rho = ACC_SQRT(r_ii * r_ii + a[i] * a[i]);
+    ACC_VAL_T c = r_ii / rho;
+    ACC_VAL_T s = a[i] / rho;
+    *MAT(*r, i, i) = rho;
+    for(unsigned j = i + 1; j < r->m; j++) {
+      ACC_VAL_T r_ij = *MAT(*r, i, j);
+      *MAT(*r, i, j) = c * r_ij + s * a[j];
+      a[j] = c * a[j] - s * r_ij;
+    }
+    for(unsigned k = 0; k < z->m; k++) {
+      ACC_VAL_T z_ik = *MAT(*z, i, k);
+      *MAT(*z, i, k) = c * z_ik + s * b[k];
+      b[k] = c * b[k] - s * z_ik;
+    }
+  }
+}
+
+// heap: n_res_nodes + n_out_nodes
+int train_fold(reservoir_t *res, ACC_MAT_T *acc_x, ACC_MAT_T *acc_y, ACC_MAT_T *states, ACC_MAT_T *targets) {
+  ACC_MAT_T row;
+  if(ACC_MAT_NEW(res->mem, &row, 1, res->n_res_nodes + res->n_out_nodes) < 0) {
+    return -1;
+  }
+  PROF_BEGIN(PROF_GRAM);
+  ACC_VAL_T *a = row.data, *b = row.data + res->n_res_nodes;
+  for(unsigned n = 0; n < states->n; n++) {
+    for(unsigned m = 0; m < res->n_res_nodes; m++) {
+      a[m] = *MAT(*states, n, m);
+    }
+    for(unsigned k = 0; k < res->n_out_nodes; k++) {
+      b[k] = *MAT(*targets, n, k);
+    }
+    _qr_fold_row(acc_x, acc_y, a, b);
+  }
+  PROF_END(PROF_GRAM);
+  ACC_MAT_DESTROY(res->mem, &row);
+  return 0;
+}
+
+// stacks the rows of the partial factor under x (TSQR merge)
+// heap: n_res_nodes + n_out_nodes
+int train_merge(reservoir_t *res, ACC_MAT_T *acc_x, ACC_MAT_T *acc_y, ACC_MAT_T *part_x, ACC_MAT_T *part_y) {
+  ACC_MAT_T row;
+  if(ACC_MAT_NEW(res->mem, &row, 1, res->n_res_nodes + res->n_out_nodes) < 0) {
+    return -1;
+  }
+  ACC_VAL_T *a = row.data, *b = row.data + res->n_res_nodes;
+  for(unsigned n = 0; n < res->n_res_nodes; n++) {
+    for(unsigned m = 0; m < res->n_res_nodes; m++) {
+      a[m] = *MAT(*part_x, n, m);
+    }
+    for(unsigned k = 0; k < res->n_out_nodes; k++) {
+      b[k] = *MAT(*part_y, n, k);
+    }
+    _qr_fold_row(acc_x, acc_y, a, b);
+  }
+  ACC_MAT_DESTROY(res->mem, &row);
+  return 0;
+}
+#else
+// heap: n_res_nodes * n + n_res_nodes * n_res_nodes + n_res_nodes * n_out_nodes
+int train_fold(reservoir_t *res, ACC_MAT_T *acc_x, ACC_MAT_T *acc_y, ACC_MAT_T *states, ACC_MAT_T *targets) {
   int ret = 0;
-  MAT_T res_nodes, res_nodes_t, x, y;
-  if(MAT_NEW(res->mem, &res_nodes, data->n + 1, res->n_res_nodes) < 0) {
+  PROF_BEGIN(PROF_GRAM);
+  ACC_MAT_T states_t, x, y;
+  states_t.data = NULL;
+  x.data = NULL;
+  y.data = NULL;
+  if(ACC_MAT_NEW(res->mem, &states_t, res->n_res_nodes, states->n) < 0) {
     ret = -1;
     goto oom_fail;
   }
-  if(MAT_NEW(res->mem, &res_nodes_t, res->n_res_nodes, data->n) < 0) {
+  if(ACC_MAT_NEW(res->mem, &x, res->n_res_nodes, res->n_res_nodes) < 0) {
     ret = -1;
     goto oom_fail;
   }
-  if(MAT_NEW(res->mem, &x, res->n_res_nodes, res->n_res_nodes) < 0) {
+  if(ACC_MAT_NEW(res->mem, &y, res->n_res_nodes, res->n_out_nodes) < 0) {
     ret = -1;
     goto oom_fail;
   }
-  if(MAT_NEW(res->mem, &y, res->n_res_nodes, res->n_in_nodes) < 0) {
+  // update (X X_T) as x = (X_T X) in case of column major
+  ACC_MAT_TRANS(&states_t, states);
+  ACC_MAT_PRODUCT(&x, &states_t, states);
+  ACC_MAT_SUM(acc_x, acc_x, &x);
+  // update (Y_TARGET X_T) as y = (X_T Y_TARGET) in case of column major
+  ACC_MAT_PRODUCT(&y, &states_t, targets);
+  ACC_MAT_SUM(acc_y, acc_y, &y);
+  PROF_END(PROF_GRAM);
+oom_fail:
+  ACC_MAT_DESTROY(res->mem, &states_t);
+  ACC_MAT_DESTROY(res->mem, &x);
+  ACC_MAT_DESTROY(res->mem, &y);
+  return ret;
+}
+
+int train_merge(reservoir_t *res, ACC_MAT_T *acc_x, ACC_MAT_T *acc_y, ACC_MAT_T *part_x, ACC_MAT_T *part_y) {
+  ACC_MAT_SUM(acc_x, acc_x, part_x);
+  ACC_MAT_SUM(acc_y, acc_y, part_y);
+  return 0;
+}
+#endif
+
+// heap: n_res_nodes * (n_data + 1) + train_fold
+// heap: + (n_res_nodes + n_out_nodes) * n_data (PRECISION_Q15, f32 copies for accumulation)
+int train_accumulate(reservoir_t *res, ACC_MAT_T *acc_x, ACC_MAT_T *acc_y, MAT_T *state, MAT_T *data, MAT_T *target, unsigned washout) {
+  int ret = 0;
+  unsigned n_acc = data->n > washout ? data->n - washout : 0;
+  if(target == NULL) {
+    // one step ahead self-prediction
+    if(res->n_out_nodes != res->n_in_nodes) {
+      return -1;
+    }
+    target = data;
+  }
+  MAT_T res_nodes, temp;
+  ACC_MAT_T states, targets;
+  temp.data = NULL;
+#if defined(PRECISION_Q15)
+  states.data = NULL;
+  targets.data = NULL;
+#endif
+  if(MAT_NEW(res->mem, &res_nodes, data->n + 1, res->n_res_nodes) < 0) {
+    ret = -1;
+    goto oom_fail;
+  }
+  if(MAT_NEW(res->mem, &temp, 1, res->n_res_nodes) < 0) {
     ret = -1;
     goto oom_fail;
   }
-  // copy last res_nodes to initial res_nodes for training
-  memcpy(res_nodes.data, res->res_nodes.data, sizeof(VAL_T) * res->n_res_nodes);
+  if(n_acc) {
+#if defined(PRECISION_Q15)
+    if(ACC_MAT_NEW(res->mem, &states, n_acc, res->n_res_nodes) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+    if(ACC_MAT_NEW(res->mem, &targets, n_acc, res->n_out_nodes) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
+#endif
+  }
+  // copy last state to initial res_nodes for training
+  memcpy(res_nodes.data, state->data, sizeof(VAL_T) * res->n_res_nodes);
   // update res_nodes with given data for length of given data times
-  MAT_T _curr, _next, _data, _temp;
-  MAT_NEW(NULL, &_curr, 1, res->n_res_nodes);
-  MAT_NEW(NULL, &_next, 1, res->n_res_nodes);
-  MAT_NEW(NULL, &_data, 1, res->n_in_nodes);
-  MAT_NEW(NULL, &_temp, 1, res->n_res_nodes);
-  _temp.data = x.data;
-  for(unsigned n = 0; n < data->n; n++) {
-    _curr.data = res_nodes.data + res->n_res_nodes * n;
-    _next.data = res_nodes.data + res->n_res_nodes * (n + 1);
-    _data.data = data->data + n * res->n_in_nodes;
-    _get_next_node_state(res, &_temp, &_next, &_curr, &_data);
+  _collect_states(res, temp.data, &res_nodes, data);
+  if(n_acc) {
+    // skip washout and fast forward one
+    MAT_T _states, _targets;
+    MAT_NEW(NULL, &_states, n_acc, res->n_res_nodes);
+    _states.data = res_nodes.data + res->n_res_nodes * (washout + 1);
+    MAT_NEW(NULL, &_targets, n_acc, res->n_out_nodes);
+    _targets.data = target->data + res->n_out_nodes * washout;
+#if defined(PRECISION_Q15)
+    // accumulate in f32
+    ACC_FROM_MAT(&states, &_states);
+    ACC_FROM_MAT(&targets, &_targets);
+#else
+    states = _states;
+    targets = _targets;
+#endif
+    if(train_fold(res, acc_x, acc_y, &states, &targets) < 0) {
+      ret = -1;
+      goto oom_fail;
+    }
   }
-  // fast forward one
-  res_nodes.data += res->n_res_nodes;
-  res_nodes.n -= 1;
-  // update (X X_T) as x = (X_T X) in case of column major
-  MAT_TRANS(&res_nodes_t, &res_nodes);
-  MAT_PRODUCT(&x, &res_nodes_t, &res_nodes);
-  MAT_SUM(&res->x, &res->x, &x);
-  // update (Y_TARGET X_T) as y = (X_T Y_TARGET) in case of column major
-  MAT_PRODUCT(&y, &res_nodes_t, data);
-  MAT_SUM(&res->y, &res->y, &y);
-  // rewind one
-  res_nodes.data -= res->n_res_nodes;
-  res_nodes.n += 1;
-  // copy back last res_nodes
-  memcpy(res->res_nodes.data, res_nodes.data + res->n_res_nodes * data->n, sizeof(VAL_T) * res->n_res_nodes);
+  // copy back last state
+  memcpy(state->data, res_nodes.data + res->n_res_nodes * data->n, sizeof(VAL_T) * res->n_res_nodes);
 oom_fail:
   MAT_DESTROY(res->mem, &res_nodes);
-  MAT_DESTROY(res->mem, &res_nodes_t);
-  MAT_DESTROY(res->mem, &x);
-  MAT_DESTROY(res->mem, &y);
+  MAT_DESTROY(res->mem, &temp);
+#if defined(PRECISION_Q15)
+  ACC_MAT_DESTROY(res->mem, &states);
+  ACC_MAT_DESTROY(res->mem, &targets);
+#endif
   return ret;
 }
 
+int train_feed_data(reservoir_t *res, MAT_T *data) {
+  if(res->external_weights) {
+    return -1;
+  }
+  if(train_accumulate(res, &res->x, &res->y, &res->res_nodes, data, NULL, 0) < 0) {
+    return -1;
+  }
+  res->n_samples += data->n;
+  return 0;
+}
+
+int train_feed_target(reservoir_t *res, MAT_T *data, MAT_T *target) {
+  if(res->external_weights) {
+    return -1;
+  }
+  if(train_accumulate(res, &res->x, &res->y, &res->res_nodes, data, target, 0) < 0) {
+    return -1;
+  }
+  res->n_samples += data->n;
+  return 0;
+}
+
+#if defined(READOUT_QR)
+// back substitution of R out_weights = Q_T Y_TARGET
+int train_compute_weight(reservoir_t *res, unsigned reset) {
+  if(res->external_weights) {
+    return -1;
+  }
+  for(unsigned k = 0; k < res->n_out_nodes; k++) {
+    for(unsigned n = res->n_res_nodes; n-- > 0;) {
+      ACC_VAL_T sum = *MAT(res->y, n, k);
+      for(unsigned m = n + 1; m < res->n_res_nodes; m++) {
+        sum -= *MAT(res->x, n, m) * *MAT(res->out_weights, m, k);
+      }
+      *MAT(res->out_weights, n, k) = sum / *MAT(res->x, n, n);
+    }
+  }
+  if(reset) {
+    _init_xy(res);
+  }
+  return 0;
+}
+#else
 // heap: n_res_nodes * n_res_nodes * 1 (reset x and y)
 // heap: n_res_nodes * n_res_nodes * 2 (do not reset x and y)
 int train_compute_weight(reservoir_t *res, unsigned reset) {
+  if(res->external_weights) {
+    return -1;
+  }
   int ret = 0;
-  MAT_T x, inv_x;
+  ACC_MAT_T x, inv_x;
   if(!reset) {
-    if(MAT_NEW(res->mem, &x, res->n_res_nodes, res->n_res_nodes) < 0) {
+    if(ACC_MAT_NEW(res->mem, &x, res->n_res_nodes, res->n_res_nodes) < 0) {
       ret = -1;
       goto oom_fail;
     }
   }
-  if(MAT_NEW(res->mem, &inv_x, res->n_res_nodes, res->n_res_nodes) < 0) {
+  if(ACC_MAT_NEW(res->mem, &inv_x, res->n_res_nodes, res->n_res_nodes) < 0) {
     ret = -1;
     goto oom_fail;
   }
@@ -208,25 +561,293 @@ int train_compute_weight(reservoir_t *res, unsigned reset) {
       for(unsigned m = 0; m < x.m; m++) {
         *_MAT(x, n, m) = *_MAT(res->x, n, m);
         if(n == m) {
-          *_MAT(x, n, m) += 0.1;
+          *_MAT(x, n, m) += READOUT_RIDGE;
         }
       }
     }
-    MAT_INV(&inv_x, &x);
+    PROF_BEGIN(PROF_INVERSE);
+    ACC_MAT_INV(&inv_x, &x);
+    PROF_END(PROF_INVERSE);
   } else {
     for(unsigned i = 0; i < res->x.n; i++) {
-      *_MAT(res->x, i, i) += 0.1;
+      *_MAT(res->x, i, i) += READOUT_RIDGE;
     }
-    MAT_INV(&inv_x, &res->x);
+    PROF_BEGIN(PROF_INVERSE);
+    ACC_MAT_INV(&inv_x, &res->x);
+    PROF_END(PROF_INVERSE);
   }
-  MAT_PRODUCT(&res->out_weights, &inv_x, &res->y);
+  ACC_MAT_PRODUCT(&res->out_weights, &inv_x, &res->y);
 oom_fail:
   if(!reset) {
-    MAT_DESTROY(res->mem, &x);
+    ACC_MAT_DESTROY(res->mem, &x);
   } else {
     _init_xy(res);
   }
-  MAT_DESTROY(res->mem, &inv_x);
+  ACC_MAT_DESTROY(res->mem, &inv_x);
+  return ret;
+}
+#endif
+
+#define TRAIN_JOB_COPY 0
+#define TRAIN_JOB_FORWARD 1
+#define TRAIN_JOB_BACK 2
+#define TRAIN_JOB_DONE 3
+
+int train_job_start(reservoir_t *res, train_job_t *job, unsigned reset) {
+  // out_weights are replaced by the job's matrix at the end
+  if(res->external_weights) {
+    return -1;
+  }
+  job->phase = TRAIN_JOB_COPY;
+  job->pivot = 0;
+  job->row = 0;
+  job->reset = reset;
+  job->w.data = NULL;
+  if(reset) {
+    job->a = res->x;
+  } else if(ACC_MAT_NEW(res->mem, &job->a, res->n_res_nodes, res->n_res_nodes) < 0) {
+    return -1;
+  }
+  if(ACC_MAT_NEW(res->mem, &job->w, res->n_res_nodes, res->n_out_nodes) < 0) {
+    if(!reset) {
+      ACC_MAT_DESTROY(res->mem, &job->a);
+    }
+    return -1;
+  }
+  return 0;
+}
+
+// a = x (+ READOUT_RIDGE I), w = y, row n
+static void _job_copy_row(reservoir_t *res, train_job_t *job, unsigned n) {
+  if(!job->reset) {
+    for(unsigned m = 0; m < res->n_res_nodes; m++) {
+      *_MAT(job->a, n, m) = *MAT(res->x, n, m);
+    }
+  }
+#if !defined(READOUT_QR)
+  *_MAT(job->a, n, n) += (ACC_VAL_T) READOUT_RIDGE;
+#endif
+  for(unsigned k = 0; k < res->n_out_nodes; k++) {
+    *_MAT(job->w, n, k) = *MAT(res->y, n, k);
+  }
+}
+
+// eliminate column p from row n, a is symmetric positive definite so no pivoting is needed
+static void _job_eliminate_row(reservoir_t *res, train_job_t *job, unsigned p, unsigned n) {
+  ACC_VAL_T f = *_MAT(job->a, n, p) / *_MAT(job->a, p, p);
+  for(unsigned m = p + 1; m < res->n_res_nodes; m++) {
+    *_MAT(job->a, n, m) -= f * *_MAT(job->a, p, m);
+  }
+  for(unsigned k = 0; k < res->n_out_nodes; k++) {
+    *_MAT(job->w, n, k) -= f * *_MAT(job->w, p, k);
+  }
+}
+
+// back substitution of row n of the upper triangle of a
+static void _job_back_row(reservoir_t *res, train_job_t *job, unsigned n) {
+  for(unsigned k = 0; k < res->n_out_nodes; k++) {
+    ACC_VAL_T sum = *_MAT(job->w, n, k);
+    for(unsigned m = n + 1; m < res->n_res_nodes; m++) {
+      sum -= *_MAT(job->a, n, m) * *_MAT(job->w, m, k);
+    }
+    *_MAT(job->w, n, k) = sum / *_MAT(job->a, n, n);
+  }
+}
+
+// next elimination row starting at pivot p, back substitution once no rows are left
+static void _job_next_pivot(reservoir_t *res, train_job_t *job, unsigned p) {
+  job->pivot = p;
+  job->row = p + 1;
+  job->phase = TRAIN_JOB_FORWARD;
+#if defined(READOUT_QR)
+  // x is already the triangular R
+  job->row = res->n_res_nodes;
+#endif
+  if(job->row >= res->n_res_nodes) {
+    job->phase = TRAIN_JOB_BACK;
+    job->row = res->n_res_nodes;
+  }
+}
+
+int train_job_step(reservoir_t *res, train_job_t *job, unsigned max_rows) {
+  PROF_BEGIN(PROF_SOLVE_STEP);
+  for(unsigned i = 0; i < max_rows && job->phase != TRAIN_JOB_DONE; i++) {
+    switch(job->phase) {
+    case TRAIN_JOB_COPY:
+      _job_copy_row(res, job, job->row);
+      if(++job->row == res->n_res_nodes) {
+        _job_next_pivot(res, job, 0);
+      }
+      break;
+    case TRAIN_JOB_FORWARD:
+      _job_eliminate_row(res, job, job->pivot, job->row);
+      if(++job->row == res->n_res_nodes) {
+        _job_next_pivot(res, job, job->pivot + 1);
+      }
+      break;
+    case TRAIN_JOB_BACK:
+      _job_back_row(res, job, --job->row);
+      if(job->row == 0) {
+        // a single pointer store, predict sees either the old or the new weights
+        ACC_VAL_T *old = res->out_weights.data;
+        res->out_weights.data = job->w.data;
+        job->w.data = old;
+        train_job_cancel(res, job);
+      }
+      break;
+    }
+  }
+  PROF_END(PROF_SOLVE_STEP);
+  return job->phase == TRAIN_JOB_DONE;
+}
+
+void train_job_cancel(reservoir_t *res, train_job_t *job) {
+  if(job->phase == TRAIN_JOB_DONE) {
+    return;
+  }
+  ACC_MAT_DESTROY(res->mem, &job->w);
+  if(job->reset) {
+    _init_xy(res);
+  } else {
+    ACC_MAT_DESTROY(res->mem, &job->a);
+  }
+  job->phase = TRAIN_JOB_DONE;
+}
+
+// clear accumulated x and y and the carried res_nodes, weights are kept
+void train_reset(reservoir_t *res) {
+  MAT_ZEROS(&res->res_nodes);
+  if(!res->external_weights) {
+    _init_xy(res);
+  }
+}
+
+#if defined(READOUT_QR)
+// dst = R_T R src = (X_T X + READOUT_RIDGE I) src
+static void _ridge_product(reservoir_t *res, ACC_VAL_T *dst, ACC_VAL_T *src, ACC_VAL_T *temp) {
+  for(unsigned n = 0; n < res->n_res_nodes; n++) {
+    ACC_VAL_T sum = 0;
+    for(unsigned m = n; m < res->n_res_nodes; m++) {
+      sum += *MAT(res->x, n, m) * src[m];
+    }
+    temp[n] = sum;
+  }
+  for(unsigned n = 0; n < res->n_res_nodes; n++) {
+    ACC_VAL_T sum = 0;
+    for(unsigned m = 0; m <= n; m++) {
+      sum += *MAT(res->x, m, n) * temp[m];
+    }
+    dst[n] = sum;
+  }
+}
+
+static ACC_VAL_T _ridge_diag(reservoir_t *res, unsigned n) {
+  ACC_VAL_T sum = 0;
+  for(unsigned m = 0; m <= n; m++) {
+    sum += *MAT(res->x, m, n) * *MAT(res->x, m, n);
+  }
+  return sum;
+}
+
+// X_T Y_TARGET = R_T Q_T Y_TARGET
+static ACC_VAL_T _ridge_rhs(reservoir_t *res, unsigned n, unsigned k) {
+  ACC_VAL_T sum = 0;
+  for(unsigned m = 0; m <= n; m++) {
+    sum += *MAT(res->x, m, n) * *MAT(res->y, m, k);
+  }
+  return sum;
+}
+#else
+// dst = (x + READOUT_RIDGE I) src
+static void _ridge_product(reservoir_t *res, ACC_VAL_T *dst, ACC_VAL_T *src, ACC_VAL_T *temp) {
+  for(unsigned n = 0; n < res->n_res_nodes; n++) {
+    ACC_VAL_T sum = (ACC_VAL_T) READOUT_RIDGE * src[n];
+    for(unsigned m = 0; m < res->n_res_nodes; m++) {
+      sum += *MAT(res->x, n, m) * src[m];
+    }
+    dst[n] = sum;
+  }
+}
+
+static ACC_VAL_T _ridge_diag(reservoir_t *res, unsigned n) {
+  return *MAT(res->x, n, n) + (ACC_VAL_T) READOUT_RIDGE;
+}
+
+static ACC_VAL_T _ridge_rhs(reservoir_t *res, unsigned n, unsigned k) {
+  return *MAT(res->y, n, k);
+}
+#endif
+
+static ACC_VAL_T _dot(ACC_VAL_T *a, ACC_VAL_T *b, unsigned n) {
+  ACC_VAL_T sum = 0;
+  for(unsigned i = 0; i < n; i++) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+// jacobi preconditioned conjugate gradient on (X_T X + READOUT_RIDGE I) out_weights = X_T Y_TARGET,
+// starting from the current out_weights. stops at ||r|| <= tol ||X_T Y_TARGET|| or max_iter iterations
+// per column. returns the largest number of iterations used by a column.
+// heap: n_res_nodes * 6
+int train_compute_weight_cg(reservoir_t *res, unsigned reset, unsigned max_iter, float tol) {
+  if(res->external_weights) {
+    return -1;
+  }
+  int ret = 0;
+  unsigned n_res = res->n_res_nodes;
+  ACC_MAT_T v;
+  if(ACC_MAT_NEW(res->mem, &v, 6, n_res) < 0) {
+    return -1;
+  }
+  // b = X_T Y_TARGET is formed on the fly and z = M^-1 r is folded into its users
+  ACC_VAL_T *w = v.data, *r = w + n_res, *p = r + n_res, *q = p + n_res;
+  ACC_VAL_T *d = q + n_res, *temp = d + n_res;
+  for(unsigned n = 0; n < n_res; n++) {
+    d[n] = _ridge_diag(res, n);
+  }
+  for(unsigned k = 0; k < res->n_out_nodes; k++) {
+    unsigned i;
+    for(unsigned n = 0; n < n_res; n++) {
+      w[n] = *MAT(res->out_weights, n, k);
+    }
+    // r = b - A w, p = z = M^-1 r
+    _ridge_product(res, q, w, temp);
+    ACC_VAL_T bb = 0, rz = 0;
+    for(unsigned n = 0; n < n_res; n++) {
+      ACC_VAL_T b = _ridge_rhs(res, n, k);
+      bb += b * b;
+      r[n] = b - q[n];
+      p[n] = r[n] / d[n];
+      rz += r[n] * p[n];
+    }
+    ACC_VAL_T limit = tol * tol * bb;
+    for(i = 0; i < max_iter && _dot(r, r, n_res) > limit; i++) {
+      _ridge_product(res, q, p, temp);
+      ACC_VAL_T alpha = rz / _dot(p, q, n_res);
+      ACC_VAL_T rz_next = 0;
+      for(unsigned n = 0; n < n_res; n++) {
+        w[n] += alpha * p[n];
+        r[n] -= alpha * q[n];
+        rz_next += r[n] * (r[n] / d[n]);
+      }
+      ACC_VAL_T beta = rz_next / rz;
+      rz = rz_next;
+      for(unsigned n = 0; n < n_res; n++) {
+        p[n] = r[n] / d[n] + beta * p[n];
+      }
+    }
+    for(unsigned n = 0; n < n_res; n++) {
+      *MAT(res->out_weights, n, k) = w[n];
+    }
+    if((int) i > ret) {
+      ret = i;
+    }
+  }
+  if(reset) {
+    _init_xy(res);
+  }
+  ACC_MAT_DESTROY(res->mem, &v);
   return ret;
 }
 
@@ -239,10 +860,48 @@ int train(reservoir_t *res, MAT_T *data, unsigned reset) {
   }
   return 0;
 }
+#endif
+
+#if defined(INFERENCE_ONLY)
+#if defined(PRECISION_Q15)
+// acc + d w with rounding and saturation
+static inline q15_t _in_mac(q15_t acc, q15_t d, q15_t w) {
+  q31_t v = acc + (((q31_t) d * w + 0x4000) >> 15);
+  return v > 0x7fff ? 0x7fff : v < -0x8000 ? -0x8000 : (q15_t) v;
+}
+#define IN_MAC(ACC, RES, D, N, M) _in_mac(ACC, D, *MAT((RES)->in_weights, N, M))
+#else
+#define IN_MAC(ACC, RES, D, N, M) ((ACC) + (D) * IN_WEIGHT(RES, N, M))
+#endif
 
+// updates res_nodes in place with scratch as the only buffer, no heap
+int predict(reservoir_t *res, MAT_T *predicted, MAT_T *data) {
+  PROF_BEGIN(PROF_PREDICT);
+  PROF_BEGIN(PROF_NODE_STATE);
+  WMAT_PRODUCT(&res->scratch, &res->res_nodes, &res->res_weights);
+  for(unsigned m = 0; m < res->n_res_nodes; m++) {
+    for(unsigned n = 0; n < res->n_in_nodes; n++) {
+      *MAT(res->scratch, 0, m) = IN_MAC(*MAT(res->scratch, 0, m), res, *MAT(*data, 0, n), n, m);
+    }
+  }
+  MAT_MUL(&res->scratch, &res->scratch, res->leak_rate);
+  MAT_MUL(&res->res_nodes, &res->res_nodes, 1.0 - res->leak_rate);
+  MAT_SUM(&res->res_nodes, &res->scratch, &res->res_nodes);
+  for(unsigned i = 0; i < res->n_res_nodes; i++) {
+    *(res->res_nodes.data + i) = activate(*(res->res_nodes.data + i));
+  }
+  PROF_END(PROF_NODE_STATE);
+  PROF_BEGIN(PROF_READOUT);
+  READOUT_PRODUCT(predicted, &res->res_nodes, &res->out_weights);
+  PROF_END(PROF_READOUT);
+  PROF_END(PROF_PREDICT);
+  return 0;
+}
+#else
 // heap: n_res_nodes + n_res_nodes
 int predict(reservoir_t *res, MAT_T *predicted, MAT_T *data) {
   int ret = 0;
+  PROF_BEGIN(PROF_PREDICT);
   MAT_T next, temp;
   if(MAT_NEW(res->mem, &next, 1, res->n_res_nodes) < 0) {
     ret = -1;
@@ -254,9 +913,43 @@ int predict(reservoir_t *res, MAT_T *predicted, MAT_T *data) {
   }
   _get_next_node_state(res, &temp, &next, &res->res_nodes, data);
   MAT_COPY(&res->res_nodes, &next);
-  MAT_PRODUCT(predicted, &res->res_nodes, &res->out_weights);
+  PROF_BEGIN(PROF_READOUT);
+  READOUT_PRODUCT(predicted, &res->res_nodes, &res->out_weights);
+  PROF_END(PROF_READOUT);
+  PROF_END(PROF_PREDICT);
 oom_fail:
   MAT_DESTROY(res->mem, &next);
   MAT_DESTROY(res->mem, &temp);
   return ret;
 }
+#endif
+
+#if !defined(INFERENCE_ONLY) || defined(ADAPT_ONLINE)
+#define ADAPT_EPSILON 1e-6f
+
+int adapt(reservoir_t *res, MAT_T *target) {
+  if(res->external_weights) {
+    return -1;
+  }
+  if(!res->adapt_enable) {
+    return 0;
+  }
+  float power = ADAPT_EPSILON;
+  for(unsigned n = 0; n < res->n_res_nodes; n++) {
+    float s = VAL_TO_F32(*MAT(res->res_nodes, 0, n));
+    power += s * s;
+  }
+  for(unsigned k = 0; k < res->n_out_nodes; k++) {
+    // error of the current readout
+    float e = VAL_TO_F32(*MAT(*target, 0, k));
+    for(unsigned n = 0; n < res->n_res_nodes; n++) {
+      e -= VAL_TO_F32(*MAT(res->res_nodes, 0, n)) * *MAT(res->out_weights, n, k);
+    }
+    float g = res->adapt_step * e / power;
+    for(unsigned n = 0; n < res->n_res_nodes; n++) {
+      *MAT(res->out_weights, n, k) += g * VAL_TO_F32(*MAT(res->res_nodes, 0, n));
+    }
+  }
+  return 0;
+}
+#endif
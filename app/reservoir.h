@@ -11,10 +11,76 @@
 #define VAL_T f64_t
 #define MAT_T mat_f64_t
 #define SPECTRAL_RADIUS_T double
+#elif defined(PRECISION_Q15)
+#define VAL_T q15_t
+#define MAT_T mat_q15_t
+#define SPECTRAL_RADIUS_T float
+#if !defined(CONST_WEIGHTS)
+#error "PRECISION_Q15 requires CONST_WEIGHTS"
+#endif
+#if defined(SIGN_IN_WEIGHTS) || defined(STORAGE_F16) || defined(STORAGE_BF16)
+#error "PRECISION_Q15 stores weights in q15"
+#endif
 #else
 #error
 #endif
 
+// inference only: weights including out_weights come from flash, no training buffers.
+// ADAPT_ONLINE keeps adapt(), out_weights are then copied from flash to the heap at init
+#if defined(INFERENCE_ONLY) && !defined(CONST_WEIGHTS)
+#error "INFERENCE_ONLY requires CONST_WEIGHTS"
+#endif
+
+#if defined(PRECISION_Q15)
+#define VAL_TO_F32(V) ((float) (V) / 32768.0f)
+#else
+#define VAL_TO_F32(V) (V)
+#endif
+
+// training accumulators and out_weights are kept in compute precision unless the backend overrides them
+#if !defined(ACC_MAT_T)
+#define ACC_VAL_T VAL_T
+#define ACC_MAT_T MAT_T
+#define ACC_MAT_NEW(...) MAT_NEW(__VA_ARGS__)
+#define ACC_MAT_DESTROY(...) MAT_DESTROY(__VA_ARGS__)
+#define ACC_MAT_COPY(...) MAT_COPY(__VA_ARGS__)
+#define ACC_MAT_ZEROS(...) MAT_ZEROS(__VA_ARGS__)
+#define ACC_MAT_TRANS(...) MAT_TRANS(__VA_ARGS__)
+#define ACC_MAT_SUM(...) MAT_SUM(__VA_ARGS__)
+#define ACC_MAT_PRODUCT(...) MAT_PRODUCT(__VA_ARGS__)
+#define ACC_MAT_MUL(...) MAT_MUL(__VA_ARGS__)
+#define ACC_MAT_INV(...) MAT_INV(__VA_ARGS__)
+#define READOUT_PRODUCT(...) MAT_PRODUCT(__VA_ARGS__)
+#endif
+
+// weights are stored in compute precision unless STORAGE_F16 or STORAGE_BF16
+#if !defined(WMAT_T)
+#define WVAL_T VAL_T
+#define WMAT_T MAT_T
+#define WVAL_FROM(V) (V)
+#define WVAL_TO(V) VAL_TO_F32(V)
+#define WMAT_NEW(...) MAT_NEW(__VA_ARGS__)
+#define WMAT_DESTROY(...) MAT_DESTROY(__VA_ARGS__)
+#define WMAT_PRODUCT(...) MAT_PRODUCT(__VA_ARGS__)
+#endif
+
+#define RES_WEIGHT(RES, N, M) WVAL_TO(*MAT((RES)->res_weights, N, M))
+#if defined(SIGN_IN_WEIGHTS)
+#define IN_WEIGHT(RES, N, M) (MAT_SIGN((RES)->in_weights, N, M) ? -(RES)->in_scale : (RES)->in_scale)
+#else
+#define IN_WEIGHT(RES, N, M) WVAL_TO(*MAT((RES)->in_weights, N, M))
+#endif
+
+// x and y hold the normal equations (X_T X, X_T Y_TARGET) or, with READOUT_QR,
+// the triangular factor R of the ridge regularised states and Q_T Y_TARGET
+#define READOUT_FORM_NORMAL 0
+#define READOUT_FORM_QR     1
+#if defined(READOUT_QR)
+#define READOUT_FORM READOUT_FORM_QR
+#else
+#define READOUT_FORM READOUT_FORM_NORMAL
+#endif
+
 #define DONT_TESET_XY 0
 #define RESET_XY      1
 
@@ -24,21 +90,82 @@ typedef struct {
   unsigned n_res_nodes;
   unsigned n_out_nodes;
   float leak_rate;
-  MAT_T in_weights;  // heap: sizeof(VAL_T) * n_in_nodes * n_res_nodes
+  unsigned external_weights; // in_weights, res_weights and out_weights are set up by the caller (e.g. a mapped model), training returns -1
+#if defined(SIGN_IN_WEIGHTS)
+  mat_sign_t in_weights; // heap: sizeof(uint32_t) * n_in_nodes * ceil(n_res_nodes / 32)
+  VAL_T in_scale;
+#else
+  WMAT_T in_weights;  // heap: sizeof(WVAL_T) * n_in_nodes * n_res_nodes
+#endif
   MAT_T res_nodes;   // heap: sizeof(VAL_T) * 1 * n_res_nodes
-  MAT_T res_weights; // heap: sizeof(VAL_T) * n_res_nodes * n_res_nodes
-  MAT_T out_weights; // heap: sizeof(VAL_T) * n_res_nodes * n_out_nodes
-  MAT_T x;           // heap: sizeof(VAL_T) * res->n_res_nodes * res->n_res_nodes
-  MAT_T y;           // heap: sizeof(VAL_T) * res->n_in_nodes * res->n_res_nodes
+  WMAT_T res_weights; // heap: sizeof(WVAL_T) * n_res_nodes * n_res_nodes
+  ACC_MAT_T out_weights; // heap: sizeof(ACC_VAL_T) * n_res_nodes * n_out_nodes (flash with INFERENCE_ONLY unless ADAPT_ONLINE)
+#if defined(INFERENCE_ONLY)
+  MAT_T scratch;         // heap: sizeof(VAL_T) * 1 * n_res_nodes
+#else
+  ACC_MAT_T x;           // heap: sizeof(ACC_VAL_T) * res->n_res_nodes * res->n_res_nodes
+  ACC_MAT_T y;           // heap: sizeof(ACC_VAL_T) * res->n_out_nodes * res->n_res_nodes
+  unsigned n_samples;    // number of samples accumulated in x and y
+#endif
+#if !defined(INFERENCE_ONLY) || defined(ADAPT_ONLINE)
+  unsigned adapt_enable; // gate for adapt()
+  float adapt_step;      // NLMS step size, 0 < adapt_step < 2
+#endif
 } reservoir_t;
 
 int init(reservoir_t *res);
 void deinit(reservoir_t *res);
 
+#if !defined(INFERENCE_ONLY)
+
+// fold states (n x n_res_nodes) with targets (n x n_out_nodes) into x and y
+int train_fold(reservoir_t *res, ACC_MAT_T *x, ACC_MAT_T *y, ACC_MAT_T *states, ACC_MAT_T *targets);
+// add partial accumulators part_x and part_y (started from zeros) to x and y
+int train_merge(reservoir_t *res, ACC_MAT_T *x, ACC_MAT_T *y, ACC_MAT_T *part_x, ACC_MAT_T *part_y);
+// run data through the reservoir starting from state without accumulating, state is advanced to the last state.
+// states (data->n + 1 rows) receives the initial state in row 0 and the state after data row n in row n + 1.
+int train_collect_states(reservoir_t *res, MAT_T *states, MAT_T *state, MAT_T *data);
+// accumulate data into x and y starting from state, state is advanced to the last state.
+// target (n_data x n_out_nodes) row n is the wanted output after data row n, NULL targets data itself.
+// the first washout samples only advance the state.
+// thread-safe as long as x, y and state are not shared between callers.
+int train_accumulate(reservoir_t *res, ACC_MAT_T *x, ACC_MAT_T *y, MAT_T *state, MAT_T *data, MAT_T *target, unsigned washout);
 int train_feed_data(reservoir_t *res, MAT_T *data);
+// every column of target is one readout, train_compute_weight solves all of them with one inversion of x
+int train_feed_target(reservoir_t *res, MAT_T *data, MAT_T *target);
 int train_compute_weight(reservoir_t *res, unsigned reset);
+// iterative refit warm-started from out_weights, O(n_res_nodes^2) per iteration
+int train_compute_weight_cg(reservoir_t *res, unsigned reset, unsigned max_iter, float tol);
 int train(reservoir_t *res, MAT_T *data, unsigned reset);
+void train_reset(reservoir_t *res);
+
+// resumable train_compute_weight, see train_job_start
+typedef struct {
+  unsigned phase;
+  unsigned pivot;
+  unsigned row;
+  unsigned reset;
+  ACC_MAT_T a; // heap: sizeof(ACC_VAL_T) * n_res_nodes * n_res_nodes (res->x with reset)
+  ACC_MAT_T w; // heap: sizeof(ACC_VAL_T) * n_res_nodes * n_out_nodes
+} train_job_t;
+
+// solves for out_weights in row operations of O(n_res_nodes * n_out_nodes) each, predict keeps working meanwhile.
+// without reset x and y are copied by the job and may keep accumulating, with reset x is solved in place
+// (no train_feed_* until the job ends) and x and y are reset at the end.
+int train_job_start(reservoir_t *res, train_job_t *job, unsigned reset);
+// runs up to max_rows row operations, returns 1 when done and the new out_weights are swapped in,
+// 0 while work is left
+int train_job_step(reservoir_t *res, train_job_t *job, unsigned max_rows);
+// drops an unfinished job, out_weights are kept (x and y are reset with reset)
+void train_job_cancel(reservoir_t *res, train_job_t *job);
+#endif
 
 int predict(reservoir_t *res, MAT_T *predicted, MAT_T *data);
+#if !defined(INFERENCE_ONLY) || defined(ADAPT_ONLINE)
+// NLMS update of out_weights towards target (1 x n_out_nodes) for the res_nodes of the last predict(),
+// O(n_res_nodes * n_out_nodes) and no heap, does nothing unless adapt_enable is set.
+// with INFERENCE_ONLY it needs ADAPT_ONLINE and tracks drift without x and y
+int adapt(reservoir_t *res, MAT_T *target);
+#endif
 
 #endif /* APP_RESERVOIR_H_ */
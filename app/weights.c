@@ -1,4 +1,5 @@
 #include "reservoir.h"
+#if !defined(PRECISION_Q15)
 const VAL_T __in_weights[] = {
   -0.100000,
   0.100000,
@@ -101,6 +102,12 @@ const VAL_T __in_weights[] = {
   0.100000,
   0.100000
 };
+const uint32_t __in_sign_weights[] = {
+  0x0c431371,
+  0x86e034e5,
+  0x0d0002a9,
+  0x00000003
+};
 const VAL_T __res_weights[] = {
   0.000245,
   -0.013844,
@@ -10103,3 +10110,30320 @@ const VAL_T __res_weights[] = {
   -0.024416,
   0.007442
 };
+#if defined(STORAGE_F16)
+const f16_t __in_weights_f16[] = {
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0x2e66,
+  0xae66,
+  0xae66,
+  0x2e66,
+  0x2e66
+};
+const f16_t __res_weights_f16[] = {
+  0x0c02,
+  0xa317,
+  0x271d,
+  0xa73e,
+  0xa2ca,
+  0x8dc6,
+  0x9bf3,
+  0x2170,
+  0x9d7d,
+  0x2a0b,
+  0x27f6,
+  0xa882,
+  0x2a0b,
+  0xa4dc,
+  0x280d,
+  0x2119,
+  0xa6b8,
+  0xa91a,
+  0x28b2,
+  0x97b8,
+  0x26f6,
+  0x2277,
+  0xa15b,
+  0xa773,
+  0x22fd,
+  0x248e,
+  0xa497,
+  0x257d,
+  0x21eb,
+  0x9f40,
+  0x1d1d,
+  0x1553,
+  0xa790,
+  0xa8a7,
+  0xa5b4,
+  0x2958,
+  0x26e9,
+  0x1ede,
+  0x1d61,
+  0xa45a,
+  0x9d9c,
+  0x20c4,
+  0x2aa8,
+  0xa003,
+  0x1f48,
+  0x2660,
+  0x9ea5,
+  0xa0ae,
+  0x9cf5,
+  0x2521,
+  0xa917,
+  0xa0d5,
+  0x2824,
+  0x2082,
+  0x2442,
+  0xa5b5,
+  0x20c6,
+  0x25e1,
+  0xa40c,
+  0x27f0,
+  0x1a0d,
+  0xa125,
+  0xa6bf,
+  0x2907,
+  0xa964,
+  0x20fc,
+  0x9fd5,
+  0x24c3,
+  0x25d8,
+  0x170b,
+  0xaae5,
+  0x2905,
+  0x215b,
+  0xa8f0,
+  0xa8b9,
+  0x1a5d,
+  0x9845,
+  0xa537,
+  0x218d,
+  0xa0bf,
+  0x27a4,
+  0x239a,
+  0x2619,
+  0x240b,
+  0x19d1,
+  0xa0d3,
+  0xa945,
+  0x9abf,
+  0xa8a6,
+  0x1a28,
+  0x2c9b,
+  0x1575,
+  0x2ae1,
+  0xa311,
+  0x2a4b,
+  0x26be,
+  0xa2f6,
+  0xac8b,
+  0x9f9e,
+  0x2658,
+  0x2ae4,
+  0x2810,
+  0x2535,
+  0xa8aa,
+  0xa4a5,
+  0x27c2,
+  0x265f,
+  0xa67a,
+  0xab69,
+  0x9e17,
+  0x9ddc,
+  0x1cf3,
+  0xa817,
+  0xa494,
+  0xa707,
+  0xa099,
+  0xa3e1,
+  0xa065,
+  0x2969,
+  0x2794,
+  0x1c3a,
+  0x29c3,
+  0x297e,
+  0x2918,
+  0xa4ff,
+  0xa844,
+  0x280f,
+  0x1bb2,
+  0x27a4,
+  0xa789,
+  0xa109,
+  0x2116,
+  0xa762,
+  0xa4ef,
+  0x24d6,
+  0x275a,
+  0x2061,
+  0x209a,
+  0xab7f,
+  0x274b,
+  0x294d,
+  0x2613,
+  0xaf47,
+  0x1b13,
+  0xa48b,
+  0x27ef,
+  0xa527,
+  0x21a5,
+  0x9e17,
+  0x2b9a,
+  0x205c,
+  0x9d22,
+  0x21e0,
+  0x2401,
+  0xa59a,
+  0xaa0a,
+  0xa7e1,
+  0x2870,
+  0x9ae0,
+  0x2433,
+  0xa73d,
+  0x1d32,
+  0x22f1,
+  0x9706,
+  0x9e47,
+  0x291f,
+  0xa4d6,
+  0xa313,
+  0x2038,
+  0x2803,
+  0x24e6,
+  0xa53e,
+  0xa80b,
+  0x269f,
+  0x24c3,
+  0x2c1f,
+  0xa85f,
+  0x2395,
+  0x2729,
+  0x2aa6,
+  0x2982,
+  0x248c,
+  0xa26b,
+  0x27c2,
+  0xa8ce,
+  0xac34,
+  0x261b,
+  0xa12b,
+  0xa6bc,
+  0x25fe,
+  0xa5ff,
+  0xa0ac,
+  0x9639,
+  0x29b3,
+  0x2ad1,
+  0x20f5,
+  0xa3ac,
+  0x2b06,
+  0x9898,
+  0x1164,
+  0xa5ae,
+  0x28cd,
+  0x2801,
+  0xa193,
+  0x2620,
+  0xa64e,
+  0x2978,
+  0xa28e,
+  0xa2fd,
+  0x262a,
+  0x25bf,
+  0x2c5d,
+  0x9646,
+  0x2a31,
+  0xad60,
+  0x9c22,
+  0xa310,
+  0x2b02,
+  0xa150,
+  0xa74e,
+  0x240f,
+  0x2145,
+  0x0aea,
+  0x1d8c,
+  0x9f87,
+  0x2212,
+  0xa5b7,
+  0x21dc,
+  0xa45a,
+  0xa2d6,
+  0xa084,
+  0xa133,
+  0xa982,
+  0x25d9,
+  0xa15d,
+  0xa70c,
+  0x2965,
+  0x2174,
+  0xa9a8,
+  0xa223,
+  0x2ca9,
+  0x8ee6,
+  0xa9ad,
+  0x2d0c,
+  0x2773,
+  0x2242,
+  0x20a0,
+  0xa982,
+  0x9f94,
+  0x218d,
+  0x1d77,
+  0x1f12,
+  0x9fae,
+  0xa7a7,
+  0xa8a7,
+  0xa85a,
+  0xa798,
+  0xa334,
+  0xac3b,
+  0x16d0,
+  0xa3f7,
+  0x280d,
+  0xa483,
+  0x27c8,
+  0x9bc9,
+  0x284e,
+  0xa860,
+  0x1ed9,
+  0x2af5,
+  0x2383,
+  0x2440,
+  0x1ccf,
+  0x229a,
+  0x9a6a,
+  0x2546,
+  0xaa63,
+  0x2333,
+  0x25de,
+  0xa52b,
+  0x181e,
+  0x2c80,
+  0x21d7,
+  0xa3b5,
+  0x1217,
+  0x275b,
+  0xace2,
+  0x2e67,
+  0x226c,
+  0x24f9,
+  0xa84c,
+  0x2b27,
+  0xa214,
+  0x988a,
+  0x24fe,
+  0xac2f,
+  0xa03e,
+  0x970c,
+  0xa59a,
+  0x199e,
+  0xa560,
+  0xa401,
+  0xa037,
+  0x9ad0,
+  0xa43f,
+  0x1c1c,
+  0xaad7,
+  0xa4cc,
+  0x9af5,
+  0x2419,
+  0x2889,
+  0x2288,
+  0xa577,
+  0x2a61,
+  0x283a,
+  0xaa06,
+  0xa000,
+  0x26fa,
+  0xa9a6,
+  0xa422,
+  0x2d06,
+  0xa11f,
+  0xa553,
+  0x298b,
+  0x2b84,
+  0x2bd0,
+  0xa2a5,
+  0x2061,
+  0xa09b,
+  0xac73,
+  0xa3e8,
+  0xa0b9,
+  0x2879,
+  0x2099,
+  0x2750,
+  0x245d,
+  0x9884,
+  0x23a7,
+  0xa87c,
+  0x23d7,
+  0xa586,
+  0xa06d,
+  0x2448,
+  0x2671,
+  0x2814,
+  0xa6ee,
+  0x24ca,
+  0xa8da,
+  0xa0e4,
+  0x16c8,
+  0x2744,
+  0xa8bf,
+  0xa228,
+  0x1ce1,
+  0x22aa,
+  0xa6d6,
+  0x2ada,
+  0xa527,
+  0x2451,
+  0x253a,
+  0x9713,
+  0x24d3,
+  0x9f61,
+  0xa594,
+  0x25ff,
+  0x9b19,
+  0xa98d,
+  0x9f76,
+  0x28aa,
+  0x274b,
+  0xa5f1,
+  0xa809,
+  0xa642,
+  0x0259,
+  0x272d,
+  0x1dfe,
+  0xa745,
+  0x228e,
+  0x1f3b,
+  0x28d8,
+  0x9fef,
+  0x29dd,
+  0xa84d,
+  0x25f5,
+  0xa2b7,
+  0xa1d5,
+  0xa4f2,
+  0xad7f,
+  0xa47c,
+  0x219b,
+  0xab15,
+  0x95af,
+  0xa94f,
+  0xab01,
+  0x245a,
+  0xa4a1,
+  0x1b28,
+  0xa363,
+  0xa14c,
+  0x224a,
+  0x29a1,
+  0x2649,
+  0x263e,
+  0xa860,
+  0xa498,
+  0x265a,
+  0x27ad,
+  0x2806,
+  0x2814,
+  0xa97d,
+  0xa642,
+  0xa400,
+  0x1fb6,
+  0x28a3,
+  0xa627,
+  0x9e39,
+  0xa6ee,
+  0xa81c,
+  0xa7d2,
+  0xa9a8,
+  0xa4ea,
+  0x28c6,
+  0x28da,
+  0xa5f5,
+  0x9fcb,
+  0xad35,
+  0xa1ec,
+  0x2c62,
+  0xa17a,
+  0x2403,
+  0x2c62,
+  0x291e,
+  0xa414,
+  0xa102,
+  0x20e5,
+  0xac6a,
+  0x2736,
+  0xa923,
+  0xa140,
+  0xa120,
+  0xaa53,
+  0xa124,
+  0xa4de,
+  0xa897,
+  0x22b0,
+  0x188e,
+  0xa5db,
+  0x2389,
+  0x1b3f,
+  0x23ca,
+  0x1e9c,
+  0x26d7,
+  0xae18,
+  0xa904,
+  0x1e3c,
+  0x1d5f,
+  0x1f60,
+  0xa97c,
+  0xa526,
+  0xac74,
+  0x28b8,
+  0xaae3,
+  0xa4cb,
+  0x2a0f,
+  0xa73c,
+  0xa932,
+  0xa661,
+  0x2838,
+  0xa368,
+  0xa93e,
+  0xa5a3,
+  0x2837,
+  0x208e,
+  0x282f,
+  0x2691,
+  0x2263,
+  0x2a94,
+  0x215c,
+  0xa727,
+  0x2606,
+  0x2632,
+  0xa0d9,
+  0x25f8,
+  0xa236,
+  0xaa90,
+  0x2ad5,
+  0x293a,
+  0xa3b0,
+  0xab21,
+  0x25f3,
+  0x9171,
+  0x2a98,
+  0xa01b,
+  0x29d5,
+  0x2613,
+  0x2c33,
+  0xa007,
+  0x1a27,
+  0x20da,
+  0x28d5,
+  0x293b,
+  0x240d,
+  0x1c4c,
+  0xa760,
+  0x2413,
+  0x2400,
+  0x176a,
+  0x242d,
+  0xa6a4,
+  0x1c7c,
+  0xa7fd,
+  0x256f,
+  0x21a3,
+  0xa316,
+  0x99c7,
+  0xa802,
+  0x24ec,
+  0xa094,
+  0xa7fb,
+  0xa506,
+  0x2067,
+  0xa495,
+  0xabea,
+  0x24b5,
+  0x2613,
+  0x9950,
+  0x1b68,
+  0x276a,
+  0xaa73,
+  0xa2fd,
+  0x2860,
+  0xa14d,
+  0x22d4,
+  0xa1dc,
+  0x2065,
+  0xa143,
+  0xacf6,
+  0xa9f2,
+  0xaa44,
+  0x274e,
+  0x258c,
+  0x29e3,
+  0x2964,
+  0x2c59,
+  0xa4bb,
+  0xa9e1,
+  0xa47c,
+  0xaa74,
+  0xa79a,
+  0xa987,
+  0xa5b7,
+  0x9e40,
+  0x2b26,
+  0x247a,
+  0x2794,
+  0x1dd4,
+  0xa99a,
+  0x2311,
+  0xa1de,
+  0x23e2,
+  0xa424,
+  0xa919,
+  0x29cc,
+  0xac78,
+  0xa608,
+  0x28c6,
+  0x276c,
+  0x199d,
+  0xa26b,
+  0x2713,
+  0x294d,
+  0x2416,
+  0x262c,
+  0x25ca,
+  0x292b,
+  0xa43e,
+  0x9cdb,
+  0xae0a,
+  0xa607,
+  0x188b,
+  0xab40,
+  0x1deb,
+  0x19c9,
+  0x8939,
+  0xa001,
+  0xa62d,
+  0x25a1,
+  0x295d,
+  0xa9df,
+  0x21ea,
+  0x9a66,
+  0x2715,
+  0x1c7f,
+  0x2014,
+  0x26ec,
+  0x10e8,
+  0x2607,
+  0xa738,
+  0x28f2,
+  0xaca4,
+  0x9def,
+  0x2ced,
+  0x2953,
+  0x2cb7,
+  0xa804,
+  0x1010,
+  0x2535,
+  0x1fd4,
+  0xa0f9,
+  0x2927,
+  0x2854,
+  0xaa0f,
+  0x2495,
+  0x25ed,
+  0x9dd5,
+  0x2612,
+  0x27b6,
+  0xaa9a,
+  0x98d2,
+  0x29a4,
+  0xa325,
+  0xa2f6,
+  0x2751,
+  0x2806,
+  0xa86f,
+  0xac9d,
+  0x246b,
+  0x1f53,
+  0x1d66,
+  0x1b56,
+  0x2879,
+  0xa9eb,
+  0x2424,
+  0xacca,
+  0x2765,
+  0x2615,
+  0x24b7,
+  0x9ff3,
+  0xa510,
+  0x215a,
+  0xa840,
+  0x29a2,
+  0x2773,
+  0x830b,
+  0xacce,
+  0x29f7,
+  0x24fc,
+  0x266e,
+  0x908a,
+  0xa6cc,
+  0xa9b1,
+  0x1047,
+  0xa0a3,
+  0x1255,
+  0x1fce,
+  0x224f,
+  0xa819,
+  0x1fd9,
+  0xa2c4,
+  0x24b6,
+  0x20e3,
+  0x191b,
+  0x2c68,
+  0x226c,
+  0x281e,
+  0x261d,
+  0x288e,
+  0xaa73,
+  0x9e0f,
+  0xaa52,
+  0x9d11,
+  0x2a7c,
+  0xa560,
+  0xaafd,
+  0x2276,
+  0x278b,
+  0x210e,
+  0x1db3,
+  0x17fa,
+  0x0c32,
+  0x255d,
+  0x2487,
+  0xab7b,
+  0xa497,
+  0xa56e,
+  0xa163,
+  0xa721,
+  0x2638,
+  0xa854,
+  0xa89b,
+  0xa53d,
+  0x9961,
+  0x2c07,
+  0xac6a,
+  0xaac3,
+  0x2598,
+  0xa619,
+  0xa0d4,
+  0x2cfc,
+  0x195b,
+  0x29c9,
+  0xa8fe,
+  0xa6ef,
+  0x24c6,
+  0x9eeb,
+  0x25d7,
+  0xa08d,
+  0xa556,
+  0x9ab9,
+  0xa3c2,
+  0xa968,
+  0xaaee,
+  0xa8f3,
+  0x9fa0,
+  0x2459,
+  0xa920,
+  0xa8c4,
+  0x90c6,
+  0x1cdd,
+  0xa76e,
+  0xaad2,
+  0xa828,
+  0x29a9,
+  0xa68a,
+  0x2758,
+  0xa42d,
+  0xa7ee,
+  0x1c0e,
+  0xa65d,
+  0xa106,
+  0x207f,
+  0x219c,
+  0xa295,
+  0xa82f,
+  0xa8b7,
+  0x1657,
+  0x0b13,
+  0xa7bf,
+  0xa295,
+  0x2706,
+  0xa970,
+  0xa95c,
+  0x9c02,
+  0xa40e,
+  0x1e95,
+  0x2d76,
+  0xa2ed,
+  0xaaa9,
+  0x2795,
+  0x016a,
+  0xa9a6,
+  0x1eba,
+  0xa3be,
+  0xa83f,
+  0x2d20,
+  0x27dc,
+  0x28be,
+  0x2a1c,
+  0xa432,
+  0x26c7,
+  0x289b,
+  0xacf9,
+  0xa69b,
+  0xa102,
+  0xa6b5,
+  0xa4a6,
+  0xa130,
+  0xa801,
+  0x26a3,
+  0xab12,
+  0x1f6e,
+  0x2442,
+  0x1e09,
+  0x2866,
+  0x1f43,
+  0x9efd,
+  0xa9b5,
+  0x9c4c,
+  0xa6d4,
+  0x15b7,
+  0x1ac9,
+  0x2331,
+  0xa7cb,
+  0x1e26,
+  0xa3e0,
+  0xa3c8,
+  0x2431,
+  0xa4b7,
+  0x293b,
+  0x2ad8,
+  0xa80a,
+  0x1ba9,
+  0x23da,
+  0xa440,
+  0x2b57,
+  0x9fc2,
+  0x2910,
+  0x97cc,
+  0x2009,
+  0x22a6,
+  0x22ee,
+  0x173c,
+  0x9cc8,
+  0x2b71,
+  0x206d,
+  0xa934,
+  0x293d,
+  0x27e5,
+  0xa2dd,
+  0xa675,
+  0x281e,
+  0x203d,
+  0x19c2,
+  0xa406,
+  0xa750,
+  0x261e,
+  0x2623,
+  0x961b,
+  0xac22,
+  0x2963,
+  0x29db,
+  0x1d5d,
+  0xad8c,
+  0xa758,
+  0xa889,
+  0x201f,
+  0x294e,
+  0x289e,
+  0xa19b,
+  0x24ee,
+  0x25ff,
+  0xad4e,
+  0xa466,
+  0xa612,
+  0xae1e,
+  0x24b6,
+  0xa767,
+  0x2c3a,
+  0x1546,
+  0xa8b0,
+  0xa853,
+  0x25a8,
+  0xa3c9,
+  0x2c02,
+  0x1cd2,
+  0x18f4,
+  0xa5fc,
+  0xa565,
+  0x2468,
+  0x9558,
+  0x2492,
+  0xac4a,
+  0xa749,
+  0xa413,
+  0xa914,
+  0x2a5c,
+  0xabe4,
+  0xa71a,
+  0xa716,
+  0xa6b1,
+  0xa685,
+  0x1873,
+  0x241e,
+  0x2616,
+  0x20b4,
+  0x2885,
+  0x258e,
+  0xa95a,
+  0xa783,
+  0xab00,
+  0x212f,
+  0xa763,
+  0x25c6,
+  0x21d4,
+  0xa1e4,
+  0x2587,
+  0x2641,
+  0xaa6a,
+  0xa7ba,
+  0xa0e1,
+  0xaa1b,
+  0xa765,
+  0xa8ba,
+  0xaaee,
+  0x0a19,
+  0xa9f3,
+  0x0adf,
+  0x9e43,
+  0xa5c6,
+  0x9bd2,
+  0x1c99,
+  0xa0b0,
+  0xaadd,
+  0x2a5e,
+  0xa400,
+  0xa5bc,
+  0x91dc,
+  0x2a3a,
+  0x92f3,
+  0xa25e,
+  0x2415,
+  0xa75d,
+  0xa8ef,
+  0xa5b3,
+  0xa348,
+  0xaae3,
+  0x9ef0,
+  0xa454,
+  0x1fff,
+  0x2a28,
+  0xa946,
+  0xa522,
+  0xa89b,
+  0x25a4,
+  0xac19,
+  0x2723,
+  0x2419,
+  0xa279,
+  0xa5f9,
+  0x1da8,
+  0xabbd,
+  0x2016,
+  0x2504,
+  0x283b,
+  0x1335,
+  0xabec,
+  0xa10a,
+  0x8842,
+  0x2343,
+  0x18e4,
+  0x22db,
+  0x296f,
+  0xa89e,
+  0xa801,
+  0x2a57,
+  0x2440,
+  0xa7e3,
+  0x2c4a,
+  0x283e,
+  0x191b,
+  0xa881,
+  0xa902,
+  0x2258,
+  0x264c,
+  0xa23c,
+  0xa871,
+  0x259d,
+  0x181f,
+  0xa501,
+  0xa630,
+  0x1fad,
+  0xa8e6,
+  0x2755,
+  0xa2ad,
+  0x2307,
+  0xa47b,
+  0x2784,
+  0x2b86,
+  0xa758,
+  0xa6e1,
+  0x27bd,
+  0xac95,
+  0x2a68,
+  0xa3f0,
+  0x2a12,
+  0x9e0e,
+  0xa30c,
+  0xa261,
+  0x2848,
+  0x2253,
+  0xa120,
+  0x26fe,
+  0x1d5d,
+  0x2b57,
+  0x1bea,
+  0xa4bf,
+  0x9ff7,
+  0xa664,
+  0xaa1e,
+  0x26cf,
+  0x2932,
+  0xa494,
+  0xa02b,
+  0xa6db,
+  0xa4cf,
+  0x277b,
+  0xa81c,
+  0x21c5,
+  0x1ccf,
+  0x294a,
+  0xa831,
+  0x1efc,
+  0x2199,
+  0xac43,
+  0x9fc4,
+  0xa89f,
+  0xa274,
+  0xab7c,
+  0x1931,
+  0x294c,
+  0x2090,
+  0x1c77,
+  0x21ea,
+  0x1594,
+  0x197d,
+  0x9d34,
+  0x21c8,
+  0x2829,
+  0x2870,
+  0xa698,
+  0xa8ea,
+  0x1a89,
+  0xa44b,
+  0xa3f0,
+  0xa615,
+  0xa8bb,
+  0x220a,
+  0x253c,
+  0xa40d,
+  0x1e6c,
+  0x1c66,
+  0x18ea,
+  0x1c37,
+  0x254e,
+  0xa82b,
+  0x2af9,
+  0xa283,
+  0x9418,
+  0xab72,
+  0x272c,
+  0xa4b0,
+  0x249a,
+  0x227b,
+  0xa24f,
+  0xa7dc,
+  0x2823,
+  0x2a37,
+  0x11bc,
+  0x2d22,
+  0xa59a,
+  0xa098,
+  0xa01e,
+  0xa181,
+  0xa084,
+  0x2504,
+  0x27e1,
+  0xa4ee,
+  0x21fb,
+  0x2338,
+  0xaa17,
+  0xa492,
+  0xa68c,
+  0x9dc0,
+  0x2b12,
+  0x226c,
+  0x27e3,
+  0xa1ce,
+  0x22da,
+  0x2226,
+  0xa6ce,
+  0xa81b,
+  0xa8dd,
+  0x1585,
+  0x297c,
+  0x2a45,
+  0x2527,
+  0xa80e,
+  0xa71a,
+  0x1f45,
+  0xa8bc,
+  0xa83d,
+  0xa56a,
+  0x2baa,
+  0xa7a8,
+  0x2b2e,
+  0x2f38,
+  0x2886,
+  0x28d4,
+  0x9005,
+  0x999e,
+  0x28a8,
+  0xa844,
+  0xa899,
+  0x2229,
+  0xa4a3,
+  0xa8b2,
+  0xabd4,
+  0x9fd5,
+  0xa3ef,
+  0x24ce,
+  0x1cbe,
+  0xa860,
+  0x26ad,
+  0x27f1,
+  0x2a6f,
+  0x270f,
+  0x1f28,
+  0x26aa,
+  0x254e,
+  0x2016,
+  0xa186,
+  0x2965,
+  0x2320,
+  0xa435,
+  0xa8a6,
+  0xa08e,
+  0x26c5,
+  0xa928,
+  0xab02,
+  0x28dd,
+  0x2735,
+  0x2730,
+  0x26a7,
+  0xa614,
+  0x2cf1,
+  0x2a3d,
+  0x259b,
+  0xac2e,
+  0x98d6,
+  0x22f9,
+  0x2442,
+  0xa802,
+  0xace2,
+  0x9baa,
+  0x1c55,
+  0x2280,
+  0x180d,
+  0x9cf9,
+  0x2699,
+  0x2a8b,
+  0x245b,
+  0x1f6f,
+  0xace0,
+  0xa873,
+  0x1bb0,
+  0x293f,
+  0xa5ab,
+  0x2250,
+  0x2471,
+  0x1050,
+  0x25c6,
+  0x2769,
+  0x2379,
+  0x2089,
+  0xac39,
+  0xaa91,
+  0xa8a5,
+  0x29b6,
+  0xa5aa,
+  0xa8db,
+  0x189b,
+  0x160b,
+  0xa646,
+  0x2914,
+  0x241c,
+  0x2524,
+  0x1c7a,
+  0x9855,
+  0x990c,
+  0xa5ac,
+  0x98a2,
+  0x2228,
+  0x19a2,
+  0x9dea,
+  0x2bca,
+  0x9f8a,
+  0x2acc,
+  0x9c46,
+  0x24fe,
+  0xa997,
+  0x2706,
+  0x2956,
+  0x23d3,
+  0xa02d,
+  0x28f3,
+  0x16b9,
+  0x9fb0,
+  0xa610,
+  0x249c,
+  0x9d05,
+  0xa957,
+  0x22ea,
+  0xa375,
+  0xa733,
+  0x2646,
+  0x9a16,
+  0x1a14,
+  0x20a1,
+  0x25a5,
+  0xa88c,
+  0x213c,
+  0xaaea,
+  0xac00,
+  0xaa46,
+  0xa731,
+  0xa2a0,
+  0x23a0,
+  0xa83b,
+  0xa0d1,
+  0x16c5,
+  0xa650,
+  0x283d,
+  0x2093,
+  0xa787,
+  0x2547,
+  0x2566,
+  0xa13f,
+  0xa8c0,
+  0x215c,
+  0x29ab,
+  0x28a0,
+  0x26f2,
+  0x2d3b,
+  0xa09c,
+  0x2717,
+  0xa174,
+  0x2794,
+  0x2670,
+  0x9cec,
+  0x28e6,
+  0xa4af,
+  0x2b1f,
+  0x2b5e,
+  0xa7e3,
+  0x1eb0,
+  0x2621,
+  0xaaba,
+  0xa3f7,
+  0x247b,
+  0x1402,
+  0xa446,
+  0x1c06,
+  0xa447,
+  0x24b8,
+  0x9472,
+  0x2a69,
+  0xa7f2,
+  0x2554,
+  0xa420,
+  0x265b,
+  0x24be,
+  0xab5f,
+  0xa3d7,
+  0x9e8a,
+  0xa8bf,
+  0xa965,
+  0xa1d7,
+  0x2a1b,
+  0xab6b,
+  0x92a3,
+  0xa8ce,
+  0x9cc0,
+  0xa956,
+  0xa2e8,
+  0xaa2d,
+  0xa95d,
+  0x26a7,
+  0xa2d2,
+  0xa8e4,
+  0x2940,
+  0x262d,
+  0x28ba,
+  0x2509,
+  0x29b4,
+  0xa4ba,
+  0xa584,
+  0x2476,
+  0x1ee0,
+  0x1bf7,
+  0xaa5a,
+  0x29fd,
+  0x9b84,
+  0xa3bd,
+  0xa5e0,
+  0x9ce1,
+  0x2626,
+  0xa2ff,
+  0x2915,
+  0x21cf,
+  0x16c8,
+  0x23f7,
+  0x28f0,
+  0x2caf,
+  0x9fe1,
+  0xa6f2,
+  0xa25f,
+  0xa80b,
+  0x24dd,
+  0x2bfa,
+  0xa8b0,
+  0xa858,
+  0x2605,
+  0xa680,
+  0xa88c,
+  0xa7a0,
+  0x2845,
+  0xa741,
+  0x2c1c,
+  0xaa43,
+  0xa9db,
+  0x90b6,
+  0x2155,
+  0x2433,
+  0x2173,
+  0x298d,
+  0x28c4,
+  0xa6a4,
+  0xac91,
+  0xa220,
+  0x2880,
+  0x2987,
+  0x9e71,
+  0xa963,
+  0x26e0,
+  0x2ca9,
+  0xa7ea,
+  0x2493,
+  0xa66b,
+  0x2a50,
+  0x279f,
+  0xa4bd,
+  0xa29a,
+  0xaa76,
+  0x2122,
+  0xaaa8,
+  0x27f3,
+  0x2809,
+  0xa98d,
+  0x247b,
+  0x2705,
+  0xa08b,
+  0xa6a6,
+  0xa496,
+  0xaaca,
+  0x9a75,
+  0x27c4,
+  0x2077,
+  0xa871,
+  0x2ac3,
+  0x28c9,
+  0xa1d5,
+  0x9f25,
+  0x9c43,
+  0xaa4c,
+  0x8c3e,
+  0xa4c9,
+  0x9eef,
+  0x1633,
+  0x2bc4,
+  0x1fb8,
+  0xa492,
+  0xac52,
+  0x283d,
+  0x10c7,
+  0xa802,
+  0x28a7,
+  0x9d1f,
+  0x203e,
+  0xaaab,
+  0xa8e6,
+  0x20d2,
+  0x2433,
+  0x25c3,
+  0xa73d,
+  0xa5c4,
+  0x231d,
+  0x25f8,
+  0xa89d,
+  0x25f7,
+  0x1ee2,
+  0x14fa,
+  0x2169,
+  0x9b48,
+  0xa500,
+  0xa603,
+  0x2c3e,
+  0x24a8,
+  0x2b3c,
+  0x207e,
+  0xa9e9,
+  0xa44e,
+  0xa45d,
+  0x2406,
+  0xa21b,
+  0x1029,
+  0x2c9e,
+  0xa8d7,
+  0x969e,
+  0x9d82,
+  0x2b5b,
+  0x1371,
+  0x1d79,
+  0xa4c0,
+  0x1c68,
+  0x20da,
+  0x2808,
+  0xa99a,
+  0x9ac7,
+  0xa2ad,
+  0x27ee,
+  0x2694,
+  0xacb0,
+  0xa778,
+  0x29a3,
+  0x238b,
+  0x1f64,
+  0xa634,
+  0x227b,
+  0xa873,
+  0x9c2c,
+  0x286e,
+  0x22fb,
+  0xa980,
+  0xa824,
+  0xa433,
+  0x2803,
+  0x2748,
+  0x193b,
+  0x2525,
+  0x25f4,
+  0x2c52,
+  0x278c,
+  0x985e,
+  0x1f47,
+  0xa557,
+  0xa8be,
+  0x2679,
+  0x25c8,
+  0xa5b5,
+  0x27bf,
+  0xac35,
+  0x0d0d,
+  0x2749,
+  0x90c0,
+  0x28f7,
+  0xa77d,
+  0x298c,
+  0x8c58,
+  0x1072,
+  0x96d9,
+  0x2527,
+  0xa8dc,
+  0x8e53,
+  0xa8c2,
+  0xa4d1,
+  0xa73c,
+  0x2c83,
+  0x2641,
+  0x2b1c,
+  0xa638,
+  0x99c4,
+  0x2aab,
+  0xa434,
+  0x263e,
+  0x2489,
+  0x9073,
+  0xa9f5,
+  0x2b1f,
+  0x249a,
+  0x2549,
+  0x9f31,
+  0x2648,
+  0x9800,
+  0xa4eb,
+  0xa1ac,
+  0x94a8,
+  0xabd8,
+  0xa4cd,
+  0x9e93,
+  0x268c,
+  0x2519,
+  0xa41f,
+  0xa76e,
+  0x2543,
+  0x209b,
+  0xac7a,
+  0x2805,
+  0x20b6,
+  0xa44b,
+  0x21ba,
+  0xa50c,
+  0xa03a,
+  0x95e8,
+  0xa143,
+  0x20ca,
+  0x9524,
+  0x2718,
+  0x20a6,
+  0x2a8e,
+  0x9a9a,
+  0xa49b,
+  0x1f1b,
+  0x2671,
+  0x2780,
+  0x1772,
+  0x24a3,
+  0xa35f,
+  0x243c,
+  0x9d2c,
+  0xa630,
+  0xa57a,
+  0xa0e3,
+  0x2953,
+  0x25cf,
+  0x2de0,
+  0xa4b5,
+  0x1995,
+  0x96da,
+  0x97a1,
+  0x2265,
+  0xa7a7,
+  0x9c71,
+  0xab26,
+  0xa248,
+  0x2ca0,
+  0x9a36,
+  0x27ab,
+  0xa813,
+  0xad05,
+  0xa708,
+  0xa7a0,
+  0xa024,
+  0xa9e8,
+  0xa519,
+  0xa3d1,
+  0x1dae,
+  0xaaa5,
+  0xa798,
+  0x2cd3,
+  0xab5d,
+  0xa123,
+  0x23e8,
+  0x284e,
+  0x2801,
+  0x9d63,
+  0xa6fa,
+  0x29db,
+  0x28d0,
+  0x2494,
+  0x9d54,
+  0x1cd7,
+  0xa553,
+  0xa92a,
+  0x2124,
+  0xa91b,
+  0x25a5,
+  0x2c42,
+  0x2244,
+  0x2477,
+  0x296d,
+  0x2129,
+  0xa903,
+  0x2460,
+  0x26e1,
+  0x288b,
+  0xa039,
+  0x1b83,
+  0xabc2,
+  0xaa6a,
+  0x241a,
+  0xacd3,
+  0xad17,
+  0xa871,
+  0x2472,
+  0x238b,
+  0xa42e,
+  0xa67e,
+  0x2bca,
+  0x952a,
+  0x9dfc,
+  0xa915,
+  0xa691,
+  0x2b83,
+  0x1dbe,
+  0x2900,
+  0x2c47,
+  0xa631,
+  0xa6de,
+  0xac6c,
+  0x28d5,
+  0xa1c8,
+  0xa4fd,
+  0x994a,
+  0xa2dd,
+  0x1d12,
+  0x2410,
+  0xa403,
+  0x196e,
+  0x2a2d,
+  0x2264,
+  0xa523,
+  0x259b,
+  0x2793,
+  0x21e4,
+  0x1c2f,
+  0x24e9,
+  0x28aa,
+  0x97de,
+  0x1d8f,
+  0x18d0,
+  0x1819,
+  0x287f,
+  0xab03,
+  0x29c3,
+  0x28b8,
+  0x2b28,
+  0x23bf,
+  0xaac8,
+  0x9d47,
+  0x22fa,
+  0xa77c,
+  0x8d47,
+  0xa16e,
+  0x9e98,
+  0x2c4a,
+  0xa854,
+  0xa46d,
+  0xa71f,
+  0xa473,
+  0x2491,
+  0x27c4,
+  0xa2b9,
+  0xa069,
+  0xac08,
+  0x2b0d,
+  0x2668,
+  0xa3b5,
+  0xa8ed,
+  0x22ce,
+  0x1c63,
+  0x2ae1,
+  0xa4eb,
+  0x291e,
+  0xa05a,
+  0x22a9,
+  0xa4be,
+  0x1f4d,
+  0x9ec9,
+  0xa922,
+  0x253d,
+  0x28b0,
+  0xa1d1,
+  0xa938,
+  0xaa2e,
+  0xa55f,
+  0xa67d,
+  0x25b1,
+  0x991d,
+  0x2138,
+  0x9f16,
+  0x1dfb,
+  0x9c98,
+  0xa552,
+  0xa1db,
+  0x2032,
+  0x25a9,
+  0x1adb,
+  0x1270,
+  0x2631,
+  0x2bc4,
+  0x1a97,
+  0xa92d,
+  0xa544,
+  0xa17a,
+  0x108c,
+  0x99c6,
+  0xab6d,
+  0xa54c,
+  0x234a,
+  0xa99e,
+  0xa259,
+  0xaa57,
+  0x252c,
+  0xa88b,
+  0x2a3c,
+  0x9fd9,
+  0xab8a,
+  0x94e9,
+  0x2824,
+  0xab34,
+  0xa8e9,
+  0x2092,
+  0x26bc,
+  0xa881,
+  0x2ad5,
+  0x9b5c,
+  0xa963,
+  0x1f14,
+  0x261a,
+  0xa433,
+  0x20f2,
+  0xa4d4,
+  0x284b,
+  0x2165,
+  0x2a40,
+  0x2405,
+  0x9b76,
+  0x2b61,
+  0x26da,
+  0x25d7,
+  0x20a1,
+  0x242f,
+  0xa84f,
+  0xa9e7,
+  0xa63b,
+  0x2c9c,
+  0x9012,
+  0xa63b,
+  0xa9a8,
+  0x259c,
+  0x2833,
+  0xabc3,
+  0x22e1,
+  0xa25f,
+  0xa236,
+  0xa7c1,
+  0x2598,
+  0x2601,
+  0xa67b,
+  0xa5fc,
+  0x1996,
+  0x26f6,
+  0x272a,
+  0x9da2,
+  0x257a,
+  0xa91e,
+  0x2230,
+  0x15a4,
+  0x24f7,
+  0x2820,
+  0x294e,
+  0x21ae,
+  0x2373,
+  0x218a,
+  0xaa3e,
+  0xa106,
+  0xa6e9,
+  0xa491,
+  0x2298,
+  0xa068,
+  0x9fba,
+  0x2567,
+  0x2427,
+  0x241f,
+  0xab84,
+  0x2c39,
+  0xa6f0,
+  0x1f60,
+  0x28fa,
+  0x2839,
+  0xa902,
+  0xa60c,
+  0x205a,
+  0x29e6,
+  0xa587,
+  0x29d4,
+  0xaab1,
+  0x9d70,
+  0xa0b5,
+  0x2247,
+  0x252c,
+  0xa97d,
+  0x2126,
+  0x295e,
+  0xa68d,
+  0xacb1,
+  0x9d78,
+  0xa877,
+  0xa632,
+  0xaaa9,
+  0x2a9e,
+  0x287e,
+  0x28c8,
+  0xa8ed,
+  0x2824,
+  0xa501,
+  0xad05,
+  0x2485,
+  0x2a60,
+  0xa460,
+  0xa76c,
+  0x0e8e,
+  0xa6f5,
+  0xac3a,
+  0x227c,
+  0x0f42,
+  0x263a,
+  0xa1c2,
+  0xa100,
+  0xa6d4,
+  0xa593,
+  0xa426,
+  0xa92c,
+  0x1a8b,
+  0xa5fb,
+  0xab4b,
+  0xa461,
+  0x29d0,
+  0x298d,
+  0x9cf7,
+  0x2594,
+  0x259a,
+  0x216f,
+  0x9c19,
+  0xa03a,
+  0x96ac,
+  0xa48f,
+  0xaaad,
+  0xa9a8,
+  0xa8c4,
+  0x1281,
+  0x9255,
+  0xa60a,
+  0x2b1a,
+  0x27f1,
+  0xa307,
+  0x181b,
+  0xa3ac,
+  0xa6ee,
+  0xa61a,
+  0x2498,
+  0x24f3,
+  0x2572,
+  0x9de9,
+  0x264c,
+  0x274e,
+  0x2259,
+  0x25cf,
+  0x25ff,
+  0xa139,
+  0x1d93,
+  0xa9a4,
+  0xa230,
+  0x2570,
+  0x2066,
+  0x8d43,
+  0xa2bd,
+  0x28c5,
+  0xaa37,
+  0x1f87,
+  0xa448,
+  0x2b40,
+  0x2865,
+  0xa49c,
+  0x22b2,
+  0xa07f,
+  0x2b80,
+  0xa638,
+  0x29d9,
+  0x968a,
+  0xa464,
+  0x0c44,
+  0x2299,
+  0xa752,
+  0x2841,
+  0xa36b,
+  0xaa07,
+  0x281b,
+  0x2639,
+  0x8ae6,
+  0x2594,
+  0xa98d,
+  0x140f,
+  0x2bc2,
+  0x2a45,
+  0xa48e,
+  0x9cea,
+  0x2463,
+  0xab15,
+  0x26bf,
+  0x2950,
+  0x2554,
+  0xa6e3,
+  0xaad4,
+  0x9ccf,
+  0x2a0c,
+  0x2285,
+  0x2224,
+  0x98d9,
+  0x23de,
+  0xaa0e,
+  0xa652,
+  0x9991,
+  0xaa19,
+  0xa935,
+  0x2528,
+  0xa73b,
+  0xaa21,
+  0x2acb,
+  0x29b9,
+  0x21b5,
+  0x88bb,
+  0x9831,
+  0x2649,
+  0x2532,
+  0x9cfb,
+  0x2388,
+  0x2611,
+  0xa818,
+  0xa3e7,
+  0xa415,
+  0x8cfa,
+  0x1b3d,
+  0x2419,
+  0xa123,
+  0x1e6d,
+  0xa6cf,
+  0xa966,
+  0x1e2c,
+  0x24d0,
+  0x24e5,
+  0xaae2,
+  0xac69,
+  0x289d,
+  0x9c33,
+  0x2190,
+  0xa348,
+  0x992d,
+  0xa370,
+  0xa7fe,
+  0xa8da,
+  0xa8bc,
+  0x2a4a,
+  0x99f5,
+  0x1cd1,
+  0x279b,
+  0x2470,
+  0x274b,
+  0xa82d,
+  0x2d24,
+  0x247c,
+  0x2be0,
+  0xa97e,
+  0xa69f,
+  0x2948,
+  0x239b,
+  0xa8d1,
+  0x244d,
+  0x27d1,
+  0xa315,
+  0xa410,
+  0x21b0,
+  0xa3a1,
+  0x2b82,
+  0xa990,
+  0xa0b7,
+  0xa847,
+  0xa408,
+  0x27ac,
+  0x24f3,
+  0x2792,
+  0x2cfc,
+  0x2921,
+  0xa975,
+  0xab88,
+  0x2578,
+  0xa4eb,
+  0xabd6,
+  0x1d5e,
+  0x22e5,
+  0x2663,
+  0xab7d,
+  0x2991,
+  0x2572,
+  0x2a79,
+  0x19c7,
+  0xa3c0,
+  0xa46a,
+  0xa8c7,
+  0x1f4e,
+  0x2740,
+  0xaa7a,
+  0xa056,
+  0xa809,
+  0x2575,
+  0xa496,
+  0x2c0e,
+  0x23cf,
+  0x2ad9,
+  0x20c4,
+  0x28e4,
+  0x9865,
+  0x280e,
+  0xa4d5,
+  0xa115,
+  0x281e,
+  0x27b5,
+  0x2616,
+  0xa201,
+  0xa4f2,
+  0xa8a1,
+  0x1e87,
+  0x9d32,
+  0x9b51,
+  0x17d2,
+  0x296d,
+  0x192f,
+  0xabdb,
+  0xab11,
+  0x1c25,
+  0x25bd,
+  0x11f2,
+  0xa5b1,
+  0xa53e,
+  0x9e15,
+  0xaaed,
+  0xaaa3,
+  0xa5ae,
+  0x2548,
+  0xa446,
+  0xa465,
+  0x206c,
+  0x256f,
+  0x1bac,
+  0x24dd,
+  0x267b,
+  0x2ab4,
+  0x2382,
+  0x1a89,
+  0xab00,
+  0x9a41,
+  0x2174,
+  0xa2d5,
+  0xa7ab,
+  0x220c,
+  0x2966,
+  0x2649,
+  0x272b,
+  0xa9da,
+  0xa910,
+  0x9bc0,
+  0xa727,
+  0xa890,
+  0x2494,
+  0x29ab,
+  0x246c,
+  0xa4a8,
+  0xa78d,
+  0xa73e,
+  0xa346,
+  0xa9ce,
+  0x24fb,
+  0xa531,
+  0xadaa,
+  0x2002,
+  0x2c52,
+  0x263e,
+  0x2900,
+  0x2929,
+  0x28b6,
+  0xad95,
+  0x1962,
+  0x230b,
+  0x2717,
+  0x287c,
+  0x2913,
+  0xa8c6,
+  0x9829,
+  0xa30c,
+  0xa55d,
+  0x2717,
+  0x28fc,
+  0xa4a2,
+  0xa026,
+  0xa762,
+  0x2ab1,
+  0x8e08,
+  0x1dc5,
+  0x2713,
+  0xaa31,
+  0x1f76,
+  0x2878,
+  0x27a8,
+  0x22d3,
+  0xa9e7,
+  0x297f,
+  0x295c,
+  0xac77,
+  0xa91a,
+  0xa377,
+  0xaacd,
+  0xa80d,
+  0x29f6,
+  0xa319,
+  0xac4c,
+  0xa529,
+  0x9821,
+  0xa77e,
+  0xa4be,
+  0xaa72,
+  0x29cd,
+  0x27c2,
+  0x1e6e,
+  0x278e,
+  0x1e3e,
+  0x9e62,
+  0x2402,
+  0x1cfa,
+  0x1d3d,
+  0x1d3c,
+  0x24ae,
+  0xa637,
+  0xa2ff,
+  0x9734,
+  0x1613,
+  0xaa38,
+  0x97b2,
+  0x2742,
+  0xa900,
+  0x9db0,
+  0x2078,
+  0x238d,
+  0x1757,
+  0xa6c1,
+  0xa807,
+  0xa5b0,
+  0x9d6d,
+  0xa8ae,
+  0x25ad,
+  0x2b52,
+  0x2315,
+  0x2156,
+  0xa87e,
+  0x22e0,
+  0xaa76,
+  0x2481,
+  0x2995,
+  0x9f01,
+  0x1182,
+  0x29ee,
+  0x2126,
+  0x25eb,
+  0xa8ad,
+  0xa935,
+  0x2933,
+  0xa71f,
+  0x1c7b,
+  0xa820,
+  0x1c0b,
+  0x2935,
+  0xaae8,
+  0x1ed8,
+  0xa64e,
+  0x283a,
+  0x8d63,
+  0x9038,
+  0x24e1,
+  0xa6f1,
+  0xa6d2,
+  0xac47,
+  0x23d2,
+  0x9fcd,
+  0x1fd3,
+  0x2b29,
+  0x25f3,
+  0x9e91,
+  0xa6c6,
+  0x1da2,
+  0x20a2,
+  0xa3b2,
+  0xa7cb,
+  0xac8c,
+  0x1f64,
+  0x23ab,
+  0xa63b,
+  0xa635,
+  0x235a,
+  0x28e6,
+  0x2b6a,
+  0xae8f,
+  0xa0ed,
+  0x22cc,
+  0xa489,
+  0x2c22,
+  0x87a4,
+  0xa468,
+  0x26dc,
+  0xa996,
+  0xacd2,
+  0x1b1e,
+  0xa03a,
+  0x244b,
+  0x9ced,
+  0xabf8,
+  0xa51c,
+  0x21b0,
+  0x2615,
+  0x9925,
+  0xa4f6,
+  0x28f2,
+  0xa021,
+  0x1fba,
+  0xa359,
+  0x9fb1,
+  0x251e,
+  0x1c62,
+  0x9c98,
+  0x28ea,
+  0x1acd,
+  0x2630,
+  0x9f0a,
+  0x29d0,
+  0x197a,
+  0x252f,
+  0xa914,
+  0x2068,
+  0xa20d,
+  0xa5f3,
+  0x1c0c,
+  0x2c0d,
+  0xa642,
+  0x2135,
+  0x2176,
+  0x2054,
+  0xa713,
+  0xa736,
+  0x2816,
+  0xa474,
+  0x9d00,
+  0x2015,
+  0xab9b,
+  0xa922,
+  0x25a4,
+  0x2520,
+  0x1d41,
+  0x254f,
+  0xa4bd,
+  0x24b2,
+  0x2912,
+  0xa962,
+  0x2939,
+  0x19ca,
+  0x2608,
+  0xa63f,
+  0x2412,
+  0xa9d3,
+  0x26ff,
+  0x9932,
+  0x248a,
+  0x26a1,
+  0x292f,
+  0xabdf,
+  0x964a,
+  0x29e7,
+  0x28db,
+  0x2a33,
+  0x1cc5,
+  0xaab5,
+  0x9963,
+  0x9ff9,
+  0x136c,
+  0x9d4c,
+  0x22fe,
+  0x2d4b,
+  0x28b4,
+  0x2be7,
+  0xac52,
+  0x2057,
+  0x23e8,
+  0xa66c,
+  0xa221,
+  0x1dd6,
+  0x2984,
+  0x1c80,
+  0x2948,
+  0x2020,
+  0xa564,
+  0x27ba,
+  0x26ff,
+  0x9f7e,
+  0xaaf3,
+  0xa1c8,
+  0x2c80,
+  0xa801,
+  0xa417,
+  0xa30f,
+  0x28fa,
+  0x259d,
+  0x1fb5,
+  0x2235,
+  0xa138,
+  0x2413,
+  0x2257,
+  0x2bdb,
+  0xab97,
+  0x262b,
+  0x1d2e,
+  0xa82b,
+  0xab38,
+  0x17d0,
+  0xa72e,
+  0x29d2,
+  0xa960,
+  0x9864,
+  0x9d65,
+  0x280d,
+  0x25b7,
+  0x2b25,
+  0x1f0d,
+  0x28f3,
+  0x2a01,
+  0x1a71,
+  0x9422,
+  0x9ff9,
+  0x11cc,
+  0x2851,
+  0xa859,
+  0x282e,
+  0xa16c,
+  0x2865,
+  0xa54f,
+  0x242d,
+  0xa7e9,
+  0xa610,
+  0xa7bd,
+  0x2b00,
+  0xa43a,
+  0x2080,
+  0xa978,
+  0x219e,
+  0x2855,
+  0x215e,
+  0xaaaf,
+  0xa0b4,
+  0x2802,
+  0xa0e0,
+  0x2a06,
+  0xa967,
+  0x248e,
+  0x9ad3,
+  0xa651,
+  0xa918,
+  0xa1d0,
+  0x9e01,
+  0x2758,
+  0x2282,
+  0xab3f,
+  0x20a1,
+  0xac3d,
+  0xa7fa,
+  0xa982,
+  0x2131,
+  0xa2d4,
+  0xa83f,
+  0x837c,
+  0xa509,
+  0xa89b,
+  0xa766,
+  0xa50a,
+  0x2480,
+  0x9ffe,
+  0x2994,
+  0x226d,
+  0xa582,
+  0x99e5,
+  0xaaae,
+  0xaa1a,
+  0xa591,
+  0xaad0,
+  0x1ba9,
+  0x214c,
+  0x25bf,
+  0x9816,
+  0xa3a1,
+  0xa444,
+  0xa41c,
+  0x9ca0,
+  0x282f,
+  0x2223,
+  0x26b3,
+  0x25af,
+  0xa8c9,
+  0xa057,
+  0xa1aa,
+  0x21b8,
+  0xa542,
+  0x9cc8,
+  0x9cae,
+  0xa772,
+  0x2843,
+  0x1f9b,
+  0x10d9,
+  0xa035,
+  0x207e,
+  0x2158,
+  0xa416,
+  0xa204,
+  0x2cc4,
+  0x9add,
+  0x27b8,
+  0xa8aa,
+  0x9a86,
+  0x27c8,
+  0xabdd,
+  0x2b4b,
+  0x976b,
+  0x2537,
+  0x9d93,
+  0xa014,
+  0xa391,
+  0x1881,
+  0xa9e3,
+  0x281d,
+  0xa813,
+  0xabe9,
+  0x273c,
+  0x2201,
+  0xa990,
+  0x211d,
+  0xa8cb,
+  0xa5e4,
+  0x2771,
+  0x266a,
+  0xa674,
+  0x1d8b,
+  0x2b3a,
+  0x2878,
+  0x991f,
+  0xa191,
+  0xa59e,
+  0x2ac9,
+  0xa874,
+  0xa179,
+  0x2c1f,
+  0x2506,
+  0xa85e,
+  0xa9c7,
+  0x25fa,
+  0xa51c,
+  0xa3ce,
+  0xa4ea,
+  0xa585,
+  0x1686,
+  0xa32e,
+  0x28f4,
+  0x2bb6,
+  0x2091,
+  0x24a4,
+  0x2669,
+  0x26d1,
+  0x1f14,
+  0xa016,
+  0xa657,
+  0x23ac,
+  0x2c7f,
+  0x27ab,
+  0x21aa,
+  0x261e,
+  0xa854,
+  0xa498,
+  0xa8de,
+  0x2235,
+  0xa77e,
+  0x9d67,
+  0xa256,
+  0x24a0,
+  0x2386,
+  0x255d,
+  0x26d3,
+  0x1e3e,
+  0x2aca,
+  0x23f4,
+  0x9795,
+  0x2a20,
+  0xaa93,
+  0x224f,
+  0x9aac,
+  0x2cfc,
+  0xa4cf,
+  0x25e3,
+  0x2b30,
+  0xad24,
+  0x9b91,
+  0x22a5,
+  0x28f0,
+  0x2457,
+  0x2a84,
+  0xab29,
+  0x1da1,
+  0xa89d,
+  0x2534,
+  0x15df,
+  0xa3d8,
+  0x1f54,
+  0x2438,
+  0xa51c,
+  0xa5f3,
+  0xa0d8,
+  0x2722,
+  0xa871,
+  0x9d36,
+  0xa68b,
+  0xa1d5,
+  0x1e7c,
+  0x209d,
+  0x257f,
+  0x206a,
+  0x2654,
+  0x2904,
+  0xa144,
+  0x2aff,
+  0x2878,
+  0xa97e,
+  0xa8ee,
+  0xa75b,
+  0x2b9c,
+  0xa461,
+  0xa626,
+  0x251a,
+  0x9d08,
+  0x14e5,
+  0x29c5,
+  0xa432,
+  0xa4fc,
+  0xa380,
+  0x2673,
+  0x2999,
+  0x0ec0,
+  0x2844,
+  0xa648,
+  0xa425,
+  0x2829,
+  0xa407,
+  0xa05d,
+  0x1523,
+  0x96a2,
+  0xa749,
+  0xa4b7,
+  0x2c0b,
+  0x2c36,
+  0x2969,
+  0x2723,
+  0x94dd,
+  0x28fe,
+  0xa4ec,
+  0xa911,
+  0x9e7d,
+  0x292c,
+  0x237a,
+  0xa43c,
+  0x156a,
+  0x2575,
+  0x9dd6,
+  0xaa12,
+  0x1c3b,
+  0xa650,
+  0xa5be,
+  0x267a,
+  0xabab,
+  0xa8ce,
+  0x2c33,
+  0xa464,
+  0x1d28,
+  0xa846,
+  0x1c3a,
+  0x2044,
+  0x2c2e,
+  0xa612,
+  0xa62d,
+  0x29eb,
+  0x1bcb,
+  0xa9df,
+  0xa4fe,
+  0xa0c8,
+  0x239e,
+  0xa733,
+  0x2c7f,
+  0x1d72,
+  0x25f3,
+  0x2521,
+  0x04b8,
+  0xacc3,
+  0x8973,
+  0x22eb,
+  0xa614,
+  0xa1f5,
+  0x9d70,
+  0x1f24,
+  0x2c57,
+  0xab0d,
+  0xa0ad,
+  0xa102,
+  0xa7d8,
+  0xa86c,
+  0xa8bf,
+  0x9d37,
+  0x2701,
+  0xac28,
+  0xa92e,
+  0xa4ae,
+  0x2041,
+  0x27d9,
+  0xa5d4,
+  0xa757,
+  0xa489,
+  0x2472,
+  0x208b,
+  0xa0d5,
+  0x2244,
+  0xa821,
+  0xa753,
+  0x2af8,
+  0xa42d,
+  0xa900,
+  0xab18,
+  0xa987,
+  0x9c65,
+  0xa0e1,
+  0xa568,
+  0x9c4b,
+  0x159e,
+  0xa830,
+  0x97f2,
+  0xa26b,
+  0x1cef,
+  0x9936,
+  0x261e,
+  0x2981,
+  0x2427,
+  0xa822,
+  0x2588,
+  0xaaf2,
+  0xa3e1,
+  0xa673,
+  0xa443,
+  0xa56c,
+  0x2533,
+  0xa4ad,
+  0xa053,
+  0x1c97,
+  0x2c59,
+  0xa656,
+  0xa1fd,
+  0xa45f,
+  0x2440,
+  0x981c,
+  0x26a7,
+  0xaa02,
+  0x24de,
+  0xab27,
+  0xa72d,
+  0x9b2c,
+  0x260b,
+  0x28c4,
+  0x9a02,
+  0x269b,
+  0x99b5,
+  0xa6d9,
+  0x1d81,
+  0x1dfd,
+  0x9e3f,
+  0x9cf6,
+  0xa44a,
+  0x99cf,
+  0xa7da,
+  0xa2c5,
+  0x973e,
+  0x26dd,
+  0x2963,
+  0x9c21,
+  0x9e8e,
+  0x2a47,
+  0xa7cf,
+  0x28ea,
+  0x2918,
+  0x24ed,
+  0x1828,
+  0xa656,
+  0xa8fd,
+  0xa0ac,
+  0x9c70,
+  0xa4da,
+  0xa7b6,
+  0xa654,
+  0x1980,
+  0xa665,
+  0xa802,
+  0xa7c9,
+  0xa41e,
+  0x206f,
+  0xa833,
+  0xa512,
+  0xa713,
+  0x28ad,
+  0x13dd,
+  0xa111,
+  0x29b8,
+  0x2352,
+  0x2988,
+  0x23ea,
+  0x9d65,
+  0x203a,
+  0x16c9,
+  0xa580,
+  0x29ef,
+  0x2697,
+  0xa971,
+  0x2559,
+  0xa491,
+  0x2a26,
+  0x2771,
+  0x28d6,
+  0x95ab,
+  0x2408,
+  0x2527,
+  0x969d,
+  0x1d58,
+  0xa8b9,
+  0x0bd0,
+  0xa928,
+  0x2536,
+  0xa509,
+  0x28aa,
+  0xa853,
+  0x25c9,
+  0xa5de,
+  0xa958,
+  0xa17f,
+  0x2902,
+  0xa80a,
+  0x2a5d,
+  0xa55e,
+  0xa7ec,
+  0xaa72,
+  0xa2c5,
+  0xa9ad,
+  0xa785,
+  0xab14,
+  0x26c0,
+  0x1edc,
+  0x288a,
+  0x241b,
+  0xa5b9,
+  0xa81a,
+  0xa805,
+  0x99ed,
+  0x24a7,
+  0x20c1,
+  0xa43a,
+  0x141e,
+  0xaa15,
+  0xa6ad,
+  0x2c94,
+  0x1fff,
+  0x1ab8,
+  0xac0c,
+  0x2927,
+  0xa7c2,
+  0xa6bf,
+  0xa792,
+  0x9e5e,
+  0x19a5,
+  0xa409,
+  0x1b44,
+  0x15a7,
+  0x14b4,
+  0x1de5,
+  0x29d8,
+  0xa415,
+  0x2821,
+  0x2767,
+  0xa5bf,
+  0x9d7e,
+  0x2ceb,
+  0x9521,
+  0xa44d,
+  0x2298,
+  0x0c75,
+  0xa242,
+  0x202d,
+  0xa2b9,
+  0x2338,
+  0xab9c,
+  0xa8f5,
+  0x22d5,
+  0x27ff,
+  0xa1fb,
+  0xa161,
+  0x27bc,
+  0xa577,
+  0xa805,
+  0xad04,
+  0x169e,
+  0x2899,
+  0xa550,
+  0x139d,
+  0xab34,
+  0xa04b,
+  0x9c35,
+  0x209e,
+  0x2b4c,
+  0xabdd,
+  0x26d4,
+  0xa3eb,
+  0xa44b,
+  0x2a64,
+  0xaabc,
+  0xa889,
+  0x2957,
+  0xa1d6,
+  0x8c06,
+  0x9df1,
+  0xa44b,
+  0xa0a2,
+  0xa817,
+  0x991b,
+  0xa670,
+  0xa2a7,
+  0x29ef,
+  0xac1c,
+  0xa6df,
+  0x9dc6,
+  0xa56b,
+  0x2720,
+  0xa8f8,
+  0xa932,
+  0x285a,
+  0x1d4a,
+  0xa648,
+  0x1eaf,
+  0xa4fd,
+  0x22b2,
+  0x8e30,
+  0x9da0,
+  0x25c1,
+  0x288d,
+  0xa1c6,
+  0x21d0,
+  0xa3ad,
+  0xaae5,
+  0x25e5,
+  0xac0b,
+  0xa433,
+  0xaac3,
+  0x25d3,
+  0x25ee,
+  0x9fab,
+  0x241f,
+  0x2508,
+  0x9c0d,
+  0xa4b1,
+  0x260e,
+  0x9b97,
+  0x2c04,
+  0x2332,
+  0x26ff,
+  0x24de,
+  0x25d1,
+  0x28ce,
+  0x9e60,
+  0x2ab4,
+  0x234c,
+  0x24d2,
+  0xabbe,
+  0x9943,
+  0xa4bb,
+  0xa2a5,
+  0x21ff,
+  0x2185,
+  0x23f4,
+  0x255a,
+  0x26f4,
+  0xab9b,
+  0x2a27,
+  0xa165,
+  0x247a,
+  0x29f6,
+  0x9f10,
+  0x25fc,
+  0x98ad,
+  0xaa40,
+  0xacf1,
+  0x8638,
+  0x21d4,
+  0xa735,
+  0x98f9,
+  0x25fc,
+  0x2212,
+  0xa124,
+  0xa8ed,
+  0xa629,
+  0x9c9d,
+  0xa4d4,
+  0xa830,
+  0x28c0,
+  0x287e,
+  0x9cbf,
+  0x2960,
+  0xa77a,
+  0xabb7,
+  0xac7d,
+  0x2a54,
+  0xa529,
+  0x26c3,
+  0x2687,
+  0x230b,
+  0xa5be,
+  0x28bb,
+  0x1824,
+  0xa341,
+  0x187a,
+  0x2828,
+  0xa5e9,
+  0x9c5c,
+  0xac9c,
+  0xaa46,
+  0x2b67,
+  0xa613,
+  0xa663,
+  0xa9fe,
+  0x25bb,
+  0xa975,
+  0x257e,
+  0x9ec9,
+  0x299b,
+  0x9dce,
+  0x2bea,
+  0xa47a,
+  0x28d8,
+  0x2d33,
+  0x1844,
+  0x206d,
+  0xa0c2,
+  0xa67e,
+  0xa8a3,
+  0x2a0a,
+  0x2859,
+  0x1ca1,
+  0x1cd3,
+  0xaae0,
+  0xa97e,
+  0x2ad5,
+  0x9f59,
+  0xa9c9,
+  0x284a,
+  0xa34d,
+  0xa603,
+  0x2575,
+  0xa865,
+  0x24cc,
+  0x1eeb,
+  0x25c3,
+  0xa8ae,
+  0x9b82,
+  0x0d6f,
+  0x1410,
+  0x2514,
+  0x20b0,
+  0xa8c5,
+  0x27b2,
+  0xa6a2,
+  0xa852,
+  0x9f68,
+  0x1c3d,
+  0xaa7d,
+  0xa79e,
+  0x2462,
+  0x1ffa,
+  0xa27d,
+  0x1e02,
+  0x1ab9,
+  0x206a,
+  0x20a6,
+  0x9835,
+  0x2633,
+  0xa233,
+  0x26ff,
+  0x98e7,
+  0x291f,
+  0x283c,
+  0xa9bc,
+  0xa446,
+  0xa93c,
+  0xa55f,
+  0x2b9e,
+  0xa9e2,
+  0x9e53,
+  0x217f,
+  0xa6a2,
+  0x21fc,
+  0xa382,
+  0x27a4,
+  0x2bac,
+  0x2789,
+  0xa415,
+  0xa08e,
+  0x271d,
+  0x1d37,
+  0x2a44,
+  0x2929,
+  0x2e05,
+  0xa042,
+  0x2523,
+  0x28fa,
+  0x28f4,
+  0x278e,
+  0x2b59,
+  0x1c55,
+  0x0f9e,
+  0xa430,
+  0x292b,
+  0x2d27,
+  0xa3a1,
+  0x9cf3,
+  0x21a7,
+  0x27c5,
+  0xa2bd,
+  0xa42e,
+  0xa023,
+  0x2603,
+  0x91e4,
+  0x1bbb,
+  0x2897,
+  0x2103,
+  0x19c3,
+  0x2033,
+  0x9ed3,
+  0x12ff,
+  0x259e,
+  0x1449,
+  0x1d14,
+  0xa67c,
+  0x25da,
+  0xacec,
+  0x2186,
+  0x273a,
+  0x28be,
+  0x94c9,
+  0x2a30,
+  0xac2a,
+  0x9d57,
+  0x2986,
+  0xa8a1,
+  0x28eb,
+  0x9f95,
+  0x9467,
+  0x24ba,
+  0x22d4,
+  0x28ee,
+  0x2752,
+  0xa9dd,
+  0xa2e6,
+  0xa83c,
+  0x1e43,
+  0x282d,
+  0xa465,
+  0xa1da,
+  0x9b7a,
+  0xaa03,
+  0xa4bb,
+  0xa702,
+  0xa11b,
+  0x219c,
+  0xab93,
+  0x2094,
+  0x1e27,
+  0xa52b,
+  0xab58,
+  0x2273,
+  0x15c9,
+  0x28ff,
+  0xa966,
+  0xa5be,
+  0xaa4d,
+  0xa0ed,
+  0x9acf,
+  0x1732,
+  0xa324,
+  0xac64,
+  0xab89,
+  0xa38d,
+  0xa99e,
+  0x25c7,
+  0x2ba4,
+  0xad62,
+  0x8ebe,
+  0xa534,
+  0x2795,
+  0x2b06,
+  0xa970,
+  0x23bb,
+  0xac60,
+  0xac0a,
+  0xa7db,
+  0x95eb,
+  0x2a90,
+  0x2cad,
+  0x201c,
+  0x1e28,
+  0xaa94,
+  0xa7b1,
+  0xa39b,
+  0x2b89,
+  0x2081,
+  0xab6f,
+  0xa0ef,
+  0x29cb,
+  0x22cc,
+  0xa72b,
+  0x2224,
+  0x166a,
+  0xa3b2,
+  0x17c6,
+  0x9414,
+  0xa201,
+  0x2aea,
+  0x2b6e,
+  0x1a32,
+  0x1980,
+  0xa82b,
+  0xa9cb,
+  0x24f3,
+  0x2908,
+  0x1e6e,
+  0x25a1,
+  0x2e62,
+  0x9c7b,
+  0x253d,
+  0x2d94,
+  0xa6be,
+  0xa3f5,
+  0x1e7b,
+  0xa618,
+  0x944b,
+  0x289c,
+  0x26e2,
+  0xa8be,
+  0xa3e7,
+  0xa72e,
+  0xa82d,
+  0x2a31,
+  0x25ca,
+  0x229b,
+  0x196e,
+  0x23de,
+  0x2a8e,
+  0x2885,
+  0x2b98,
+  0xa215,
+  0x1a05,
+  0xa5c4,
+  0x9de9,
+  0x9ffa,
+  0x1fde,
+  0x2da0,
+  0x208c,
+  0x1955,
+  0xa12d,
+  0x27ed,
+  0x27ce,
+  0x2179,
+  0xa457,
+  0xaa41,
+  0xa732,
+  0x16fc,
+  0xa61b,
+  0x230a,
+  0xac11,
+  0xa990,
+  0x2407,
+  0x2856,
+  0x23eb,
+  0x23f3,
+  0x1be4,
+  0xa53a,
+  0x243e,
+  0x277f,
+  0xa588,
+  0x20aa,
+  0x2cf2,
+  0x25a2,
+  0x201b,
+  0x2706,
+  0xa46e,
+  0x287e,
+  0xa502,
+  0x9ccf,
+  0x2688,
+  0x230f,
+  0x9ca2,
+  0x2551,
+  0x205f,
+  0x2c0b,
+  0x2a02,
+  0x89ce,
+  0x2974,
+  0x2598,
+  0x1c3a,
+  0xac4b,
+  0x2a79,
+  0x2644,
+  0x29e5,
+  0x274f,
+  0xaaf0,
+  0xa832,
+  0xa8d1,
+  0xa5c0,
+  0xa885,
+  0x2796,
+  0x287f,
+  0x2566,
+  0x1dbc,
+  0xa98b,
+  0x2219,
+  0x9ef6,
+  0x2437,
+  0xa77a,
+  0xa146,
+  0xa557,
+  0xa2f0,
+  0x24d5,
+  0xa6fe,
+  0xa694,
+  0xa237,
+  0x265d,
+  0xa9aa,
+  0x9ed8,
+  0xa625,
+  0xa7a8,
+  0xa7e1,
+  0x1dd0,
+  0xa995,
+  0x9df2,
+  0xaba3,
+  0x1c7d,
+  0x22ae,
+  0x279f,
+  0xa5f2,
+  0x2921,
+  0x2442,
+  0x9cd9,
+  0xa639,
+  0xa1ef,
+  0x2ada,
+  0x27d8,
+  0x9d64,
+  0x249b,
+  0xa317,
+  0x24fd,
+  0xa714,
+  0xa662,
+  0x1e38,
+  0x292b,
+  0x232e,
+  0xabca,
+  0xaa36,
+  0xa45a,
+  0x223c,
+  0xa7ba,
+  0x9aef,
+  0x9f44,
+  0x2014,
+  0x1912,
+  0x2799,
+  0x256c,
+  0xa4c3,
+  0x2616,
+  0xa9a3,
+  0x2bcb,
+  0x9f89,
+  0xa81d,
+  0x1df8,
+  0xa12c,
+  0x2a0c,
+  0x9452,
+  0x2668,
+  0xa796,
+  0x16a5,
+  0x209d,
+  0xa42b,
+  0x2b37,
+  0x1bb2,
+  0xa887,
+  0x1f16,
+  0x268d,
+  0xa877,
+  0x1d0a,
+  0x24e4,
+  0xa39d,
+  0xac6a,
+  0x1c78,
+  0xa1bb,
+  0x219d,
+  0x27ac,
+  0xa63f,
+  0x1f0d,
+  0x2579,
+  0xa0b2,
+  0x9e5d,
+  0x2869,
+  0x245e,
+  0x2976,
+  0xa626,
+  0xa8bc,
+  0xa81b,
+  0x2b4a,
+  0x2247,
+  0x2011,
+  0x2027,
+  0x265b,
+  0xa841,
+  0xa967,
+  0x962b,
+  0x2628,
+  0x9bad,
+  0x9a81,
+  0x9a4d,
+  0x2191,
+  0x2756,
+  0x209c,
+  0xa881,
+  0x292c,
+  0x25d1,
+  0x2bf0,
+  0x2c7e,
+  0x2ae0,
+  0x2754,
+  0x2728,
+  0xa7ae,
+  0x18d2,
+  0x0fb3,
+  0x2abf,
+  0x1b00,
+  0x2a70,
+  0xa659,
+  0xa25b,
+  0x17e3,
+  0x27b6,
+  0x1826,
+  0xac89,
+  0x1c18,
+  0xa69f,
+  0xa159,
+  0xa8e1,
+  0x9cec,
+  0xa90a,
+  0x242e,
+  0xa62a,
+  0x2488,
+  0x2ae2,
+  0x181a,
+  0x208d,
+  0x24e3,
+  0x2474,
+  0xab4d,
+  0x23c1,
+  0xa84e,
+  0xab4d,
+  0x259e,
+  0x287c,
+  0x2886,
+  0x259c,
+  0xa0dd,
+  0x1dbf,
+  0x2951,
+  0x239d,
+  0xa6a7,
+  0xa3b0,
+  0xa6b9,
+  0x2525,
+  0xa572,
+  0xa593,
+  0xa00d,
+  0x2278,
+  0xaa58,
+  0xa0b9,
+  0xa6f7,
+  0x2a35,
+  0x2315,
+  0xa94b,
+  0x2350,
+  0x24b0,
+  0xa6ea,
+  0x241f,
+  0x24aa,
+  0x2d21,
+  0x2189,
+  0x27e1,
+  0xa02e,
+  0x9ab1,
+  0x99b6,
+  0x2528,
+  0x9c68,
+  0xac60,
+  0xa770,
+  0xac50,
+  0xa6a6,
+  0xa79d,
+  0xa46a,
+  0x281f,
+  0x288f,
+  0xa3d4,
+  0xa37c,
+  0xa464,
+  0x203a,
+  0x2649,
+  0x9834,
+  0x2844,
+  0x2292,
+  0xa5df,
+  0x27d2,
+  0xacbd,
+  0x2893,
+  0x9606,
+  0x2614,
+  0xa621,
+  0x2227,
+  0xa95b,
+  0x2210,
+  0x9bbb,
+  0x25f7,
+  0xa3b4,
+  0xa46e,
+  0xa2ba,
+  0x270f,
+  0x187b,
+  0xa0fc,
+  0x269f,
+  0x287c,
+  0xa5b9,
+  0x1f78,
+  0xa82b,
+  0x9c86,
+  0x2c04,
+  0xa869,
+  0xa27a,
+  0x27ce,
+  0x29f4,
+  0xa823,
+  0x98d6,
+  0x2125,
+  0x2657,
+  0xa84e,
+  0xa11e,
+  0x2732,
+  0x2160,
+  0xa370,
+  0x1ea6,
+  0x29a8,
+  0xa652,
+  0xa6b6,
+  0x9b12,
+  0x1dd3,
+  0xa40a,
+  0xa1f8,
+  0x9398,
+  0x2a9d,
+  0x2aca,
+  0xa825,
+  0xa6f0,
+  0xa543,
+  0x0521,
+  0xa5f6,
+  0x1e45,
+  0x2345,
+  0xa8f9,
+  0x283f,
+  0xaa03,
+  0x2628,
+  0xa9b1,
+  0x0a48,
+  0x24a4,
+  0xa6fb,
+  0xa1e1,
+  0xa352,
+  0x206c,
+  0xaa48,
+  0x2869,
+  0x2ae0,
+  0xa83d,
+  0x24bd,
+  0x1c76,
+  0xa134,
+  0x2669,
+  0x1888,
+  0xa4c4,
+  0x1c4e,
+  0x283f,
+  0xa581,
+  0x20bc,
+  0xaa12,
+  0x2804,
+  0xa9cc,
+  0x29c2,
+  0xa593,
+  0x2b3d,
+  0xa712,
+  0x2505,
+  0xa94f,
+  0x2aae,
+  0xa1ae,
+  0xa897,
+  0x20d4,
+  0xa6d9,
+  0x1da9,
+  0xa961,
+  0xa39b,
+  0x27ec,
+  0x2062,
+  0x249a,
+  0xa627,
+  0x2c0e,
+  0xa312,
+  0x9f4e,
+  0x991d,
+  0xa64f,
+  0xabc5,
+  0x24c2,
+  0x235a,
+  0x28b1,
+  0x22c6,
+  0xa73b,
+  0x1815,
+  0x27e0,
+  0x1f34,
+  0x1da0,
+  0xaa04,
+  0x147d,
+  0xa595,
+  0x1c8a,
+  0xab22,
+  0x2147,
+  0x2179,
+  0x2287,
+  0x228a,
+  0x2a35,
+  0xa715,
+  0x2941,
+  0xac0a,
+  0xa25c,
+  0xa8eb,
+  0x2815,
+  0x23bf,
+  0x204d,
+  0x20eb,
+  0x239d,
+  0xaa91,
+  0x9168,
+  0xa77e,
+  0xa174,
+  0xaa07,
+  0x995c,
+  0xa658,
+  0x9cb9,
+  0x2095,
+  0xa44d,
+  0x1c52,
+  0x2599,
+  0x2442,
+  0x292a,
+  0x2334,
+  0xaaf1,
+  0xa909,
+  0xa6c9,
+  0xa207,
+  0xabfa,
+  0x2e39,
+  0x1fba,
+  0xa6d6,
+  0x2877,
+  0x9c80,
+  0x1c4b,
+  0x1e2b,
+  0x2116,
+  0x1a04,
+  0x1421,
+  0x266b,
+  0x2310,
+  0xa13b,
+  0x2772,
+  0x29fb,
+  0x191f,
+  0xac15,
+  0x1bf6,
+  0x2ae6,
+  0xacdd,
+  0x246a,
+  0xa3f8,
+  0xa1ca,
+  0x9cc2,
+  0xa41d,
+  0x9ee1,
+  0x2342,
+  0x2951,
+  0x9fb3,
+  0xa805,
+  0xaa15,
+  0x911b,
+  0xac0e,
+  0x146f,
+  0xa5a2,
+  0x2486,
+  0x2872,
+  0x27d3,
+  0xa99c,
+  0xab48,
+  0x24d4,
+  0xa5b1,
+  0xa9e9,
+  0x2441,
+  0x0d1b,
+  0xa5a2,
+  0x2542,
+  0x20cb,
+  0x9bf2,
+  0x18f3,
+  0xa5c4,
+  0x2656,
+  0xa588,
+  0xadd8,
+  0xa57d,
+  0x29ab,
+  0x9776,
+  0xa9e4,
+  0xa1b0,
+  0xa232,
+  0xa44e,
+  0x1a86,
+  0x2331,
+  0x2d4a,
+  0xa81a,
+  0x2098,
+  0x29a7,
+  0xa713,
+  0x2119,
+  0x219c,
+  0xa5dd,
+  0x1f99,
+  0x1bd9,
+  0x2992,
+  0xab81,
+  0xa3ba,
+  0x258a,
+  0xab4d,
+  0xa46d,
+  0x0525,
+  0xa55c,
+  0x1e49,
+  0x9f56,
+  0xa9ec,
+  0xa874,
+  0xa626,
+  0x1dce,
+  0x2977,
+  0x1237,
+  0xab0c,
+  0x24cf,
+  0xa105,
+  0xa666,
+  0x22c5,
+  0x9eed,
+  0x2344,
+  0x28e4,
+  0xa717,
+  0xa2c7,
+  0x2118,
+  0xa092,
+  0xa1b7,
+  0x2535,
+  0x2a0f,
+  0x26ce,
+  0xa569,
+  0x25c9,
+  0x2d1c,
+  0xa4dd,
+  0x9803,
+  0x2c2e,
+  0x2c4a,
+  0x8495,
+  0x9b0d,
+  0x2537,
+  0x2d02,
+  0x233d,
+  0xaa2d,
+  0x1f55,
+  0x2537,
+  0x9ea5,
+  0x2188,
+  0x2708,
+  0x16e0,
+  0xa9ad,
+  0x2d0a,
+  0xa7ab,
+  0x2101,
+  0x23e7,
+  0x2b19,
+  0x9d6f,
+  0x1c67,
+  0x1d1b,
+  0x27e0,
+  0xa1ec,
+  0x9f76,
+  0x2692,
+  0xa815,
+  0x1fb8,
+  0xa55f,
+  0x9f99,
+  0xa635,
+  0x2974,
+  0xa1ad,
+  0x21a9,
+  0xa4e3,
+  0x1bce,
+  0x268c,
+  0x1c24,
+  0xa82b,
+  0xa7a0,
+  0x20d3,
+  0xa77c,
+  0xa720,
+  0x9f74,
+  0x2a9b,
+  0xab75,
+  0x2469,
+  0xa672,
+  0x2840,
+  0x989b,
+  0xa42f,
+  0x1bed,
+  0xa67c,
+  0x25ae,
+  0xa6e1,
+  0x2320,
+  0x2604,
+  0x2711,
+  0x20d2,
+  0xa27c,
+  0x9cb1,
+  0x2632,
+  0xa726,
+  0xa6e5,
+  0x279d,
+  0xa768,
+  0x9e8a,
+  0x27d1,
+  0xac51,
+  0x0ea1,
+  0x1486,
+  0xa97c,
+  0x2627,
+  0x2091,
+  0x24a3,
+  0x2c0f,
+  0x1e03,
+  0x95d0,
+  0x24e2,
+  0x282f,
+  0x1dca,
+  0x9c34,
+  0xa462,
+  0xa3f7,
+  0x9904,
+  0xa670,
+  0x2753,
+  0x9da0,
+  0xa91b,
+  0xabff,
+  0xa4c5,
+  0xa509,
+  0x2401,
+  0x2468,
+  0x2af8,
+  0xaca0,
+  0x2a5b,
+  0xa9ea,
+  0xa6fa,
+  0x1ee9,
+  0x1f5c,
+  0xa81e,
+  0x2a09,
+  0x2472,
+  0xa753,
+  0xa5ef,
+  0xabd0,
+  0xaa06,
+  0x262b,
+  0x26f0,
+  0x1fb3,
+  0x282b,
+  0xa694,
+  0xa08c,
+  0x20e9,
+  0xa90a,
+  0xa8b0,
+  0x21d5,
+  0xa00d,
+  0xa202,
+  0x22f3,
+  0xa801,
+  0x2982,
+  0x12b3,
+  0x2ca2,
+  0x2549,
+  0xa745,
+  0x255a,
+  0x2300,
+  0x2849,
+  0x240c,
+  0xa878,
+  0x28f1,
+  0x9c4a,
+  0x2885,
+  0xa61d,
+  0xa2b8,
+  0xa576,
+  0x293f,
+  0x2133,
+  0xac5b,
+  0x20b6,
+  0x242f,
+  0x2538,
+  0xa4d0,
+  0x29d6,
+  0x226b,
+  0xa68d,
+  0xabab,
+  0x2190,
+  0x2880,
+  0xa856,
+  0xa814,
+  0x2725,
+  0xa3ad,
+  0x90d8,
+  0x21db,
+  0x254b,
+  0xab5a,
+  0xa6c1,
+  0x19d5,
+  0x256f,
+  0xacb5,
+  0xa175,
+  0x2a5e,
+  0x2869,
+  0xa84f,
+  0x2559,
+  0x10b1,
+  0x25fe,
+  0x2153,
+  0x289b,
+  0x214a,
+  0xabc5,
+  0x2687,
+  0x247a,
+  0x1cca,
+  0xa1c8,
+  0xa791,
+  0x206b,
+  0x28c9,
+  0x1cff,
+  0x2972,
+  0x23e3,
+  0x28a5,
+  0x9db8,
+  0x21ff,
+  0xa73f,
+  0x1b4a,
+  0x2423,
+  0x1e66,
+  0x22ab,
+  0x9f01,
+  0x23d2,
+  0x1d39,
+  0x22ea,
+  0x2202,
+  0xab65,
+  0x2709,
+  0x291e,
+  0x202f,
+  0xa740,
+  0x1b56,
+  0xa221,
+  0x2a46,
+  0xaa36,
+  0xa5ac,
+  0x0de7,
+  0xaaea,
+  0xa81d,
+  0x21e8,
+  0xa956,
+  0x2096,
+  0xa833,
+  0x250a,
+  0x20dc,
+  0x995d,
+  0xa435,
+  0x1cbc,
+  0xa6ff,
+  0xa3f5,
+  0x98d4,
+  0x2add,
+  0x2251,
+  0xa82f,
+  0xa0e2,
+  0x1fb6,
+  0xa059,
+  0xabc9,
+  0xa85f,
+  0xa82e,
+  0x2786,
+  0xaa10,
+  0xa4f1,
+  0xa8c7,
+  0x1d43,
+  0xa585,
+  0xa765,
+  0xa4dd,
+  0xa873,
+  0x95bb,
+  0xa6b6,
+  0x28b9,
+  0x2919,
+  0x28ab,
+  0xa83a,
+  0xa7a6,
+  0x26cd,
+  0xaaa4,
+  0x2608,
+  0xa646,
+  0xa063,
+  0x1d0c,
+  0x2806,
+  0x2892,
+  0xaa56,
+  0xa92e,
+  0x9d48,
+  0xa510,
+  0xa874,
+  0xa6d3,
+  0xa614,
+  0x2882,
+  0x2225,
+  0xa219,
+  0x902d,
+  0xa937,
+  0x204e,
+  0xa8d4,
+  0x26c9,
+  0xa5dc,
+  0xa61d,
+  0x2281,
+  0x2bf8,
+  0x278a,
+  0x2334,
+  0x260a,
+  0x2452,
+  0x2404,
+  0x238c,
+  0xa8ee,
+  0xa424,
+  0x1f90,
+  0x1e49,
+  0xa5d5,
+  0x9968,
+  0x1242,
+  0x1ff9,
+  0x2538,
+  0x27db,
+  0x2185,
+  0x279d,
+  0xa276,
+  0xa8e7,
+  0xa43a,
+  0xa5a5,
+  0xa9e6,
+  0xa407,
+  0xa624,
+  0xa92d,
+  0xa09c,
+  0x2af1,
+  0x2875,
+  0xa72d,
+  0x1c82,
+  0xa7f9,
+  0xa3be,
+  0x26d7,
+  0x29e2,
+  0x24d9,
+  0xa4ef,
+  0xa83f,
+  0x9f1b,
+  0x280d,
+  0x2c4b,
+  0xa168,
+  0xa3a3,
+  0xa67c,
+  0x2878,
+  0x28cc,
+  0x9b21,
+  0x1480,
+  0x1a5e,
+  0xa5a3,
+  0xa8c4,
+  0xa4b1,
+  0x1c26,
+  0x8e50,
+  0xa680,
+  0x1fc4,
+  0x27af,
+  0x2462,
+  0xa590,
+  0x9236,
+  0xa245,
+  0x2888,
+  0x27b3,
+  0x2c41,
+  0x2b6b,
+  0x26ab,
+  0x2993,
+  0x2569,
+  0x2441,
+  0x2862,
+  0x24b1,
+  0xa1fd,
+  0x2292,
+  0xa4b3,
+  0xa8d8,
+  0xa0ac,
+  0xa47b,
+  0x2a28,
+  0x2382,
+  0x1c3b,
+  0x23aa,
+  0xa7a0,
+  0x2923,
+  0xa887,
+  0xabb2,
+  0x1942,
+  0x28b7,
+  0x9851,
+  0x2aea,
+  0x2511,
+  0x1f5e,
+  0x25b3,
+  0x9d09,
+  0xa329,
+  0x1f52,
+  0xa678,
+  0x240b,
+  0x2cbc,
+  0x2948,
+  0x28c5,
+  0xa6e5,
+  0xaaf3,
+  0xa480,
+  0x21a0,
+  0x265d,
+  0xa149,
+  0xa425,
+  0xa14f,
+  0x245f,
+  0xa4d8,
+  0x2a60,
+  0x26ae,
+  0x1dbb,
+  0x1f8a,
+  0x2907,
+  0xaae9,
+  0x2518,
+  0x9ebf,
+  0xa7fc,
+  0xa477,
+  0xa6a2,
+  0x2985,
+  0xa3cb,
+  0x25bb,
+  0x9eb6,
+  0x28c4,
+  0xa92e,
+  0x1dc1,
+  0x9ef1,
+  0xa90f,
+  0x2a9c,
+  0x1c53,
+  0xa44a,
+  0x1469,
+  0x9dd3,
+  0x271d,
+  0x9d51,
+  0x24c6,
+  0xa329,
+  0xa9dd,
+  0x245c,
+  0xa8d3,
+  0x2324,
+  0x2696,
+  0xab98,
+  0x24be,
+  0x2872,
+  0x8e4f,
+  0x9f77,
+  0x27fa,
+  0xab37,
+  0xac8f,
+  0xa11c,
+  0x2733,
+  0xac78,
+  0x24f4,
+  0xa827,
+  0x1cfd,
+  0x281a,
+  0x25b6,
+  0x2530,
+  0xa3e2,
+  0x1dda,
+  0x27d0,
+  0x2078,
+  0xa5fe,
+  0xa066,
+  0x14b8,
+  0x1d96,
+  0xa64c,
+  0x97c7,
+  0xa5f2,
+  0x273e,
+  0x2934,
+  0xa46a,
+  0xab84,
+  0xa584,
+  0x2af0,
+  0xa4fd,
+  0x265b,
+  0x24ea,
+  0x25e4,
+  0x29e4,
+  0xa07c,
+  0x2acc,
+  0x2acf,
+  0xa62f,
+  0xa291,
+  0xaac7,
+  0xa91e,
+  0x2ad6,
+  0x2c0c,
+  0xa9c4,
+  0x990a,
+  0x28ce,
+  0xaab9,
+  0x27a5,
+  0x209c,
+  0xac3e,
+  0xa73f,
+  0x22b6,
+  0xa6f0,
+  0x16d0,
+  0xa0d9,
+  0xa84a,
+  0x23b7,
+  0xa371,
+  0x9a68,
+  0xa15d,
+  0xa581,
+  0xa2af,
+  0x2af9,
+  0x288d,
+  0x23a2,
+  0x245e,
+  0xa526,
+  0x29a9,
+  0x22bd,
+  0x26b5,
+  0xa5c8,
+  0x9f87,
+  0x2039,
+  0xaa0e,
+  0xabf4,
+  0x2991,
+  0x2c99,
+  0xa04e,
+  0xac0b,
+  0xa5ab,
+  0x2102,
+  0x15cb,
+  0x2650,
+  0xa7f3,
+  0x9a51,
+  0x2620,
+  0x2929,
+  0x1719,
+  0x25d5,
+  0x2419,
+  0x2837,
+  0x28db,
+  0x93c3,
+  0xa426,
+  0x2555,
+  0x27f2,
+  0x20c7,
+  0xa7fd,
+  0xa2c4,
+  0x2b05,
+  0x24f4,
+  0x2db0,
+  0x2ca8,
+  0x24d2,
+  0xa9c4,
+  0x9047,
+  0x24c5,
+  0x2991,
+  0xa5cd,
+  0x99ab,
+  0x1fd2,
+  0x27d9,
+  0xaaec,
+  0x2025,
+  0x254b,
+  0x25ba,
+  0x2516,
+  0x29f8,
+  0x95ef,
+  0x9320,
+  0x1eab,
+  0x2276,
+  0x9315,
+  0x208d,
+  0x2879,
+  0xa5f4,
+  0x9f74,
+  0x2409,
+  0x1da8,
+  0x29a0,
+  0x1f0a,
+  0x2401,
+  0x25ba,
+  0x2532,
+  0x26b0,
+  0xa5bc,
+  0x1a2f,
+  0xa8d1,
+  0x22bf,
+  0x14fc,
+  0xae2a,
+  0x2394,
+  0xaa2e,
+  0x2476,
+  0x2410,
+  0xa0aa,
+  0x2ab7,
+  0x9a2e,
+  0xa685,
+  0xa184,
+  0xa171,
+  0xa83f,
+  0x1e82,
+  0x21c5,
+  0xa2f0,
+  0xa169,
+  0x0748,
+  0x289d,
+  0xaa19,
+  0x2ac0,
+  0x25ce,
+  0xa1c3,
+  0x1e3b,
+  0xa3a8,
+  0xa8d0,
+  0x25dd,
+  0x299b,
+  0xa947,
+  0xa9c7,
+  0x2824,
+  0x2a3e,
+  0x2840,
+  0xa6a2,
+  0xabe4,
+  0x2913,
+  0xa063,
+  0x9cc3,
+  0xa7cd,
+  0xa148,
+  0xaaef,
+  0x2b04,
+  0x2194,
+  0x2b41,
+  0x2b68,
+  0x212b,
+  0x1042,
+  0x2bb7,
+  0xa6d1,
+  0x2678,
+  0x258a,
+  0x8f40,
+  0x29e4,
+  0xa824,
+  0xa7d2,
+  0x240e,
+  0x1c5d,
+  0xa807,
+  0x27ab,
+  0x11bd,
+  0x9ed2,
+  0xa847,
+  0x22eb,
+  0xa707,
+  0xa83e,
+  0x9f47,
+  0xa2fe,
+  0x2142,
+  0xa54f,
+  0x1fd7,
+  0x1958,
+  0x26c9,
+  0x1cd7,
+  0x2345,
+  0x26ac,
+  0x26c3,
+  0xa028,
+  0x2828,
+  0xa96a,
+  0xa36a,
+  0xa1dd,
+  0x2791,
+  0x2a23,
+  0xad56,
+  0x26db,
+  0x2062,
+  0x25b6,
+  0x1948,
+  0xa4c4,
+  0x1759,
+  0x248c,
+  0xa11e,
+  0x2c30,
+  0x2948,
+  0xa8a8,
+  0x28bb,
+  0x299d,
+  0x2586,
+  0x1822,
+  0x23b3,
+  0xa11c,
+  0x1d9b,
+  0x2af5,
+  0x23af,
+  0xa892,
+  0xa209,
+  0xa91d,
+  0x2699,
+  0xa78d,
+  0x9cd3,
+  0x25f0,
+  0x9ada,
+  0xa694,
+  0x26d8,
+  0xa477,
+  0xa114,
+  0x238c,
+  0xa43a,
+  0xacaf,
+  0x265e,
+  0x224e,
+  0x29c7,
+  0xa6e6,
+  0xa0f1,
+  0xab50,
+  0xa586,
+  0x29c6,
+  0xa7d9,
+  0xa832,
+  0x991f,
+  0x2680,
+  0xa8d7,
+  0x02c9,
+  0xa8e0,
+  0xa4dd,
+  0x1607,
+  0x2775,
+  0xa03e,
+  0x2722,
+  0x2817,
+  0x26da,
+  0x1cf9,
+  0x1a24,
+  0x9447,
+  0xa95c,
+  0x2886,
+  0xa77e,
+  0xa3b2,
+  0x23ab,
+  0x2a25,
+  0x2501,
+  0xa7b0,
+  0x15b2,
+  0x2a8a,
+  0x23bf,
+  0x2931,
+  0xa0c9,
+  0x1dd6,
+  0x26cc,
+  0x1d36,
+  0x264b,
+  0xaa9d,
+  0x9a58,
+  0x2a39,
+  0x1c83,
+  0xa570,
+  0x25b0,
+  0x2cba,
+  0x203e,
+  0x2d1c,
+  0xa0d6,
+  0x9ecb,
+  0xabd1,
+  0x23fd,
+  0x27af,
+  0x1e37,
+  0xae72,
+  0x257b,
+  0x209a,
+  0x1bb8,
+  0x20a0,
+  0x29f9,
+  0x1b3e,
+  0x2a89,
+  0xa50d,
+  0x2c06,
+  0xaa33,
+  0x28e3,
+  0x9ef6,
+  0x262b,
+  0x2747,
+  0x2290,
+  0x1dd4,
+  0x2642,
+  0x2073,
+  0xa4d7,
+  0xac25,
+  0xa88f,
+  0x293a,
+  0xa6e1,
+  0x9e66,
+  0xa912,
+  0x182f,
+  0x20be,
+  0xa61c,
+  0xaa70,
+  0xa45e,
+  0x290d,
+  0xa876,
+  0x207e,
+  0x2341,
+  0x2215,
+  0x192a,
+  0xa55a,
+  0x29af,
+  0xadad,
+  0x2a85,
+  0xae5c,
+  0x29ca,
+  0x9c0d,
+  0xa886,
+  0x181c,
+  0xaa77,
+  0x26cb,
+  0x29a6,
+  0x9ea2,
+  0xa80d,
+  0xa873,
+  0x1ce2,
+  0xa888,
+  0xa5d0,
+  0xab1d,
+  0xa2d3,
+  0x1848,
+  0x20c6,
+  0xa7b8,
+  0x9cb0,
+  0xa0b8,
+  0xa97a,
+  0x2a0e,
+  0xa3eb,
+  0xa93c,
+  0xa877,
+  0x9e38,
+  0xab0f,
+  0xa8f3,
+  0x2df6,
+  0x23e0,
+  0xa40c,
+  0x2504,
+  0x2228,
+  0x9576,
+  0x989f,
+  0x9362,
+  0x1fc6,
+  0x257b,
+  0xa636,
+  0x9da9,
+  0x2a5a,
+  0x9b46,
+  0x2242,
+  0x2612,
+  0xa4ef,
+  0x24af,
+  0xa450,
+  0x23a1,
+  0x1878,
+  0x244e,
+  0x27b4,
+  0xa144,
+  0x2969,
+  0x2985,
+  0x9e00,
+  0xa700,
+  0xa55e,
+  0x2cd4,
+  0xa5d3,
+  0x2033,
+  0x2ad6,
+  0xa479,
+  0x2056,
+  0x26d9,
+  0x9f6b,
+  0xae06,
+  0xa503,
+  0x8680,
+  0x15df,
+  0x29bb,
+  0x2cb4,
+  0xa3fe,
+  0x1dfe,
+  0xa401,
+  0x2831,
+  0x2875,
+  0x189f,
+  0x2693,
+  0xad45,
+  0x9f8e,
+  0xad8b,
+  0xa1c3,
+  0xa1e5,
+  0x287d,
+  0x15f5,
+  0x9caf,
+  0xa87a,
+  0xa84f,
+  0xa8f6,
+  0xa982,
+  0x28ee,
+  0x28ce,
+  0xa48e,
+  0xaa78,
+  0xa1fd,
+  0xa431,
+  0x9382,
+  0xa4e5,
+  0x99dc,
+  0xa853,
+  0x841c,
+  0xa50b,
+  0x2975,
+  0xa5ac,
+  0xa4a4,
+  0xa746,
+  0xa634,
+  0x2912,
+  0x2ce7,
+  0xa951,
+  0x8ec0,
+  0x226d,
+  0x2994,
+  0xa66b,
+  0x1515,
+  0xa2bf,
+  0x98ea,
+  0x2ac8,
+  0xa722,
+  0xa8cb,
+  0xa5d1,
+  0xa46c,
+  0x19d9,
+  0xa834,
+  0xa51e,
+  0x8c9e,
+  0xa79c,
+  0x19e2,
+  0xa767,
+  0x2821,
+  0xa189,
+  0xa7a8,
+  0x9ce6,
+  0xaaff,
+  0x2828,
+  0x1f54,
+  0x20bd,
+  0xa552,
+  0xa840,
+  0x9d0d,
+  0xac0e,
+  0x243c,
+  0x12bd,
+  0x1d12,
+  0x208b,
+  0x2046,
+  0x9fa9,
+  0xa10e,
+  0x93df,
+  0x28f2,
+  0xab04,
+  0x2991,
+  0x1a48,
+  0xa286,
+  0x224d,
+  0xa81f,
+  0x2844,
+  0x2242,
+  0xa798,
+  0xa404,
+  0xa434,
+  0xa3cc,
+  0x2024,
+  0xaa70,
+  0x2b19,
+  0x2424,
+  0x26de,
+  0x22e3,
+  0xaa04,
+  0xabb4,
+  0x20e6,
+  0xaa66,
+  0x28de,
+  0x2885,
+  0xaa91,
+  0x99af,
+  0x2924,
+  0xa3dd,
+  0xac7b,
+  0xa16e,
+  0x27b8,
+  0xa849,
+  0x9fbc,
+  0xa8d2,
+  0x2a0e,
+  0xa084,
+  0xaafb,
+  0x2c76,
+  0x2935,
+  0x28fa,
+  0xa2cf,
+  0x276d,
+  0x9649,
+  0x2640,
+  0xa409,
+  0xa0c9,
+  0x140f,
+  0xa47a,
+  0x9f90,
+  0x8a41,
+  0xa4bf,
+  0xa5e0,
+  0x963a,
+  0x2541,
+  0x2a13,
+  0x1114,
+  0x29eb,
+  0x248b,
+  0xa656,
+  0xab35,
+  0xa280,
+  0xa4b3,
+  0x292e,
+  0x2b04,
+  0xa464,
+  0x2924,
+  0xa277,
+  0xa455,
+  0xa382,
+  0xaaed,
+  0xa6f8,
+  0x24f1,
+  0xa59f,
+  0x943d,
+  0x2a6d,
+  0xaa07,
+  0xa9e0,
+  0x2b62,
+  0x1c33,
+  0x2c77,
+  0x2967,
+  0xa418,
+  0x289e,
+  0x23b3,
+  0xa283,
+  0x9706,
+  0xa76b,
+  0xa94a,
+  0x29a2,
+  0x2b50,
+  0x2c87,
+  0x24b6,
+  0x1e9b,
+  0xa4e1,
+  0x96bc,
+  0x21b6,
+  0x2988,
+  0xa083,
+  0x2bc2,
+  0x2c5c,
+  0x252f,
+  0xa8dd,
+  0x25fe,
+  0xa8e7,
+  0xa43d,
+  0xa118,
+  0xa508,
+  0xa839,
+  0x261d,
+  0x169e,
+  0x2a46,
+  0x2249,
+  0x2b64,
+  0xa50d,
+  0x20dd,
+  0x1ee9,
+  0xa3b6,
+  0x24cf,
+  0xa3e4,
+  0xa78e,
+  0x2c7c,
+  0x2a35,
+  0x2732,
+  0xa7d4,
+  0x2ca3,
+  0x2063,
+  0x2c16,
+  0x9ef9,
+  0x1cc3,
+  0xa4d0,
+  0xa569,
+  0x255a,
+  0x288b,
+  0x2131,
+  0x28d3,
+  0x9f03,
+  0x1f19,
+  0x2203,
+  0x2a2c,
+  0x2044,
+  0xac7f,
+  0xa356,
+  0x2900,
+  0x23f3,
+  0x202f,
+  0x2be8,
+  0x230f,
+  0xa724,
+  0x1211,
+  0xa492,
+  0xa505,
+  0x28fa,
+  0x9b3d,
+  0xa175,
+  0x2156,
+  0x869e,
+  0xa930,
+  0x1873,
+  0x1f02,
+  0xaa58,
+  0x9cd4,
+  0x1dc3,
+  0xa2ae,
+  0x9fd9,
+  0xaa4b,
+  0x947c,
+  0x25ea,
+  0xa9c9,
+  0x1d76,
+  0xa0a9,
+  0x266e,
+  0x9c50,
+  0xa924,
+  0x2324,
+  0x2961,
+  0xa1cc,
+  0x25b8,
+  0x23a9,
+  0x28cf,
+  0x29ac,
+  0x21fa,
+  0x98b5,
+  0x2623,
+  0xa13c,
+  0xa04d,
+  0x2933,
+  0x2903,
+  0x29b9,
+  0xa988,
+  0x2ae3,
+  0xa842,
+  0x21d7,
+  0x285f,
+  0xa28b,
+  0x9366,
+  0x28b6,
+  0x2475,
+  0xa718,
+  0xaa26,
+  0xa72f,
+  0x0fe8,
+  0xa7c6,
+  0xab7a,
+  0x2781,
+  0x981b,
+  0x2247,
+  0x2529,
+  0x233e,
+  0x2cbf,
+  0xa99b,
+  0x213a,
+  0x2878,
+  0x29f5,
+  0x275c,
+  0xa7ee,
+  0x15f1,
+  0x239b,
+  0xa04b,
+  0xa70f,
+  0xa843,
+  0xa677,
+  0x2775,
+  0x1e24,
+  0x241c,
+  0xa3af,
+  0x1ba4,
+  0xa4e5,
+  0xac0c,
+  0x24ad,
+  0xa50a,
+  0x213c,
+  0xa083,
+  0x2603,
+  0xad84,
+  0xa386,
+  0xa9be,
+  0x2864,
+  0xa96e,
+  0xa2d5,
+  0xa098,
+  0xac31,
+  0x1c82,
+  0x1e5e,
+  0x225f,
+  0x223f,
+  0xaa06,
+  0x20dd,
+  0x9f47,
+  0xa448,
+  0xab2a,
+  0xa140,
+  0x22a0,
+  0xa43e,
+  0x176c,
+  0xaad2,
+  0xa420,
+  0xaaf5,
+  0xa155,
+  0x24c6,
+  0xa8eb,
+  0x2070,
+  0x21c1,
+  0xa150,
+  0x2431,
+  0xa958,
+  0x27e6,
+  0x299f,
+  0xaa99,
+  0x94c6,
+  0x2692,
+  0x9c18,
+  0xa64b,
+  0x286d,
+  0xabd2,
+  0x29b4,
+  0xaa90,
+  0xaa6e,
+  0xa419,
+  0x2d0e,
+  0x9c04,
+  0x2745,
+  0x24a2,
+  0xa65a,
+  0xa679,
+  0xa63d,
+  0x25d1,
+  0x2a1f,
+  0x2804,
+  0x2096,
+  0x2310,
+  0x2a01,
+  0x28bb,
+  0xa62f,
+  0x2670,
+  0x2826,
+  0xa49a,
+  0x24ab,
+  0x2a50,
+  0x2823,
+  0xa46b,
+  0x2607,
+  0xa44a,
+  0x1f43,
+  0xa83f,
+  0xaa33,
+  0x285b,
+  0x254e,
+  0x9900,
+  0x2480,
+  0x290d,
+  0xab77,
+  0xa7bb,
+  0x29fe,
+  0x1e5e,
+  0xab81,
+  0x1398,
+  0x2849,
+  0x202f,
+  0xa386,
+  0xaaa9,
+  0x22e9,
+  0xa526,
+  0xa85b,
+  0x9e8e,
+  0xa187,
+  0xa06b,
+  0x2cc7,
+  0x253f,
+  0xaed2,
+  0xaa6b,
+  0xac5d,
+  0x2446,
+  0x2840,
+  0x2460,
+  0xa908,
+  0x1fec,
+  0x261b,
+  0x28ab,
+  0x243a,
+  0x2954,
+  0x2712,
+  0x26e3,
+  0xac6b,
+  0xaced,
+  0x9c92,
+  0xaab3,
+  0xac42,
+  0x25e3,
+  0x2821,
+  0xac99,
+  0x2866,
+  0xa715,
+  0x265d,
+  0xa917,
+  0x2a59,
+  0x2163,
+  0xa66c,
+  0x1d33,
+  0x2340,
+  0xa05f,
+  0x2897,
+  0x245c,
+  0x276a,
+  0xa9cd,
+  0x975f,
+  0x26a7,
+  0x1f56,
+  0x20f1,
+  0x1d4f,
+  0xa656,
+  0xac02,
+  0x984a,
+  0x9f43,
+  0x1e4f,
+  0xa54b,
+  0xa8a0,
+  0x25d8,
+  0xa82f,
+  0x0c32,
+  0x2992,
+  0x9b7f,
+  0x1f08,
+  0xa842,
+  0x28f9,
+  0xa878,
+  0x2829,
+  0x26e9,
+  0xa544,
+  0x2256,
+  0xa63f,
+  0x9e43,
+  0x1a4a,
+  0x27b0,
+  0x253e,
+  0x2879,
+  0x14c4,
+  0xa557,
+  0x9b9e,
+  0x2420,
+  0x274d,
+  0xa83d,
+  0x28b8,
+  0xa85f,
+  0xa8e9,
+  0xa9df,
+  0x2102,
+  0xa8cd,
+  0xa11d,
+  0x28a8,
+  0x9f51,
+  0x9f65,
+  0xa870,
+  0xab6a,
+  0xa6a2,
+  0x2770,
+  0x25d9,
+  0xa37b,
+  0x952e,
+  0x9697,
+  0xaba3,
+  0xa98d,
+  0x26b8,
+  0x1a83,
+  0x27a1,
+  0x9cf6,
+  0xa616,
+  0x16ec,
+  0xa19a,
+  0x25be,
+  0x2970,
+  0xa7a8,
+  0xab4e,
+  0xad8f,
+  0xa290,
+  0x2b82,
+  0x2524,
+  0xa1be,
+  0x2be1,
+  0x246b,
+  0x0d24,
+  0xa6e6,
+  0x2c71,
+  0x1f81,
+  0x2534,
+  0xa91c,
+  0x1f0f,
+  0xa691,
+  0x9e92,
+  0xa4c6,
+  0x0fc0,
+  0x9f58,
+  0x1bff,
+  0x9aa6,
+  0x254e,
+  0x1a08,
+  0xa60b,
+  0x9f39,
+  0x9573,
+  0xa56b,
+  0xa3f5,
+  0xab33,
+  0x24e7,
+  0x2b4d,
+  0x1d30,
+  0x25f0,
+  0x281b,
+  0x2222,
+  0x22ae,
+  0x2b4b,
+  0x1729,
+  0x29dd,
+  0xa47d,
+  0x9d4c,
+  0xa92d,
+  0x9e68,
+  0x2365,
+  0x2a6e,
+  0x2088,
+  0x2c6e,
+  0xa14b,
+  0xa48b,
+  0x294d,
+  0xa88e,
+  0x2105,
+  0x2852,
+  0x16dc,
+  0xa7f5,
+  0x2440,
+  0x9fc4,
+  0x9ce2,
+  0x25a6,
+  0x2579,
+  0x17f7,
+  0xac86,
+  0x1460,
+  0xa10b,
+  0xa0a4,
+  0x2a92,
+  0xad6b,
+  0x2bca,
+  0x2820,
+  0x264f,
+  0xa4c9,
+  0xa917,
+  0x25b8,
+  0x9a1f,
+  0xa2e0,
+  0xa842,
+  0x289b,
+  0x181d,
+  0x24ea,
+  0xa205,
+  0x21ce,
+  0x9007,
+  0xa579,
+  0xa5c0,
+  0x2971,
+  0xa73e,
+  0x211f,
+  0xaa94,
+  0xa7fd,
+  0x245d,
+  0xa2f3,
+  0xa72f,
+  0xa0d3,
+  0xac10,
+  0x9a20,
+  0x295f,
+  0xa6e2,
+  0xa606,
+  0x2491,
+  0xa5bc,
+  0xa858,
+  0x9ea1,
+  0x2434,
+  0x9d4b,
+  0x282a,
+  0xa708,
+  0xa542,
+  0x24c5,
+  0xaad9,
+  0xa917,
+  0x2a4a,
+  0x24d1,
+  0xa804,
+  0x9d05,
+  0xa4cb,
+  0x24bd,
+  0x29cc,
+  0xa506,
+  0x97fe,
+  0x2927,
+  0xa712,
+  0x2555,
+  0x93d3,
+  0xa58c,
+  0xa8ce,
+  0x9594,
+  0x257a,
+  0x182f,
+  0x2833,
+  0xa7cb,
+  0xa449,
+  0xa4fd,
+  0xa951,
+  0x2b14,
+  0x298e,
+  0xa12c,
+  0x2845,
+  0x99c5,
+  0xa78a,
+  0x9bd7,
+  0xab4a,
+  0x984b,
+  0xa6f4,
+  0xa937,
+  0x264c,
+  0xa047,
+  0x2683,
+  0xa4fb,
+  0x23ad,
+  0x27f8,
+  0xa8ed,
+  0x284c,
+  0x9eb2,
+  0xa1c5,
+  0xa47a,
+  0xa09c,
+  0xa054,
+  0x2536,
+  0xa4d8,
+  0xa8e4,
+  0xa590,
+  0xa0d6,
+  0x2839,
+  0xad7f,
+  0x9a53,
+  0x2543,
+  0xa850,
+  0xa47d,
+  0x2399,
+  0x28d3,
+  0xa8d7,
+  0x26a3,
+  0x1a2b,
+  0x9e15,
+  0xa44b,
+  0xa2de,
+  0xa3a6,
+  0xa5f8,
+  0xa8eb,
+  0x243b,
+  0x1f04,
+  0x1388,
+  0xa4c7,
+  0x1725,
+  0x9ab5,
+  0x9be4,
+  0x24ec,
+  0xa468,
+  0xa501,
+  0xa5e0,
+  0x2abf,
+  0x2c89,
+  0xa830,
+  0x2512,
+  0xaa84,
+  0x29f4,
+  0x241e,
+  0x22a0,
+  0xa9cf,
+  0x1fc2,
+  0xa570,
+  0x29fd,
+  0x29b8,
+  0xa7d0,
+  0xa5c2,
+  0x1427,
+  0x2506,
+  0x2665,
+  0x2671,
+  0x2647,
+  0x237b,
+  0xab25,
+  0x1f70,
+  0xa51c,
+  0x2185,
+  0xa781,
+  0xa585,
+  0xa8ff,
+  0x2741,
+  0xa984,
+  0x2568,
+  0xa51c,
+  0xa592,
+  0xa654,
+  0xa5ef,
+  0x98f5,
+  0xa866,
+  0x2a68,
+  0xa980,
+  0x23f9,
+  0xa2e8,
+  0x229d,
+  0xad43,
+  0x288c,
+  0x23df,
+  0xa882,
+  0xa2f3,
+  0x177a,
+  0x2638,
+  0x1a21,
+  0x1cdb,
+  0xa7ea,
+  0x9b0a,
+  0x2820,
+  0xa59f,
+  0x2a4a,
+  0xa9fd,
+  0xa18f,
+  0xa36f,
+  0x2871,
+  0x999a,
+  0xa649,
+  0x2527,
+  0x2489,
+  0xaadc,
+  0x27c7,
+  0xaa2c,
+  0x287d,
+  0xa194,
+  0x2b87,
+  0x206e,
+  0xac02,
+  0xaa18,
+  0xab18,
+  0x1aff,
+  0x261e,
+  0x99ab,
+  0xa8cf,
+  0xa322,
+  0xa9c3,
+  0xa37c,
+  0xa7b2,
+  0x9b53,
+  0xa4dd,
+  0x232f,
+  0x1ebc,
+  0x2433,
+  0xa675,
+  0xa0b3,
+  0x2b75,
+  0x16d1,
+  0xa0a6,
+  0x1925,
+  0xa22c,
+  0xa768,
+  0xa1d2,
+  0x2c99,
+  0xab21,
+  0x25aa,
+  0x22d4,
+  0x2818,
+  0xab8d,
+  0x9f5d,
+  0x2a11,
+  0x9b96,
+  0xa492,
+  0x1ab8,
+  0xa364,
+  0x1027,
+  0x943d,
+  0x1a3b,
+  0xa96b,
+  0x2b01,
+  0x1d9d,
+  0xaa42,
+  0x24de,
+  0x2694,
+  0xa7d6,
+  0x2a3e,
+  0xa04e,
+  0x2396,
+  0x2323,
+  0x220d,
+  0xa835,
+  0x277a,
+  0x264d,
+  0x2b29,
+  0x24db,
+  0x2123,
+  0xa32f,
+  0x9f95,
+  0x277f,
+  0xa4e0,
+  0x1d25,
+  0xaa40,
+  0xa70b,
+  0x26bf,
+  0x272b,
+  0xabf9,
+  0x293e,
+  0x265c,
+  0x23ea,
+  0xa863,
+  0x1e47,
+  0xa8ac,
+  0x27c6,
+  0xab35,
+  0x145e,
+  0x2310,
+  0xa5a8,
+  0xa7f6,
+  0xacbf,
+  0x29c7,
+  0x2890,
+  0x14aa,
+  0xa14c,
+  0xa2e7,
+  0x25e0,
+  0x2195,
+  0x1f90,
+  0x28fe,
+  0x2156,
+  0xa806,
+  0x2942,
+  0x1d5c,
+  0xa82a,
+  0x2548,
+  0x9d43,
+  0x27d3,
+  0x9e1f,
+  0x2819,
+  0x248a,
+  0x2bd6,
+  0xac1c,
+  0xa07d,
+  0x2791,
+  0x25e0,
+  0xa0d3,
+  0x9b7d,
+  0x2061,
+  0x9f76,
+  0x230f,
+  0x1c10,
+  0x207c,
+  0xac75,
+  0xa5ca,
+  0x2464,
+  0x27d4,
+  0x2059,
+  0x183b,
+  0xa6d4,
+  0xa976,
+  0xa957,
+  0x2b1c,
+  0x29d9,
+  0x1fbd,
+  0xa908,
+  0xa1a2,
+  0x24d7,
+  0xa4ca,
+  0xa61d,
+  0xae1f,
+  0x279e,
+  0xa1da,
+  0xaa02,
+  0xa178,
+  0xae4e,
+  0x27cc,
+  0xa37d,
+  0x21c0,
+  0x95f4,
+  0xa5ff,
+  0x27a4,
+  0x99a6,
+  0x28c8,
+  0x9c80,
+  0xa5ff,
+  0xa1ba,
+  0x1bb7,
+  0xa83c,
+  0x23da,
+  0x1cce,
+  0xa9a1,
+  0x27a2,
+  0x2aa1,
+  0xa033,
+  0x2254,
+  0xa0a5,
+  0xa9a5,
+  0x2b2f,
+  0xa53a,
+  0x22d7,
+  0xa986,
+  0x23d8,
+  0xa43f,
+  0x2154,
+  0x2bad,
+  0x19e1,
+  0x274c,
+  0x1c96,
+  0xaa20,
+  0xa86e,
+  0x2825,
+  0xa947,
+  0x18a4,
+  0xa96f,
+  0x23fe,
+  0x2a93,
+  0x1d7e,
+  0x9fc4,
+  0x9a5b,
+  0x2004,
+  0xaa32,
+  0x2906,
+  0xa764,
+  0x2090,
+  0x94d1,
+  0x2674,
+  0x999c,
+  0x25a1,
+  0x9687,
+  0x26d9,
+  0xa69e,
+  0x14db,
+  0xa604,
+  0xa7f5,
+  0x22d0,
+  0xa540,
+  0xa650,
+  0xa4b3,
+  0xa1e5,
+  0xa706,
+  0x1dd1,
+  0xa767,
+  0xaa98,
+  0xa509,
+  0x25ca,
+  0xa840,
+  0x29e0,
+  0xa4eb,
+  0xa41b,
+  0x2263,
+  0x2864,
+  0x276b,
+  0x1c96,
+  0x27f2,
+  0xa92b,
+  0xa79d,
+  0xa3b2,
+  0x2a48,
+  0xa6dc,
+  0x226a,
+  0xa93c,
+  0x2608,
+  0x20d6,
+  0xa8cf,
+  0x2695,
+  0xa105,
+  0xad6d,
+  0x2979,
+  0xa875,
+  0x2316,
+  0x9410,
+  0x2415,
+  0xac53,
+  0x1b51,
+  0x1d30,
+  0x29d8,
+  0x28cb,
+  0xa81d,
+  0x2c0c,
+  0x21cb,
+  0x97f0,
+  0xa775,
+  0xa6f2,
+  0x28f5,
+  0x1ce8,
+  0x1d55,
+  0x2665,
+  0x14e5,
+  0xa11e,
+  0x2a4c,
+  0x2597,
+  0x24d4,
+  0xa216,
+  0xa64f,
+  0xa986,
+  0xa46d,
+  0xa9af,
+  0x2cbe,
+  0x253d,
+  0x2230,
+  0xa4c5,
+  0xa10f,
+  0xa6df,
+  0xa550,
+  0xa25d,
+  0xa855,
+  0x26ff,
+  0xa820,
+  0xa120,
+  0x2309,
+  0x2340,
+  0xa45c,
+  0x2075,
+  0xa5ee,
+  0x2b0e,
+  0xa5a0,
+  0x23f8,
+  0xac1f,
+  0xa33a,
+  0x25f8,
+  0x2224,
+  0x1d02,
+  0x1181,
+  0xa90f,
+  0x1e33,
+  0xa634,
+  0x9b57,
+  0xad4b,
+  0x1d08,
+  0xaad4,
+  0x26e6,
+  0x1b16,
+  0xa94d,
+  0xa471,
+  0x2006,
+  0xa141,
+  0x299f,
+  0xab59,
+  0x2422,
+  0xaaa5,
+  0x1f8d,
+  0x24b4,
+  0x9cf8,
+  0xa791,
+  0x28c1,
+  0x1579,
+  0xab11,
+  0x295f,
+  0xade3,
+  0xa69e,
+  0x2725,
+  0xa04c,
+  0xab1e,
+  0xa412,
+  0xa91a,
+  0x9c41,
+  0x1d1c,
+  0x255a,
+  0xa863,
+  0xa890,
+  0x287d,
+  0x2069,
+  0xa717,
+  0x2a98,
+  0xa9bc,
+  0xa246,
+  0xa3a8,
+  0x2717,
+  0x2bfa,
+  0x2778,
+  0x28a9,
+  0x9ff8,
+  0x2862,
+  0x9a85,
+  0x258c,
+  0xa462,
+  0x24d7,
+  0x1771,
+  0xa11f,
+  0xa08e,
+  0xa58a,
+  0xa629,
+  0xa13b,
+  0x260c,
+  0x1a8d,
+  0x9843,
+  0x17b3,
+  0xa94e,
+  0xa303,
+  0x251c,
+  0x26c7,
+  0x27a3,
+  0xabcc,
+  0xa094,
+  0x21d2,
+  0x27db,
+  0xa143,
+  0x1ca6,
+  0x1c4f,
+  0xa967,
+  0xa63f,
+  0x2595,
+  0x1bec,
+  0xa979,
+  0x9dd1,
+  0x2903,
+  0xa14d,
+  0xa39e,
+  0x251f,
+  0x2546,
+  0x2016,
+  0x1f0b,
+  0x246d,
+  0x9b2f,
+  0x9f94,
+  0x2c5f,
+  0x2949,
+  0xa39a,
+  0xa874,
+  0xac39,
+  0x29d2,
+  0xa718,
+  0x2833,
+  0xa9c2,
+  0x1733,
+  0x1fac,
+  0xa939,
+  0x1fb4,
+  0xa869,
+  0x282b,
+  0x2aa1,
+  0x201c,
+  0x2583,
+  0xa6a8,
+  0x23b5,
+  0xa4a2,
+  0x254d,
+  0x29af,
+  0x27c7,
+  0xa794,
+  0x2a5b,
+  0xa5bf,
+  0x295e,
+  0x1da4,
+  0x9ee9,
+  0x2818,
+  0xa459,
+  0xaa33,
+  0x2579,
+  0x1c6f,
+  0xaa04,
+  0xa1a0,
+  0xa0f5,
+  0xa75d,
+  0xa3a3,
+  0x23d7,
+  0x2841,
+  0x96b9,
+  0x27ba,
+  0x2186,
+  0x25ab,
+  0x2803,
+  0x24aa,
+  0x2aea,
+  0x9eba,
+  0xaab8,
+  0xa9e6,
+  0xa889,
+  0x28b7,
+  0x28f0,
+  0xa4d4,
+  0x2922,
+  0xa4c5,
+  0x2925,
+  0x29b7,
+  0x20ea,
+  0x239d,
+  0xac2a,
+  0x2664,
+  0xa8b2,
+  0x274d,
+  0x9f1b,
+  0xa6fe,
+  0x946c,
+  0xa73b,
+  0x2800,
+  0x2a6f,
+  0x2554,
+  0xa811,
+  0x28c8,
+  0x286b,
+  0x9c9a,
+  0x2a3e,
+  0x2151,
+  0xa12b,
+  0x9854,
+  0xa337,
+  0x2bb6,
+  0xac62,
+  0x28c4,
+  0x2940,
+  0xa738,
+  0xa405,
+  0x19ba,
+  0xa634,
+  0x9ee7,
+  0x2051,
+  0x1220,
+  0x2287,
+  0xac2c,
+  0x1d1f,
+  0x2662,
+  0xa0cc,
+  0x2c5b,
+  0x2112,
+  0x2a5c,
+  0x9e83,
+  0xa2d7,
+  0x1c85,
+  0x1e1b,
+  0x1fe1,
+  0x9852,
+  0x9b4f,
+  0xa5c5,
+  0x27b3,
+  0x2cd5,
+  0x9dde,
+  0x217f,
+  0x1e24,
+  0x20fb,
+  0xa7a4,
+  0x2c6a,
+  0x2823,
+  0xa6c7,
+  0x2d3e,
+  0x2075,
+  0x2203,
+  0xa80f,
+  0x27d6,
+  0x9cd8,
+  0xac1b,
+  0xa70a,
+  0xa6ae,
+  0x2898,
+  0xac2e,
+  0x2697,
+  0x200f,
+  0xabcf,
+  0xa31b,
+  0xabc2,
+  0xa5e7,
+  0xa4cf,
+  0x28ad,
+  0xae81,
+  0xacfe,
+  0xa891,
+  0x9242,
+  0xa323,
+  0x2359,
+  0x1892,
+  0xa688,
+  0x2101,
+  0x2863,
+  0x2911,
+  0x295b,
+  0x24ab,
+  0xaa66,
+  0x1987,
+  0xa40e,
+  0x260e,
+  0xa406,
+  0x9f4a,
+  0x9d63,
+  0x2845,
+  0xa923,
+  0x2ce3,
+  0x2d54,
+  0x25d3,
+  0xa0f2,
+  0x9b32,
+  0xa0e4,
+  0x158c,
+  0x1e75,
+  0x2437,
+  0xa190,
+  0x1ef5,
+  0x2c43,
+  0x9f61,
+  0xa87d,
+  0x2c0c,
+  0x9dca,
+  0xa3c6,
+  0x2618,
+  0x286e,
+  0x2307,
+  0xa1ab,
+  0x27fa,
+  0x190f,
+  0x2869,
+  0xa264,
+  0x27f2,
+  0x281c,
+  0x8e13,
+  0x2341,
+  0x29b6,
+  0x217c,
+  0x25a6,
+  0xa6d4,
+  0xa69d,
+  0xa707,
+  0x25df,
+  0xabc5,
+  0xa075,
+  0x1901,
+  0xa531,
+  0xac81,
+  0xa357,
+  0x1cf4,
+  0xa868,
+  0xa012,
+  0x22f0,
+  0xa472,
+  0x20d4,
+  0xa439,
+  0xaa90,
+  0x1183,
+  0x0125,
+  0x215b,
+  0xa9b1,
+  0x2206,
+  0x2318,
+  0xa6a6,
+  0x204f,
+  0x2177,
+  0xa873,
+  0xac79,
+  0xa4fd,
+  0xa6bb,
+  0x272a,
+  0xa731,
+  0x2834,
+  0xa6f9,
+  0x204f,
+  0xaaa0,
+  0xa506,
+  0xa67e,
+  0x27b0,
+  0x26a8,
+  0x2477,
+  0xa578,
+  0x2616,
+  0x2bee,
+  0x2096,
+  0x26c0,
+  0xa2bc,
+  0x29d3,
+  0xa812,
+  0x1e55,
+  0x286b,
+  0x2a1e,
+  0xa904,
+  0xa7d9,
+  0x2944,
+  0xa90d,
+  0x9c8a,
+  0xa565,
+  0x274d,
+  0x2272,
+  0x249a,
+  0x2341,
+  0xa761,
+  0xac08,
+  0x2cb2,
+  0x245a,
+  0x2bd2,
+  0x24db,
+  0x18b6,
+  0xa861,
+  0x1fee,
+  0x2759,
+  0x2301,
+  0xa411,
+  0x262f,
+  0x2971,
+  0xa099,
+  0x2a62,
+  0xa7d5,
+  0x1e67,
+  0x26ef,
+  0xa02a,
+  0x298c,
+  0x285f,
+  0xa4b7,
+  0x272a,
+  0x2719,
+  0xac3c,
+  0xa2a9,
+  0x1760,
+  0x2045,
+  0x2d3e,
+  0xa8ea,
+  0x2419,
+  0xa7e9,
+  0xa291,
+  0x2619,
+  0x9b76,
+  0xa53b,
+  0x2886,
+  0xa255,
+  0x24e2,
+  0xa729,
+  0x284a,
+  0x246a,
+  0x2b58,
+  0xa567,
+  0xa1d9,
+  0x277c,
+  0x241b,
+  0x2431,
+  0x2a86,
+  0xace5,
+  0xa479,
+  0x1b31,
+  0xa8d9,
+  0xa80a,
+  0xa8ae,
+  0x9c02,
+  0x9abe,
+  0x29ce,
+  0xab90,
+  0xa7a2,
+  0x987f,
+  0xa63a,
+  0x2c06,
+  0x2651,
+  0x18a0,
+  0x2221,
+  0x1d0b,
+  0x2057,
+  0x2b76,
+  0x2818,
+  0x2725,
+  0xa4be,
+  0x2a92,
+  0x2446,
+  0x261a,
+  0x960c,
+  0xabdb,
+  0x1459,
+  0xa48d,
+  0x27a2,
+  0xa5ef,
+  0xa58c,
+  0x1ca0,
+  0x23cd,
+  0xa84b,
+  0xa52d,
+  0xa7b9,
+  0xa84a,
+  0xa686,
+  0xa85c,
+  0x2993,
+  0x2236,
+  0x2768,
+  0xa629,
+  0x1e22,
+  0x277f,
+  0x2811,
+  0x27f1,
+  0xac57,
+  0x2471,
+  0x2bb2,
+  0x9182,
+  0x2826,
+  0xa611,
+  0xa480,
+  0x28e6,
+  0xa642,
+  0xad67,
+  0x20ed,
+  0x2c4a,
+  0x1c1d,
+  0x9e37,
+  0x1641,
+  0xa729,
+  0x2414,
+  0x28f7,
+  0x9948,
+  0x283a,
+  0xa7b2,
+  0x286a,
+  0x1abe,
+  0xaae9,
+  0x9c85,
+  0x2c0d,
+  0xa1a7,
+  0xaa9c,
+  0xa536,
+  0x99f8,
+  0x2827,
+  0x2375,
+  0x1945,
+  0x9dcc,
+  0x29b9,
+  0x22e9,
+  0x29b5,
+  0xa1b1,
+  0xa9c2,
+  0x99e3,
+  0xaa74,
+  0xa325,
+  0xa9ec,
+  0x966c,
+  0xa52c,
+  0xa7d9,
+  0x260c,
+  0x24b5,
+  0x8d93,
+  0x9f74,
+  0x2c1b,
+  0x2698,
+  0xaace,
+  0x2b45,
+  0xa0cd,
+  0xa238,
+  0x2d2d,
+  0xa8e9,
+  0x2299,
+  0x9f67,
+  0x29b2,
+  0xab0a,
+  0x9d52,
+  0x235d,
+  0xa71e,
+  0x2313,
+  0x27db,
+  0x1fd0,
+  0xa537,
+  0x2862,
+  0xa8c9,
+  0x1e0b,
+  0xa5ae,
+  0x1f7f,
+  0x2608,
+  0x243a,
+  0xa48d,
+  0x9e4e,
+  0x9d2b,
+  0x28fa,
+  0xa890,
+  0xa9c2,
+  0xa5ad,
+  0xa02a,
+  0xa59f,
+  0x2ad3,
+  0x2159,
+  0xa3df,
+  0x9c00,
+  0x2234,
+  0x2476,
+  0x29b6,
+  0x23c6,
+  0x2a3a,
+  0x23a6,
+  0xaa93,
+  0x9cbe,
+  0xab18,
+  0x26ea,
+  0x1c9c,
+  0xa1a0,
+  0xa577,
+  0xa564,
+  0xaa8c,
+  0xa924,
+  0xa6b0,
+  0x9c77,
+  0x2986,
+  0x2907,
+  0x2128,
+  0xabb9,
+  0x2951,
+  0x28d9,
+  0x1f74,
+  0xace3,
+  0x28ff,
+  0x0614,
+  0x2088,
+  0xa29f,
+  0x2247,
+  0x9a30,
+  0x2260,
+  0x262d,
+  0xa86d,
+  0x9652,
+  0xa8ed,
+  0xa519,
+  0x269b,
+  0xaaaa,
+  0x1b49,
+  0x91fa,
+  0xa038,
+  0x285f,
+  0x2b5e,
+  0x289d,
+  0x2526,
+  0xa936,
+  0xaadc,
+  0x1529,
+  0x2a71,
+  0x24d6,
+  0x211b,
+  0xa7d6,
+  0x2282,
+  0x2a66,
+  0x9fa7,
+  0x17a8,
+  0xa405,
+  0xaae4,
+  0x2870,
+  0xa8e7,
+  0x9066,
+  0xac53,
+  0x248e,
+  0xa89d,
+  0x9a5b,
+  0x25a5,
+  0x1333,
+  0xa297,
+  0x1ea0,
+  0xa88a,
+  0xa452,
+  0x2705,
+  0xa3f7,
+  0xa64d,
+  0xa634,
+  0x2afa,
+  0x9d50,
+  0x27ac,
+  0xa67c,
+  0x249b,
+  0x20d4,
+  0x22b6,
+  0x2226,
+  0x2c2a,
+  0x29d9,
+  0xa8c8,
+  0xa6fb,
+  0xa44d,
+  0xad89,
+  0x2a08,
+  0x24ee,
+  0x1c5b,
+  0x250f,
+  0x2324,
+  0x27f4,
+  0x28b8,
+  0x962e,
+  0x243b,
+  0x16ef,
+  0x9599,
+  0x2728,
+  0x2722,
+  0x2407,
+  0x24a3,
+  0xa442,
+  0x194e,
+  0xa6fb,
+  0x228e,
+  0x9f9c,
+  0xa0fa,
+  0xaaae,
+  0xa8b0,
+  0xa8db,
+  0xa6b4,
+  0x98d9,
+  0xa7d4,
+  0x2711,
+  0xa521,
+  0x2861,
+  0xa735,
+  0x2543,
+  0x2969,
+  0x1816,
+  0xa22d,
+  0x15a7,
+  0x2120,
+  0x9242,
+  0xa9f5,
+  0x2145,
+  0x1fb5,
+  0x2444,
+  0x2417,
+  0x2997,
+  0x256a,
+  0xaa20,
+  0xaa20,
+  0x25d4,
+  0xa662,
+  0x222d,
+  0xaa00,
+  0x2bdb,
+  0xa8b9,
+  0x2a8a,
+  0xa2aa,
+  0xab02,
+  0xa43f,
+  0x1fff,
+  0x291b,
+  0xa8ff,
+  0x224d,
+  0x9ecf,
+  0x264f,
+  0x9f34,
+  0x25b6,
+  0xa72d,
+  0x1ab1,
+  0x1d7f,
+  0x22e4,
+  0x2a0a,
+  0x223e,
+  0x2512,
+  0x936e,
+  0xa02b,
+  0x9a56,
+  0xa5e2,
+  0x250b,
+  0xaa74,
+  0xa8d9,
+  0xa976,
+  0xa75b,
+  0xa48e,
+  0x1c1a,
+  0x9be1,
+  0xa0c2,
+  0x9878,
+  0xaa23,
+  0x260c,
+  0xa251,
+  0xa91e,
+  0xa55a,
+  0xacab,
+  0x9a12,
+  0xac5a,
+  0x2993,
+  0x1ffd,
+  0xa49a,
+  0xa5f2,
+  0x23e8,
+  0xac2c,
+  0x117d,
+  0x2557,
+  0x9a26,
+  0x2b54,
+  0x2b3e,
+  0x2503,
+  0x2608,
+  0x26fb,
+  0x1a03,
+  0xa545,
+  0x2c1b,
+  0x25da,
+  0xa9b3,
+  0x2a3b,
+  0x2576,
+  0x28e5,
+  0x00d4,
+  0xa733,
+  0x9ed5,
+  0x29ea,
+  0x96a3,
+  0x2a61,
+  0xa819,
+  0xabd9,
+  0x2134,
+  0x1cf8,
+  0x27c0,
+  0x2c25,
+  0x19a4,
+  0x2ab5,
+  0x281a,
+  0x2861,
+  0x9f2e,
+  0x9fac,
+  0x960d,
+  0x0944,
+  0xa87a,
+  0x9fca,
+  0xa42e,
+  0x23e0,
+  0x9d29,
+  0xa985,
+  0xa818,
+  0x28d3,
+  0x292b,
+  0xac15,
+  0x12ea,
+  0x1caa,
+  0xa6f5,
+  0xa071,
+  0x1c26,
+  0x2a13,
+  0xa6c1,
+  0x2ae1,
+  0xa27a,
+  0x2027,
+  0xa382,
+  0xa94f,
+  0xa855,
+  0x2419,
+  0x290b,
+  0x23e5,
+  0x213b,
+  0x2839,
+  0xa8d7,
+  0x27a9,
+  0x24bc,
+  0x2528,
+  0xa96c,
+  0x0e12,
+  0xac65,
+  0xa3e1,
+  0x9539,
+  0x0cba,
+  0x2707,
+  0x20e1,
+  0x21a6,
+  0x19c9,
+  0x9b3f,
+  0x2c66,
+  0x1c4c,
+  0x24f8,
+  0x26f1,
+  0x9e6e,
+  0xa826,
+  0x2a49,
+  0xa495,
+  0xa45a,
+  0x9d62,
+  0x24ae,
+  0xa85f,
+  0x25ec,
+  0x2760,
+  0x2a3c,
+  0xa1ec,
+  0xaacb,
+  0xa440,
+  0xa257,
+  0x24d7,
+  0xa719,
+  0x27f6,
+  0x290a,
+  0x1eea,
+  0xa277,
+  0x19f9,
+  0x2c72,
+  0xa086,
+  0xa1dd,
+  0xaa06,
+  0x286f,
+  0x29c4,
+  0x9e1c,
+  0x26c9,
+  0x0e68,
+  0xa9d4,
+  0x2580,
+  0xa680,
+  0xa85b,
+  0x1e1c,
+  0x1f68,
+  0xa7ef,
+  0xaa93,
+  0xa4ef,
+  0xa4c8,
+  0x28a2,
+  0x24f5,
+  0x9347,
+  0x238f,
+  0xa6b8,
+  0x2ad8,
+  0x2927,
+  0xa88d,
+  0x23c3,
+  0xa96b,
+  0xa7e9,
+  0xa0ec,
+  0xa7d1,
+  0xaabf,
+  0xa331,
+  0xa01f,
+  0x2ae4,
+  0xa92e,
+  0x2415,
+  0x26f5,
+  0x286a,
+  0x1057,
+  0x2068,
+  0x2793,
+  0x2545,
+  0xa0a3,
+  0x2702,
+  0x2152,
+  0x29f5,
+  0xa6e2,
+  0x29d9,
+  0x1f69,
+  0xa4c3,
+  0xa297,
+  0xa7fd,
+  0xaae7,
+  0xa408,
+  0x25d6,
+  0x25c3,
+  0xac7d,
+  0x941a,
+  0x285c,
+  0x294b,
+  0x29b7,
+  0xac8d,
+  0x255e,
+  0x2860,
+  0x2344,
+  0x2579,
+  0x275b,
+  0x280e,
+  0xa920,
+  0xa1e1,
+  0xa419,
+  0x271f,
+  0x2af7,
+  0x2913,
+  0x2999,
+  0x2ce7,
+  0xaaa0,
+  0x1dd3,
+  0xa83a,
+  0x27a0,
+  0xa87a,
+  0x9d12,
+  0x28ed,
+  0xa6b2,
+  0xa845,
+  0xad52,
+  0x2a6d,
+  0x271b,
+  0xacc2,
+  0x9cf9,
+  0xa6cc,
+  0x9cc5,
+  0xab09,
+  0x289c,
+  0xa62f,
+  0x2489,
+  0x1517,
+  0x249b,
+  0x2874,
+  0x255c,
+  0xa170,
+  0xa5fe,
+  0x244a,
+  0x9efd,
+  0x21a8,
+  0x9f21,
+  0x26d2,
+  0x1549,
+  0x20e2,
+  0xa2a8,
+  0x2a7c,
+  0xa9d1,
+  0x279e,
+  0x29e0,
+  0x2a39,
+  0xaac9,
+  0xa6fd,
+  0x2014,
+  0x2663,
+  0x2203,
+  0xa533,
+  0xa390,
+  0x24a8,
+  0x2abd,
+  0xa0eb,
+  0xa8f5,
+  0x9e51,
+  0xa7db,
+  0x2638,
+  0x241c,
+  0x2460,
+  0x26de,
+  0x267a,
+  0xa156,
+  0xa077,
+  0x26f3,
+  0x27d6,
+  0xa89b,
+  0x21d9,
+  0xa3ea,
+  0xa8e3,
+  0xa3dc,
+  0xa4cb,
+  0xa291,
+  0xa994,
+  0xa40d,
+  0x26fb,
+  0xa1a8,
+  0x2a69,
+  0xab4c,
+  0x2759,
+  0x2606,
+  0x9cd8,
+  0xa680,
+  0xa5f4,
+  0xa0b9,
+  0x2d9d,
+  0x99b9,
+  0xa67e,
+  0x1c1b,
+  0x946b,
+  0x242e,
+  0x2528,
+  0x24d0,
+  0xa444,
+  0xa4ff,
+  0x1d1c,
+  0x262a,
+  0x9f1c,
+  0xa585,
+  0xaa66,
+  0x1e10,
+  0x281a,
+  0xad26,
+  0xa964,
+  0x2015,
+  0x267f,
+  0xa253,
+  0x1580,
+  0x28a6,
+  0xa7be,
+  0xa56c,
+  0x293f,
+  0x19dc,
+  0xa562,
+  0xa188,
+  0x1874,
+  0x2b65,
+  0x9f71,
+  0xa6f5,
+  0x8146,
+  0xa687,
+  0x222e,
+  0x2363,
+  0x28a4,
+  0x2698,
+  0xa509,
+  0x2140,
+  0x26b6,
+  0xa783,
+  0x25b4,
+  0xa450,
+  0xa798,
+  0x24dd,
+  0xa9fc,
+  0x2056,
+  0xa815,
+  0xa9de,
+  0xaae6,
+  0x1f07,
+  0xa4a9,
+  0x15da,
+  0x9539,
+  0xa7ea,
+  0xa4fe,
+  0x1f87,
+  0x2c0d,
+  0x21d1,
+  0xa8d4,
+  0x2b13,
+  0x2c08,
+  0x2330,
+  0xa926,
+  0x25f7,
+  0x243b,
+  0x21b7,
+  0xaa45,
+  0x1959,
+  0x2772,
+  0x1b58,
+  0x2865,
+  0x2c8d,
+  0x228c,
+  0x29e4,
+  0xa3e3,
+  0x193b,
+  0xa538,
+  0xab62,
+  0x1eaa,
+  0xa650,
+  0x1fab,
+  0xa936,
+  0x287c,
+  0xa206,
+  0x2c40,
+  0x201b,
+  0xa4e3,
+  0x203e,
+  0xa842,
+  0xa803,
+  0xac1f,
+  0xa020,
+  0x201b,
+  0xa23d,
+  0x2a50,
+  0xa335,
+  0x237f,
+  0xa0a6,
+  0xa1fe,
+  0x9f24,
+  0xa581,
+  0xaafc,
+  0xa5d7,
+  0xa4d6,
+  0x9dde,
+  0xa10a,
+  0x2008,
+  0xa2a7,
+  0x24cd,
+  0xa489,
+  0x28d0,
+  0x2261,
+  0xa220,
+  0x1707,
+  0xa16a,
+  0xa6b1,
+  0x96db,
+  0x234b,
+  0xa3ed,
+  0x2455,
+  0x9485,
+  0x289d,
+  0xa6c4,
+  0xa787,
+  0xa4ac,
+  0xa5f1,
+  0x22a4,
+  0x25cd,
+  0x2470,
+  0x2954,
+  0xa549,
+  0x9c56,
+  0x1d4a,
+  0x28b8,
+  0x21e2,
+  0x9e35,
+  0x2bc3,
+  0xa2cd,
+  0xa3b3,
+  0x2d64,
+  0x9c80,
+  0xa852,
+  0xa8e1,
+  0xa710,
+  0xa808,
+  0x26aa,
+  0xac27,
+  0xa2f1,
+  0x216a,
+  0x295c,
+  0x1fff,
+  0xa72f,
+  0x1497,
+  0xa140,
+  0xa2de,
+  0xa04a,
+  0x9e17,
+  0x2455,
+  0x21e1,
+  0x27b9,
+  0xa9b4,
+  0x22f3,
+  0xab5f,
+  0xabc0,
+  0x27b8,
+  0x2905,
+  0xa3de,
+  0xa54f,
+  0x1ae3,
+  0xa72e,
+  0xa24c,
+  0xa296,
+  0x24b4,
+  0x291c,
+  0x1da9,
+  0x1bb4,
+  0x9d8b,
+  0xa376,
+  0x94e3,
+  0x2052,
+  0x9e7a,
+  0xa393,
+  0x29a3,
+  0x9af1,
+  0x2acf,
+  0xa3bd,
+  0x2452,
+  0x1d16,
+  0xa42e,
+  0x9e6b,
+  0xa382,
+  0x28df,
+  0xa625,
+  0x2937,
+  0x9c1a,
+  0xa555,
+  0x256d,
+  0x9976,
+  0xac30,
+  0x1b20,
+  0x2704,
+  0xa945,
+  0x27b4,
+  0x21a5,
+  0x25cd,
+  0x2842,
+  0xa477,
+  0x9e48,
+  0x2384,
+  0x2819,
+  0x2210,
+  0xa825,
+  0x1efe,
+  0xa4ae,
+  0x25c4,
+  0xa961,
+  0x205a,
+  0xa6fa,
+  0x2e0a,
+  0x2c10,
+  0x2365,
+  0x9a53,
+  0xa8cd,
+  0xa6f6,
+  0xa1e3,
+  0xa4ea,
+  0x1cb0,
+  0xa0a4,
+  0x951c,
+  0x2959,
+  0x2be7,
+  0xa782,
+  0x2b16,
+  0xa2ca,
+  0xa716,
+  0xa6be,
+  0x281f,
+  0x241a,
+  0x2841,
+  0x9f10,
+  0x29a4,
+  0x22ff,
+  0x20e7,
+  0x244b,
+  0x2900,
+  0x2ca4,
+  0x2dd1,
+  0xa508,
+  0xaae0,
+  0xa7c7,
+  0xa151,
+  0x24fa,
+  0x20b0,
+  0xaa24,
+  0xa3f8,
+  0x9bf6,
+  0x21ee,
+  0x242a,
+  0x1858,
+  0x91ff,
+  0xaa03,
+  0x2379,
+  0x1498,
+  0x2859,
+  0x9d7e,
+  0xa141,
+  0xa03a,
+  0x2c0f,
+  0xa9fc,
+  0xa53c,
+  0x1b34,
+  0x23d3,
+  0xa319,
+  0x1f34,
+  0x11b6,
+  0x9c97,
+  0x9ef0,
+  0x2296,
+  0xa85a,
+  0x22d2,
+  0x245c,
+  0x2880,
+  0x2604,
+  0x2c10,
+  0x95f4,
+  0x28fc,
+  0x2026,
+  0x1470,
+  0x2632,
+  0x287f,
+  0xa8d5,
+  0xa3d6,
+  0xa0f7,
+  0x1be5,
+  0x2861,
+  0xa6e4,
+  0xa096,
+  0x24d1,
+  0x1ccc,
+  0x1821,
+  0x22b2,
+  0xa99b,
+  0xa774,
+  0xa6eb,
+  0xa610,
+  0xa81a,
+  0x9a41,
+  0x2328,
+  0x21cc,
+  0x1f50,
+  0x2923,
+  0xa887,
+  0xa51d,
+  0xa5c2,
+  0x153e,
+  0x25d8,
+  0x1811,
+  0xa6fd,
+  0xa3cd,
+  0x2ac4,
+  0x1692,
+  0xa781,
+  0x9ffc,
+  0x9fb1,
+  0x267b,
+  0x24f3,
+  0x88f2,
+  0xa477,
+  0xa95a,
+  0x1c43,
+  0x9422,
+  0xa1e2,
+  0x9c32,
+  0x97ac,
+  0x9e23,
+  0x18dc,
+  0xa0c7,
+  0xa056,
+  0x21bc,
+  0x2031,
+  0x1110,
+  0x9b20,
+  0x1c62,
+  0x2af7,
+  0x141c,
+  0x1fb6,
+  0x1538,
+  0xa878,
+  0x2af9,
+  0xa5ab,
+  0xa5eb,
+  0x2431,
+  0x1f11,
+  0x2356,
+  0x2595,
+  0x1b11,
+  0xa68a,
+  0x9ed3,
+  0xa9f8,
+  0x9b9e,
+  0x9ddd,
+  0x2127,
+  0xa886,
+  0x1ae3,
+  0x288d,
+  0xa042,
+  0x285b,
+  0x24eb,
+  0x0d1d,
+  0x285c,
+  0xa3d4,
+  0xa808,
+  0x8edc,
+  0x23b1,
+  0x29ca,
+  0xac4d,
+  0x2519,
+  0x2321,
+  0x235e,
+  0xacb4,
+  0x9d6e,
+  0x2563,
+  0xaa53,
+  0xa152,
+  0xaa3c,
+  0xa522,
+  0xa8bd,
+  0xa1b3,
+  0xa834,
+  0x2862,
+  0x28af,
+  0x20c8,
+  0x984c,
+  0x27b3,
+  0x2455,
+  0x9a1e,
+  0x1b22,
+  0x1c62,
+  0x23b2,
+  0xa330,
+  0x232c,
+  0x2d02,
+  0xa2c8,
+  0x9d3d,
+  0xa46a,
+  0x0728,
+  0x2330,
+  0x27c2,
+  0xa517,
+  0xabb4,
+  0x22e7,
+  0x254a,
+  0x21b9,
+  0xab68,
+  0xac06,
+  0x2b22,
+  0xa07a,
+  0x2e77,
+  0x2654,
+  0xa403,
+  0x253b,
+  0x2a5b,
+  0x225e,
+  0x1633,
+  0xa4f1,
+  0x284f,
+  0x249a,
+  0xa0e3,
+  0xac86,
+  0xa8ad,
+  0x1d1b,
+  0x27a8,
+  0x270e,
+  0x2d61,
+  0x24ce,
+  0xa801,
+  0x2b0f,
+  0xa8ba,
+  0x2ada,
+  0xaa69,
+  0x2893,
+  0xa37d,
+  0x2409,
+  0xa9f2,
+  0x23b9,
+  0x2ccf,
+  0x241f,
+  0xa990,
+  0xaa36,
+  0x256f,
+  0x9fbb,
+  0xa5de,
+  0xa2b8,
+  0xa2c9,
+  0xa41f,
+  0xa0f0,
+  0x26f5,
+  0x2a3b,
+  0x2b5b,
+  0x1c10,
+  0x24cf,
+  0x2a07,
+  0x20b4,
+  0x2474,
+  0x2648,
+  0xa2c1,
+  0x27d4,
+  0x1855,
+  0xa2d0,
+  0x272b,
+  0xac0d,
+  0x2696,
+  0x1e75,
+  0xa973,
+  0x2b52,
+  0xa7ae,
+  0x9f60,
+  0xa95e,
+  0xac1d,
+  0x2936,
+  0xa1c6,
+  0xa523,
+  0x2473,
+  0x2c0a,
+  0x26d5,
+  0x8976,
+  0x2193,
+  0x9e45,
+  0xae29,
+  0xa86f,
+  0x2633,
+  0x2875,
+  0x28d6,
+  0x2973,
+  0x275c,
+  0x90c1,
+  0x248f,
+  0x25ff,
+  0x19f1,
+  0xaacb,
+  0xacac,
+  0x29ad,
+  0xa097,
+  0x1efb,
+  0x9e41,
+  0x2508,
+  0x284e,
+  0xac93,
+  0x26b2,
+  0x286f,
+  0x21a8,
+  0x952a,
+  0xa37e,
+  0x1f2b,
+  0x2710,
+  0x18dc,
+  0xa5be,
+  0xa06b,
+  0xa998,
+  0x2c0e,
+  0x25ab,
+  0xa67d,
+  0x983c,
+  0x992c,
+  0x2840,
+  0x24fc,
+  0x9d91,
+  0xa646,
+  0x2a66,
+  0x9e04,
+  0x2967,
+  0x2751,
+  0x9e7f,
+  0xa7ca,
+  0x2577,
+  0x28ea,
+  0x1566,
+  0xa47a,
+  0x82e6,
+  0x2981,
+  0xa448,
+  0x974a,
+  0x9f8e,
+  0x2d10,
+  0x241a,
+  0xaa48,
+  0x86be,
+  0x282a,
+  0xa80a,
+  0x2339,
+  0xa05e,
+  0x22f3,
+  0x28ca,
+  0x276a,
+  0xa8d6,
+  0x2364,
+  0xaa10,
+  0x25c2,
+  0xa070,
+  0xa24a,
+  0xa6ad,
+  0x1d4c,
+  0x226e,
+  0x2553,
+  0xa8be,
+  0x15d3,
+  0x239b,
+  0x2882,
+  0x2a00,
+  0x2416,
+  0x2604,
+  0x21b6,
+  0x25d2,
+  0x2be4,
+  0xa90a,
+  0x9b96,
+  0x2b02,
+  0xac8e,
+  0xa096,
+  0xa373,
+  0x9e36,
+  0x9ae1,
+  0xa5fb,
+  0xa680,
+  0xa528,
+  0xa4da,
+  0xa7bd,
+  0xa53d,
+  0xa311,
+  0xa4dc,
+  0xa1f6,
+  0xa1b0,
+  0xa834,
+  0x217a,
+  0x21d7,
+  0x1c3a,
+  0x2889,
+  0x958b,
+  0x2448,
+  0x9a46,
+  0x9163,
+  0xa8a6,
+  0x9b0f,
+  0xac03,
+  0x2410,
+  0xa930,
+  0xa26d,
+  0x24fb,
+  0x262a,
+  0xa3d2,
+  0x2c43,
+  0x273e,
+  0x9f31,
+  0x2554,
+  0xa24b,
+  0x241e,
+  0xa7cc,
+  0x28c3,
+  0x293b,
+  0x28a2,
+  0x2356,
+  0xa879,
+  0xa160,
+  0xa770,
+  0x2170,
+  0xa406,
+  0x2540,
+  0x238b,
+  0x98fa,
+  0x29e4,
+  0xab56,
+  0x9f1a,
+  0xa5fa,
+  0x2779,
+  0xa415,
+  0x9b6e,
+  0x2220,
+  0x28f3,
+  0x27f7,
+  0x2614,
+  0x2059,
+  0x2486,
+  0x1ceb,
+  0x2831,
+  0x20b3,
+  0xa53e,
+  0x2892,
+  0x2a1e,
+  0xa48f,
+  0x2c87,
+  0xad02,
+  0xa78d,
+  0x28f1,
+  0xa826,
+  0xac09,
+  0xa9a5,
+  0x27ab,
+  0x2079,
+  0xa9f4,
+  0x16ec,
+  0x2804,
+  0xa998,
+  0x2d0f,
+  0x9c29,
+  0x23d0,
+  0x2a9a,
+  0x240c,
+  0xa62c,
+  0xaa7b,
+  0xaa6b,
+  0x1855,
+  0x2ca2,
+  0x252a,
+  0x2237,
+  0x261b,
+  0x233e,
+  0xa04b,
+  0xa95d,
+  0xa8df,
+  0xa4e6,
+  0xa690,
+  0x2942,
+  0x2031,
+  0x20f4,
+  0x1f4b,
+  0x2468,
+  0xa954,
+  0xa6ce,
+  0xa566,
+  0x2359,
+  0xa754,
+  0x1f64,
+  0xacac,
+  0x2a63,
+  0xaccd,
+  0x9511,
+  0x921a,
+  0x2985,
+  0xa238,
+  0xa94e,
+  0xa6bd,
+  0x22e6,
+  0x0b2a,
+  0x23eb,
+  0x262a,
+  0xa33e,
+  0x2856,
+  0x29bb,
+  0x2836,
+  0x2a36,
+  0x287d,
+  0x298b,
+  0x2977,
+  0xa510,
+  0x28f8,
+  0xa233,
+  0x282a,
+  0x2827,
+  0x296e,
+  0xaab3,
+  0xa51a,
+  0x2136,
+  0xa7e9,
+  0xa0f8,
+  0xa801,
+  0xa55a,
+  0xa76f,
+  0xa55e,
+  0x1ba6,
+  0xa6fb,
+  0x2b3a,
+  0x1c01,
+  0x2c38,
+  0x292a,
+  0x1f91,
+  0x2227,
+  0xa818,
+  0xa9bc,
+  0xab00,
+  0x98f6,
+  0x2a28,
+  0x22ad,
+  0x263a,
+  0x276a,
+  0xa8ce,
+  0x27b7,
+  0x22a6,
+  0xa19d,
+  0x200e,
+  0x23e6,
+  0x26f5,
+  0xa92d,
+  0x2816,
+  0x9c06,
+  0x9ead,
+  0x282c,
+  0x28f2,
+  0xa8b4,
+  0x20e5,
+  0xa3cd,
+  0xa703,
+  0x243a,
+  0x280f,
+  0xaae2,
+  0x156d,
+  0x242c,
+  0x9c8e,
+  0x20f9,
+  0x25d1,
+  0xa8db,
+  0x2814,
+  0x2550,
+  0x2285,
+  0xa516,
+  0x268d,
+  0xa984,
+  0xa2c1,
+  0x29ee,
+  0x25b2,
+  0x2537,
+  0x27b4,
+  0x1982,
+  0x2615,
+  0x25e6,
+  0x145a,
+  0xa394,
+  0xa377,
+  0x253e,
+  0x21c1,
+  0xa491,
+  0x991a,
+  0xa4aa,
+  0x2160,
+  0xa577,
+  0x2729,
+  0x1a58,
+  0x200b,
+  0x2549,
+  0x9427,
+  0xacc0,
+  0x204d,
+  0x27a0,
+  0xa4b6,
+  0x1fbb,
+  0x259b,
+  0x239d,
+  0xaae5,
+  0x2003,
+  0x29c0,
+  0xa451,
+  0xa2ae,
+  0xa56d,
+  0x1db1,
+  0x287f,
+  0x2062,
+  0xa8e3,
+  0x2cb6,
+  0xa5f0,
+  0xa95a,
+  0xa5d2,
+  0x2703,
+  0x2a42,
+  0xa8e5,
+  0x2aad,
+  0xa9e3,
+  0xa590,
+  0x2cb4,
+  0x1f4c,
+  0x29da,
+  0x9b4f,
+  0x1e55,
+  0xabbc,
+  0x21be,
+  0xa37a,
+  0x1c1f,
+  0xa560,
+  0x1c68,
+  0xa914,
+  0x2b19,
+  0x2924,
+  0x9e58,
+  0x26f3,
+  0x2912,
+  0x2c34,
+  0xad35,
+  0xa598,
+  0x9da5,
+  0xa171,
+  0x2b5c,
+  0x2a21,
+  0x1da9,
+  0x2a51,
+  0x274a,
+  0x1ab6,
+  0xa43b,
+  0x2881,
+  0xa432,
+  0xa7bb,
+  0x235b,
+  0x2996,
+  0xa987,
+  0x9613,
+  0xa0ef,
+  0xa129,
+  0x9e05,
+  0x2879,
+  0x25be,
+  0xabdf,
+  0x2a94,
+  0x2231,
+  0xaa88,
+  0x9458,
+  0x9d3e,
+  0x1f8a,
+  0xa894,
+  0xa48f,
+  0xad0f,
+  0x9f47,
+  0x2a0a,
+  0xa6e3,
+  0xa58e,
+  0x1b8d,
+  0x2007,
+  0xa8ef,
+  0xa73b,
+  0x294c,
+  0x1ee5,
+  0xaa85,
+  0xa759,
+  0xa9c5,
+  0xa2bc,
+  0xa291,
+  0x2b4c,
+  0x269f,
+  0x29db,
+  0xa425,
+  0xa813,
+  0xaafe,
+  0x24c5,
+  0xad94,
+  0x1f7f,
+  0xa3ae,
+  0x26e1,
+  0xa45d,
+  0xa27e,
+  0x2c1c,
+  0xa893,
+  0x2a3f,
+  0xa922,
+  0x225c,
+  0x28d3,
+  0x2222,
+  0x25ea,
+  0x2035,
+  0xa0e8,
+  0x296a,
+  0x2841,
+  0x2649,
+  0xa9b1,
+  0x8d83,
+  0x21a9,
+  0x2ba5,
+  0x2630,
+  0xadd0,
+  0xa939,
+  0x2697,
+  0x238a,
+  0xa550,
+  0xa8e9,
+  0xa90f,
+  0x1c0f,
+  0xa8f3,
+  0x2c49,
+  0x230d,
+  0x2818,
+  0xa905,
+  0x9d28,
+  0xa172,
+  0x26ac,
+  0xa580,
+  0xa2ea,
+  0x240c,
+  0xa2e3,
+  0xa88e,
+  0x2964,
+  0xa3e9,
+  0xab50,
+  0xa739,
+  0xa7e4,
+  0xa2e0,
+  0x2670,
+  0x28ca,
+  0x23e4,
+  0x28e9,
+  0x96da,
+  0xa113,
+  0xa8d0,
+  0x2035,
+  0x2c82,
+  0xa89f,
+  0xacdf,
+  0xaa33,
+  0x2a25,
+  0xa63a,
+  0x98b6,
+  0xac62,
+  0xa913,
+  0x197d,
+  0xa89a,
+  0x23eb,
+  0xa255,
+  0x222f,
+  0x2a23,
+  0x20a9,
+  0x2051,
+  0xa4ba,
+  0x281a,
+  0x200b,
+  0xab52,
+  0x286e,
+  0x23b0,
+  0x20a2,
+  0xa682,
+  0xa811,
+  0x1c6c,
+  0xa57b,
+  0xa892,
+  0x9a08,
+  0xa70e,
+  0x20de,
+  0x2a63,
+  0x29ba,
+  0xad4a,
+  0xa9d7,
+  0xa251,
+  0xa8b0,
+  0xa5a7,
+  0xa68e,
+  0xa21f,
+  0x216f,
+  0x26fb,
+  0x2305,
+  0x2810,
+  0x9ed0,
+  0x287d,
+  0x25e5,
+  0xa104,
+  0xa909,
+  0x2988,
+  0x925a,
+  0x2921,
+  0x24b9,
+  0x2a31,
+  0xa873,
+  0x2925,
+  0x27aa,
+  0x24d3,
+  0xab58,
+  0x2d25,
+  0x246f,
+  0x94bc,
+  0xa921,
+  0x2cb5,
+  0xa217,
+  0xa00a,
+  0x2820,
+  0x28dd,
+  0x2a02,
+  0xa80f,
+  0x287b,
+  0xa80e,
+  0xa044,
+  0xa7a2,
+  0x2c02,
+  0xa70c,
+  0x2a42,
+  0x210e,
+  0xa5b5,
+  0x1d0e,
+  0xaccd,
+  0x2ae0,
+  0x214e,
+  0xadba,
+  0xa148,
+  0x21a5,
+  0xa51a,
+  0x2744,
+  0xab75,
+  0x9c47,
+  0x2150,
+  0x221b,
+  0xa24c,
+  0x2c4b,
+  0xa48f,
+  0xa2f7,
+  0xa7a7,
+  0xa38e,
+  0x0586,
+  0xa4db,
+  0x238a,
+  0xa987,
+  0xa214,
+  0xa728,
+  0x1f5a,
+  0x2b28,
+  0x2436,
+  0x2a26,
+  0x222c,
+  0x978c,
+  0x1e7e,
+  0x2965,
+  0x8714,
+  0x263a,
+  0xa866,
+  0xa5d4,
+  0xa771,
+  0x2109,
+  0x22d4,
+  0x9e37,
+  0x2069,
+  0x2980,
+  0x2069,
+  0x237f,
+  0xa297,
+  0xa85f,
+  0x2432,
+  0x288a,
+  0x265e,
+  0xa319,
+  0x9c64,
+  0xaa36,
+  0xa50a,
+  0x24c0,
+  0xa726,
+  0x2836,
+  0x1d90,
+  0x2a9c,
+  0x2512,
+  0xa397,
+  0x2427,
+  0x2595,
+  0x251d,
+  0x265f,
+  0xa7bb,
+  0x2602,
+  0xa441,
+  0x24f7,
+  0x9097,
+  0x2ccf,
+  0x2a61,
+  0xa8a7,
+  0x27e9,
+  0x28a2,
+  0x1ff6,
+  0xa774,
+  0x2415,
+  0x2836,
+  0xa8a0,
+  0x1d30,
+  0x1f22,
+  0x2412,
+  0x28d6,
+  0x2024,
+  0xa546,
+  0xa1fc,
+  0xa863,
+  0x231a,
+  0x2382,
+  0xad41,
+  0x27e7,
+  0xa218,
+  0x29f5,
+  0x264d,
+  0x263a,
+  0x211a,
+  0x2b2d,
+  0x29d5,
+  0xa8d7,
+  0xa011,
+  0xa9fa,
+  0x22e5,
+  0x975c,
+  0x2b7c,
+  0xab5f,
+  0x217e,
+  0x2219,
+  0x97cf,
+  0x2a1d,
+  0xab58,
+  0xab38,
+  0xa229,
+  0xa89c,
+  0x2579,
+  0x2547,
+  0xa39d,
+  0x2535,
+  0x2694,
+  0x9d31,
+  0x8dd6,
+  0x2456,
+  0x20ea,
+  0xa935,
+  0x2a2a,
+  0x2829,
+  0x28ad,
+  0xa760,
+  0x1d18,
+  0x29e9,
+  0xa54b,
+  0x1f8b,
+  0x26da,
+  0xac11,
+  0x9cb8,
+  0xa245,
+  0x24da,
+  0x2745,
+  0x202b,
+  0x25c2,
+  0x25a3,
+  0x252d,
+  0xabf6,
+  0x1436,
+  0xa33b,
+  0xac21,
+  0xa86a,
+  0x24e3,
+  0xa049,
+  0xa8fa,
+  0x1ffc,
+  0x2b53,
+  0x8825,
+  0x9fbf,
+  0x1964,
+  0x2741,
+  0xa04c,
+  0xa9d7,
+  0xac7d,
+  0x9caa,
+  0xa45c,
+  0xa302,
+  0x2c0d,
+  0xaa30,
+  0x22fb,
+  0x1ee2,
+  0x9db4,
+  0xa07e,
+  0xa2d8,
+  0x1ed4,
+  0x2584,
+  0x9896,
+  0x9c5d,
+  0x2af5,
+  0xaaba,
+  0xaa00,
+  0xa033,
+  0xa18c,
+  0xa3a6,
+  0xac58,
+  0xa40d,
+  0xa6dd,
+  0x98c3,
+  0xa60c,
+  0x25d6,
+  0x2514,
+  0x1434,
+  0x27f5,
+  0x2506,
+  0x9db1,
+  0xa4ec,
+  0x21a0,
+  0xa322,
+  0x1847,
+  0x0d0f,
+  0xa407,
+  0xa5ce,
+  0xa428,
+  0x2a8f,
+  0x20fc,
+  0xa570,
+  0xa547,
+  0xa6ca,
+  0xa6ad,
+  0x244f,
+  0x21a0,
+  0xa0ac,
+  0x27ff,
+  0x9d96,
+  0x2909,
+  0xa839,
+  0x185e,
+  0xae62,
+  0xa60e,
+  0xa879,
+  0x266b,
+  0xa500,
+  0x203c,
+  0x0fd1,
+  0xa4b5,
+  0x18a0,
+  0xa625,
+  0x2840,
+  0xa3d0,
+  0x9ce0,
+  0xa434,
+  0xaa0d,
+  0x246a,
+  0xa2ed,
+  0x2769,
+  0xab5b,
+  0x2656,
+  0xaad3,
+  0x2d71,
+  0xa701,
+  0xa4ea,
+  0xa79d,
+  0x9b8b,
+  0xa161,
+  0xaa88,
+  0xaa77,
+  0x2143,
+  0xa1d0,
+  0xa7b0,
+  0xaa82,
+  0x1f11,
+  0xa871,
+  0x23c5,
+  0x22c4,
+  0xa468,
+  0x2864,
+  0xa39e,
+  0xa676,
+  0xa9e4,
+  0x2440,
+  0x23b5,
+  0xa7d0,
+  0xab60,
+  0x21d6,
+  0xa8ec,
+  0x19be,
+  0xaa47,
+  0x9071,
+  0x2902,
+  0xa8bf,
+  0xa697,
+  0x2138,
+  0xa335,
+  0xab2a,
+  0xa892,
+  0xa4c1,
+  0x2656,
+  0x2c30,
+  0x980c,
+  0xa724,
+  0xa745,
+  0x9399,
+  0x9db6,
+  0xa332,
+  0xa709,
+  0xaa04,
+  0x9c3d,
+  0x2797,
+  0x2491,
+  0xa596,
+  0xa953,
+  0xa6f3,
+  0xa514,
+  0x28d9,
+  0x1c77,
+  0x2a31,
+  0xa3ae,
+  0x20d1,
+  0x17fd,
+  0x22b8,
+  0xa2cb,
+  0x277a,
+  0x15fd,
+  0x1d15,
+  0x133b,
+  0x2583,
+  0x1836,
+  0x2a91,
+  0x22aa,
+  0x26b3,
+  0x22af,
+  0xa9e3,
+  0x2adc,
+  0xa092,
+  0x2089,
+  0xa176,
+  0x9c29,
+  0xa82f,
+  0x137e,
+  0xa77c,
+  0x9e17,
+  0xa643,
+  0x1ca7,
+  0xa39c,
+  0x29b5,
+  0x274e,
+  0x1e85,
+  0xa4f7,
+  0x2bca,
+  0x27e6,
+  0xa027,
+  0xa8f5,
+  0x1be2,
+  0x9998,
+  0x26a9,
+  0x1d8e,
+  0x2435,
+  0xa1b8,
+  0xab9a,
+  0x23ac,
+  0xa830,
+  0xa1aa,
+  0x2285,
+  0xa1ea,
+  0xabba,
+  0x28b7,
+  0x2547,
+  0x1788,
+  0x2576,
+  0x25e3,
+  0x2a12,
+  0xad05,
+  0x2d1d,
+  0xa518,
+  0x25e7,
+  0x1c7b,
+  0x2629,
+  0x1f2b,
+  0x147d,
+  0xa82c,
+  0x2611,
+  0x285f,
+  0xafeb,
+  0xa1e6,
+  0xa505,
+  0x25a9,
+  0xa173,
+  0x27aa,
+  0x242f,
+  0xa5f0,
+  0xa67f,
+  0xa03c,
+  0x277e,
+  0x26ff,
+  0x8dc4,
+  0xa86b,
+  0xa9cb,
+  0x23f5,
+  0x24d8,
+  0x2836,
+  0x1f96,
+  0xa998,
+  0xa8ac,
+  0xa17a,
+  0xa74d,
+  0xa9cd,
+  0xa7ad,
+  0x2a67,
+  0x2004,
+  0x9f66,
+  0x28df,
+  0x9c13,
+  0x246c,
+  0x2b9d,
+  0xa45d,
+  0xaa06,
+  0x27ab,
+  0xa00d,
+  0x281c,
+  0xaa9e,
+  0x274d,
+  0x9b72,
+  0xa2b3,
+  0x28fa,
+  0x1f9d,
+  0x21d9,
+  0x18a1,
+  0x21d6,
+  0xa656,
+  0x9ae8,
+  0xa874,
+  0xa057,
+  0x214b,
+  0x1f14,
+  0xaa7c,
+  0xa6d9,
+  0xa479,
+  0xa70f,
+  0xa98b,
+  0x9ea0,
+  0xa986,
+  0xa5c0,
+  0x24b9,
+  0xa4ce,
+  0x1b7d,
+  0xa02d,
+  0x250e,
+  0xa245,
+  0x26c9,
+  0x2922,
+  0x25f0,
+  0xa97a,
+  0xa523,
+  0xa9da,
+  0x2caa,
+  0x28c7,
+  0xa7a1,
+  0x20f6,
+  0xa886,
+  0x10f9,
+  0x29f0,
+  0x27de,
+  0xa3ed,
+  0x25ef,
+  0xa172,
+  0x15d0,
+  0x2410,
+  0x28c2,
+  0x28dc,
+  0x2615,
+  0xa0af,
+  0x2390,
+  0x2ce6,
+  0x25d8,
+  0x9fd1,
+  0x21ec,
+  0xa55f,
+  0x102c,
+  0xa9c4,
+  0xa4f1,
+  0xa449,
+  0xa705,
+  0xa801,
+  0xa892,
+  0x9a01,
+  0x280b,
+  0x2518,
+  0x22a6,
+  0x24b8,
+  0x9ddc,
+  0x1d19,
+  0x24aa,
+  0xa2d5,
+  0xa755,
+  0x2ab0,
+  0x253f,
+  0xa7a3,
+  0xa3dd,
+  0xa122,
+  0x2b52,
+  0x2c88,
+  0x20c1,
+  0x0e0b,
+  0x1e43,
+  0x2622,
+  0xa019,
+  0x2077,
+  0xa0d1,
+  0xa12b,
+  0xa9a6,
+  0x21c7,
+  0xa885,
+  0x25be,
+  0x2286,
+  0x1d39,
+  0x287c,
+  0xa1d9,
+  0xa278,
+  0x244d,
+  0xa181,
+  0x2b3d,
+  0x29a3,
+  0xabbf,
+  0xa6be,
+  0xa479,
+  0x9c25,
+  0x2051,
+  0x1cd5,
+  0xa27e,
+  0x161b,
+  0x28af,
+  0x9a13,
+  0x24d9,
+  0x2a2a,
+  0x23f5,
+  0xa794,
+  0xac82,
+  0xa411,
+  0xa0d3,
+  0x9687,
+  0xa7d7,
+  0xa41a,
+  0xa54a,
+  0x275c,
+  0x2196,
+  0x191b,
+  0x8c24,
+  0x28ab,
+  0x2785,
+  0x224b,
+  0x2ab4,
+  0xa091,
+  0x1c2d,
+  0x2026,
+  0x23d6,
+  0xad0d,
+  0xa4b5,
+  0x97ed,
+  0x240e,
+  0x24c8,
+  0x98fa,
+  0xa22b,
+  0x283a,
+  0xa8fc,
+  0x183c,
+  0xa5b6,
+  0x1a36,
+  0xa87f,
+  0xa008,
+  0x2482,
+  0x28d8,
+  0xa897,
+  0x2386,
+  0xa9ce,
+  0xa5f0,
+  0x253d,
+  0x2a94,
+  0x27e0,
+  0xadc4,
+  0xa7ef,
+  0xaa38,
+  0xaba5,
+  0x25e5,
+  0xa2e2,
+  0x2a0c,
+  0x241a,
+  0xa0ba,
+  0x9c85,
+  0xaa0b,
+  0xa6b1,
+  0xae46,
+  0xa756,
+  0xa85a,
+  0x2661,
+  0x1771,
+  0x174c,
+  0x238f,
+  0xa9d1,
+  0x2965,
+  0x2a23,
+  0x9de2,
+  0xa4bf,
+  0xa6d5,
+  0xaaec,
+  0x2212,
+  0xa5b3,
+  0xa84f,
+  0x9d4f,
+  0xaa53,
+  0xa891,
+  0xa904,
+  0x2994,
+  0x250d,
+  0xa105,
+  0xa9b7,
+  0xa95d,
+  0x26e8,
+  0x2319,
+  0x99c7,
+  0x2920,
+  0xac1d,
+  0x1770,
+  0xac43,
+  0xa873,
+  0x21e8,
+  0xaa33,
+  0x274c,
+  0xa101,
+  0xa968,
+  0x24bd,
+  0xa1b0,
+  0x296a,
+  0xa8ca,
+  0xa1ed,
+  0xa2f2,
+  0xa344,
+  0x28e3,
+  0xab54,
+  0xa8e8,
+  0xa9db,
+  0x2882,
+  0x26f6,
+  0x2a07,
+  0x28b0,
+  0xa688,
+  0x2315,
+  0xac22,
+  0x2b74,
+  0xaa0a,
+  0xa8c4,
+  0xa978,
+  0x1aba,
+  0xa810,
+  0x24a3,
+  0x2ba7,
+  0x25f9,
+  0xa5d6,
+  0x2aa9,
+  0x2683,
+  0xa08f,
+  0xa297,
+  0x1db3,
+  0xa623,
+  0xa52b,
+  0x2002,
+  0xa9cf,
+  0xa5ad,
+  0xa2c1,
+  0x03ce,
+  0xa1e1,
+  0x277d,
+  0x28d3,
+  0x28f3,
+  0xaa8b,
+  0xab3d,
+  0xa1e9,
+  0x2539,
+  0xa125,
+  0xa423,
+  0x95cf,
+  0xa4fc,
+  0x99dc,
+  0x27c2,
+  0xa90c,
+  0x249f,
+  0x9cf5,
+  0x0c94,
+  0x285f,
+  0x2486,
+  0xaa5f,
+  0xa777,
+  0xa071,
+  0x2717,
+  0x9f19,
+  0xaa51,
+  0x1d71,
+  0x2ac1,
+  0x12f1,
+  0x2bc0,
+  0x2a4c,
+  0xa196,
+  0x2449,
+  0x238d,
+  0xa44e,
+  0x2862,
+  0x2b46,
+  0xa8dc,
+  0xa59c,
+  0x27dc,
+  0x2038,
+  0xa194,
+  0x2222,
+  0x276e,
+  0x1a26,
+  0x01cc,
+  0x29ca,
+  0x2923,
+  0xa77c,
+  0x29b5,
+  0x1e42,
+  0x9b51,
+  0xa07e,
+  0x27e5,
+  0x22e4,
+  0x1f5b,
+  0x2910,
+  0xa6d2,
+  0xa595,
+  0xa470,
+  0x9be2,
+  0xa8d0,
+  0xa284,
+  0xa6b3,
+  0x1f08,
+  0x9ee4,
+  0x946b,
+  0x287a,
+  0x9788,
+  0x20a4,
+  0xa139,
+  0x2a1d,
+  0x22f2,
+  0x1eed,
+  0x217c,
+  0x1177,
+  0x2170,
+  0x2196,
+  0x268b,
+  0xa515,
+  0x238c,
+  0xa68c,
+  0x1fcb,
+  0xa60b,
+  0x11e1,
+  0xa5fd,
+  0x9a67,
+  0x9a50,
+  0x286a,
+  0x1bd3,
+  0xa92d,
+  0xac42,
+  0xa87e,
+  0x2617,
+  0x2b26,
+  0x9de8,
+  0xa4d7,
+  0x2131,
+  0xa4b6,
+  0x9c19,
+  0xa4c6,
+  0x259c,
+  0xa736,
+  0xa638,
+  0x2723,
+  0x1a87,
+  0x28c1,
+  0x1c27,
+  0x299a,
+  0x2af9,
+  0x2e29,
+  0x9bef,
+  0xa786,
+  0x2c4a,
+  0x14a2,
+  0x2968,
+  0xa926,
+  0xa2a6,
+  0x2244,
+  0x20d3,
+  0x2314,
+  0x2073,
+  0xa3be,
+  0xa597,
+  0x280f,
+  0x2512,
+  0x2b90,
+  0xa39d,
+  0x9c1b,
+  0x2ab3,
+  0x2816,
+  0x29dd,
+  0xa948,
+  0xa845,
+  0x1b27,
+  0xa8f6,
+  0x2821,
+  0x2418,
+  0xa5d3,
+  0xa153,
+  0x9a7c,
+  0xaa94,
+  0x2411,
+  0x07eb,
+  0xa7ab,
+  0xa553,
+  0xa358,
+  0x232b,
+  0xa0fd,
+  0x241e,
+  0xa229,
+  0xa7cb,
+  0x20db,
+  0xa73b,
+  0xa552,
+  0x8e82,
+  0xaa2b,
+  0xa46b,
+  0xa7a9,
+  0xac21,
+  0x9878,
+  0xa124,
+  0xa702,
+  0x23fc,
+  0x2ac6,
+  0x2c11,
+  0x1dbc,
+  0x28b6,
+  0x91f2,
+  0x2678,
+  0x2483,
+  0x227d,
+  0xa494,
+  0x1fad,
+  0x251f,
+  0x25e5,
+  0x29fc,
+  0xa0cf,
+  0x9857,
+  0x29f2,
+  0x28b8,
+  0x96d7,
+  0x29ac,
+  0xa32a,
+  0x2c09,
+  0x1e41,
+  0x2883,
+  0xa935,
+  0xa723,
+  0xaa22,
+  0x28a1,
+  0x2421,
+  0x29cc,
+  0x2758,
+  0xa436,
+  0x9d3c,
+  0xaa4a,
+  0x1a53,
+  0x9eec,
+  0x2876,
+  0xa8f9,
+  0x29f6,
+  0x258c,
+  0x2082,
+  0x26b5,
+  0xa28e,
+  0x2ad2,
+  0x267f,
+  0xabdd,
+  0x1e9b,
+  0xa4a0,
+  0xaa5e,
+  0x1585,
+  0x28dd,
+  0xaa2b,
+  0x2613,
+  0x2019,
+  0x2504,
+  0xa966,
+  0x2b4e,
+  0xa4e5,
+  0xa935,
+  0xa841,
+  0x2929,
+  0x2048,
+  0x2844,
+  0x2573,
+  0x25fb,
+  0xa78d,
+  0x2967,
+  0x1c47,
+  0x9f89,
+  0x2085,
+  0xa132,
+  0x23a1,
+  0x284f,
+  0x9db0,
+  0x8e60,
+  0xa6e2,
+  0x2996,
+  0x2898,
+  0x199e,
+  0xa592,
+  0x2507,
+  0x1e45,
+  0xa02d,
+  0xa405,
+  0x25f2,
+  0xa81a,
+  0x2972,
+  0x2716,
+  0x96ef,
+  0x2700,
+  0xa826,
+  0xa2ed,
+  0xa6a3,
+  0xa885,
+  0xa6a1,
+  0xa57a,
+  0x9cb0,
+  0xa239,
+  0x9402,
+  0x2b74,
+  0x233a,
+  0xa90e,
+  0xaa58,
+  0xa620,
+  0xa767,
+  0xa44e,
+  0x285c,
+  0x0b90,
+  0xa6dd,
+  0xa6e7,
+  0x2aa3,
+  0x2064,
+  0x2905,
+  0xa25b,
+  0x255d,
+  0x2806,
+  0x272b,
+  0x264e,
+  0xa87a,
+  0xa611,
+  0xa883,
+  0xa60c,
+  0x9d00,
+  0x963b,
+  0x295b,
+  0x26ce,
+  0x2186,
+  0xa421,
+  0x1f98,
+  0x2332,
+  0xac47,
+  0x1cb0,
+  0x1c7b,
+  0x1d6d,
+  0xa932,
+  0x25fc,
+  0x234c,
+  0x9d37,
+  0x2170,
+  0x23b0,
+  0x9448,
+  0xa372,
+  0x21af,
+  0x965e,
+  0xa921,
+  0xa92b,
+  0x0c67,
+  0x2351,
+  0xa854,
+  0x9a8f,
+  0x2a9d,
+  0x299b,
+  0x259e,
+  0xab51,
+  0x24ad,
+  0xa8af,
+  0x9d77,
+  0x8a5c,
+  0xa461,
+  0xa648,
+  0xa3f8,
+  0x199b,
+  0x27dd,
+  0x25c4,
+  0x2805,
+  0x28bc,
+  0x21d2,
+  0xa22b,
+  0xa982,
+  0x2218,
+  0x1e33,
+  0x239a,
+  0x2899,
+  0x2119,
+  0xa89b,
+  0x9244,
+  0xa34b,
+  0xa0ad,
+  0x2629,
+  0xa1b9,
+  0xa50e,
+  0x2a1f,
+  0xa138,
+  0xa7cb,
+  0x268a,
+  0xa789,
+  0xa173,
+  0xa6a1,
+  0xa5a8,
+  0x9d2b,
+  0x2daa,
+  0xa53f,
+  0x26ae,
+  0xa464,
+  0x249a,
+  0x22fb,
+  0xa126,
+  0x219f,
+  0x28ff,
+  0x287c,
+  0xa5db,
+  0x2646,
+  0xa672,
+  0xa89a,
+  0xa6cb,
+  0x98c5,
+  0x2655,
+  0xac57,
+  0xaa72,
+  0xa9c3,
+  0xaa23,
+  0xa2c8,
+  0x2a14,
+  0x2b05,
+  0x2443,
+  0x2932,
+  0x8e6c,
+  0x1525,
+  0x21ef,
+  0xa45a,
+  0xa03b,
+  0x2592,
+  0x291c,
+  0x26d8,
+  0xa317,
+  0x25c2,
+  0x9c71,
+  0xa8a6,
+  0x2acc,
+  0xa67d,
+  0x94c3,
+  0x26a6,
+  0x2213,
+  0x2bc6,
+  0x207d,
+  0x2623,
+  0xa763,
+  0xabcd,
+  0x9ec4,
+  0xa8cf,
+  0xa49b,
+  0x2684,
+  0xa69d,
+  0xa578,
+  0xa58e,
+  0x210b,
+  0x1bb1,
+  0x2b11,
+  0xa36c,
+  0x2b13,
+  0x9f21,
+  0x2393,
+  0xa0d9,
+  0x2963,
+  0xa125,
+  0x24ec,
+  0xa529,
+  0x1f23,
+  0xa2ec,
+  0xa66b,
+  0xa97c,
+  0x2484,
+  0x2730,
+  0xa1d8,
+  0xa5cf,
+  0x2700,
+  0x0f8c,
+  0xaa85,
+  0x2a56,
+  0xa92a,
+  0xa9b4,
+  0xa95f,
+  0xac84,
+  0x9705,
+  0x2845,
+  0x2b11,
+  0x292b,
+  0xa0f7,
+  0xac85,
+  0x24c1,
+  0x20f1,
+  0xa77d,
+  0x2636,
+  0xa502,
+  0xa07b,
+  0xa183,
+  0xa518,
+  0xaaae,
+  0x20ea,
+  0x294b,
+  0x26b8,
+  0xaabc,
+  0xa106,
+  0xaad6,
+  0x9a1a,
+  0xa603,
+  0xa7ca,
+  0x1de7,
+  0x2938,
+  0x21be,
+  0xa649,
+  0x8992,
+  0x2a21,
+  0x23ab,
+  0x8c54,
+  0x2a9a,
+  0x1923,
+  0x2793,
+  0x27ee,
+  0x23ea,
+  0xa04b,
+  0x2a44,
+  0xab62,
+  0x2558,
+  0xa81d,
+  0xa078,
+  0x0fdf,
+  0x18b9,
+  0x9d90,
+  0x24d1,
+  0xaca6,
+  0x1a9d,
+  0x2819,
+  0x2984,
+  0x9cd2,
+  0x9c2f,
+  0xabc6,
+  0xa206,
+  0xac1b,
+  0x2476,
+  0x1f5a,
+  0xa41c,
+  0x1d3a,
+  0x24a9,
+  0xa8fe,
+  0x2b22,
+  0xa250,
+  0xa9b3,
+  0x2930,
+  0x2589,
+  0x2940,
+  0x2a76,
+  0x262b,
+  0x0d93,
+  0x2944,
+  0x9c53,
+  0xab22,
+  0xab71,
+  0x0083,
+  0xa0ee,
+  0xaaad,
+  0xa4e3,
+  0xa9d8,
+  0x2a72,
+  0xa883,
+  0x0836,
+  0xa8f1,
+  0xaa01,
+  0xa391,
+  0x9deb,
+  0xa567,
+  0x2b11,
+  0xa80f,
+  0xa8fe,
+  0x9dc2,
+  0x2973,
+  0xa6d4,
+  0x98c2,
+  0xa6f3,
+  0xa68d,
+  0x2395,
+  0x214c,
+  0xa822,
+  0xa91f,
+  0x1c18,
+  0xa518,
+  0xa57b,
+  0x1ef9,
+  0x9a6f,
+  0x249a,
+  0xab06,
+  0x1037,
+  0x106e,
+  0x2780,
+  0x9f42,
+  0x274f,
+  0x9544,
+  0x1a5a,
+  0x2935,
+  0xaa0f,
+  0xa57e,
+  0xac14,
+  0x202b,
+  0xa43d,
+  0x29c6,
+  0x2760,
+  0x23d1,
+  0xa15b,
+  0xa987,
+  0xa08b,
+  0xa97f,
+  0xa86e,
+  0x2833,
+  0x2968,
+  0x1fe7,
+  0x281a,
+  0x2529,
+  0x99c6,
+  0x2119,
+  0xa153,
+  0xa0d1,
+  0x27ad,
+  0xa53f,
+  0x2664,
+  0xa248,
+  0x2660,
+  0x28fe,
+  0x259f,
+  0x9b0c,
+  0x2141,
+  0x2471,
+  0x281e,
+  0x1132,
+  0xa85e,
+  0xaa63,
+  0xac45,
+  0x2919,
+  0x2915,
+  0xa4e7,
+  0xa0fa,
+  0xa977,
+  0x2520,
+  0x25e1,
+  0x27f1,
+  0xa596,
+  0x287c,
+  0x27ba,
+  0x29cf,
+  0x2642,
+  0x21e2,
+  0x2490,
+  0xa9bf,
+  0x964e,
+  0xa8f1,
+  0x21c0,
+  0xab0f,
+  0xa902,
+  0xa56a,
+  0x26b9,
+  0x1af9,
+  0x9848,
+  0x153b,
+  0xa40e,
+  0xa491,
+  0x213c,
+  0x28ff,
+  0x2006,
+  0xa60e,
+  0xa950,
+  0xa419,
+  0x248f,
+  0x9dca,
+  0xa628,
+  0x9e9d,
+  0x1cf8,
+  0xa9f6,
+  0x9fee,
+  0x9b02,
+  0xa121,
+  0xa36a,
+  0xa608,
+  0x28d4,
+  0xa5a5,
+  0xa2f7,
+  0x00a4,
+  0x250b,
+  0x2966,
+  0x28e4,
+  0xa8c5,
+  0xaa8d,
+  0x1cf4,
+  0x2609,
+  0x29fb,
+  0x2534,
+  0x14ed,
+  0xa1ee,
+  0x254d,
+  0xa393,
+  0x1d1d,
+  0x25f1,
+  0x236e,
+  0x9af1,
+  0xa8c3,
+  0xa644,
+  0x2a9c,
+  0xa0b3,
+  0x9ef5,
+  0xa561,
+  0xaa70,
+  0xa829,
+  0x244c,
+  0x29b5,
+  0xa4c6,
+  0xa56b,
+  0xaa61,
+  0xa498,
+  0x1e4c,
+  0xa2e6,
+  0x2211,
+  0xaa47,
+  0xa734,
+  0xa2e1,
+  0x9f6a,
+  0xa97e,
+  0xa4a7,
+  0x23fb,
+  0xa8a5,
+  0xaa8a,
+  0xa0d0,
+  0xa1e6,
+  0x2024,
+  0xa371,
+  0x18da,
+  0x9be5,
+  0xa23d,
+  0x9b1d,
+  0x2060,
+  0x291e,
+  0x2063,
+  0xa86f,
+  0x263a,
+  0xa8c2,
+  0x29a9,
+  0xa0e1,
+  0x157d,
+  0x24c0,
+  0xa853,
+  0x28a4,
+  0xa92b,
+  0x1d4d,
+  0x23b2,
+  0xa8d0,
+  0xa52c,
+  0x9f5d,
+  0xa7c3,
+  0xaa55,
+  0x1d09,
+  0x9c2f,
+  0x9ef5,
+  0x1e2d,
+  0xa85d,
+  0xa142,
+  0xab6c,
+  0x2857,
+  0x2586,
+  0xa266,
+  0x25c5,
+  0x28f5,
+  0x156e,
+  0x2695,
+  0xa0b1,
+  0x2101,
+  0x283a,
+  0xa6b0,
+  0xa9a6,
+  0xa0ee,
+  0x25e6,
+  0x1d20,
+  0xa402,
+  0x1e78,
+  0x26f6,
+  0x290b,
+  0x21c5,
+  0xa45c,
+  0x2946,
+  0xa1cf,
+  0xa514,
+  0xa4bd,
+  0x25bc,
+  0xa716,
+  0xa67f,
+  0x9e42,
+  0x289a,
+  0x296f,
+  0xa59d,
+  0xa03d,
+  0x2746,
+  0x2673,
+  0x1c06,
+  0x2589,
+  0xa3c7,
+  0xa52e,
+  0xaaec,
+  0x9c69,
+  0x2546,
+  0x19cd,
+  0x2569,
+  0xac1d,
+  0xac16,
+  0x24e7,
+  0x29a1,
+  0x2696,
+  0x2564,
+  0xa2cb,
+  0x20a5,
+  0x2794,
+  0xa904,
+  0x2546,
+  0x942e,
+  0x28d9,
+  0x23a6,
+  0xa431,
+  0xa111,
+  0xaa66,
+  0xac4f,
+  0xa866,
+  0x9bcc,
+  0x266b,
+  0x2826,
+  0x1bff,
+  0xa588,
+  0xa211,
+  0x19e9,
+  0xa628,
+  0xa81a,
+  0xa564,
+  0x1645,
+  0x1c96,
+  0xaa3d,
+  0xa7aa,
+  0x8697,
+  0x2ad6,
+  0x12f9,
+  0x2b5b,
+  0xa844,
+  0xa4b3,
+  0x1d5e,
+  0xac98,
+  0x2656,
+  0x9fb3,
+  0x98ac,
+  0xa3da,
+  0x2815,
+  0x26c0,
+  0x1f87,
+  0x2087,
+  0xa8d0,
+  0x2a56,
+  0x25cc,
+  0x9d3c,
+  0x81d3,
+  0xa1e6,
+  0x9e51,
+  0xa65e,
+  0xa579,
+  0xa270,
+  0x1bcb,
+  0x2951,
+  0x9fcb,
+  0x2b10,
+  0xa86a,
+  0xaae9,
+  0x216a,
+  0x2726,
+  0x22c7,
+  0xa6f5,
+  0x963e,
+  0x2970,
+  0x2983,
+  0x2930,
+  0xab67,
+  0x9105,
+  0xaa75,
+  0xa431,
+  0xa55a,
+  0x2279,
+  0x9c1a,
+  0xa923,
+  0x1ba2,
+  0xa4de,
+  0xabe7,
+  0x206b,
+  0x29f9,
+  0x1b0a,
+  0x8dd0,
+  0xa5a6,
+  0x2869,
+  0x29ff,
+  0xa80d,
+  0xa544,
+  0xa15a,
+  0xa800,
+  0x9d4f,
+  0x2b99,
+  0x2875,
+  0x2624,
+  0xa09b,
+  0x9e2d,
+  0x9dcb,
+  0x1548,
+  0xaa08,
+  0x196d,
+  0x2888,
+  0x25a7,
+  0x22e9,
+  0xa569,
+  0xa554,
+  0x1894,
+  0xa33b,
+  0x0d18,
+  0x284c,
+  0xabe2,
+  0xa9a6,
+  0x1db9,
+  0xa645,
+  0x16fa,
+  0x923a,
+  0x9c42,
+  0x1074,
+  0x2493,
+  0x26f5,
+  0x2425,
+  0x28d8,
+  0x277b,
+  0x22be,
+  0xa50c,
+  0x9c9c,
+  0xa896,
+  0xa41b,
+  0x24de,
+  0x20bc,
+  0xaadc,
+  0x9c86,
+  0xa868,
+  0x9a2e,
+  0xa8b2,
+  0xac23,
+  0x269d,
+  0xa830,
+  0xa15a,
+  0x25ee,
+  0xa920,
+  0x2796,
+  0xa4e4,
+  0xa817,
+  0x2027,
+  0x9ec3,
+  0x941e,
+  0xa007,
+  0xa517,
+  0xa568,
+  0x9def,
+  0x2bd2,
+  0x234a,
+  0x1e0f,
+  0x9fa2,
+  0xa138,
+  0x20e0,
+  0xa370,
+  0xa6b6,
+  0xa044,
+  0xa768,
+  0x2be8,
+  0xa51b,
+  0x2941,
+  0xa49b,
+  0x2148,
+  0x2264,
+  0xa647,
+  0x1295,
+  0xa651,
+  0x26ce,
+  0x2bf0,
+  0x253e,
+  0x2570,
+  0xa8eb,
+  0xa79b,
+  0x1455,
+  0xa38a,
+  0x1f3d,
+  0x2ab9,
+  0x191b,
+  0x2b4e,
+  0x2896,
+  0x1d63,
+  0xa887,
+  0x1c65,
+  0xa858,
+  0x280f,
+  0xa6dd,
+  0xa560,
+  0x222f,
+  0x9ca5,
+  0x2c6b,
+  0x2537,
+  0xa9a2,
+  0xa46a,
+  0x1bf0,
+  0xa9dd,
+  0xa6f4,
+  0xa287,
+  0x2b2a,
+  0x200f,
+  0x19bc,
+  0xac8d,
+  0xa0e6,
+  0x2048,
+  0xaa69,
+  0xa685,
+  0xa962,
+  0x224b,
+  0xa468,
+  0x28ff,
+  0x2b55,
+  0xa5fa,
+  0xa8c7,
+  0x2461,
+  0xa105,
+  0xa8a0,
+  0x20de,
+  0x2b58,
+  0xa9a6,
+  0x2c88,
+  0x24fd,
+  0x1f16,
+  0x2771,
+  0xa75b,
+  0x9fb4,
+  0x2879,
+  0x27dc,
+  0x22e8,
+  0xa54c,
+  0x9e08,
+  0x240a,
+  0xa9d6,
+  0x2bc3,
+  0x24cf,
+  0x2723,
+  0x25b1,
+  0x1922,
+  0xa416,
+  0x27ca,
+  0xa988,
+  0x27c2,
+  0x2ad1,
+  0x2e6b,
+  0x26e2,
+  0x2997,
+  0x2243,
+  0x9ffa,
+  0x2805,
+  0xa6c0,
+  0x87a7,
+  0x27b5,
+  0x2500,
+  0x21d1,
+  0x2592,
+  0x2a92,
+  0x29ed,
+  0x2110,
+  0xa2e7,
+  0xa300,
+  0xa133,
+  0x2765,
+  0xa69f,
+  0xa5ee,
+  0x2960,
+  0xac4d,
+  0x2170,
+  0x2877,
+  0x210d,
+  0x1e87,
+  0x2193,
+  0xa67f,
+  0x1415,
+  0x28d6,
+  0xa8b6,
+  0xa085,
+  0x2702,
+  0xa99d,
+  0xaa30,
+  0x1bf6,
+  0xa87c,
+  0xa4e8,
+  0xa36d,
+  0xa6c8,
+  0xa10e,
+  0xa6b1,
+  0xac33,
+  0x9dfd,
+  0xa68a,
+  0x28a0,
+  0xa7c0,
+  0x2868,
+  0x287a,
+  0x919e,
+  0x274c,
+  0xa972,
+  0xa700,
+  0x2920,
+  0xa8b0,
+  0x2a13,
+  0xa772,
+  0x1cb4,
+  0x214d,
+  0xa3b5,
+  0xa776,
+  0xa759,
+  0xa87c,
+  0x2651,
+  0xa621,
+  0xa998,
+  0x2106,
+  0x29b5,
+  0x1a04,
+  0x1f2c,
+  0xac11,
+  0x1e50,
+  0xa202,
+  0xa8ac,
+  0xaab7,
+  0xa98c,
+  0x1091,
+  0xa401,
+  0x2652,
+  0xa64b,
+  0xa78b,
+  0x125f,
+  0xa5ae,
+  0x2612,
+  0x2775,
+  0x2a73,
+  0x22e9,
+  0x2a86,
+  0x2c03,
+  0x23eb,
+  0x2807,
+  0x2aa2,
+  0xab07,
+  0x9d21,
+  0x2869,
+  0xa53a,
+  0x2123,
+  0x114e,
+  0x9f97,
+  0xa767,
+  0x1b08,
+  0x293e,
+  0x2cf5,
+  0xa04a,
+  0x235b,
+  0x24f1,
+  0x24e1,
+  0xaa6f,
+  0xa731,
+  0xa5f5,
+  0x29f7,
+  0x9ce5,
+  0xaab2,
+  0xac2b,
+  0x1def,
+  0xa26e,
+  0x23a1,
+  0x284f,
+  0x24f5,
+  0xa6bd,
+  0xa5bc,
+  0x2818,
+  0xa2c6,
+  0xa2eb,
+  0x9c89,
+  0xab2e,
+  0xa67c,
+  0xa319,
+  0xab54,
+  0xa4b6,
+  0x1966,
+  0xa10b,
+  0x2cdf,
+  0xa619,
+  0x9d3d,
+  0x122b,
+  0x28db,
+  0x1eed,
+  0x0db6,
+  0xa18b,
+  0x9f21,
+  0x1ac2,
+  0xa80e,
+  0xa2b9,
+  0x24cf,
+  0x284f,
+  0xab2e,
+  0xa4ed,
+  0xa6be,
+  0x2cc3,
+  0xa913,
+  0xa84a,
+  0x2b00,
+  0x20ce,
+  0xa02a,
+  0x1fb0,
+  0x9908,
+  0xa0c8,
+  0x2cab,
+  0xa456,
+  0x0e20,
+  0xab98,
+  0x29e2,
+  0xa961,
+  0x1c4d,
+  0x286e,
+  0x2184,
+  0x1288,
+  0x293a,
+  0x26f0,
+  0xa85d,
+  0xa44d,
+  0xa645,
+  0x9c92,
+  0xa8a2,
+  0x063a,
+  0xa932,
+  0x24bf,
+  0x281c,
+  0xa81b,
+  0xa571,
+  0xa74b,
+  0xa5d7,
+  0xabfc,
+  0x2029,
+  0x279f,
+  0x2812,
+  0x24c8,
+  0x2a16,
+  0x2446,
+  0x1d54,
+  0xa461,
+  0xa232,
+  0x2458,
+  0x1d3a,
+  0x298f,
+  0x97d1,
+  0xa9ad,
+  0x264d,
+  0xac35,
+  0x2709,
+  0x81b9,
+  0xa667,
+  0x2874,
+  0xa05e,
+  0x2c57,
+  0xa098,
+  0x22c1,
+  0xac6f,
+  0x25c6,
+  0x28b4,
+  0x2704,
+  0x2b75,
+  0xa4af,
+  0x96d1,
+  0x9f30,
+  0x28ac,
+  0x22fa,
+  0x1cc9,
+  0x1c3e,
+  0xa8d3,
+  0x22ae,
+  0x0ff1,
+  0xab06,
+  0xa6c5,
+  0x1ce7,
+  0x9891,
+  0x1d93,
+  0xa8fa,
+  0xa057,
+  0x2333,
+  0x2618,
+  0xa3c2,
+  0x9fff,
+  0xa7f6,
+  0xa9c3,
+  0x9cf8,
+  0xa18d,
+  0x28bb,
+  0x9f7d,
+  0x1f82,
+  0xa517,
+  0xac3d,
+  0x1d1e,
+  0x2d37,
+  0xa806,
+  0xa95e,
+  0xa6f0,
+  0xa835,
+  0x2d61,
+  0x2905,
+  0xa88b,
+  0xa629,
+  0xa559,
+  0x29f1,
+  0xa4ca,
+  0x1e5e,
+  0xa778,
+  0xaa9d,
+  0x9950,
+  0x2703,
+  0x2b81,
+  0x2842,
+  0x2741,
+  0x2405,
+  0x271a,
+  0x2ce0,
+  0x2678,
+  0x28e0,
+  0x9eb0,
+  0x1a1c,
+  0x1a61,
+  0x9639,
+  0xa2e1,
+  0x2289,
+  0xa987,
+  0xa05c,
+  0x99bd,
+  0x1f0d,
+  0x9a7d,
+  0x1e4b,
+  0xa21b,
+  0x1f6a,
+  0x27c8,
+  0xac0c,
+  0xaaa8,
+  0xa848,
+  0xa542,
+  0x23cb,
+  0x22c5,
+  0xaa77,
+  0x21c2,
+  0xa9f9,
+  0x25e8,
+  0x2654,
+  0x203c,
+  0xa431,
+  0x2569,
+  0xa6b4,
+  0x2bd1,
+  0x18f0,
+  0x1e68,
+  0x2a9d,
+  0xa51b,
+  0xa5c8,
+  0x9e61,
+  0x2056,
+  0xabc9,
+  0xa2e4,
+  0x980a,
+  0x2887,
+  0xa013,
+  0xa939,
+  0xa21f,
+  0xa466,
+  0x9e19,
+  0xa979,
+  0x2c0d,
+  0x2200,
+  0x2117,
+  0x28a7,
+  0xa82f,
+  0xab05,
+  0xaa04,
+  0x2418,
+  0x1e10,
+  0x1ca5,
+  0x1dff,
+  0xa1a1,
+  0x2805,
+  0xa57a,
+  0xa9b3,
+  0x2abb,
+  0x2754,
+  0x21f8,
+  0xa332,
+  0xac4d,
+  0xa8c1,
+  0x2536,
+  0x289b,
+  0x98d0,
+  0x9c2a,
+  0xa473,
+  0x22b4,
+  0x24db,
+  0x2aaf,
+  0x28e2,
+  0x2744,
+  0xa3b0,
+  0x2ae0,
+  0xa56e,
+  0xa2f9,
+  0xa5da,
+  0xa064,
+  0xac36,
+  0xa8c7,
+  0x2c0b,
+  0xa94c,
+  0x9f95,
+  0x9f82,
+  0x2543,
+  0xa3b7,
+  0x2c0f,
+  0xa6be,
+  0xa4a2,
+  0x1967,
+  0xa1dd,
+  0xabb9,
+  0xa390,
+  0x9a24,
+  0x1a33,
+  0xac65,
+  0x2374,
+  0x9411,
+  0x27f1,
+  0x1a5d,
+  0x9818,
+  0xa4a2,
+  0xa6af,
+  0xa58e,
+  0x215a,
+  0x9f39,
+  0x2613,
+  0x24eb,
+  0x21ce,
+  0x277a,
+  0x2982,
+  0xa575,
+  0x2c15,
+  0x2a41,
+  0x2c3e,
+  0x9dbf,
+  0x157f,
+  0x2955,
+  0x2a20,
+  0xa29b,
+  0xaa4c,
+  0x9e6c,
+  0x2440,
+  0xa072,
+  0xa914,
+  0x24ee,
+  0x252a,
+  0x143d,
+  0x2c57,
+  0xa853,
+  0x0371,
+  0x24c8,
+  0x2457,
+  0xa5d7,
+  0xa315,
+  0x1717,
+  0xa313,
+  0x2b41,
+  0x2460,
+  0xa5ad,
+  0x2623,
+  0x2976,
+  0x1f17,
+  0xaa77,
+  0x2c66,
+  0xacc0,
+  0x218c,
+  0x2382,
+  0xa515,
+  0xa5eb,
+  0xa59b,
+  0x2897,
+  0x2885,
+  0x1302,
+  0x1821,
+  0xa743,
+  0xaa5f,
+  0xa356,
+  0x1c47,
+  0x2755,
+  0xa632,
+  0xa54b,
+  0x1f0e,
+  0x28d8,
+  0x2b36,
+  0x2413,
+  0x9e34,
+  0xa672,
+  0xa268,
+  0xa1d1,
+  0xa37b,
+  0xa8f1,
+  0xa379,
+  0x23bb,
+  0x27e3,
+  0xa42f,
+  0xa81d,
+  0xa0c3,
+  0x28fd,
+  0x24da,
+  0x2a9d,
+  0x02d3,
+  0xa6d1,
+  0x2784,
+  0xaabd,
+  0xa723,
+  0xa9e0,
+  0xa44a,
+  0x26fd,
+  0x9e69,
+  0x1967,
+  0x1cd5,
+  0xa991,
+  0x278d,
+  0xa563,
+  0x1d6f,
+  0xa837,
+  0xac42,
+  0x2ad9,
+  0x155b,
+  0xa5cd,
+  0xa3cc,
+  0x1e38,
+  0x2ba7,
+  0x9fa5,
+  0xa16e,
+  0xa562,
+  0x29fe,
+  0xa400,
+  0xac79,
+  0xad10,
+  0x2932,
+  0x2218,
+  0xa7c6,
+  0xaba2,
+  0x9921,
+  0x2b21,
+  0xa4aa,
+  0x2cc8,
+  0xa535,
+  0x26bc,
+  0x211c,
+  0xa689,
+  0xa754,
+  0xa9e6,
+  0xaa8e,
+  0x2957,
+  0xa6b0,
+  0xa6b3,
+  0xa868,
+  0x21d7,
+  0x21b8,
+  0x24e0,
+  0xa4ef,
+  0x2be9,
+  0x247f,
+  0x2880,
+  0x2b15,
+  0x207e,
+  0xa21e,
+  0xa696,
+  0x1f31,
+  0x2857,
+  0x24db,
+  0xa44c,
+  0xa4be,
+  0x26be,
+  0xa99a,
+  0xaaf6,
+  0x9a9f,
+  0x2626,
+  0x245e,
+  0xa974,
+  0xa106,
+  0x2a6b,
+  0x94e5,
+  0xa53d,
+  0xa6da,
+  0x99fc,
+  0xa7f4,
+  0xa4e4,
+  0x9c4a,
+  0xa135,
+  0xaaf1,
+  0xac7b,
+  0x299d,
+  0xa730,
+  0xa530,
+  0x1be5,
+  0x9a85,
+  0xa9b1,
+  0x2d85,
+  0x2146,
+  0xa0d9,
+  0xa3af,
+  0xa591,
+  0xabd1,
+  0xad16,
+  0xa668,
+  0x9808,
+  0x2070,
+  0xa4ab,
+  0x26bc,
+  0x1b79,
+  0xafa0,
+  0xa521,
+  0x2c38,
+  0xa6cc,
+  0xaceb,
+  0x1c71,
+  0x1f78,
+  0xa85e,
+  0x29f4,
+  0x1b86,
+  0xa536,
+  0xa8ff,
+  0xaac6,
+  0x256b,
+  0x288e,
+  0x1e5a,
+  0x2203,
+  0x2474,
+  0xa220,
+  0xa474,
+  0xaab6,
+  0xa506,
+  0xa749,
+  0x2b24,
+  0xa61a,
+  0x2405,
+  0x1584,
+  0xa410,
+  0xa1fb,
+  0x268f,
+  0x24c4,
+  0x2423,
+  0x1d08,
+  0x2961,
+  0xa323,
+  0x2660,
+  0xa45c,
+  0xa525,
+  0xa924,
+  0xa742,
+  0x20c1,
+  0xa8aa,
+  0xa2f1,
+  0xab8c,
+  0xa756,
+  0xa6eb,
+  0x299b,
+  0xa8ef,
+  0x25d2,
+  0xa409,
+  0x994e,
+  0xa5c6,
+  0x2989,
+  0x2a96,
+  0x1fe6,
+  0x260f,
+  0xaa72,
+  0xa991,
+  0x228c,
+  0xac21,
+  0x22a0,
+  0x2250,
+  0x992f,
+  0xa4ac,
+  0x2562,
+  0xaf8d,
+  0x9a09,
+  0xa2d6,
+  0xaa18,
+  0x1bce,
+  0x9f79,
+  0xabb2,
+  0x2a2b,
+  0x9312,
+  0xa1d4,
+  0xa828,
+  0xa4b0,
+  0xa61d,
+  0x289e,
+  0xa4e1,
+  0xa0f6,
+  0x2273,
+  0xa0c3,
+  0xa81a,
+  0xa595,
+  0x27b0,
+  0x1db3,
+  0x28fe,
+  0x2a83,
+  0xa734,
+  0x97c7,
+  0x2813,
+  0xa4d5,
+  0xa88c,
+  0xa7b7,
+  0xaa9f,
+  0xa09e,
+  0x2857,
+  0xa4e5,
+  0x28d8,
+  0xa203,
+  0xaaeb,
+  0x2543,
+  0xa7d8,
+  0x9cd5,
+  0x2c83,
+  0x83d7,
+  0x9b74,
+  0xaa5c,
+  0x236e,
+  0xaaf2,
+  0xa382,
+  0x9cba,
+  0x1c04,
+  0xa970,
+  0xaa53,
+  0x2514,
+  0xabc0,
+  0x18e5,
+  0x1f30,
+  0xa1a4,
+  0xabce,
+  0xa4bd,
+  0x2612,
+  0x237c,
+  0xa034,
+  0x26f7,
+  0x2a94,
+  0xa578,
+  0xa864,
+  0x2c36,
+  0x1d06,
+  0xa53e,
+  0x29d0,
+  0x9c96,
+  0x2627,
+  0x94d8,
+  0x26b3,
+  0x9771,
+  0xa496,
+  0x988a,
+  0x2a7f,
+  0x1bd9,
+  0xa1b7,
+  0xaa71,
+  0x29d2,
+  0xa610,
+  0x2489,
+  0xa278,
+  0x20b1,
+  0xaa0d,
+  0x245b,
+  0xa817,
+  0x25a6,
+  0x2bfb,
+  0xa943,
+  0x27e2,
+  0x26bc,
+  0xa5bd,
+  0xa1e5,
+  0xa5b1,
+  0x21ab,
+  0x9fe2,
+  0x2c22,
+  0xa6a6,
+  0xa650,
+  0x2c3e,
+  0x2bbe,
+  0xa5ca,
+  0x240f,
+  0xa027,
+  0x2612,
+  0x1eff,
+  0xa319,
+  0xa32e,
+  0xacda,
+  0x9864,
+  0x24d0,
+  0xa5db,
+  0x21ef,
+  0x2411,
+  0xa640,
+  0x1f9f
+};
+#elif defined(STORAGE_BF16)
+const bf16_t __in_weights_bf16[] = {
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0x3dcd,
+  0xbdcd,
+  0xbdcd,
+  0x3dcd,
+  0x3dcd
+};
+const bf16_t __res_weights_bf16[] = {
+  0x3980,
+  0xbc63,
+  0x3ce4,
+  0xbce8,
+  0xbc59,
+  0xb9b9,
+  0xbb7e,
+  0x3c2e,
+  0xbbb0,
+  0x3d41,
+  0x3cff,
+  0xbd10,
+  0x3d41,
+  0xbc9b,
+  0x3d02,
+  0x3c23,
+  0xbcd7,
+  0xbd23,
+  0x3d16,
+  0xbaf7,
+  0x3cdf,
+  0x3c4f,
+  0xbc2b,
+  0xbcee,
+  0x3c60,
+  0x3c92,
+  0xbc93,
+  0x3cb0,
+  0x3c3d,
+  0xbbe8,
+  0x3ba4,
+  0x3aaa,
+  0xbcf2,
+  0xbd15,
+  0xbcb7,
+  0x3d2b,
+  0x3cdd,
+  0x3bdc,
+  0x3bac,
+  0xbc8b,
+  0xbbb4,
+  0x3c19,
+  0x3d55,
+  0xbc00,
+  0x3be9,
+  0x3ccc,
+  0xbbd5,
+  0xbc16,
+  0xbb9f,
+  0x3ca4,
+  0xbd23,
+  0xbc1b,
+  0x3d04,
+  0x3c10,
+  0x3c88,
+  0xbcb7,
+  0x3c19,
+  0x3cbc,
+  0xbc81,
+  0x3cfe,
+  0x3b42,
+  0xbc25,
+  0xbcd8,
+  0x3d21,
+  0xbd2d,
+  0x3c20,
+  0xbbfb,
+  0x3c98,
+  0x3cbb,
+  0x3ae1,
+  0xbd5d,
+  0x3d21,
+  0x3c2b,
+  0xbd1e,
+  0xbd17,
+  0x3b4c,
+  0xbb09,
+  0xbca7,
+  0x3c32,
+  0xbc18,
+  0x3cf4,
+  0x3c73,
+  0x3cc3,
+  0x3c81,
+  0x3b3a,
+  0xbc1a,
+  0xbd29,
+  0xbb58,
+  0xbd15,
+  0x3b45,
+  0x3d93,
+  0x3aaf,
+  0x3d5c,
+  0xbc62,
+  0x3d49,
+  0x3cd8,
+  0xbc5f,
+  0xbd91,
+  0xbbf4,
+  0x3ccb,
+  0x3d5d,
+  0x3d02,
+  0x3ca7,
+  0xbd15,
+  0xbc95,
+  0x3cf8,
+  0x3ccc,
+  0xbccf,
+  0xbd6d,
+  0xbbc3,
+  0xbbbc,
+  0x3b9e,
+  0xbd03,
+  0xbc92,
+  0xbce1,
+  0xbc13,
+  0xbc7c,
+  0xbc0d,
+  0x3d2d,
+  0x3cf3,
+  0x3b87,
+  0x3d38,
+  0x3d30,
+  0x3d23,
+  0xbca0,
+  0xbd09,
+  0x3d02,
+  0x3b76,
+  0x3cf5,
+  0xbcf1,
+  0xbc21,
+  0x3c23,
+  0xbcec,
+  0xbc9e,
+  0x3c9b,
+  0x3ceb,
+  0x3c0c,
+  0x3c13,
+  0xbd70,
+  0x3ce9,
+  0x3d2a,
+  0x3cc2,
+  0xbde9,
+  0x3b62,
+  0xbc91,
+  0x3cfe,
+  0xbca5,
+  0x3c35,
+  0xbbc3,
+  0x3d73,
+  0x3c0c,
+  0xbba4,
+  0x3c3c,
+  0x3c80,
+  0xbcb3,
+  0xbd41,
+  0xbcfc,
+  0x3d0e,
+  0xbb5c,
+  0x3c86,
+  0xbce8,
+  0x3ba6,
+  0x3c5e,
+  0xbae1,
+  0xbbc9,
+  0x3d24,
+  0xbc9b,
+  0xbc62,
+  0x3c07,
+  0x3d00,
+  0x3c9d,
+  0xbca8,
+  0xbd01,
+  0x3cd4,
+  0x3c98,
+  0x3d84,
+  0xbd0c,
+  0x3c73,
+  0x3ce5,
+  0x3d55,
+  0x3d30,
+  0x3c91,
+  0xbc4d,
+  0x3cf8,
+  0xbd1a,
+  0xbd86,
+  0x3cc3,
+  0xbc25,
+  0xbcd7,
+  0x3cc0,
+  0xbcc0,
+  0xbc15,
+  0xbac7,
+  0x3d36,
+  0x3d5a,
+  0x3c1f,
+  0xbc76,
+  0x3d61,
+  0xbb13,
+  0x3a2c,
+  0xbcb6,
+  0x3d1a,
+  0x3d00,
+  0xbc32,
+  0x3cc4,
+  0xbcca,
+  0x3d2f,
+  0xbc52,
+  0xbc60,
+  0x3cc5,
+  0x3cb8,
+  0x3d8c,
+  0xbac9,
+  0x3d46,
+  0xbdac,
+  0xbb84,
+  0xbc62,
+  0x3d60,
+  0xbc2a,
+  0xbcea,
+  0x3c82,
+  0x3c29,
+  0x395d,
+  0x3bb1,
+  0xbbf1,
+  0x3c42,
+  0xbcb7,
+  0x3c3b,
+  0xbc8b,
+  0xbc5b,
+  0xbc11,
+  0xbc26,
+  0xbd30,
+  0x3cbb,
+  0xbc2c,
+  0xbce2,
+  0x3d2d,
+  0x3c2e,
+  0xbd35,
+  0xbc44,
+  0x3d95,
+  0xb9dd,
+  0xbd36,
+  0x3da1,
+  0x3cee,
+  0x3c48,
+  0x3c14,
+  0xbd30,
+  0xbbf2,
+  0x3c32,
+  0x3baf,
+  0x3be2,
+  0xbbf6,
+  0xbcf5,
+  0xbd15,
+  0xbd0b,
+  0xbcf3,
+  0xbc66,
+  0xbd87,
+  0x3ada,
+  0xbc7f,
+  0x3d02,
+  0xbc90,
+  0x3cf9,
+  0xbb79,
+  0x3d0a,
+  0xbd0c,
+  0x3bdb,
+  0x3d5f,
+  0x3c70,
+  0x3c88,
+  0x3b9a,
+  0x3c53,
+  0xbb4d,
+  0x3ca9,
+  0xbd4c,
+  0x3c66,
+  0x3cbc,
+  0xbca5,
+  0x3b04,
+  0x3d90,
+  0x3c3b,
+  0xbc77,
+  0x3a43,
+  0x3ceb,
+  0xbd9c,
+  0x3dcd,
+  0x3c4d,
+  0x3c9f,
+  0xbd09,
+  0x3d65,
+  0xbc42,
+  0xbb11,
+  0x3ca0,
+  0xbd86,
+  0xbc08,
+  0xbae2,
+  0xbcb3,
+  0x3b34,
+  0xbcac,
+  0xbc80,
+  0xbc07,
+  0xbb5a,
+  0xbc88,
+  0x3b84,
+  0xbd5b,
+  0xbc9a,
+  0xbb5f,
+  0x3c83,
+  0x3d11,
+  0x3c51,
+  0xbcaf,
+  0x3d4c,
+  0x3d07,
+  0xbd41,
+  0xbc00,
+  0x3cdf,
+  0xbd35,
+  0xbc84,
+  0x3da1,
+  0xbc24,
+  0xbcaa,
+  0x3d31,
+  0x3d70,
+  0x3d7a,
+  0xbc55,
+  0x3c0c,
+  0xbc13,
+  0xbd8e,
+  0xbc7d,
+  0xbc17,
+  0x3d0f,
+  0x3c13,
+  0x3cea,
+  0x3c8c,
+  0xbb11,
+  0x3c75,
+  0xbd10,
+  0x3c7b,
+  0xbcb1,
+  0xbc0e,
+  0x3c89,
+  0x3cce,
+  0x3d03,
+  0xbcde,
+  0x3c99,
+  0xbd1b,
+  0xbc1d,
+  0x3ad9,
+  0x3ce9,
+  0xbd18,
+  0xbc45,
+  0x3b9c,
+  0x3c55,
+  0xbcdb,
+  0x3d5b,
+  0xbca5,
+  0x3c8a,
+  0x3ca7,
+  0xbae2,
+  0x3c9a,
+  0xbbec,
+  0xbcb2,
+  0x3cc0,
+  0xbb63,
+  0xbd32,
+  0xbbef,
+  0x3d15,
+  0x3ce9,
+  0xbcbe,
+  0xbd01,
+  0xbcc8,
+  0x3816,
+  0x3ce6,
+  0x3bc0,
+  0xbce9,
+  0x3c52,
+  0x3be7,
+  0x3d1b,
+  0xbbfe,
+  0x3d3c,
+  0xbd0a,
+  0x3cbf,
+  0xbc57,
+  0xbc3b,
+  0xbc9e,
+  0xbdb0,
+  0xbc90,
+  0x3c33,
+  0xbd63,
+  0xbab6,
+  0xbd2a,
+  0xbd60,
+  0x3c8b,
+  0xbc94,
+  0x3b65,
+  0xbc6c,
+  0xbc29,
+  0x3c49,
+  0x3d34,
+  0x3cc9,
+  0x3cc8,
+  0xbd0c,
+  0xbc93,
+  0x3ccb,
+  0x3cf6,
+  0x3d01,
+  0x3d02,
+  0xbd30,
+  0xbcc8,
+  0xbc80,
+  0x3bf7,
+  0x3d14,
+  0xbcc5,
+  0xbbc7,
+  0xbcde,
+  0xbd03,
+  0xbcfa,
+  0xbd35,
+  0xbc9d,
+  0x3d19,
+  0x3d1b,
+  0xbcbf,
+  0xbbf9,
+  0xbda7,
+  0xbc3e,
+  0x3d8c,
+  0xbc2f,
+  0x3c80,
+  0x3d8c,
+  0x3d24,
+  0xbc82,
+  0xbc20,
+  0x3c1d,
+  0xbd8d,
+  0x3ce7,
+  0xbd24,
+  0xbc28,
+  0xbc24,
+  0xbd4a,
+  0xbc25,
+  0xbc9c,
+  0xbd13,
+  0x3c56,
+  0x3b12,
+  0xbcbb,
+  0x3c71,
+  0x3b68,
+  0x3c79,
+  0x3bd4,
+  0x3cdb,
+  0xbdc3,
+  0xbd20,
+  0x3bc7,
+  0x3bac,
+  0x3bec,
+  0xbd30,
+  0xbca5,
+  0xbd8f,
+  0x3d17,
+  0xbd5c,
+  0xbc99,
+  0x3d42,
+  0xbce7,
+  0xbd26,
+  0xbccc,
+  0x3d07,
+  0xbc6d,
+  0xbd28,
+  0xbcb4,
+  0x3d07,
+  0x3c12,
+  0x3d06,
+  0x3cd2,
+  0x3c4c,
+  0x3d53,
+  0x3c2b,
+  0xbce5,
+  0x3cc1,
+  0x3cc6,
+  0xbc1b,
+  0x3cbf,
+  0xbc47,
+  0xbd52,
+  0x3d5b,
+  0x3d27,
+  0xbc76,
+  0xbd64,
+  0x3cbe,
+  0xba2e,
+  0x3d53,
+  0xbc03,
+  0x3d3b,
+  0x3cc2,
+  0x3d86,
+  0xbc01,
+  0x3b45,
+  0x3c1b,
+  0x3d1b,
+  0x3d27,
+  0x3c82,
+  0x3b8a,
+  0xbcec,
+  0x3c82,
+  0x3c80,
+  0x3aed,
+  0x3c86,
+  0xbcd4,
+  0x3b90,
+  0xbd00,
+  0x3cae,
+  0x3c34,
+  0xbc63,
+  0xbb39,
+  0xbd00,
+  0x3c9d,
+  0xbc12,
+  0xbcff,
+  0xbca1,
+  0x3c0d,
+  0xbc93,
+  0xbd7d,
+  0x3c97,
+  0x3cc2,
+  0xbb2a,
+  0x3b6d,
+  0x3ced,
+  0xbd4e,
+  0xbc60,
+  0x3d0c,
+  0xbc2a,
+  0x3c5a,
+  0xbc3b,
+  0x3c0d,
+  0xbc28,
+  0xbd9f,
+  0xbd3e,
+  0xbd49,
+  0x3cea,
+  0x3cb1,
+  0x3d3c,
+  0x3d2c,
+  0x3d8b,
+  0xbc97,
+  0xbd3c,
+  0xbc90,
+  0xbd4e,
+  0xbcf3,
+  0xbd31,
+  0xbcb7,
+  0xbbc8,
+  0x3d65,
+  0x3c8f,
+  0x3cf3,
+  0x3bba,
+  0xbd33,
+  0x3c62,
+  0xbc3c,
+  0x3c7c,
+  0xbc84,
+  0xbd23,
+  0x3d39,
+  0xbd8f,
+  0xbcc1,
+  0x3d19,
+  0x3ced,
+  0x3b34,
+  0xbc4d,
+  0x3ce2,
+  0x3d2a,
+  0x3c83,
+  0x3cc6,
+  0x3cb9,
+  0x3d25,
+  0xbc88,
+  0xbb9b,
+  0xbdc1,
+  0xbcc1,
+  0x3b11,
+  0xbd68,
+  0x3bbd,
+  0x3b39,
+  0xb927,
+  0xbc00,
+  0xbcc6,
+  0x3cb4,
+  0x3d2c,
+  0xbd3c,
+  0x3c3d,
+  0xbb4d,
+  0x3ce3,
+  0x3b90,
+  0x3c02,
+  0x3cde,
+  0x3a1d,
+  0x3cc1,
+  0xbce7,
+  0x3d1e,
+  0xbd95,
+  0xbbbe,
+  0x3d9e,
+  0x3d2a,
+  0x3d97,
+  0xbd01,
+  0x3a02,
+  0x3ca7,
+  0x3bfb,
+  0xbc1f,
+  0x3d25,
+  0x3d0a,
+  0xbd42,
+  0x3c93,
+  0x3cbe,
+  0xbbbb,
+  0x3cc2,
+  0x3cf7,
+  0xbd53,
+  0xbb1a,
+  0x3d35,
+  0xbc65,
+  0xbc5f,
+  0x3cea,
+  0x3d01,
+  0xbd0e,
+  0xbd94,
+  0x3c8d,
+  0x3bea,
+  0x3bad,
+  0x3b6b,
+  0x3d0f,
+  0xbd3d,
+  0x3c85,
+  0xbd99,
+  0x3ced,
+  0x3cc3,
+  0x3c97,
+  0xbbfe,
+  0xbca2,
+  0x3c2b,
+  0xbd08,
+  0x3d34,
+  0x3cee,
+  0xb843,
+  0xbd9a,
+  0x3d3f,
+  0x3c9f,
+  0x3cce,
+  0xba11,
+  0xbcd9,
+  0xbd36,
+  0x3a09,
+  0xbc14,
+  0x3a4b,
+  0x3bfa,
+  0x3c4a,
+  0xbd03,
+  0x3bfb,
+  0xbc59,
+  0x3c97,
+  0x3c1c,
+  0x3b23,
+  0x3d8d,
+  0x3c4e,
+  0x3d04,
+  0x3cc4,
+  0x3d12,
+  0xbd4e,
+  0xbbc2,
+  0xbd4a,
+  0xbba2,
+  0x3d50,
+  0xbcac,
+  0xbd60,
+  0x3c4f,
+  0x3cf1,
+  0x3c22,
+  0x3bb6,
+  0x3aff,
+  0x3986,
+  0x3cac,
+  0x3c91,
+  0xbd6f,
+  0xbc93,
+  0xbcae,
+  0xbc2c,
+  0xbce4,
+  0x3cc7,
+  0xbd0b,
+  0xbd13,
+  0xbca8,
+  0xbb2c,
+  0x3d81,
+  0xbd8d,
+  0xbd58,
+  0x3cb3,
+  0xbcc3,
+  0xbc1a,
+  0x3da0,
+  0x3b2b,
+  0x3d39,
+  0xbd20,
+  0xbcde,
+  0x3c99,
+  0xbbdd,
+  0x3cbb,
+  0xbc12,
+  0xbcab,
+  0xbb57,
+  0xbc78,
+  0xbd2d,
+  0xbd5e,
+  0xbd1e,
+  0xbbf4,
+  0x3c8b,
+  0xbd24,
+  0xbd19,
+  0xba19,
+  0x3b9c,
+  0xbcee,
+  0xbd5a,
+  0xbd05,
+  0x3d35,
+  0xbcd1,
+  0x3ceb,
+  0xbc86,
+  0xbcfe,
+  0x3b82,
+  0xbccc,
+  0xbc21,
+  0x3c10,
+  0x3c34,
+  0xbc53,
+  0xbd06,
+  0xbd17,
+  0x3acb,
+  0x3962,
+  0xbcf8,
+  0xbc53,
+  0x3ce1,
+  0xbd2e,
+  0xbd2c,
+  0xbb80,
+  0xbc82,
+  0x3bd3,
+  0x3daf,
+  0xbc5e,
+  0xbd55,
+  0x3cf3,
+  0x37b5,
+  0xbd35,
+  0x3bd7,
+  0xbc78,
+  0xbd08,
+  0x3da4,
+  0x3cfc,
+  0x3d18,
+  0x3d44,
+  0xbc86,
+  0x3cd9,
+  0x3d13,
+  0xbd9f,
+  0xbcd3,
+  0xbc20,
+  0xbcd7,
+  0xbc95,
+  0xbc26,
+  0xbd00,
+  0x3cd4,
+  0xbd62,
+  0x3bee,
+  0x3c88,
+  0x3bc1,
+  0x3d0d,
+  0x3be8,
+  0xbbe0,
+  0xbd37,
+  0xbb8a,
+  0xbcda,
+  0x3ab7,
+  0x3b59,
+  0x3c66,
+  0xbcf9,
+  0x3bc5,
+  0xbc7c,
+  0xbc79,
+  0x3c86,
+  0xbc97,
+  0x3d27,
+  0x3d5b,
+  0xbd01,
+  0x3b75,
+  0x3c7b,
+  0xbc88,
+  0x3d6b,
+  0xbbf8,
+  0x3d22,
+  0xbafa,
+  0x3c01,
+  0x3c55,
+  0x3c5e,
+  0x3ae8,
+  0xbb99,
+  0x3d6e,
+  0x3c0e,
+  0xbd27,
+  0x3d28,
+  0x3cfd,
+  0xbc5c,
+  0xbccf,
+  0x3d04,
+  0x3c08,
+  0x3b38,
+  0xbc81,
+  0xbcea,
+  0x3cc4,
+  0x3cc4,
+  0xbac3,
+  0xbd84,
+  0x3d2c,
+  0x3d3b,
+  0x3bac,
+  0xbdb1,
+  0xbceb,
+  0xbd11,
+  0x3c04,
+  0x3d2a,
+  0x3d14,
+  0xbc33,
+  0x3c9e,
+  0x3cc0,
+  0xbdaa,
+  0xbc8d,
+  0xbcc2,
+  0xbdc4,
+  0x3c97,
+  0xbced,
+  0x3d87,
+  0x3aa9,
+  0xbd16,
+  0xbd0a,
+  0x3cb5,
+  0xbc79,
+  0x3d80,
+  0x3b9a,
+  0x3b1e,
+  0xbcbf,
+  0xbcad,
+  0x3c8d,
+  0xbaab,
+  0x3c92,
+  0xbd89,
+  0xbce9,
+  0xbc82,
+  0xbd22,
+  0x3d4c,
+  0xbd7c,
+  0xbce3,
+  0xbce3,
+  0xbcd6,
+  0xbcd1,
+  0x3b0e,
+  0x3c84,
+  0x3cc3,
+  0x3c16,
+  0x3d11,
+  0x3cb2,
+  0xbd2b,
+  0xbcf0,
+  0xbd60,
+  0x3c26,
+  0xbcec,
+  0x3cb9,
+  0x3c3a,
+  0xbc3c,
+  0x3cb1,
+  0x3cc8,
+  0xbd4d,
+  0xbcf7,
+  0xbc1c,
+  0xbd43,
+  0xbced,
+  0xbd17,
+  0xbd5e,
+  0x3943,
+  0xbd3e,
+  0x395c,
+  0xbbc8,
+  0xbcb9,
+  0xbb7a,
+  0x3b93,
+  0xbc16,
+  0xbd5c,
+  0x3d4c,
+  0xbc80,
+  0xbcb7,
+  0xba3b,
+  0x3d47,
+  0xba5e,
+  0xbc4c,
+  0x3c83,
+  0xbcec,
+  0xbd1e,
+  0xbcb6,
+  0xbc69,
+  0xbd5c,
+  0xbbde,
+  0xbc8b,
+  0x3c00,
+  0x3d45,
+  0xbd29,
+  0xbca4,
+  0xbd13,
+  0x3cb4,
+  0xbd83,
+  0x3ce4,
+  0x3c83,
+  0xbc4f,
+  0xbcbf,
+  0x3bb5,
+  0xbd78,
+  0x3c03,
+  0x3ca0,
+  0x3d07,
+  0x3a67,
+  0xbd7e,
+  0xbc21,
+  0xb908,
+  0x3c68,
+  0x3b1c,
+  0x3c5b,
+  0x3d2e,
+  0xbd14,
+  0xbd00,
+  0x3d4b,
+  0x3c88,
+  0xbcfc,
+  0x3d89,
+  0x3d08,
+  0x3b23,
+  0xbd10,
+  0xbd20,
+  0x3c4b,
+  0x3cca,
+  0xbc47,
+  0xbd0e,
+  0x3cb4,
+  0x3b04,
+  0xbca0,
+  0xbcc6,
+  0x3bf6,
+  0xbd1d,
+  0x3ceb,
+  0xbc56,
+  0x3c61,
+  0xbc8f,
+  0x3cf0,
+  0x3d71,
+  0xbceb,
+  0xbcdc,
+  0x3cf8,
+  0xbd93,
+  0x3d4d,
+  0xbc7e,
+  0x3d42,
+  0xbbc2,
+  0xbc62,
+  0xbc4c,
+  0x3d09,
+  0x3c4a,
+  0xbc24,
+  0x3ce0,
+  0x3bac,
+  0x3d6b,
+  0x3b7d,
+  0xbc98,
+  0xbbff,
+  0xbccc,
+  0xbd44,
+  0x3cda,
+  0x3d26,
+  0xbc92,
+  0xbc05,
+  0xbcdb,
+  0xbc9a,
+  0x3cef,
+  0xbd04,
+  0x3c39,
+  0x3b9a,
+  0x3d29,
+  0xbd06,
+  0x3be0,
+  0x3c33,
+  0xbd88,
+  0xbbf9,
+  0xbd14,
+  0xbc4f,
+  0xbd6f,
+  0x3b26,
+  0x3d29,
+  0x3c12,
+  0x3b8f,
+  0x3c3d,
+  0x3ab3,
+  0x3b30,
+  0xbba6,
+  0x3c39,
+  0x3d05,
+  0x3d0e,
+  0xbcd3,
+  0xbd1d,
+  0x3b51,
+  0xbc89,
+  0xbc7e,
+  0xbcc3,
+  0xbd17,
+  0x3c41,
+  0x3ca7,
+  0xbc82,
+  0x3bcd,
+  0x3b8d,
+  0x3b1d,
+  0x3b87,
+  0x3caa,
+  0xbd05,
+  0x3d5f,
+  0xbc50,
+  0xba83,
+  0xbd6e,
+  0x3ce5,
+  0xbc96,
+  0x3c93,
+  0x3c4f,
+  0xbc4a,
+  0xbcfc,
+  0x3d04,
+  0x3d47,
+  0x3a38,
+  0x3da4,
+  0xbcb3,
+  0xbc13,
+  0xbc04,
+  0xbc30,
+  0xbc10,
+  0x3ca0,
+  0x3cfc,
+  0xbc9e,
+  0x3c3f,
+  0x3c67,
+  0xbd43,
+  0xbc92,
+  0xbcd1,
+  0xbbb8,
+  0x3d62,
+  0x3c4e,
+  0x3cfc,
+  0xbc3a,
+  0x3c5b,
+  0x3c45,
+  0xbcda,
+  0xbd03,
+  0xbd1c,
+  0x3ab1,
+  0x3d2f,
+  0x3d49,
+  0x3ca5,
+  0xbd02,
+  0xbce3,
+  0x3be9,
+  0xbd17,
+  0xbd08,
+  0xbcad,
+  0x3d75,
+  0xbcf5,
+  0x3d66,
+  0x3de7,
+  0x3d11,
+  0x3d1a,
+  0xba01,
+  0xbb34,
+  0x3d15,
+  0xbd08,
+  0xbd13,
+  0x3c45,
+  0xbc94,
+  0xbd16,
+  0xbd7a,
+  0xbbfb,
+  0xbc7e,
+  0x3c9a,
+  0x3b98,
+  0xbd0c,
+  0x3cd6,
+  0x3cfe,
+  0x3d4e,
+  0x3ce2,
+  0x3be5,
+  0x3cd5,
+  0x3caa,
+  0x3c03,
+  0xbc31,
+  0x3d2d,
+  0x3c64,
+  0xbc87,
+  0xbd15,
+  0xbc12,
+  0x3cd9,
+  0xbd25,
+  0xbd60,
+  0x3d1c,
+  0x3ce7,
+  0x3ce6,
+  0x3cd5,
+  0xbcc3,
+  0x3d9e,
+  0x3d48,
+  0x3cb3,
+  0xbd86,
+  0xbb1b,
+  0x3c5f,
+  0x3c88,
+  0xbd00,
+  0xbd9c,
+  0xbb75,
+  0x3b8b,
+  0x3c50,
+  0x3b02,
+  0xbb9f,
+  0x3cd3,
+  0x3d51,
+  0x3c8b,
+  0x3bee,
+  0xbd9c,
+  0xbd0e,
+  0x3b76,
+  0x3d28,
+  0xbcb5,
+  0x3c4a,
+  0x3c8e,
+  0x3a0a,
+  0x3cb9,
+  0x3ced,
+  0x3c6f,
+  0x3c11,
+  0xbd87,
+  0xbd52,
+  0xbd15,
+  0x3d37,
+  0xbcb5,
+  0xbd1b,
+  0x3b13,
+  0x3ac1,
+  0xbcc9,
+  0x3d23,
+  0x3c84,
+  0x3ca5,
+  0x3b8f,
+  0xbb0b,
+  0xbb22,
+  0xbcb6,
+  0xbb14,
+  0x3c45,
+  0x3b34,
+  0xbbbd,
+  0x3d79,
+  0xbbf1,
+  0x3d59,
+  0xbb89,
+  0x3ca0,
+  0xbd33,
+  0x3ce1,
+  0x3d2b,
+  0x3c7a,
+  0xbc06,
+  0x3d1e,
+  0x3ad7,
+  0xbbf6,
+  0xbcc2,
+  0x3c93,
+  0xbba1,
+  0xbd2b,
+  0x3c5d,
+  0xbc6f,
+  0xbce6,
+  0x3cc9,
+  0xbb43,
+  0x3b42,
+  0x3c14,
+  0x3cb5,
+  0xbd11,
+  0x3c28,
+  0xbd5d,
+  0xbd80,
+  0xbd49,
+  0xbce6,
+  0xbc54,
+  0x3c74,
+  0xbd07,
+  0xbc1a,
+  0x3ad9,
+  0xbcca,
+  0x3d08,
+  0x3c12,
+  0xbcf1,
+  0x3ca9,
+  0x3cad,
+  0xbc28,
+  0xbd18,
+  0x3c2c,
+  0x3d35,
+  0x3d14,
+  0x3cde,
+  0x3da7,
+  0xbc13,
+  0x3ce3,
+  0xbc2f,
+  0x3cf2,
+  0x3cce,
+  0xbb9e,
+  0x3d1d,
+  0xbc96,
+  0x3d64,
+  0x3d6c,
+  0xbcfc,
+  0x3bd6,
+  0x3cc4,
+  0xbd57,
+  0xbc7f,
+  0x3c8f,
+  0x3a80,
+  0xbc89,
+  0x3b81,
+  0xbc89,
+  0x3c97,
+  0xba8e,
+  0x3d4d,
+  0xbcfe,
+  0x3caa,
+  0xbc84,
+  0x3ccb,
+  0x3c98,
+  0xbd6c,
+  0xbc7b,
+  0xbbd1,
+  0xbd18,
+  0xbd2d,
+  0xbc3b,
+  0x3d43,
+  0xbd6d,
+  0xba54,
+  0xbd1a,
+  0xbb98,
+  0xbd2b,
+  0xbc5d,
+  0xbd46,
+  0xbd2c,
+  0x3cd5,
+  0xbc5a,
+  0xbd1c,
+  0x3d28,
+  0x3cc6,
+  0x3d17,
+  0x3ca1,
+  0x3d36,
+  0xbc97,
+  0xbcb0,
+  0x3c8f,
+  0x3bdc,
+  0x3b7f,
+  0xbd4b,
+  0x3d40,
+  0xbb71,
+  0xbc78,
+  0xbcbc,
+  0xbb9c,
+  0x3cc5,
+  0xbc60,
+  0x3d23,
+  0x3c3a,
+  0x3ad9,
+  0x3c7f,
+  0x3d1e,
+  0x3d96,
+  0xbbfc,
+  0xbcde,
+  0xbc4c,
+  0xbd01,
+  0x3c9c,
+  0x3d7f,
+  0xbd16,
+  0xbd0b,
+  0x3cc1,
+  0xbcd0,
+  0xbd11,
+  0xbcf4,
+  0x3d09,
+  0xbce8,
+  0x3d83,
+  0xbd48,
+  0xbd3b,
+  0xba17,
+  0x3c2b,
+  0x3c86,
+  0x3c2e,
+  0x3d32,
+  0x3d18,
+  0xbcd5,
+  0xbd92,
+  0xbc44,
+  0x3d10,
+  0x3d31,
+  0xbbce,
+  0xbd2c,
+  0x3cdc,
+  0x3d95,
+  0xbcfd,
+  0x3c92,
+  0xbccd,
+  0x3d4a,
+  0x3cf4,
+  0xbc98,
+  0xbc53,
+  0xbd4f,
+  0x3c24,
+  0xbd55,
+  0x3cfe,
+  0x3d01,
+  0xbd32,
+  0x3c8f,
+  0x3ce1,
+  0xbc11,
+  0xbcd5,
+  0xbc93,
+  0xbd59,
+  0xbb4f,
+  0x3cf8,
+  0x3c0f,
+  0xbd0e,
+  0x3d58,
+  0x3d19,
+  0xbc3b,
+  0xbbe5,
+  0xbb88,
+  0xbd4a,
+  0xb988,
+  0xbc99,
+  0xbbde,
+  0x3ac6,
+  0x3d79,
+  0x3bf7,
+  0xbc92,
+  0xbd8a,
+  0x3d08,
+  0x3a19,
+  0xbd00,
+  0x3d15,
+  0xbba4,
+  0x3c08,
+  0xbd55,
+  0xbd1d,
+  0x3c1a,
+  0x3c86,
+  0x3cb8,
+  0xbce8,
+  0xbcb9,
+  0x3c64,
+  0x3cbf,
+  0xbd14,
+  0x3cbf,
+  0x3bdc,
+  0x3a9f,
+  0x3c2d,
+  0xbb69,
+  0xbca0,
+  0xbcc0,
+  0x3d88,
+  0x3c95,
+  0x3d68,
+  0x3c10,
+  0xbd3d,
+  0xbc8a,
+  0xbc8c,
+  0x3c81,
+  0xbc43,
+  0x3a05,
+  0x3d94,
+  0xbd1b,
+  0xbad4,
+  0xbbb0,
+  0x3d6b,
+  0x3a6e,
+  0x3baf,
+  0xbc98,
+  0x3b8d,
+  0x3c1b,
+  0x3d01,
+  0xbd33,
+  0xbb59,
+  0xbc56,
+  0x3cfe,
+  0x3cd2,
+  0xbd96,
+  0xbcef,
+  0x3d34,
+  0x3c71,
+  0x3bec,
+  0xbcc6,
+  0x3c4f,
+  0xbd0e,
+  0xbb86,
+  0x3d0e,
+  0x3c5f,
+  0xbd30,
+  0xbd05,
+  0xbc86,
+  0x3d00,
+  0x3ce9,
+  0x3b27,
+  0x3ca5,
+  0x3cbe,
+  0x3d8a,
+  0x3cf2,
+  0xbb0c,
+  0x3be9,
+  0xbcab,
+  0xbd18,
+  0x3ccf,
+  0x3cb9,
+  0xbcb7,
+  0x3cf8,
+  0xbd87,
+  0x39a2,
+  0x3ce9,
+  0xba18,
+  0x3d1f,
+  0xbcf0,
+  0x3d31,
+  0xb98b,
+  0x3a0e,
+  0xbadb,
+  0x3ca5,
+  0xbd1b,
+  0xb9ca,
+  0xbd18,
+  0xbc9a,
+  0xbce7,
+  0x3d90,
+  0x3cc8,
+  0x3d64,
+  0xbcc7,
+  0xbb39,
+  0x3d55,
+  0xbc86,
+  0x3cc8,
+  0x3c91,
+  0xba0e,
+  0xbd3f,
+  0x3d64,
+  0x3c93,
+  0x3ca9,
+  0xbbe6,
+  0x3cc9,
+  0xbb00,
+  0xbc9d,
+  0xbc36,
+  0xba95,
+  0xbd7b,
+  0xbc9a,
+  0xbbd2,
+  0x3cd1,
+  0x3ca3,
+  0xbc84,
+  0xbcee,
+  0x3ca8,
+  0x3c13,
+  0xbd8f,
+  0x3d01,
+  0x3c17,
+  0xbc89,
+  0x3c37,
+  0xbca1,
+  0xbc07,
+  0xbabd,
+  0xbc28,
+  0x3c19,
+  0xbaa5,
+  0x3ce3,
+  0x3c15,
+  0x3d52,
+  0xbb53,
+  0xbc93,
+  0x3be3,
+  0x3cce,
+  0x3cf0,
+  0x3aee,
+  0x3c94,
+  0xbc6c,
+  0x3c87,
+  0xbba5,
+  0xbcc6,
+  0xbcaf,
+  0xbc1c,
+  0x3d2a,
+  0x3cba,
+  0x3dbc,
+  0xbc97,
+  0x3b33,
+  0xbadb,
+  0xbaf4,
+  0x3c4d,
+  0xbcf5,
+  0xbb8e,
+  0xbd65,
+  0xbc49,
+  0x3d94,
+  0xbb47,
+  0x3cf5,
+  0xbd02,
+  0xbda1,
+  0xbce1,
+  0xbcf4,
+  0xbc05,
+  0xbd3d,
+  0xbca3,
+  0xbc7a,
+  0x3bb6,
+  0xbd55,
+  0xbcf3,
+  0x3d9a,
+  0xbd6c,
+  0xbc24,
+  0x3c7d,
+  0x3d0a,
+  0x3d00,
+  0xbbac,
+  0xbcdf,
+  0x3d3b,
+  0x3d1a,
+  0x3c92,
+  0xbbaa,
+  0x3b9b,
+  0xbcaa,
+  0xbd25,
+  0x3c25,
+  0xbd23,
+  0x3cb5,
+  0x3d88,
+  0x3c48,
+  0x3c8f,
+  0x3d2e,
+  0x3c25,
+  0xbd20,
+  0x3c8c,
+  0x3cdc,
+  0x3d11,
+  0xbc07,
+  0x3b70,
+  0xbd78,
+  0xbd4d,
+  0x3c83,
+  0xbd9a,
+  0xbda3,
+  0xbd0e,
+  0x3c8e,
+  0x3c71,
+  0xbc86,
+  0xbcd0,
+  0x3d79,
+  0xbaa5,
+  0xbbbf,
+  0xbd23,
+  0xbcd2,
+  0x3d70,
+  0x3bb8,
+  0x3d20,
+  0x3d89,
+  0xbcc6,
+  0xbcdc,
+  0xbd8d,
+  0x3d1b,
+  0xbc39,
+  0xbca0,
+  0xbb29,
+  0xbc5c,
+  0x3ba2,
+  0x3c82,
+  0xbc80,
+  0x3b2e,
+  0x3d46,
+  0x3c4c,
+  0xbca4,
+  0x3cb3,
+  0x3cf2,
+  0x3c3d,
+  0x3b86,
+  0x3c9d,
+  0x3d15,
+  0xbafc,
+  0x3bb2,
+  0x3b1a,
+  0x3b03,
+  0x3d10,
+  0xbd60,
+  0x3d38,
+  0x3d17,
+  0x3d65,
+  0x3c78,
+  0xbd59,
+  0xbba9,
+  0x3c5f,
+  0xbcf0,
+  0xb9a9,
+  0xbc2e,
+  0xbbd3,
+  0x3d89,
+  0xbd0a,
+  0xbc8e,
+  0xbce4,
+  0xbc8e,
+  0x3c92,
+  0x3cf9,
+  0xbc57,
+  0xbc0d,
+  0xbd81,
+  0x3d62,
+  0x3ccd,
+  0xbc77,
+  0xbd1e,
+  0x3c5a,
+  0x3b8c,
+  0x3d5c,
+  0xbc9d,
+  0x3d24,
+  0xbc0b,
+  0x3c55,
+  0xbc98,
+  0x3bea,
+  0xbbd9,
+  0xbd24,
+  0x3ca8,
+  0x3d16,
+  0xbc3a,
+  0xbd27,
+  0xbd46,
+  0xbcac,
+  0xbcd0,
+  0x3cb6,
+  0xbb24,
+  0x3c27,
+  0xbbe3,
+  0x3bbf,
+  0xbb93,
+  0xbcaa,
+  0xbc3b,
+  0x3c06,
+  0x3cb5,
+  0x3b5b,
+  0x3a4e,
+  0x3cc6,
+  0x3d78,
+  0x3b53,
+  0xbd26,
+  0xbca8,
+  0xbc2f,
+  0x3a12,
+  0xbb39,
+  0xbd6e,
+  0xbcaa,
+  0x3c69,
+  0xbd34,
+  0xbc4b,
+  0xbd4b,
+  0x3ca5,
+  0xbd11,
+  0x3d47,
+  0xbbfb,
+  0xbd71,
+  0xba9d,
+  0x3d04,
+  0xbd67,
+  0xbd1d,
+  0x3c12,
+  0x3cd8,
+  0xbd10,
+  0x3d5b,
+  0xbb6c,
+  0xbd2c,
+  0x3be3,
+  0x3cc3,
+  0xbc86,
+  0x3c1e,
+  0xbc9a,
+  0x3d09,
+  0x3c2d,
+  0x3d48,
+  0x3c81,
+  0xbb6f,
+  0x3d6c,
+  0x3cdb,
+  0x3cbb,
+  0x3c14,
+  0x3c86,
+  0xbd0a,
+  0xbd3d,
+  0xbcc7,
+  0x3d93,
+  0xba02,
+  0xbcc7,
+  0xbd35,
+  0x3cb4,
+  0x3d06,
+  0xbd78,
+  0x3c5c,
+  0xbc4c,
+  0xbc47,
+  0xbcf8,
+  0x3cb3,
+  0x3cc0,
+  0xbccf,
+  0xbcbf,
+  0x3b33,
+  0x3cdf,
+  0x3ce5,
+  0xbbb4,
+  0x3caf,
+  0xbd24,
+  0x3c46,
+  0x3ab5,
+  0x3c9f,
+  0x3d04,
+  0x3d2a,
+  0x3c36,
+  0x3c6e,
+  0x3c31,
+  0xbd48,
+  0xbc21,
+  0xbcdd,
+  0xbc92,
+  0x3c53,
+  0xbc0d,
+  0xbbf7,
+  0x3cad,
+  0x3c85,
+  0x3c84,
+  0xbd71,
+  0x3d87,
+  0xbcde,
+  0x3bec,
+  0x3d1f,
+  0x3d07,
+  0xbd20,
+  0xbcc1,
+  0x3c0b,
+  0x3d3d,
+  0xbcb1,
+  0x3d3b,
+  0xbd56,
+  0xbbae,
+  0xbc17,
+  0x3c49,
+  0x3ca6,
+  0xbd30,
+  0x3c25,
+  0x3d2c,
+  0xbcd2,
+  0xbd96,
+  0xbbaf,
+  0xbd0f,
+  0xbcc6,
+  0xbd55,
+  0x3d54,
+  0x3d10,
+  0x3d19,
+  0xbd1e,
+  0x3d04,
+  0xbca0,
+  0xbda1,
+  0x3c91,
+  0x3d4c,
+  0xbc8c,
+  0xbcee,
+  0x39d2,
+  0xbcdf,
+  0xbd87,
+  0x3c4f,
+  0x39e8,
+  0x3cc7,
+  0xbc38,
+  0xbc20,
+  0xbcda,
+  0xbcb2,
+  0xbc85,
+  0xbd26,
+  0x3b51,
+  0xbcbf,
+  0xbd69,
+  0xbc8c,
+  0x3d3a,
+  0x3d32,
+  0xbb9f,
+  0x3cb3,
+  0x3cb3,
+  0x3c2e,
+  0xbb83,
+  0xbc07,
+  0xbad6,
+  0xbc92,
+  0xbd56,
+  0xbd35,
+  0xbd18,
+  0x3a50,
+  0xba4b,
+  0xbcc1,
+  0x3d63,
+  0x3cfe,
+  0xbc61,
+  0x3b03,
+  0xbc75,
+  0xbcde,
+  0xbcc3,
+  0x3c93,
+  0x3c9e,
+  0x3cae,
+  0xbbbd,
+  0x3cc9,
+  0x3cea,
+  0x3c4b,
+  0x3cba,
+  0x3cc0,
+  0xbc27,
+  0x3bb2,
+  0xbd34,
+  0xbc46,
+  0x3cae,
+  0x3c0d,
+  0xb9a8,
+  0xbc58,
+  0x3d19,
+  0xbd47,
+  0x3bf1,
+  0xbc89,
+  0x3d68,
+  0x3d0d,
+  0xbc94,
+  0x3c56,
+  0xbc10,
+  0x3d70,
+  0xbcc7,
+  0x3d3b,
+  0xbad1,
+  0xbc8d,
+  0x3988,
+  0x3c53,
+  0xbcea,
+  0x3d08,
+  0xbc6d,
+  0xbd41,
+  0x3d03,
+  0x3cc7,
+  0xb95d,
+  0x3cb2,
+  0xbd32,
+  0x3a82,
+  0x3d78,
+  0x3d49,
+  0xbc92,
+  0xbb9d,
+  0x3c8c,
+  0xbd63,
+  0x3cd8,
+  0x3d2a,
+  0x3caa,
+  0xbcdc,
+  0xbd5b,
+  0xbb9a,
+  0x3d42,
+  0x3c51,
+  0x3c44,
+  0xbb1b,
+  0x3c7c,
+  0xbd42,
+  0xbcca,
+  0xbb32,
+  0xbd43,
+  0xbd27,
+  0x3ca5,
+  0xbce7,
+  0xbd44,
+  0x3d59,
+  0x3d37,
+  0x3c37,
+  0xb917,
+  0xbb06,
+  0x3cc9,
+  0x3ca6,
+  0xbb9f,
+  0x3c71,
+  0x3cc2,
+  0xbd03,
+  0xbc7d,
+  0xbc83,
+  0xb99f,
+  0x3b68,
+  0x3c83,
+  0xbc24,
+  0x3bce,
+  0xbcda,
+  0xbd2d,
+  0x3bc5,
+  0x3c9a,
+  0x3c9d,
+  0xbd5c,
+  0xbd8d,
+  0x3d14,
+  0xbb86,
+  0x3c32,
+  0xbc69,
+  0xbb26,
+  0xbc6e,
+  0xbd00,
+  0xbd1b,
+  0xbd18,
+  0x3d49,
+  0xbb3f,
+  0x3b9a,
+  0x3cf3,
+  0x3c8e,
+  0x3ce9,
+  0xbd06,
+  0x3da5,
+  0x3c8f,
+  0x3d7c,
+  0xbd30,
+  0xbcd4,
+  0x3d29,
+  0x3c73,
+  0xbd1a,
+  0x3c8a,
+  0x3cfa,
+  0xbc63,
+  0xbc82,
+  0x3c36,
+  0xbc74,
+  0x3d70,
+  0xbd32,
+  0xbc17,
+  0xbd09,
+  0xbc81,
+  0x3cf5,
+  0x3c9e,
+  0x3cf2,
+  0x3da0,
+  0x3d24,
+  0xbd2f,
+  0xbd71,
+  0x3caf,
+  0xbc9d,
+  0xbd7b,
+  0x3bac,
+  0x3c5d,
+  0x3ccc,
+  0xbd70,
+  0x3d32,
+  0x3cae,
+  0x3d4f,
+  0x3b39,
+  0xbc78,
+  0xbc8d,
+  0xbd19,
+  0x3bea,
+  0x3ce8,
+  0xbd4f,
+  0xbc0b,
+  0xbd01,
+  0x3caf,
+  0xbc93,
+  0x3d82,
+  0x3c7a,
+  0x3d5b,
+  0x3c19,
+  0x3d1d,
+  0xbb0d,
+  0x3d02,
+  0xbc9b,
+  0xbc23,
+  0x3d04,
+  0x3cf7,
+  0x3cc3,
+  0xbc40,
+  0xbc9e,
+  0xbd14,
+  0x3bd1,
+  0xbba6,
+  0xbb6a,
+  0x3afa,
+  0x3d2e,
+  0x3b26,
+  0xbd7b,
+  0xbd62,
+  0x3b85,
+  0x3cb8,
+  0x3a3e,
+  0xbcb6,
+  0xbca8,
+  0xbbc3,
+  0xbd5e,
+  0xbd54,
+  0xbcb6,
+  0x3ca9,
+  0xbc89,
+  0xbc8d,
+  0x3c0d,
+  0x3cae,
+  0x3b75,
+  0x3c9c,
+  0x3ccf,
+  0x3d57,
+  0x3c70,
+  0x3b51,
+  0xbd60,
+  0xbb48,
+  0x3c2f,
+  0xbc5b,
+  0xbcf5,
+  0x3c42,
+  0x3d2d,
+  0x3cc9,
+  0x3ce5,
+  0xbd3b,
+  0xbd22,
+  0xbb78,
+  0xbce5,
+  0xbd12,
+  0x3c93,
+  0x3d35,
+  0x3c8d,
+  0xbc95,
+  0xbcf2,
+  0xbce8,
+  0xbc69,
+  0xbd3a,
+  0x3c9f,
+  0xbca6,
+  0xbdb5,
+  0x3c00,
+  0x3d8a,
+  0x3cc8,
+  0x3d20,
+  0x3d25,
+  0x3d17,
+  0xbdb3,
+  0x3b2c,
+  0x3c61,
+  0x3ce3,
+  0x3d0f,
+  0x3d22,
+  0xbd19,
+  0xbb05,
+  0xbc62,
+  0xbcac,
+  0x3ce3,
+  0x3d1f,
+  0xbc94,
+  0xbc05,
+  0xbcec,
+  0x3d56,
+  0xb9c1,
+  0x3bb9,
+  0x3ce2,
+  0xbd46,
+  0x3bef,
+  0x3d0f,
+  0x3cf5,
+  0x3c5a,
+  0xbd3d,
+  0x3d30,
+  0x3d2c,
+  0xbd8f,
+  0xbd23,
+  0xbc6f,
+  0xbd5a,
+  0xbd02,
+  0x3d3f,
+  0xbc63,
+  0xbd8a,
+  0xbca5,
+  0xbb04,
+  0xbcf0,
+  0xbc98,
+  0xbd4e,
+  0x3d3a,
+  0x3cf8,
+  0x3bce,
+  0x3cf2,
+  0x3bc8,
+  0xbbcc,
+  0x3c80,
+  0x3b9f,
+  0x3ba8,
+  0x3ba7,
+  0x3c96,
+  0xbcc7,
+  0xbc60,
+  0xbae6,
+  0x3ac2,
+  0xbd47,
+  0xbaf6,
+  0x3ce8,
+  0xbd20,
+  0xbbb6,
+  0x3c0f,
+  0x3c72,
+  0x3aeb,
+  0xbcd8,
+  0xbd01,
+  0xbcb6,
+  0xbbae,
+  0xbd16,
+  0x3cb6,
+  0x3d6a,
+  0x3c63,
+  0x3c2b,
+  0xbd10,
+  0x3c5c,
+  0xbd4f,
+  0x3c90,
+  0x3d33,
+  0xbbe0,
+  0x3a30,
+  0x3d3e,
+  0x3c25,
+  0x3cbd,
+  0xbd16,
+  0xbd27,
+  0x3d26,
+  0xbce4,
+  0x3b8f,
+  0xbd04,
+  0x3b81,
+  0x3d27,
+  0xbd5d,
+  0x3bdb,
+  0xbcca,
+  0x3d07,
+  0xb9ac,
+  0xba07,
+  0x3c9c,
+  0xbcde,
+  0xbcda,
+  0xbd89,
+  0x3c7a,
+  0xbbfa,
+  0x3bfa,
+  0x3d65,
+  0x3cbe,
+  0xbbd2,
+  0xbcd9,
+  0x3bb4,
+  0x3c14,
+  0xbc76,
+  0xbcf9,
+  0xbd92,
+  0x3bed,
+  0x3c75,
+  0xbcc7,
+  0xbcc7,
+  0x3c6b,
+  0x3d1d,
+  0x3d6d,
+  0xbdd2,
+  0xbc1e,
+  0x3c59,
+  0xbc91,
+  0x3d84,
+  0xb8f5,
+  0xbc8d,
+  0x3cdc,
+  0xbd33,
+  0xbd9a,
+  0x3b64,
+  0xbc07,
+  0x3c89,
+  0xbb9e,
+  0xbd7f,
+  0xbca3,
+  0x3c36,
+  0x3cc3,
+  0xbb25,
+  0xbc9f,
+  0x3d1e,
+  0xbc04,
+  0x3bf7,
+  0xbc6b,
+  0xbbf6,
+  0x3ca4,
+  0x3b8c,
+  0xbb93,
+  0x3d1d,
+  0x3b5a,
+  0x3cc6,
+  0xbbe1,
+  0x3d3a,
+  0x3b2f,
+  0x3ca6,
+  0xbd23,
+  0x3c0d,
+  0xbc42,
+  0xbcbe,
+  0x3b81,
+  0x3d82,
+  0xbcc8,
+  0x3c27,
+  0x3c2f,
+  0x3c0b,
+  0xbce2,
+  0xbce7,
+  0x3d03,
+  0xbc8e,
+  0xbba0,
+  0x3c03,
+  0xbd73,
+  0xbd24,
+  0x3cb4,
+  0x3ca4,
+  0x3ba8,
+  0x3caa,
+  0xbc98,
+  0x3c96,
+  0x3d22,
+  0xbd2c,
+  0x3d27,
+  0x3b39,
+  0x3cc1,
+  0xbcc8,
+  0x3c82,
+  0xbd3a,
+  0x3ce0,
+  0xbb26,
+  0x3c91,
+  0x3cd4,
+  0x3d26,
+  0xbd7c,
+  0xbac9,
+  0x3d3d,
+  0x3d1b,
+  0x3d46,
+  0x3b99,
+  0xbd57,
+  0xbb2c,
+  0xbbff,
+  0x3a6e,
+  0xbbaa,
+  0x3c60,
+  0x3da9,
+  0x3d17,
+  0x3d7d,
+  0xbd8a,
+  0x3c0b,
+  0x3c7d,
+  0xbcce,
+  0xbc44,
+  0x3bbb,
+  0x3d31,
+  0x3b90,
+  0x3d29,
+  0x3c04,
+  0xbcac,
+  0x3cf7,
+  0x3ce0,
+  0xbbf0,
+  0xbd5e,
+  0xbc39,
+  0x3d90,
+  0xbd00,
+  0xbc83,
+  0xbc62,
+  0x3d1f,
+  0x3cb4,
+  0x3bf7,
+  0x3c47,
+  0xbc27,
+  0x3c82,
+  0x3c4b,
+  0x3d7b,
+  0xbd73,
+  0x3cc5,
+  0x3ba6,
+  0xbd05,
+  0xbd67,
+  0x3afa,
+  0xbce6,
+  0x3d3a,
+  0xbd2c,
+  0xbb0c,
+  0xbbad,
+  0x3d02,
+  0x3cb7,
+  0x3d65,
+  0x3be2,
+  0x3d1e,
+  0x3d40,
+  0x3b4e,
+  0xba84,
+  0xbbff,
+  0x3a3a,
+  0x3d0a,
+  0xbd0b,
+  0x3d06,
+  0xbc2e,
+  0x3d0d,
+  0xbcaa,
+  0x3c86,
+  0xbcfd,
+  0xbcc2,
+  0xbcf8,
+  0x3d60,
+  0xbc87,
+  0x3c10,
+  0xbd2f,
+  0x3c34,
+  0x3d0b,
+  0x3c2c,
+  0xbd56,
+  0xbc16,
+  0x3d00,
+  0xbc1c,
+  0x3d41,
+  0xbd2d,
+  0x3c92,
+  0xbb5a,
+  0xbcca,
+  0xbd23,
+  0xbc3a,
+  0xbbc0,
+  0x3ceb,
+  0x3c50,
+  0xbd68,
+  0x3c14,
+  0xbd88,
+  0xbcff,
+  0xbd30,
+  0x3c26,
+  0xbc5b,
+  0xbd08,
+  0xb85f,
+  0xbca1,
+  0xbd13,
+  0xbced,
+  0xbca1,
+  0x3c90,
+  0xbc00,
+  0x3d33,
+  0x3c4e,
+  0xbcb0,
+  0xbb3d,
+  0xbd56,
+  0xbd43,
+  0xbcb2,
+  0xbd5a,
+  0x3b75,
+  0x3c29,
+  0x3cb8,
+  0xbb03,
+  0xbc74,
+  0xbc88,
+  0xbc83,
+  0xbb94,
+  0x3d06,
+  0x3c44,
+  0x3cd6,
+  0x3cb6,
+  0xbd19,
+  0xbc0b,
+  0xbc35,
+  0x3c37,
+  0xbca8,
+  0xbb99,
+  0xbb96,
+  0xbcee,
+  0x3d08,
+  0x3bf3,
+  0x3a1b,
+  0xbc07,
+  0x3c10,
+  0x3c2b,
+  0xbc83,
+  0xbc40,
+  0x3d98,
+  0xbb5c,
+  0x3cf7,
+  0xbd15,
+  0xbb51,
+  0x3cf9,
+  0xbd7c,
+  0x3d69,
+  0xbaed,
+  0x3ca7,
+  0xbbb2,
+  0xbc02,
+  0xbc72,
+  0x3b10,
+  0xbd3c,
+  0x3d04,
+  0xbd02,
+  0xbd7d,
+  0x3ce8,
+  0x3c40,
+  0xbd32,
+  0x3c24,
+  0xbd19,
+  0xbcbd,
+  0x3cee,
+  0x3ccd,
+  0xbcce,
+  0x3bb1,
+  0x3d67,
+  0x3d0f,
+  0xbb24,
+  0xbc32,
+  0xbcb4,
+  0x3d59,
+  0xbd0e,
+  0xbc2f,
+  0x3d84,
+  0x3ca1,
+  0xbd0c,
+  0xbd39,
+  0x3cbf,
+  0xbca3,
+  0xbc7a,
+  0xbc9d,
+  0xbcb1,
+  0x3ad1,
+  0xbc66,
+  0x3d1e,
+  0x3d77,
+  0x3c12,
+  0x3c94,
+  0x3ccd,
+  0x3cda,
+  0x3be2,
+  0xbc03,
+  0xbccb,
+  0x3c75,
+  0x3d90,
+  0x3cf5,
+  0x3c35,
+  0x3cc4,
+  0xbd0b,
+  0xbc93,
+  0xbd1c,
+  0x3c47,
+  0xbcf0,
+  0xbbad,
+  0xbc4b,
+  0x3c94,
+  0x3c71,
+  0x3cac,
+  0x3cda,
+  0x3bc8,
+  0x3d59,
+  0x3c7f,
+  0xbaf3,
+  0x3d44,
+  0xbd52,
+  0x3c4a,
+  0xbb55,
+  0x3da0,
+  0xbc9a,
+  0x3cbc,
+  0x3d66,
+  0xbda4,
+  0xbb72,
+  0x3c55,
+  0x3d1e,
+  0x3c8b,
+  0x3d50,
+  0xbd65,
+  0x3bb4,
+  0xbd14,
+  0x3ca6,
+  0x3abc,
+  0xbc7b,
+  0x3bea,
+  0x3c87,
+  0xbca4,
+  0xbcbe,
+  0xbc1b,
+  0x3ce4,
+  0xbd0e,
+  0xbba7,
+  0xbcd1,
+  0xbc3b,
+  0x3bcf,
+  0x3c14,
+  0x3cb0,
+  0x3c0d,
+  0x3cca,
+  0x3d21,
+  0xbc29,
+  0x3d60,
+  0x3d0f,
+  0xbd30,
+  0xbd1e,
+  0xbceb,
+  0x3d73,
+  0xbc8c,
+  0xbcc5,
+  0x3ca3,
+  0xbba1,
+  0x3a9d,
+  0x3d39,
+  0xbc86,
+  0xbca0,
+  0xbc70,
+  0x3cce,
+  0x3d33,
+  0x39d8,
+  0x3d08,
+  0xbcc9,
+  0xbc85,
+  0x3d05,
+  0xbc81,
+  0xbc0c,
+  0x3aa4,
+  0xbad4,
+  0xbce9,
+  0xbc97,
+  0x3d81,
+  0x3d87,
+  0x3d2d,
+  0x3ce4,
+  0xba9c,
+  0x3d20,
+  0xbc9d,
+  0xbd22,
+  0xbbd0,
+  0x3d25,
+  0x3c6f,
+  0xbc88,
+  0x3aad,
+  0x3caf,
+  0xbbbb,
+  0xbd42,
+  0x3b87,
+  0xbcca,
+  0xbcb8,
+  0x3ccf,
+  0xbd75,
+  0xbd1a,
+  0x3d86,
+  0xbc8c,
+  0x3ba5,
+  0xbd09,
+  0x3b87,
+  0x3c08,
+  0x3d86,
+  0xbcc2,
+  0xbcc6,
+  0x3d3d,
+  0x3b79,
+  0xbd3c,
+  0xbca0,
+  0xbc19,
+  0x3c74,
+  0xbce6,
+  0x3d90,
+  0x3bae,
+  0x3cbe,
+  0x3ca4,
+  0x3897,
+  0xbd98,
+  0xb92e,
+  0x3c5d,
+  0xbcc3,
+  0xbc3f,
+  0xbbae,
+  0x3be5,
+  0x3d8b,
+  0xbd62,
+  0xbc16,
+  0xbc20,
+  0xbcfb,
+  0xbd0d,
+  0xbd18,
+  0xbba7,
+  0x3ce0,
+  0xbd85,
+  0xbd26,
+  0xbc96,
+  0x3c08,
+  0x3cfb,
+  0xbcba,
+  0xbceb,
+  0xbc91,
+  0x3c8e,
+  0x3c11,
+  0xbc1b,
+  0x3c48,
+  0xbd04,
+  0xbcea,
+  0x3d5f,
+  0xbc86,
+  0xbd20,
+  0xbd63,
+  0xbd31,
+  0xbb8d,
+  0xbc1c,
+  0xbcad,
+  0xbb89,
+  0x3ab4,
+  0xbd06,
+  0xbafe,
+  0xbc4d,
+  0x3b9e,
+  0xbb27,
+  0x3cc4,
+  0x3d30,
+  0x3c85,
+  0xbd04,
+  0x3cb1,
+  0xbd5e,
+  0xbc7c,
+  0xbcce,
+  0xbc88,
+  0xbcae,
+  0x3ca6,
+  0xbc96,
+  0xbc0a,
+  0x3b93,
+  0x3d8b,
+  0xbccb,
+  0xbc40,
+  0xbc8c,
+  0x3c88,
+  0xbb03,
+  0x3cd5,
+  0xbd40,
+  0x3c9c,
+  0xbd65,
+  0xbce6,
+  0xbb66,
+  0x3cc1,
+  0x3d19,
+  0xbb40,
+  0x3cd3,
+  0xbb37,
+  0xbcdb,
+  0x3bb0,
+  0x3bc0,
+  0xbbc8,
+  0xbb9f,
+  0xbc89,
+  0xbb3a,
+  0xbcfb,
+  0xbc59,
+  0xbae8,
+  0x3cdc,
+  0x3d2c,
+  0xbb84,
+  0xbbd2,
+  0x3d49,
+  0xbcfa,
+  0x3d1d,
+  0x3d23,
+  0x3c9e,
+  0x3b05,
+  0xbccb,
+  0xbd20,
+  0xbc16,
+  0xbb8e,
+  0xbc9b,
+  0xbcf7,
+  0xbcca,
+  0x3b30,
+  0xbccd,
+  0xbd00,
+  0xbcf9,
+  0xbc84,
+  0x3c0e,
+  0xbd06,
+  0xbca2,
+  0xbce2,
+  0x3d16,
+  0x3a7c,
+  0xbc22,
+  0x3d37,
+  0x3c6a,
+  0x3d31,
+  0x3c7d,
+  0xbbad,
+  0x3c07,
+  0x3ad9,
+  0xbcb0,
+  0x3d3e,
+  0x3cd3,
+  0xbd2e,
+  0x3cab,
+  0xbc92,
+  0x3d45,
+  0x3cee,
+  0x3d1b,
+  0xbab5,
+  0x3c81,
+  0x3ca5,
+  0xbad4,
+  0x3bab,
+  0xbd17,
+  0x397a,
+  0xbd25,
+  0x3ca7,
+  0xbca1,
+  0x3d15,
+  0xbd0a,
+  0x3cb9,
+  0xbcbc,
+  0xbd2b,
+  0xbc30,
+  0x3d20,
+  0xbd01,
+  0x3d4c,
+  0xbcac,
+  0xbcfe,
+  0xbd4e,
+  0xbc59,
+  0xbd36,
+  0xbcf1,
+  0xbd63,
+  0x3cd8,
+  0x3bdc,
+  0x3d11,
+  0x3c83,
+  0xbcb7,
+  0xbd03,
+  0xbd01,
+  0xbb3e,
+  0x3c95,
+  0x3c18,
+  0xbc87,
+  0x3a84,
+  0xbd43,
+  0xbcd6,
+  0x3d93,
+  0x3c00,
+  0x3b57,
+  0xbd82,
+  0x3d25,
+  0xbcf8,
+  0xbcd8,
+  0xbcf2,
+  0xbbcc,
+  0x3b35,
+  0xbc81,
+  0x3b68,
+  0x3ab5,
+  0x3a96,
+  0x3bbd,
+  0x3d3b,
+  0xbc83,
+  0x3d04,
+  0x3ced,
+  0xbcb8,
+  0xbbb0,
+  0x3d9d,
+  0xbaa4,
+  0xbc8a,
+  0x3c53,
+  0x398f,
+  0xbc48,
+  0x3c06,
+  0xbc57,
+  0x3c67,
+  0xbd73,
+  0xbd1f,
+  0x3c5b,
+  0x3d00,
+  0xbc3f,
+  0xbc2c,
+  0x3cf7,
+  0xbcaf,
+  0xbd01,
+  0xbda1,
+  0x3ad4,
+  0x3d13,
+  0xbcaa,
+  0x3a74,
+  0xbd66,
+  0xbc09,
+  0xbb87,
+  0x3c14,
+  0x3d6a,
+  0xbd7c,
+  0x3cda,
+  0xbc7d,
+  0xbc89,
+  0x3d4d,
+  0xbd58,
+  0xbd11,
+  0x3d2b,
+  0xbc3b,
+  0xb981,
+  0xbbbe,
+  0xbc89,
+  0xbc14,
+  0xbd03,
+  0xbb23,
+  0xbcce,
+  0xbc55,
+  0x3d3e,
+  0xbd84,
+  0xbcdc,
+  0xbbb9,
+  0xbcad,
+  0x3ce4,
+  0xbd1f,
+  0xbd26,
+  0x3d0b,
+  0x3ba9,
+  0xbcc9,
+  0x3bd6,
+  0xbca0,
+  0x3c56,
+  0xb9c6,
+  0xbbb4,
+  0x3cb8,
+  0x3d12,
+  0xbc39,
+  0x3c3a,
+  0xbc76,
+  0xbd5d,
+  0x3cbd,
+  0xbd81,
+  0xbc86,
+  0xbd58,
+  0x3cba,
+  0x3cbe,
+  0xbbf5,
+  0x3c84,
+  0x3ca1,
+  0xbb82,
+  0xbc96,
+  0x3cc2,
+  0xbb73,
+  0x3d81,
+  0x3c66,
+  0x3ce0,
+  0x3c9c,
+  0x3cba,
+  0x3d1a,
+  0xbbcc,
+  0x3d57,
+  0x3c69,
+  0x3c9a,
+  0xbd78,
+  0xbb28,
+  0xbc97,
+  0xbc55,
+  0x3c40,
+  0x3c31,
+  0x3c7e,
+  0x3cab,
+  0x3cde,
+  0xbd73,
+  0x3d45,
+  0xbc2d,
+  0x3c8f,
+  0x3d3f,
+  0xbbe2,
+  0x3cbf,
+  0xbb16,
+  0xbd48,
+  0xbd9e,
+  0xb8c7,
+  0x3c3b,
+  0xbce7,
+  0xbb1f,
+  0x3cc0,
+  0x3c42,
+  0xbc25,
+  0xbd1e,
+  0xbcc5,
+  0xbb94,
+  0xbc9b,
+  0xbd06,
+  0x3d18,
+  0x3d10,
+  0xbb98,
+  0x3d2c,
+  0xbcef,
+  0xbd77,
+  0xbd90,
+  0x3d4b,
+  0xbca5,
+  0x3cd8,
+  0x3cd1,
+  0x3c61,
+  0xbcb8,
+  0x3d17,
+  0x3b04,
+  0xbc68,
+  0x3b0f,
+  0x3d05,
+  0xbcbd,
+  0xbb8c,
+  0xbd94,
+  0xbd49,
+  0x3d6d,
+  0xbcc2,
+  0xbccc,
+  0xbd40,
+  0x3cb7,
+  0xbd2f,
+  0x3cb0,
+  0xbbd9,
+  0x3d33,
+  0xbbba,
+  0x3d7d,
+  0xbc8f,
+  0x3d1b,
+  0x3da6,
+  0x3b09,
+  0x3c0e,
+  0xbc18,
+  0xbcd0,
+  0xbd14,
+  0x3d41,
+  0x3d0b,
+  0x3b94,
+  0x3b9a,
+  0xbd5c,
+  0xbd30,
+  0x3d5b,
+  0xbbeb,
+  0xbd39,
+  0x3d09,
+  0xbc6a,
+  0xbcc0,
+  0x3caf,
+  0xbd0d,
+  0x3c9a,
+  0x3bdd,
+  0x3cb8,
+  0xbd16,
+  0xbb70,
+  0x39ae,
+  0x3a82,
+  0x3ca2,
+  0x3c16,
+  0xbd19,
+  0x3cf6,
+  0xbcd4,
+  0xbd0a,
+  0xbbed,
+  0x3b88,
+  0xbd50,
+  0xbcf4,
+  0x3c8c,
+  0x3bff,
+  0xbc50,
+  0x3bc0,
+  0x3b57,
+  0x3c0d,
+  0x3c15,
+  0xbb07,
+  0x3cc6,
+  0xbc46,
+  0x3ce0,
+  0xbb1d,
+  0x3d24,
+  0x3d08,
+  0xbd38,
+  0xbc89,
+  0xbd28,
+  0xbcac,
+  0x3d74,
+  0xbd3c,
+  0xbbca,
+  0x3c30,
+  0xbcd4,
+  0x3c40,
+  0xbc70,
+  0x3cf4,
+  0x3d75,
+  0x3cf1,
+  0xbc83,
+  0xbc12,
+  0x3ce4,
+  0x3ba7,
+  0x3d48,
+  0x3d25,
+  0x3dc1,
+  0xbc08,
+  0x3ca4,
+  0x3d1f,
+  0x3d1f,
+  0x3cf2,
+  0x3d6b,
+  0x3b8b,
+  0x39f4,
+  0xbc86,
+  0x3d25,
+  0x3da5,
+  0xbc74,
+  0xbb9e,
+  0x3c35,
+  0x3cf9,
+  0xbc58,
+  0xbc86,
+  0xbc04,
+  0x3cc0,
+  0xba3d,
+  0x3b77,
+  0x3d13,
+  0x3c20,
+  0x3b38,
+  0x3c06,
+  0xbbda,
+  0x3a60,
+  0x3cb4,
+  0x3a89,
+  0x3ba3,
+  0xbcd0,
+  0x3cbb,
+  0xbd9d,
+  0x3c31,
+  0x3ce7,
+  0x3d18,
+  0xba99,
+  0x3d46,
+  0xbd85,
+  0xbbab,
+  0x3d31,
+  0xbd14,
+  0x3d1d,
+  0xbbf3,
+  0xba8d,
+  0x3c97,
+  0x3c5b,
+  0x3d1e,
+  0x3cea,
+  0xbd3c,
+  0xbc5d,
+  0xbd08,
+  0x3bc8,
+  0x3d06,
+  0xbc8d,
+  0xbc3b,
+  0xbb6f,
+  0xbd40,
+  0xbc97,
+  0xbce0,
+  0xbc23,
+  0x3c34,
+  0xbd72,
+  0x3c12,
+  0x3bc5,
+  0xbca5,
+  0xbd6b,
+  0x3c4e,
+  0x3ab9,
+  0x3d20,
+  0xbd2d,
+  0xbcb8,
+  0xbd4a,
+  0xbc1e,
+  0xbb5a,
+  0x3ae6,
+  0xbc65,
+  0xbd8d,
+  0xbd71,
+  0xbc72,
+  0xbd34,
+  0x3cb9,
+  0x3d74,
+  0xbdac,
+  0xb9d8,
+  0xbca6,
+  0x3cf3,
+  0x3d61,
+  0xbd2e,
+  0x3c77,
+  0xbd8c,
+  0xbd81,
+  0xbcfb,
+  0xbabd,
+  0x3d52,
+  0x3d96,
+  0x3c03,
+  0x3bc5,
+  0xbd53,
+  0xbcf6,
+  0xbc73,
+  0x3d71,
+  0x3c10,
+  0xbd6e,
+  0xbc1e,
+  0x3d39,
+  0x3c59,
+  0xbce5,
+  0x3c44,
+  0x3acd,
+  0xbc76,
+  0x3af9,
+  0xba82,
+  0xbc40,
+  0x3d5d,
+  0x3d6e,
+  0x3b46,
+  0x3b30,
+  0xbd05,
+  0xbd39,
+  0x3c9e,
+  0x3d21,
+  0x3bce,
+  0x3cb4,
+  0x3dcc,
+  0xbb8f,
+  0x3ca8,
+  0x3db3,
+  0xbcd8,
+  0xbc7f,
+  0x3bcf,
+  0xbcc3,
+  0xba89,
+  0x3d14,
+  0x3cdc,
+  0xbd18,
+  0xbc7d,
+  0xbce6,
+  0xbd06,
+  0x3d46,
+  0x3cb9,
+  0x3c53,
+  0x3b2e,
+  0x3c7c,
+  0x3d52,
+  0x3d11,
+  0x3d73,
+  0xbc43,
+  0x3b41,
+  0xbcb9,
+  0xbbbd,
+  0xbbff,
+  0x3bfc,
+  0x3db4,
+  0x3c12,
+  0x3b2b,
+  0xbc26,
+  0x3cfe,
+  0x3cfa,
+  0x3c2f,
+  0xbc8b,
+  0xbd48,
+  0xbce6,
+  0x3adf,
+  0xbcc3,
+  0x3c61,
+  0xbd82,
+  0xbd32,
+  0x3c81,
+  0x3d0b,
+  0x3c7d,
+  0x3c7e,
+  0x3b7d,
+  0xbca7,
+  0x3c88,
+  0x3cf0,
+  0xbcb1,
+  0x3c15,
+  0x3d9e,
+  0x3cb4,
+  0x3c03,
+  0x3ce1,
+  0xbc8e,
+  0x3d10,
+  0xbca0,
+  0xbb9a,
+  0x3cd1,
+  0x3c62,
+  0xbb94,
+  0x3caa,
+  0x3c0c,
+  0x3d81,
+  0x3d40,
+  0xb93a,
+  0x3d2e,
+  0x3cb3,
+  0x3b87,
+  0xbd89,
+  0x3d4f,
+  0x3cc9,
+  0x3d3d,
+  0x3cea,
+  0xbd5e,
+  0xbd06,
+  0xbd1a,
+  0xbcb8,
+  0xbd11,
+  0x3cf3,
+  0x3d10,
+  0x3cad,
+  0x3bb8,
+  0xbd31,
+  0x3c43,
+  0xbbdf,
+  0x3c87,
+  0xbcef,
+  0xbc29,
+  0xbcab,
+  0xbc5e,
+  0x3c9b,
+  0xbce0,
+  0xbcd2,
+  0xbc47,
+  0x3ccc,
+  0xbd35,
+  0xbbdb,
+  0xbcc5,
+  0xbcf5,
+  0xbcfc,
+  0x3bba,
+  0xbd33,
+  0xbbbe,
+  0xbd74,
+  0x3b90,
+  0x3c56,
+  0x3cf4,
+  0xbcbe,
+  0x3d24,
+  0x3c88,
+  0xbb9b,
+  0xbcc7,
+  0xbc3e,
+  0x3d5b,
+  0x3cfb,
+  0xbbad,
+  0x3c93,
+  0xbc63,
+  0x3ca0,
+  0xbce3,
+  0xbccc,
+  0x3bc7,
+  0x3d25,
+  0x3c66,
+  0xbd79,
+  0xbd47,
+  0xbc8b,
+  0x3c48,
+  0xbcf7,
+  0xbb5e,
+  0xbbe8,
+  0x3c02,
+  0x3b22,
+  0x3cf3,
+  0x3cae,
+  0xbc98,
+  0x3cc3,
+  0xbd34,
+  0x3d79,
+  0xbbf1,
+  0xbd04,
+  0x3bbf,
+  0xbc26,
+  0x3d42,
+  0xba8a,
+  0x3ccd,
+  0xbcf3,
+  0x3ad5,
+  0x3c14,
+  0xbc85,
+  0x3d67,
+  0x3b76,
+  0xbd11,
+  0x3be3,
+  0x3cd2,
+  0xbd0f,
+  0x3ba1,
+  0x3c9d,
+  0xbc74,
+  0xbd8d,
+  0x3b8f,
+  0xbc37,
+  0x3c34,
+  0x3cf5,
+  0xbcc8,
+  0x3be2,
+  0x3caf,
+  0xbc16,
+  0xbbcc,
+  0x3d0d,
+  0x3c8c,
+  0x3d2f,
+  0xbcc5,
+  0xbd17,
+  0xbd03,
+  0x3d69,
+  0x3c49,
+  0x3c02,
+  0x3c05,
+  0x3ccb,
+  0xbd08,
+  0xbd2d,
+  0xbac5,
+  0x3cc5,
+  0xbb76,
+  0xbb50,
+  0xbb4a,
+  0x3c32,
+  0x3ceb,
+  0x3c13,
+  0xbd10,
+  0x3d25,
+  0x3cba,
+  0x3d7e,
+  0x3d90,
+  0x3d5c,
+  0x3ceb,
+  0x3ce5,
+  0xbcf6,
+  0x3b1a,
+  0x39f6,
+  0x3d58,
+  0x3b60,
+  0x3d4e,
+  0xbccb,
+  0xbc4b,
+  0x3afc,
+  0x3cf7,
+  0x3b05,
+  0xbd91,
+  0x3b83,
+  0xbcd4,
+  0xbc2b,
+  0xbd1c,
+  0xbb9d,
+  0xbd21,
+  0x3c86,
+  0xbcc5,
+  0x3c91,
+  0x3d5c,
+  0x3b03,
+  0x3c12,
+  0x3c9c,
+  0x3c8f,
+  0xbd6a,
+  0x3c78,
+  0xbd0a,
+  0xbd6a,
+  0x3cb4,
+  0x3d0f,
+  0x3d11,
+  0x3cb4,
+  0xbc1c,
+  0x3bb8,
+  0x3d2a,
+  0x3c74,
+  0xbcd5,
+  0xbc76,
+  0xbcd7,
+  0x3ca5,
+  0xbcae,
+  0xbcb2,
+  0xbc02,
+  0x3c4f,
+  0xbd4b,
+  0xbc17,
+  0xbcdf,
+  0x3d47,
+  0x3c63,
+  0xbd29,
+  0x3c6a,
+  0x3c96,
+  0xbcdd,
+  0x3c84,
+  0x3c95,
+  0x3da4,
+  0x3c31,
+  0x3cfc,
+  0xbc06,
+  0xbb56,
+  0xbb37,
+  0x3ca5,
+  0xbb8d,
+  0xbd8c,
+  0xbcee,
+  0xbd8a,
+  0xbcd5,
+  0xbcf4,
+  0xbc8d,
+  0x3d04,
+  0x3d12,
+  0xbc7b,
+  0xbc6f,
+  0xbc8d,
+  0x3c07,
+  0x3cc9,
+  0xbb06,
+  0x3d09,
+  0x3c52,
+  0xbcbc,
+  0x3cfa,
+  0xbd98,
+  0x3d12,
+  0xbac1,
+  0x3cc2,
+  0xbcc4,
+  0x3c45,
+  0xbd2b,
+  0x3c42,
+  0xbb77,
+  0x3cbf,
+  0xbc77,
+  0xbc8e,
+  0xbc57,
+  0x3ce2,
+  0x3b0f,
+  0xbc20,
+  0x3cd4,
+  0x3d10,
+  0xbcb7,
+  0x3bef,
+  0xbd05,
+  0xbb91,
+  0x3d81,
+  0xbd0d,
+  0xbc4f,
+  0x3cfa,
+  0x3d3f,
+  0xbd04,
+  0xbb1b,
+  0x3c25,
+  0x3ccb,
+  0xbd0a,
+  0xbc24,
+  0x3ce6,
+  0x3c2c,
+  0xbc6e,
+  0x3bd5,
+  0x3d35,
+  0xbcca,
+  0xbcd7,
+  0xbb62,
+  0x3bba,
+  0xbc81,
+  0xbc3f,
+  0xba73,
+  0x3d54,
+  0x3d59,
+  0xbd05,
+  0xbcde,
+  0xbca8,
+  0x38a4,
+  0xbcbf,
+  0x3bc9,
+  0x3c69,
+  0xbd1f,
+  0x3d08,
+  0xbd40,
+  0x3cc5,
+  0xbd36,
+  0x3949,
+  0x3c94,
+  0xbcdf,
+  0xbc3c,
+  0xbc6a,
+  0x3c0e,
+  0xbd49,
+  0x3d0d,
+  0x3d5c,
+  0xbd08,
+  0x3c98,
+  0x3b8f,
+  0xbc26,
+  0x3ccd,
+  0x3b11,
+  0xbc98,
+  0x3b8a,
+  0x3d08,
+  0xbcb0,
+  0x3c17,
+  0xbd42,
+  0x3d01,
+  0xbd39,
+  0x3d38,
+  0xbcb2,
+  0x3d68,
+  0xbce2,
+  0x3ca1,
+  0xbd2a,
+  0x3d56,
+  0xbc36,
+  0xbd13,
+  0x3c1b,
+  0xbcdb,
+  0x3bb5,
+  0xbd2c,
+  0xbc73,
+  0x3cfe,
+  0x3c0c,
+  0x3c93,
+  0xbcc5,
+  0x3d82,
+  0xbc62,
+  0xbbea,
+  0xbb24,
+  0xbcca,
+  0xbd79,
+  0x3c98,
+  0x3c6b,
+  0x3d16,
+  0x3c59,
+  0xbce7,
+  0x3b03,
+  0x3cfc,
+  0x3be7,
+  0x3bb4,
+  0xbd41,
+  0x3a90,
+  0xbcb3,
+  0x3b91,
+  0xbd64,
+  0x3c29,
+  0x3c2f,
+  0x3c51,
+  0x3c51,
+  0x3d47,
+  0xbce3,
+  0x3d28,
+  0xbd81,
+  0xbc4c,
+  0xbd1d,
+  0x3d03,
+  0x3c78,
+  0x3c0a,
+  0x3c1d,
+  0x3c74,
+  0xbd52,
+  0xba2d,
+  0xbcf0,
+  0xbc2f,
+  0xbd41,
+  0xbb2b,
+  0xbccb,
+  0xbb97,
+  0x3c13,
+  0xbc8a,
+  0x3b8a,
+  0x3cb3,
+  0x3c88,
+  0x3d25,
+  0x3c66,
+  0xbd5e,
+  0xbd21,
+  0xbcd9,
+  0xbc41,
+  0xbd7f,
+  0x3dc7,
+  0x3bf7,
+  0xbcdb,
+  0x3d0f,
+  0xbb90,
+  0x3b89,
+  0x3bc5,
+  0x3c23,
+  0x3b41,
+  0x3a84,
+  0x3ccd,
+  0x3c62,
+  0xbc27,
+  0x3cee,
+  0x3d3f,
+  0x3b24,
+  0xbd83,
+  0x3b7f,
+  0x3d5d,
+  0xbd9c,
+  0x3c8d,
+  0xbc7f,
+  0xbc39,
+  0xbb98,
+  0xbc84,
+  0xbbdc,
+  0x3c68,
+  0x3d2a,
+  0xbbf6,
+  0xbd01,
+  0xbd43,
+  0xba23,
+  0xbd82,
+  0x3a8e,
+  0xbcb4,
+  0x3c91,
+  0x3d0e,
+  0x3cfa,
+  0xbd33,
+  0xbd69,
+  0x3c9a,
+  0xbcb6,
+  0xbd3d,
+  0x3c88,
+  0x39a3,
+  0xbcb4,
+  0x3ca8,
+  0x3c19,
+  0xbb7e,
+  0x3b1e,
+  0xbcb9,
+  0x3ccb,
+  0xbcb1,
+  0xbdbb,
+  0xbcb0,
+  0x3d35,
+  0xbaef,
+  0xbd3c,
+  0xbc36,
+  0xbc46,
+  0xbc8a,
+  0x3b51,
+  0x3c66,
+  0x3da9,
+  0xbd03,
+  0x3c13,
+  0x3d35,
+  0xbce2,
+  0x3c23,
+  0x3c33,
+  0xbcbc,
+  0x3bf3,
+  0x3b7b,
+  0x3d32,
+  0xbd70,
+  0xbc77,
+  0x3cb1,
+  0xbd6a,
+  0xbc8e,
+  0x38a5,
+  0xbcac,
+  0x3bc9,
+  0xbbeb,
+  0xbd3d,
+  0xbd0e,
+  0xbcc5,
+  0x3bba,
+  0x3d2f,
+  0x3a47,
+  0xbd62,
+  0x3c9a,
+  0xbc21,
+  0xbccd,
+  0x3c59,
+  0xbbde,
+  0x3c68,
+  0x3d1d,
+  0xbce3,
+  0xbc59,
+  0x3c23,
+  0xbc12,
+  0xbc37,
+  0x3ca7,
+  0x3d42,
+  0x3cda,
+  0xbcad,
+  0x3cb9,
+  0x3da3,
+  0xbc9c,
+  0xbb00,
+  0x3d86,
+  0x3d89,
+  0xb893,
+  0xbb62,
+  0x3ca7,
+  0x3da0,
+  0x3c68,
+  0xbd46,
+  0x3beb,
+  0x3ca7,
+  0xbbd5,
+  0x3c31,
+  0x3ce1,
+  0x3adc,
+  0xbd36,
+  0x3da1,
+  0xbcf5,
+  0x3c20,
+  0x3c7d,
+  0x3d63,
+  0xbbae,
+  0x3b8d,
+  0x3ba3,
+  0x3cfc,
+  0xbc3e,
+  0xbbef,
+  0x3cd2,
+  0xbd03,
+  0x3bf7,
+  0xbcac,
+  0xbbf3,
+  0xbcc7,
+  0x3d2f,
+  0xbc36,
+  0x3c35,
+  0xbc9c,
+  0x3b7a,
+  0x3cd2,
+  0x3b85,
+  0xbd05,
+  0xbcf4,
+  0x3c1a,
+  0xbcf0,
+  0xbce4,
+  0xbbee,
+  0x3d53,
+  0xbd6f,
+  0x3c8d,
+  0xbcce,
+  0x3d08,
+  0xbb13,
+  0xbc86,
+  0x3b7e,
+  0xbcd0,
+  0x3cb6,
+  0xbcdc,
+  0x3c64,
+  0x3cc1,
+  0x3ce2,
+  0x3c1a,
+  0xbc4f,
+  0xbb96,
+  0x3cc6,
+  0xbce5,
+  0xbcdd,
+  0x3cf4,
+  0xbced,
+  0xbbd1,
+  0x3cfa,
+  0xbd8a,
+  0x39d4,
+  0x3a91,
+  0xbd30,
+  0x3cc5,
+  0x3c12,
+  0x3c94,
+  0x3d82,
+  0x3bc0,
+  0xbaba,
+  0x3c9c,
+  0x3d06,
+  0x3bb9,
+  0xbb86,
+  0xbc8c,
+  0xbc7f,
+  0xbb21,
+  0xbcce,
+  0x3cea,
+  0xbbb4,
+  0xbd23,
+  0xbd80,
+  0xbc99,
+  0xbca1,
+  0x3c80,
+  0x3c8d,
+  0x3d5f,
+  0xbd94,
+  0x3d4b,
+  0xbd3d,
+  0xbcdf,
+  0x3bdd,
+  0x3bec,
+  0xbd04,
+  0x3d41,
+  0x3c8e,
+  0xbcea,
+  0xbcbe,
+  0xbd7a,
+  0xbd41,
+  0x3cc5,
+  0x3cde,
+  0x3bf6,
+  0x3d05,
+  0xbcd3,
+  0xbc11,
+  0x3c1d,
+  0xbd21,
+  0xbd16,
+  0x3c3b,
+  0xbc02,
+  0xbc40,
+  0x3c5e,
+  0xbd00,
+  0x3d30,
+  0x3a56,
+  0x3d94,
+  0x3ca9,
+  0xbce9,
+  0x3cab,
+  0x3c60,
+  0x3d09,
+  0x3c81,
+  0xbd0f,
+  0x3d1e,
+  0xbb89,
+  0x3d11,
+  0xbcc4,
+  0xbc57,
+  0xbcaf,
+  0x3d28,
+  0x3c26,
+  0xbd8b,
+  0x3c17,
+  0x3c86,
+  0x3ca7,
+  0xbc9a,
+  0x3d3b,
+  0x3c4d,
+  0xbcd2,
+  0xbd75,
+  0x3c32,
+  0x3d10,
+  0xbd0b,
+  0xbd02,
+  0x3ce5,
+  0xbc76,
+  0xba1b,
+  0x3c3b,
+  0x3ca9,
+  0xbd6b,
+  0xbcd8,
+  0x3b3b,
+  0x3cae,
+  0xbd97,
+  0xbc2f,
+  0x3d4c,
+  0x3d0d,
+  0xbd0a,
+  0x3cab,
+  0x3a16,
+  0x3cc0,
+  0x3c2a,
+  0x3d13,
+  0x3c29,
+  0xbd79,
+  0x3cd1,
+  0x3c8f,
+  0x3b99,
+  0xbc39,
+  0xbcf2,
+  0x3c0d,
+  0x3d19,
+  0x3ba0,
+  0x3d2e,
+  0x3c7c,
+  0x3d15,
+  0xbbb7,
+  0x3c40,
+  0xbce8,
+  0x3b69,
+  0x3c84,
+  0x3bcd,
+  0x3c55,
+  0xbbe0,
+  0x3c7a,
+  0x3ba7,
+  0x3c5d,
+  0x3c40,
+  0xbd6d,
+  0x3ce1,
+  0x3d24,
+  0x3c06,
+  0xbce8,
+  0x3b6b,
+  0xbc44,
+  0x3d49,
+  0xbd47,
+  0xbcb6,
+  0x39bd,
+  0xbd5d,
+  0xbd04,
+  0x3c3d,
+  0xbd2b,
+  0x3c13,
+  0xbd06,
+  0x3ca1,
+  0x3c1b,
+  0xbb2c,
+  0xbc87,
+  0x3b98,
+  0xbce0,
+  0xbc7f,
+  0xbb1b,
+  0x3d5c,
+  0x3c4a,
+  0xbd06,
+  0xbc1c,
+  0x3bf7,
+  0xbc0b,
+  0xbd79,
+  0xbd0c,
+  0xbd06,
+  0x3cf1,
+  0xbd42,
+  0xbc9e,
+  0xbd19,
+  0x3ba8,
+  0xbcb1,
+  0xbced,
+  0xbc9c,
+  0xbd0e,
+  0xbab7,
+  0xbcd7,
+  0x3d17,
+  0x3d23,
+  0x3d15,
+  0xbd07,
+  0xbcf5,
+  0x3cda,
+  0xbd54,
+  0x3cc1,
+  0xbcc9,
+  0xbc0c,
+  0x3ba2,
+  0x3d01,
+  0x3d12,
+  0xbd4b,
+  0xbd26,
+  0xbba9,
+  0xbca2,
+  0xbd0f,
+  0xbcda,
+  0xbcc2,
+  0x3d10,
+  0x3c45,
+  0xbc43,
+  0xba06,
+  0xbd27,
+  0x3c0a,
+  0xbd1b,
+  0x3cd9,
+  0xbcbb,
+  0xbcc4,
+  0x3c50,
+  0x3d7f,
+  0x3cf1,
+  0x3c67,
+  0x3cc1,
+  0x3c8a,
+  0x3c80,
+  0x3c72,
+  0xbd1e,
+  0xbc84,
+  0x3bf2,
+  0x3bc9,
+  0xbcbb,
+  0xbb2d,
+  0x3a48,
+  0x3bff,
+  0x3ca7,
+  0x3cfb,
+  0x3c31,
+  0x3cf4,
+  0xbc4f,
+  0xbd1d,
+  0xbc87,
+  0xbcb5,
+  0xbd3d,
+  0xbc81,
+  0xbcc4,
+  0xbd26,
+  0xbc13,
+  0x3d5e,
+  0x3d0f,
+  0xbce6,
+  0x3b90,
+  0xbcff,
+  0xbc78,
+  0x3cdb,
+  0x3d3c,
+  0x3c9b,
+  0xbc9e,
+  0xbd08,
+  0xbbe3,
+  0x3d02,
+  0x3d89,
+  0xbc2d,
+  0xbc74,
+  0xbccf,
+  0x3d0f,
+  0x3d19,
+  0xbb64,
+  0x3a90,
+  0x3b4c,
+  0xbcb4,
+  0xbd18,
+  0xbc96,
+  0x3b85,
+  0xb9ca,
+  0xbcd0,
+  0x3bf9,
+  0x3cf6,
+  0x3c8c,
+  0xbcb2,
+  0xba47,
+  0xbc49,
+  0x3d11,
+  0x3cf6,
+  0x3d88,
+  0x3d6d,
+  0x3cd5,
+  0x3d32,
+  0x3cad,
+  0x3c88,
+  0x3d0c,
+  0x3c96,
+  0xbc40,
+  0x3c52,
+  0xbc96,
+  0xbd1b,
+  0xbc16,
+  0xbc8f,
+  0x3d45,
+  0x3c70,
+  0x3b87,
+  0x3c75,
+  0xbcf4,
+  0x3d24,
+  0xbd11,
+  0xbd76,
+  0x3b28,
+  0x3d17,
+  0xbb0a,
+  0x3d5d,
+  0x3ca2,
+  0x3bec,
+  0x3cb6,
+  0xbba1,
+  0xbc65,
+  0x3bea,
+  0xbccf,
+  0x3c81,
+  0x3d97,
+  0x3d29,
+  0x3d19,
+  0xbcdd,
+  0xbd5e,
+  0xbc90,
+  0x3c34,
+  0x3ccc,
+  0xbc29,
+  0xbc85,
+  0xbc2a,
+  0x3c8c,
+  0xbc9b,
+  0x3d4c,
+  0x3cd6,
+  0x3bb7,
+  0x3bf1,
+  0x3d21,
+  0xbd5d,
+  0x3ca3,
+  0xbbd8,
+  0xbcff,
+  0xbc8f,
+  0xbcd4,
+  0x3d31,
+  0xbc79,
+  0x3cb7,
+  0xbbd7,
+  0x3d18,
+  0xbd26,
+  0x3bb8,
+  0xbbde,
+  0xbd22,
+  0x3d53,
+  0x3b8a,
+  0xbc89,
+  0x3a8d,
+  0xbbba,
+  0x3ce4,
+  0xbbaa,
+  0x3c99,
+  0xbc65,
+  0xbd3c,
+  0x3c8c,
+  0xbd1a,
+  0x3c65,
+  0x3cd3,
+  0xbd73,
+  0x3c98,
+  0x3d0e,
+  0xb9ca,
+  0xbbef,
+  0x3cff,
+  0xbd67,
+  0xbd92,
+  0xbc24,
+  0x3ce6,
+  0xbd8f,
+  0x3c9f,
+  0xbd05,
+  0x3ba0,
+  0x3d03,
+  0x3cb7,
+  0x3ca6,
+  0xbc7c,
+  0x3bbb,
+  0x3cfa,
+  0x3c0f,
+  0xbcc0,
+  0xbc0d,
+  0x3a97,
+  0x3bb3,
+  0xbcca,
+  0xbaf9,
+  0xbcbe,
+  0x3ce8,
+  0x3d27,
+  0xbc8d,
+  0xbd70,
+  0xbcb1,
+  0x3d5e,
+  0xbca0,
+  0x3ccb,
+  0x3c9d,
+  0x3cbc,
+  0x3d3d,
+  0xbc10,
+  0x3d5a,
+  0x3d5a,
+  0xbcc6,
+  0xbc52,
+  0xbd59,
+  0xbd24,
+  0x3d5b,
+  0x3d82,
+  0xbd38,
+  0xbb21,
+  0x3d1a,
+  0xbd57,
+  0x3cf5,
+  0x3c13,
+  0xbd88,
+  0xbce8,
+  0x3c57,
+  0xbcde,
+  0x3ada,
+  0xbc1b,
+  0xbd09,
+  0x3c77,
+  0xbc6e,
+  0xbb4d,
+  0xbc2c,
+  0xbcb0,
+  0xbc56,
+  0x3d5f,
+  0x3d12,
+  0x3c74,
+  0x3c8c,
+  0xbca5,
+  0x3d35,
+  0x3c58,
+  0x3cd7,
+  0xbcb9,
+  0xbbf1,
+  0x3c07,
+  0xbd42,
+  0xbd7e,
+  0x3d32,
+  0x3d93,
+  0xbc0a,
+  0xbd81,
+  0xbcb5,
+  0x3c20,
+  0x3ab9,
+  0x3cca,
+  0xbcfe,
+  0xbb4a,
+  0x3cc4,
+  0x3d25,
+  0x3ae3,
+  0x3cbb,
+  0x3c83,
+  0x3d07,
+  0x3d1b,
+  0xba78,
+  0xbc85,
+  0x3cab,
+  0x3cfe,
+  0x3c19,
+  0xbd00,
+  0xbc58,
+  0x3d61,
+  0x3c9f,
+  0x3db6,
+  0x3d95,
+  0x3c9a,
+  0xbd38,
+  0xba09,
+  0x3c99,
+  0x3d32,
+  0xbcba,
+  0xbb35,
+  0x3bfa,
+  0x3cfb,
+  0xbd5d,
+  0x3c05,
+  0x3ca9,
+  0x3cb7,
+  0x3ca3,
+  0x3d3f,
+  0xbabe,
+  0xba64,
+  0x3bd5,
+  0x3c4f,
+  0xba63,
+  0x3c12,
+  0x3d0f,
+  0xbcbf,
+  0xbbef,
+  0x3c81,
+  0x3bb5,
+  0x3d34,
+  0x3be1,
+  0x3c80,
+  0x3cb7,
+  0x3ca6,
+  0x3cd6,
+  0xbcb7,
+  0x3b46,
+  0xbd1a,
+  0x3c58,
+  0x3a9f,
+  0xbdc5,
+  0x3c72,
+  0xbd46,
+  0x3c8f,
+  0x3c82,
+  0xbc15,
+  0x3d57,
+  0xbb46,
+  0xbcd1,
+  0xbc31,
+  0xbc2e,
+  0xbd08,
+  0x3bd0,
+  0x3c39,
+  0xbc5e,
+  0xbc2d,
+  0x38e9,
+  0x3d14,
+  0xbd43,
+  0x3d58,
+  0x3cba,
+  0xbc38,
+  0x3bc7,
+  0xbc75,
+  0xbd1a,
+  0x3cbc,
+  0x3d33,
+  0xbd29,
+  0xbd39,
+  0x3d04,
+  0x3d48,
+  0x3d08,
+  0xbcd4,
+  0xbd7c,
+  0x3d22,
+  0xbc0c,
+  0xbb98,
+  0xbcfa,
+  0xbc29,
+  0xbd5e,
+  0x3d60,
+  0x3c32,
+  0x3d68,
+  0x3d6d,
+  0x3c25,
+  0x3a08,
+  0x3d77,
+  0xbcda,
+  0x3ccf,
+  0x3cb1,
+  0xb9e8,
+  0x3d3c,
+  0xbd04,
+  0xbcfa,
+  0x3c82,
+  0x3b8c,
+  0xbd01,
+  0x3cf5,
+  0x3a38,
+  0xbbda,
+  0xbd09,
+  0x3c5d,
+  0xbce1,
+  0xbd08,
+  0xbbe9,
+  0xbc60,
+  0x3c28,
+  0xbcaa,
+  0x3bfb,
+  0x3b2b,
+  0x3cd9,
+  0x3b9b,
+  0x3c69,
+  0x3cd5,
+  0x3cd8,
+  0xbc05,
+  0x3d05,
+  0xbd2d,
+  0xbc6d,
+  0xbc3c,
+  0x3cf2,
+  0x3d44,
+  0xbdab,
+  0x3cdb,
+  0x3c0c,
+  0x3cb7,
+  0x3b29,
+  0xbc99,
+  0x3aeb,
+  0x3c92,
+  0xbc24,
+  0x3d86,
+  0x3d29,
+  0xbd15,
+  0x3d17,
+  0x3d34,
+  0x3cb1,
+  0x3b04,
+  0x3c76,
+  0xbc24,
+  0x3bb3,
+  0x3d5f,
+  0x3c76,
+  0xbd12,
+  0xbc41,
+  0xbd24,
+  0x3cd3,
+  0xbcf2,
+  0xbb9a,
+  0x3cbe,
+  0xbb5b,
+  0xbcd3,
+  0x3cdb,
+  0xbc8f,
+  0xbc23,
+  0x3c72,
+  0xbc87,
+  0xbd96,
+  0x3ccc,
+  0x3c4a,
+  0x3d39,
+  0xbcdd,
+  0xbc1e,
+  0xbd6a,
+  0xbcb1,
+  0x3d39,
+  0xbcfb,
+  0xbd06,
+  0xbb24,
+  0x3cd0,
+  0xbd1b,
+  0x3832,
+  0xbd1c,
+  0xbc9c,
+  0x3ac1,
+  0x3cef,
+  0xbc08,
+  0x3ce4,
+  0x3d03,
+  0x3cdb,
+  0x3b9f,
+  0x3b44,
+  0xba89,
+  0xbd2c,
+  0x3d11,
+  0xbcf0,
+  0xbc76,
+  0x3c75,
+  0x3d45,
+  0x3ca0,
+  0xbcf6,
+  0x3ab6,
+  0x3d51,
+  0x3c78,
+  0x3d26,
+  0xbc19,
+  0x3bbb,
+  0x3cd9,
+  0x3ba7,
+  0x3cc9,
+  0xbd54,
+  0xbb4b,
+  0x3d47,
+  0x3b90,
+  0xbcae,
+  0x3cb6,
+  0x3d97,
+  0x3c08,
+  0x3da3,
+  0xbc1b,
+  0xbbd9,
+  0xbd7a,
+  0x3c80,
+  0x3cf6,
+  0x3bc7,
+  0xbdce,
+  0x3caf,
+  0x3c13,
+  0x3b77,
+  0x3c14,
+  0x3d3f,
+  0x3b68,
+  0x3d51,
+  0xbca2,
+  0x3d81,
+  0xbd46,
+  0x3d1c,
+  0xbbdf,
+  0x3cc5,
+  0x3ce9,
+  0x3c52,
+  0x3bba,
+  0x3cc8,
+  0x3c0e,
+  0xbc9b,
+  0xbd85,
+  0xbd12,
+  0x3d27,
+  0xbcdc,
+  0xbbcd,
+  0xbd22,
+  0x3b06,
+  0x3c18,
+  0xbcc3,
+  0xbd4e,
+  0xbc8c,
+  0x3d22,
+  0xbd0f,
+  0x3c10,
+  0x3c68,
+  0x3c43,
+  0x3b25,
+  0xbcab,
+  0x3d36,
+  0xbdb6,
+  0x3d51,
+  0xbdcc,
+  0x3d39,
+  0xbb82,
+  0xbd11,
+  0x3b03,
+  0xbd4f,
+  0x3cd9,
+  0x3d35,
+  0xbbd4,
+  0xbd02,
+  0xbd0e,
+  0x3b9c,
+  0xbd11,
+  0xbcba,
+  0xbd64,
+  0xbc5a,
+  0x3b09,
+  0x3c19,
+  0xbcf7,
+  0xbb96,
+  0xbc17,
+  0xbd2f,
+  0x3d42,
+  0xbc7d,
+  0xbd27,
+  0xbd0f,
+  0xbbc7,
+  0xbd62,
+  0xbd1e,
+  0x3dbf,
+  0x3c7c,
+  0xbc82,
+  0x3ca1,
+  0x3c45,
+  0xbaaf,
+  0xbb14,
+  0xba6c,
+  0x3bf9,
+  0x3caf,
+  0xbcc7,
+  0xbbb5,
+  0x3d4b,
+  0xbb69,
+  0x3c48,
+  0x3cc2,
+  0xbc9e,
+  0x3c96,
+  0xbc8a,
+  0x3c74,
+  0x3b0f,
+  0x3c8a,
+  0x3cf6,
+  0xbc29,
+  0x3d2d,
+  0x3d31,
+  0xbbc0,
+  0xbce0,
+  0xbcac,
+  0x3d9b,
+  0xbcba,
+  0x3c06,
+  0x3d5b,
+  0xbc8f,
+  0x3c0b,
+  0x3cdb,
+  0xbbed,
+  0xbdc1,
+  0xbca0,
+  0xb8d0,
+  0x3abc,
+  0x3d37,
+  0x3d97,
+  0xbc80,
+  0x3bc0,
+  0xbc80,
+  0x3d06,
+  0x3d0f,
+  0x3b14,
+  0x3cd2,
+  0xbda9,
+  0xbbf2,
+  0xbdb1,
+  0xbc38,
+  0xbc3d,
+  0x3d10,
+  0x3abf,
+  0xbb96,
+  0xbd0f,
+  0xbd0a,
+  0xbd1f,
+  0xbd30,
+  0x3d1e,
+  0x3d1a,
+  0xbc92,
+  0xbd4f,
+  0xbc40,
+  0xbc86,
+  0xba70,
+  0xbc9d,
+  0xbb3b,
+  0xbd0a,
+  0xb883,
+  0xbca1,
+  0x3d2f,
+  0xbcb6,
+  0xbc94,
+  0xbce9,
+  0xbcc7,
+  0x3d22,
+  0x3d9d,
+  0xbd2a,
+  0xb9d8,
+  0x3c4e,
+  0x3d32,
+  0xbccd,
+  0x3aa3,
+  0xbc58,
+  0xbb1d,
+  0x3d59,
+  0xbce4,
+  0xbd19,
+  0xbcba,
+  0xbc8e,
+  0x3b3b,
+  0xbd06,
+  0xbca4,
+  0xb994,
+  0xbcf3,
+  0x3b3c,
+  0xbced,
+  0x3d04,
+  0xbc31,
+  0xbcf5,
+  0xbb9d,
+  0xbd60,
+  0x3d05,
+  0x3beb,
+  0x3c18,
+  0xbcaa,
+  0xbd08,
+  0xbba2,
+  0xbd82,
+  0x3c88,
+  0x3a58,
+  0x3ba2,
+  0x3c11,
+  0x3c09,
+  0xbbf5,
+  0xbc22,
+  0xba7c,
+  0x3d1e,
+  0xbd60,
+  0x3d32,
+  0x3b49,
+  0xbc51,
+  0x3c4a,
+  0xbd04,
+  0x3d08,
+  0x3c48,
+  0xbcf3,
+  0xbc80,
+  0xbc87,
+  0xbc7a,
+  0x3c04,
+  0xbd4e,
+  0x3d63,
+  0x3c84,
+  0x3cdc,
+  0x3c5c,
+  0xbd40,
+  0xbd76,
+  0x3c1d,
+  0xbd4d,
+  0x3d1c,
+  0x3d11,
+  0xbd52,
+  0xbb36,
+  0x3d25,
+  0xbc7c,
+  0xbd8f,
+  0xbc2e,
+  0x3cf7,
+  0xbd09,
+  0xbbf7,
+  0xbd1a,
+  0x3d42,
+  0xbc10,
+  0xbd5f,
+  0x3d8f,
+  0x3d27,
+  0x3d1f,
+  0xbc5a,
+  0x3cee,
+  0xbac9,
+  0x3cc8,
+  0xbc81,
+  0xbc19,
+  0x3a82,
+  0xbc8f,
+  0xbbf2,
+  0xb948,
+  0xbc98,
+  0xbcbc,
+  0xbac7,
+  0x3ca8,
+  0x3d42,
+  0x3a22,
+  0x3d3d,
+  0x3c91,
+  0xbccb,
+  0xbd67,
+  0xbc50,
+  0xbc96,
+  0x3d26,
+  0x3d61,
+  0xbc8c,
+  0x3d25,
+  0xbc4f,
+  0xbc8b,
+  0xbc70,
+  0xbd5e,
+  0xbcdf,
+  0x3c9e,
+  0xbcb4,
+  0xba88,
+  0x3d4e,
+  0xbd41,
+  0xbd3c,
+  0x3d6c,
+  0x3b86,
+  0x3d8f,
+  0x3d2d,
+  0xbc83,
+  0x3d14,
+  0x3c76,
+  0xbc50,
+  0xbae1,
+  0xbced,
+  0xbd29,
+  0x3d34,
+  0x3d6a,
+  0x3d91,
+  0x3c97,
+  0x3bd3,
+  0xbc9c,
+  0xbad7,
+  0x3c37,
+  0x3d31,
+  0xbc10,
+  0x3d78,
+  0x3d8c,
+  0x3ca6,
+  0xbd1c,
+  0x3cc0,
+  0xbd1d,
+  0xbc88,
+  0xbc23,
+  0xbca1,
+  0xbd07,
+  0x3cc4,
+  0x3ad4,
+  0x3d49,
+  0x3c49,
+  0x3d6d,
+  0xbca2,
+  0x3c1c,
+  0x3bdd,
+  0xbc77,
+  0x3c9a,
+  0xbc7d,
+  0xbcf2,
+  0x3d90,
+  0x3d47,
+  0x3ce6,
+  0xbcfa,
+  0x3d94,
+  0x3c0c,
+  0x3d83,
+  0xbbdf,
+  0x3b98,
+  0xbc9a,
+  0xbcad,
+  0x3cab,
+  0x3d11,
+  0x3c26,
+  0x3d1a,
+  0xbbe0,
+  0x3be3,
+  0x3c40,
+  0x3d46,
+  0x3c08,
+  0xbd90,
+  0xbc6b,
+  0x3d20,
+  0x3c7e,
+  0x3c06,
+  0x3d7d,
+  0x3c62,
+  0xbce4,
+  0x3a42,
+  0xbc92,
+  0xbca1,
+  0x3d1f,
+  0xbb68,
+  0xbc2f,
+  0x3c2b,
+  0xb8d4,
+  0xbd26,
+  0x3b0e,
+  0x3be0,
+  0xbd4b,
+  0xbb9a,
+  0x3bb8,
+  0xbc56,
+  0xbbfb,
+  0xbd49,
+  0xba90,
+  0x3cbd,
+  0xbd39,
+  0x3baf,
+  0xbc15,
+  0x3cce,
+  0xbb8a,
+  0xbd24,
+  0x3c65,
+  0x3d2c,
+  0xbc3a,
+  0x3cb7,
+  0x3c75,
+  0x3d1a,
+  0x3d35,
+  0x3c3f,
+  0xbb17,
+  0x3cc4,
+  0xbc28,
+  0xbc0a,
+  0x3d26,
+  0x3d20,
+  0x3d37,
+  0xbd31,
+  0x3d5c,
+  0xbd08,
+  0x3c3b,
+  0x3d0c,
+  0xbc51,
+  0xba6d,
+  0x3d17,
+  0x3c8f,
+  0xbce3,
+  0xbd45,
+  0xbce6,
+  0x39fd,
+  0xbcf9,
+  0xbd6f,
+  0x3cf0,
+  0xbb03,
+  0x3c49,
+  0x3ca5,
+  0x3c68,
+  0x3d98,
+  0xbd33,
+  0x3c27,
+  0x3d0f,
+  0x3d3f,
+  0x3ceb,
+  0xbcfe,
+  0x3abe,
+  0x3c73,
+  0xbc09,
+  0xbce2,
+  0xbd08,
+  0xbccf,
+  0x3cef,
+  0x3bc4,
+  0x3c83,
+  0xbc76,
+  0x3b75,
+  0xbc9d,
+  0xbd82,
+  0x3c96,
+  0xbca1,
+  0x3c27,
+  0xbc10,
+  0x3cc0,
+  0xbdb1,
+  0xbc71,
+  0xbd38,
+  0x3d0d,
+  0xbd2e,
+  0xbc5b,
+  0xbc13,
+  0xbd86,
+  0x3b90,
+  0x3bcc,
+  0x3c4c,
+  0x3c48,
+  0xbd41,
+  0x3c1c,
+  0xbbe9,
+  0xbc89,
+  0xbd65,
+  0xbc28,
+  0x3c54,
+  0xbc88,
+  0x3aee,
+  0xbd5a,
+  0xbc84,
+  0xbd5f,
+  0xbc2b,
+  0x3c99,
+  0xbd1d,
+  0x3c0e,
+  0x3c38,
+  0xbc2a,
+  0x3c86,
+  0xbd2b,
+  0x3cfd,
+  0x3d34,
+  0xbd53,
+  0xba99,
+  0x3cd2,
+  0xbb83,
+  0xbcc9,
+  0x3d0e,
+  0xbd7a,
+  0x3d36,
+  0xbd52,
+  0xbd4e,
+  0xbc83,
+  0x3da2,
+  0xbb81,
+  0x3ce9,
+  0x3c94,
+  0xbccb,
+  0xbccf,
+  0xbcc8,
+  0x3cba,
+  0x3d44,
+  0x3d01,
+  0x3c13,
+  0x3c62,
+  0x3d40,
+  0x3d17,
+  0xbcc6,
+  0x3cce,
+  0x3d05,
+  0xbc93,
+  0x3c95,
+  0x3d4a,
+  0x3d04,
+  0xbc8d,
+  0x3cc1,
+  0xbc89,
+  0x3be8,
+  0xbd08,
+  0xbd46,
+  0x3d0b,
+  0x3caa,
+  0xbb20,
+  0x3c90,
+  0x3d22,
+  0xbd6f,
+  0xbcf7,
+  0x3d40,
+  0x3bcc,
+  0xbd70,
+  0x3a73,
+  0x3d09,
+  0x3c06,
+  0xbc71,
+  0xbd55,
+  0x3c5d,
+  0xbca5,
+  0xbd0b,
+  0xbbd2,
+  0xbc31,
+  0xbc0d,
+  0x3d99,
+  0x3ca8,
+  0xbdda,
+  0xbd4d,
+  0xbd8c,
+  0x3c89,
+  0x3d08,
+  0x3c8c,
+  0xbd21,
+  0x3bfe,
+  0x3cc3,
+  0x3d15,
+  0x3c87,
+  0x3d2a,
+  0x3ce2,
+  0x3cdc,
+  0xbd8d,
+  0xbd9e,
+  0xbb92,
+  0xbd56,
+  0xbd88,
+  0x3cbc,
+  0x3d04,
+  0xbd93,
+  0x3d0d,
+  0xbce3,
+  0x3ccc,
+  0xbd23,
+  0x3d4b,
+  0x3c2c,
+  0xbcce,
+  0x3ba6,
+  0x3c68,
+  0xbc0c,
+  0x3d13,
+  0x3c8c,
+  0x3ced,
+  0xbd3a,
+  0xbaec,
+  0x3cd5,
+  0x3beb,
+  0x3c1e,
+  0x3baa,
+  0xbccb,
+  0xbd80,
+  0xbb09,
+  0xbbe8,
+  0x3bca,
+  0xbca9,
+  0xbd14,
+  0x3cbb,
+  0xbd06,
+  0x3986,
+  0x3d32,
+  0xbb70,
+  0x3be1,
+  0xbd08,
+  0x3d1f,
+  0xbd0f,
+  0x3d05,
+  0x3cdd,
+  0xbca8,
+  0x3c4b,
+  0xbcc8,
+  0xbbc8,
+  0x3b49,
+  0x3cf6,
+  0x3ca8,
+  0x3d0f,
+  0x3a99,
+  0xbcab,
+  0xbb74,
+  0x3c84,
+  0x3cea,
+  0xbd08,
+  0x3d17,
+  0xbd0c,
+  0xbd1d,
+  0xbd3c,
+  0x3c20,
+  0xbd1a,
+  0xbc24,
+  0x3d15,
+  0xbbea,
+  0xbbed,
+  0xbd0e,
+  0xbd6d,
+  0xbcd4,
+  0x3cee,
+  0x3cbb,
+  0xbc6f,
+  0xbaa6,
+  0xbad3,
+  0xbd74,
+  0xbd32,
+  0x3cd7,
+  0x3b50,
+  0x3cf4,
+  0xbb9f,
+  0xbcc3,
+  0x3add,
+  0xbc33,
+  0x3cb8,
+  0x3d2e,
+  0xbcf5,
+  0xbd6a,
+  0xbdb2,
+  0xbc52,
+  0x3d70,
+  0x3ca5,
+  0xbc38,
+  0x3d7c,
+  0x3c8d,
+  0x39a4,
+  0xbcdd,
+  0x3d8e,
+  0x3bf0,
+  0x3ca6,
+  0xbd24,
+  0x3be2,
+  0xbcd2,
+  0xbbd2,
+  0xbc99,
+  0x39f8,
+  0xbbeb,
+  0x3b80,
+  0xbb55,
+  0x3caa,
+  0x3b41,
+  0xbcc1,
+  0xbbe7,
+  0xbaae,
+  0xbcad,
+  0xbc7f,
+  0xbd66,
+  0x3c9d,
+  0x3d6a,
+  0x3ba6,
+  0x3cbe,
+  0x3d03,
+  0x3c44,
+  0x3c56,
+  0x3d69,
+  0x3ae5,
+  0x3d3c,
+  0xbc90,
+  0xbba9,
+  0xbd26,
+  0xbbcd,
+  0x3c6d,
+  0x3d4e,
+  0x3c11,
+  0x3d8e,
+  0xbc29,
+  0xbc91,
+  0x3d2a,
+  0xbd12,
+  0x3c21,
+  0x3d0a,
+  0x3adc,
+  0xbcff,
+  0x3c88,
+  0xbbf8,
+  0xbb9c,
+  0x3cb5,
+  0x3caf,
+  0x3aff,
+  0xbd91,
+  0x3a8c,
+  0xbc21,
+  0xbc15,
+  0x3d52,
+  0xbdad,
+  0x3d79,
+  0x3d04,
+  0x3cca,
+  0xbc99,
+  0xbd23,
+  0x3cb7,
+  0xbb44,
+  0xbc5c,
+  0xbd08,
+  0x3d13,
+  0x3b04,
+  0x3c9d,
+  0xbc41,
+  0x3c3a,
+  0xba01,
+  0xbcaf,
+  0xbcb8,
+  0x3d2e,
+  0xbce8,
+  0x3c24,
+  0xbd52,
+  0xbd00,
+  0x3c8c,
+  0xbc5e,
+  0xbce6,
+  0xbc1a,
+  0xbd82,
+  0xbb44,
+  0x3d2c,
+  0xbcdc,
+  0xbcc1,
+  0x3c92,
+  0xbcb8,
+  0xbd0b,
+  0xbbd4,
+  0x3c86,
+  0xbba9,
+  0x3d05,
+  0xbce1,
+  0xbca8,
+  0x3c99,
+  0xbd5b,
+  0xbd23,
+  0x3d49,
+  0x3c9a,
+  0xbd00,
+  0xbba1,
+  0xbc99,
+  0x3c98,
+  0x3d39,
+  0xbca1,
+  0xbb00,
+  0x3d25,
+  0xbce2,
+  0x3cab,
+  0xba7a,
+  0xbcb1,
+  0xbd1a,
+  0xbab2,
+  0x3caf,
+  0x3b06,
+  0x3d06,
+  0xbcf9,
+  0xbc89,
+  0xbca0,
+  0xbd2a,
+  0x3d62,
+  0x3d32,
+  0xbc26,
+  0x3d09,
+  0xbb39,
+  0xbcf1,
+  0xbb7b,
+  0xbd69,
+  0xbb09,
+  0xbcde,
+  0xbd27,
+  0x3cc9,
+  0xbc09,
+  0x3cd0,
+  0xbc9f,
+  0x3c76,
+  0x3cff,
+  0xbd1e,
+  0x3d0a,
+  0xbbd6,
+  0xbc39,
+  0xbc8f,
+  0xbc13,
+  0xbc0b,
+  0x3ca7,
+  0xbc9b,
+  0xbd1c,
+  0xbcb2,
+  0xbc1b,
+  0x3d07,
+  0xbdb0,
+  0xbb4a,
+  0x3ca8,
+  0xbd0a,
+  0xbc90,
+  0x3c73,
+  0x3d1a,
+  0xbd1b,
+  0x3cd4,
+  0x3b45,
+  0xbbc3,
+  0xbc89,
+  0xbc5c,
+  0xbc75,
+  0xbcbf,
+  0xbd1d,
+  0x3c87,
+  0x3be1,
+  0x3a71,
+  0xbc99,
+  0x3ae5,
+  0xbb57,
+  0xbb7c,
+  0x3c9d,
+  0xbc8d,
+  0xbca0,
+  0xbcbc,
+  0x3d58,
+  0x3d91,
+  0xbd06,
+  0x3ca2,
+  0xbd50,
+  0x3d3f,
+  0x3c84,
+  0x3c54,
+  0xbd3a,
+  0x3bf8,
+  0xbcae,
+  0x3d40,
+  0x3d37,
+  0xbcfa,
+  0xbcb8,
+  0x3a85,
+  0x3ca1,
+  0x3ccd,
+  0x3cce,
+  0x3cc9,
+  0x3c6f,
+  0xbd65,
+  0x3bee,
+  0xbca3,
+  0x3c31,
+  0xbcf0,
+  0xbcb1,
+  0xbd20,
+  0x3ce8,
+  0xbd30,
+  0x3cad,
+  0xbca4,
+  0xbcb2,
+  0xbcca,
+  0xbcbe,
+  0xbb1f,
+  0xbd0d,
+  0x3d4d,
+  0xbd30,
+  0x3c7f,
+  0xbc5d,
+  0x3c54,
+  0xbda8,
+  0x3d12,
+  0x3c7c,
+  0xbd10,
+  0xbc5e,
+  0x3aef,
+  0x3cc7,
+  0x3b44,
+  0x3b9b,
+  0xbcfd,
+  0xbb61,
+  0x3d04,
+  0xbcb4,
+  0x3d49,
+  0xbd40,
+  0xbc32,
+  0xbc6e,
+  0x3d0e,
+  0xbb33,
+  0xbcc9,
+  0x3ca5,
+  0x3c91,
+  0xbd5b,
+  0x3cf9,
+  0xbd46,
+  0x3d10,
+  0xbc33,
+  0x3d71,
+  0x3c0e,
+  0xbd80,
+  0xbd43,
+  0xbd63,
+  0x3b60,
+  0x3cc4,
+  0xbb35,
+  0xbd1a,
+  0xbc64,
+  0xbd38,
+  0xbc6f,
+  0xbcf6,
+  0xbb6a,
+  0xbc9c,
+  0x3c66,
+  0x3bd8,
+  0x3c86,
+  0xbccf,
+  0xbc16,
+  0x3d6f,
+  0x3ada,
+  0xbc15,
+  0x3b25,
+  0xbc46,
+  0xbced,
+  0xbc3a,
+  0x3d93,
+  0xbd64,
+  0x3cb5,
+  0x3c5b,
+  0x3d03,
+  0xbd72,
+  0xbbec,
+  0x3d42,
+  0xbb73,
+  0xbc92,
+  0x3b57,
+  0xbc6c,
+  0x3a05,
+  0xba88,
+  0x3b47,
+  0xbd2d,
+  0x3d60,
+  0x3bb4,
+  0xbd48,
+  0x3c9c,
+  0x3cd3,
+  0xbcfb,
+  0x3d48,
+  0xbc0a,
+  0x3c73,
+  0x3c64,
+  0x3c42,
+  0xbd07,
+  0x3cef,
+  0x3cca,
+  0x3d65,
+  0x3c9b,
+  0x3c24,
+  0xbc66,
+  0xbbf3,
+  0x3cf0,
+  0xbc9c,
+  0x3ba5,
+  0xbd48,
+  0xbce1,
+  0x3cd8,
+  0x3ce5,
+  0xbd7f,
+  0x3d28,
+  0x3ccb,
+  0x3c7d,
+  0xbd0c,
+  0x3bc9,
+  0xbd16,
+  0x3cf9,
+  0xbd67,
+  0x3a8c,
+  0x3c62,
+  0xbcb5,
+  0xbcff,
+  0xbd98,
+  0x3d39,
+  0x3d12,
+  0x3a95,
+  0xbc2a,
+  0xbc5d,
+  0x3cbc,
+  0x3c33,
+  0x3bf2,
+  0x3d20,
+  0x3c2b,
+  0xbd01,
+  0x3d28,
+  0x3bab,
+  0xbd05,
+  0x3ca9,
+  0xbba8,
+  0x3cfa,
+  0xbbc4,
+  0x3d03,
+  0x3c91,
+  0x3d7b,
+  0xbd83,
+  0xbc10,
+  0x3cf2,
+  0x3cbc,
+  0xbc1a,
+  0xbb70,
+  0x3c0c,
+  0xbbef,
+  0x3c62,
+  0x3b82,
+  0x3c10,
+  0xbd8f,
+  0xbcb9,
+  0x3c8d,
+  0x3cfa,
+  0x3c0b,
+  0x3b07,
+  0xbcda,
+  0xbd2f,
+  0xbd2b,
+  0x3d63,
+  0x3d3b,
+  0x3bf8,
+  0xbd21,
+  0xbc34,
+  0x3c9b,
+  0xbc99,
+  0xbcc4,
+  0xbdc4,
+  0x3cf4,
+  0xbc3b,
+  0xbd40,
+  0xbc2f,
+  0xbdca,
+  0x3cfa,
+  0xbc70,
+  0x3c38,
+  0xbabe,
+  0xbcc0,
+  0x3cf4,
+  0xbb35,
+  0x3d19,
+  0xbb90,
+  0xbcc0,
+  0xbc37,
+  0x3b77,
+  0xbd08,
+  0x3c7b,
+  0x3b9a,
+  0xbd34,
+  0x3cf4,
+  0x3d54,
+  0xbc06,
+  0x3c4b,
+  0xbc15,
+  0xbd35,
+  0x3d66,
+  0xbca7,
+  0x3c5b,
+  0xbd31,
+  0x3c7b,
+  0xbc88,
+  0x3c2a,
+  0x3d76,
+  0x3b3c,
+  0x3ce9,
+  0x3b93,
+  0xbd44,
+  0xbd0e,
+  0x3d05,
+  0xbd29,
+  0x3b15,
+  0xbd2e,
+  0x3c80,
+  0x3d52,
+  0x3bb0,
+  0xbbf9,
+  0xbb4b,
+  0x3c00,
+  0xbd46,
+  0x3d21,
+  0xbced,
+  0x3c12,
+  0xba9a,
+  0x3ccf,
+  0xbb34,
+  0x3cb4,
+  0xbad1,
+  0x3cdb,
+  0xbcd4,
+  0x3a9b,
+  0xbcc1,
+  0xbcff,
+  0x3c5a,
+  0xbca8,
+  0xbcca,
+  0xbc96,
+  0xbc3d,
+  0xbce1,
+  0x3bba,
+  0xbced,
+  0xbd53,
+  0xbca1,
+  0x3cb9,
+  0xbd08,
+  0x3d3c,
+  0xbc9d,
+  0xbc83,
+  0x3c4c,
+  0x3d0c,
+  0x3ced,
+  0x3b93,
+  0x3cfe,
+  0xbd25,
+  0xbcf4,
+  0xbc76,
+  0x3d49,
+  0xbcdc,
+  0x3c4d,
+  0xbd28,
+  0x3cc1,
+  0x3c1b,
+  0xbd1a,
+  0x3cd3,
+  0xbc21,
+  0xbdae,
+  0x3d2f,
+  0xbd0f,
+  0x3c63,
+  0xba82,
+  0x3c83,
+  0xbd8a,
+  0x3b6a,
+  0x3ba6,
+  0x3d3b,
+  0x3d19,
+  0xbd04,
+  0x3d82,
+  0x3c39,
+  0xbafe,
+  0xbcef,
+  0xbcde,
+  0x3d1f,
+  0x3b9d,
+  0x3bab,
+  0x3ccd,
+  0x3a9d,
+  0xbc24,
+  0x3d4a,
+  0x3cb3,
+  0x3c9a,
+  0xbc43,
+  0xbcca,
+  0xbd31,
+  0xbc8e,
+  0xbd36,
+  0x3d98,
+  0x3ca8,
+  0x3c46,
+  0xbc99,
+  0xbc22,
+  0xbcdc,
+  0xbcaa,
+  0xbc4c,
+  0xbd0b,
+  0x3ce0,
+  0xbd04,
+  0xbc24,
+  0x3c61,
+  0x3c68,
+  0xbc8b,
+  0x3c0f,
+  0xbcbe,
+  0x3d62,
+  0xbcb4,
+  0x3c7f,
+  0xbd84,
+  0xbc67,
+  0x3cbf,
+  0x3c45,
+  0x3ba0,
+  0x3a30,
+  0xbd22,
+  0x3bc6,
+  0xbcc7,
+  0xbb6b,
+  0xbda9,
+  0x3ba1,
+  0xbd5b,
+  0x3cdd,
+  0x3b63,
+  0xbd2a,
+  0xbc8e,
+  0x3c01,
+  0xbc28,
+  0x3d34,
+  0xbd6b,
+  0x3c84,
+  0xbd55,
+  0x3bf2,
+  0x3c96,
+  0xbb9f,
+  0xbcf2,
+  0x3d18,
+  0x3aaf,
+  0xbd62,
+  0x3d2c,
+  0xbdbc,
+  0xbcd4,
+  0x3ce5,
+  0xbc09,
+  0xbd64,
+  0xbc82,
+  0xbd23,
+  0xbb88,
+  0x3ba3,
+  0x3cab,
+  0xbd0c,
+  0xbd12,
+  0x3d10,
+  0x3c0d,
+  0xbce3,
+  0x3d53,
+  0xbd37,
+  0xbc49,
+  0xbc75,
+  0x3ce3,
+  0x3d7f,
+  0x3cef,
+  0x3d15,
+  0xbbff,
+  0x3d0c,
+  0xbb51,
+  0x3cb2,
+  0xbc8c,
+  0x3c9b,
+  0x3aee,
+  0xbc24,
+  0xbc12,
+  0xbcb1,
+  0xbcc5,
+  0xbc27,
+  0x3cc2,
+  0x3b52,
+  0xbb08,
+  0x3af6,
+  0xbd2a,
+  0xbc60,
+  0x3ca3,
+  0x3cd9,
+  0x3cf4,
+  0xbd7a,
+  0xbc12,
+  0x3c3a,
+  0x3cfb,
+  0xbc28,
+  0x3b95,
+  0x3b8a,
+  0xbd2d,
+  0xbcc8,
+  0x3cb3,
+  0x3b7e,
+  0xbd2f,
+  0xbbba,
+  0x3d20,
+  0xbc2a,
+  0xbc74,
+  0x3ca4,
+  0x3ca9,
+  0x3c03,
+  0x3be1,
+  0x3c8e,
+  0xbb66,
+  0xbbf2,
+  0x3d8c,
+  0x3d29,
+  0xbc73,
+  0xbd0e,
+  0xbd87,
+  0x3d3a,
+  0xbce3,
+  0x3d06,
+  0xbd38,
+  0x3ae6,
+  0x3bf5,
+  0xbd27,
+  0x3bf6,
+  0xbd0d,
+  0x3d05,
+  0x3d54,
+  0x3c04,
+  0x3cb0,
+  0xbcd5,
+  0x3c77,
+  0xbc94,
+  0x3caa,
+  0x3d36,
+  0x3cf9,
+  0xbcf2,
+  0x3d4b,
+  0xbcb8,
+  0x3d2c,
+  0x3bb5,
+  0xbbdd,
+  0x3d03,
+  0xbc8b,
+  0xbd46,
+  0x3caf,
+  0x3b8e,
+  0xbd40,
+  0xbc34,
+  0xbc1f,
+  0xbcec,
+  0xbc74,
+  0x3c7b,
+  0x3d08,
+  0xbad7,
+  0x3cf7,
+  0x3c31,
+  0x3cb5,
+  0x3d00,
+  0x3c95,
+  0x3d5d,
+  0xbbd7,
+  0xbd57,
+  0xbd3d,
+  0xbd11,
+  0x3d17,
+  0x3d1e,
+  0xbc9b,
+  0x3d24,
+  0xbc99,
+  0x3d25,
+  0x3d37,
+  0x3c1d,
+  0x3c74,
+  0xbd85,
+  0x3ccc,
+  0xbd16,
+  0x3cea,
+  0xbbe3,
+  0xbce0,
+  0xba8e,
+  0xbce7,
+  0x3d00,
+  0x3d4e,
+  0x3caa,
+  0xbd02,
+  0x3d19,
+  0x3d0d,
+  0xbb93,
+  0x3d48,
+  0x3c2a,
+  0xbc25,
+  0xbb0a,
+  0xbc67,
+  0x3d77,
+  0xbd8c,
+  0x3d19,
+  0x3d28,
+  0xbce7,
+  0xbc81,
+  0x3b37,
+  0xbcc7,
+  0xbbdd,
+  0x3c0a,
+  0x3a44,
+  0x3c51,
+  0xbd86,
+  0x3ba4,
+  0x3ccc,
+  0xbc1a,
+  0x3d8b,
+  0x3c22,
+  0x3d4c,
+  0xbbd0,
+  0xbc5b,
+  0x3b91,
+  0x3bc3,
+  0x3bfc,
+  0xbb0a,
+  0xbb6a,
+  0xbcb9,
+  0x3cf6,
+  0x3d9b,
+  0xbbbc,
+  0x3c30,
+  0x3bc5,
+  0x3c1f,
+  0xbcf5,
+  0x3d8d,
+  0x3d04,
+  0xbcd9,
+  0x3da8,
+  0x3c0f,
+  0x3c40,
+  0xbd02,
+  0x3cfb,
+  0xbb9b,
+  0xbd83,
+  0xbce1,
+  0xbcd6,
+  0x3d13,
+  0xbd86,
+  0x3cd3,
+  0x3c02,
+  0xbd7a,
+  0xbc63,
+  0xbd78,
+  0xbcbd,
+  0xbc9a,
+  0x3d16,
+  0xbdd0,
+  0xbda0,
+  0xbd12,
+  0xba48,
+  0xbc64,
+  0x3c6b,
+  0x3b12,
+  0xbcd1,
+  0x3c20,
+  0x3d0c,
+  0x3d22,
+  0x3d2b,
+  0x3c95,
+  0xbd4d,
+  0x3b31,
+  0xbc82,
+  0x3cc2,
+  0xbc81,
+  0xbbe9,
+  0xbbac,
+  0x3d09,
+  0xbd24,
+  0x3d9c,
+  0x3dab,
+  0x3cba,
+  0xbc1e,
+  0xbb66,
+  0xbc1c,
+  0x3ab1,
+  0x3bcf,
+  0x3c87,
+  0xbc32,
+  0x3bdf,
+  0x3d88,
+  0xbbec,
+  0xbd10,
+  0x3d81,
+  0xbbb9,
+  0xbc79,
+  0x3cc3,
+  0x3d0e,
+  0x3c61,
+  0xbc35,
+  0x3cff,
+  0x3b22,
+  0x3d0d,
+  0xbc4c,
+  0x3cfe,
+  0x3d03,
+  0xb9c2,
+  0x3c68,
+  0x3d37,
+  0x3c30,
+  0x3cb5,
+  0xbcda,
+  0xbcd4,
+  0xbce1,
+  0x3cbc,
+  0xbd79,
+  0xbc0f,
+  0x3b20,
+  0xbca6,
+  0xbd90,
+  0xbc6b,
+  0x3b9f,
+  0xbd0d,
+  0xbc02,
+  0x3c5e,
+  0xbc8e,
+  0x3c1b,
+  0xbc87,
+  0xbd52,
+  0x3a30,
+  0x3793,
+  0x3c2b,
+  0xbd36,
+  0x3c41,
+  0x3c63,
+  0xbcd5,
+  0x3c0a,
+  0x3c2f,
+  0xbd0e,
+  0xbd8f,
+  0xbca0,
+  0xbcd7,
+  0x3ce5,
+  0xbce6,
+  0x3d07,
+  0xbcdf,
+  0x3c0a,
+  0xbd54,
+  0xbca1,
+  0xbcd0,
+  0x3cf6,
+  0x3cd5,
+  0x3c8f,
+  0xbcaf,
+  0x3cc3,
+  0x3d7e,
+  0x3c13,
+  0x3cd8,
+  0xbc58,
+  0x3d3a,
+  0xbd02,
+  0x3bcb,
+  0x3d0d,
+  0x3d44,
+  0xbd20,
+  0xbcfb,
+  0x3d29,
+  0xbd22,
+  0xbb91,
+  0xbcad,
+  0x3cea,
+  0x3c4e,
+  0x3c93,
+  0x3c68,
+  0xbcec,
+  0xbd81,
+  0x3d96,
+  0x3c8b,
+  0x3d7a,
+  0x3c9b,
+  0x3b17,
+  0xbd0c,
+  0x3bfe,
+  0x3ceb,
+  0x3c60,
+  0xbc82,
+  0x3cc6,
+  0x3d2e,
+  0xbc13,
+  0x3d4c,
+  0xbcfb,
+  0x3bcd,
+  0x3cde,
+  0xbc05,
+  0x3d32,
+  0x3d0c,
+  0xbc97,
+  0x3ce5,
+  0x3ce3,
+  0xbd87,
+  0xbc55,
+  0x3aec,
+  0x3c09,
+  0x3da8,
+  0xbd1d,
+  0x3c83,
+  0xbcfd,
+  0xbc52,
+  0x3cc3,
+  0xbb6f,
+  0xbca7,
+  0x3d11,
+  0xbc4b,
+  0x3c9c,
+  0xbce5,
+  0x3d09,
+  0x3c8d,
+  0x3d6b,
+  0xbcad,
+  0xbc3b,
+  0x3cf0,
+  0x3c83,
+  0x3c86,
+  0x3d51,
+  0xbd9d,
+  0xbc8f,
+  0x3b66,
+  0xbd1b,
+  0xbd01,
+  0xbd16,
+  0xbb80,
+  0xbb58,
+  0x3d3a,
+  0xbd72,
+  0xbcf4,
+  0xbb10,
+  0xbcc7,
+  0x3d81,
+  0x3cca,
+  0x3b14,
+  0x3c44,
+  0x3ba1,
+  0x3c0b,
+  0x3d6f,
+  0x3d03,
+  0x3ce5,
+  0xbc98,
+  0x3d52,
+  0x3c89,
+  0x3cc3,
+  0xbac2,
+  0xbd7b,
+  0x3a8b,
+  0xbc92,
+  0x3cf4,
+  0xbcbe,
+  0xbcb1,
+  0x3b94,
+  0x3c7a,
+  0xbd09,
+  0xbca6,
+  0xbcf7,
+  0xbd09,
+  0xbcd1,
+  0xbd0b,
+  0x3d32,
+  0x3c47,
+  0x3ced,
+  0xbcc5,
+  0x3bc4,
+  0x3cf0,
+  0x3d02,
+  0x3cfe,
+  0xbd8b,
+  0x3c8e,
+  0x3d76,
+  0xba30,
+  0x3d05,
+  0xbcc2,
+  0xbc90,
+  0x3d1d,
+  0xbcc8,
+  0xbdad,
+  0x3c1e,
+  0x3d89,
+  0x3b84,
+  0xbbc7,
+  0x3ac8,
+  0xbce5,
+  0x3c83,
+  0x3d1f,
+  0xbb29,
+  0x3d07,
+  0xbcf6,
+  0x3d0d,
+  0x3b58,
+  0xbd5d,
+  0xbb91,
+  0x3d82,
+  0xbc35,
+  0xbd53,
+  0xbca7,
+  0xbb3f,
+  0x3d05,
+  0x3c6f,
+  0x3b29,
+  0xbbba,
+  0x3d37,
+  0x3c5d,
+  0x3d37,
+  0xbc36,
+  0xbd38,
+  0xbb3c,
+  0xbd4e,
+  0xbc65,
+  0xbd3d,
+  0xbacd,
+  0xbca6,
+  0xbcfb,
+  0x3cc1,
+  0x3c97,
+  0xb9b2,
+  0xbbef,
+  0x3d83,
+  0x3cd3,
+  0xbd5a,
+  0x3d69,
+  0xbc1a,
+  0xbc47,
+  0x3da6,
+  0xbd1d,
+  0x3c53,
+  0xbbed,
+  0x3d36,
+  0xbd61,
+  0xbbaa,
+  0x3c6c,
+  0xbce4,
+  0x3c62,
+  0x3cfb,
+  0x3bfa,
+  0xbca7,
+  0x3d0c,
+  0xbd19,
+  0x3bc1,
+  0xbcb6,
+  0x3bf0,
+  0x3cc1,
+  0x3c87,
+  0xbc92,
+  0xbbca,
+  0xbba5,
+  0x3d1f,
+  0xbd12,
+  0xbd38,
+  0xbcb6,
+  0xbc05,
+  0xbcb4,
+  0x3d5a,
+  0x3c2b,
+  0xbc7c,
+  0xbb80,
+  0x3c47,
+  0x3c8f,
+  0x3d37,
+  0x3c79,
+  0x3d47,
+  0x3c75,
+  0xbd52,
+  0xbb98,
+  0xbd63,
+  0x3cdd,
+  0x3b94,
+  0xbc34,
+  0xbcaf,
+  0xbcac,
+  0xbd51,
+  0xbd24,
+  0xbcd6,
+  0xbb8f,
+  0x3d31,
+  0x3d21,
+  0x3c25,
+  0xbd77,
+  0x3d2a,
+  0x3d1b,
+  0x3bef,
+  0xbd9c,
+  0x3d20,
+  0x38c3,
+  0x3c11,
+  0xbc54,
+  0x3c49,
+  0xbb46,
+  0x3c4c,
+  0x3cc6,
+  0xbd0e,
+  0xbaca,
+  0xbd1e,
+  0xbca3,
+  0x3cd3,
+  0xbd55,
+  0x3b69,
+  0xba3f,
+  0xbc07,
+  0x3d0c,
+  0x3d6c,
+  0x3d14,
+  0x3ca5,
+  0xbd27,
+  0xbd5b,
+  0x3aa5,
+  0x3d4e,
+  0x3c9b,
+  0x3c23,
+  0xbcfb,
+  0x3c50,
+  0x3d4d,
+  0xbbf5,
+  0x3af5,
+  0xbc81,
+  0xbd5d,
+  0x3d0e,
+  0xbd1d,
+  0xba0d,
+  0xbd8a,
+  0x3c92,
+  0xbd14,
+  0xbb4b,
+  0x3cb5,
+  0x3a66,
+  0xbc53,
+  0x3bd4,
+  0xbd11,
+  0xbc8a,
+  0x3ce1,
+  0xbc7f,
+  0xbcca,
+  0xbcc7,
+  0x3d5f,
+  0xbbaa,
+  0x3cf6,
+  0xbcd0,
+  0x3c93,
+  0x3c1b,
+  0x3c57,
+  0x3c45,
+  0x3d85,
+  0x3d3b,
+  0xbd19,
+  0xbcdf,
+  0xbc8a,
+  0xbdb1,
+  0x3d41,
+  0x3c9e,
+  0x3b8b,
+  0x3ca2,
+  0x3c65,
+  0x3cff,
+  0x3d17,
+  0xbac6,
+  0x3c87,
+  0x3ade,
+  0xbab3,
+  0x3ce5,
+  0x3ce4,
+  0x3c81,
+  0x3c94,
+  0xbc88,
+  0x3b2a,
+  0xbcdf,
+  0x3c52,
+  0xbbf4,
+  0xbc1f,
+  0xbd56,
+  0xbd16,
+  0xbd1b,
+  0xbcd6,
+  0xbb1b,
+  0xbcfa,
+  0x3ce2,
+  0xbca4,
+  0x3d0c,
+  0xbce7,
+  0x3ca8,
+  0x3d2d,
+  0x3b03,
+  0xbc46,
+  0x3ab5,
+  0x3c24,
+  0xba48,
+  0xbd3f,
+  0x3c29,
+  0x3bf7,
+  0x3c88,
+  0x3c83,
+  0x3d33,
+  0x3cad,
+  0xbd44,
+  0xbd44,
+  0x3cbb,
+  0xbccc,
+  0x3c46,
+  0xbd40,
+  0x3d7b,
+  0xbd17,
+  0x3d51,
+  0xbc55,
+  0xbd60,
+  0xbc88,
+  0x3c00,
+  0x3d23,
+  0xbd20,
+  0x3c4a,
+  0xbbda,
+  0x3cca,
+  0xbbe7,
+  0x3cb7,
+  0xbce6,
+  0x3b56,
+  0x3bb0,
+  0x3c5d,
+  0x3d41,
+  0x3c48,
+  0x3ca2,
+  0xba6e,
+  0xbc05,
+  0xbb4b,
+  0xbcbc,
+  0x3ca1,
+  0xbd4f,
+  0xbd1b,
+  0xbd2f,
+  0xbceb,
+  0xbc92,
+  0x3b83,
+  0xbb7c,
+  0xbc18,
+  0xbb0f,
+  0xbd44,
+  0x3cc1,
+  0xbc4a,
+  0xbd24,
+  0xbcab,
+  0xbd95,
+  0xbb42,
+  0xbd8b,
+  0x3d32,
+  0x3c00,
+  0xbc93,
+  0xbcbe,
+  0x3c7d,
+  0xbd86,
+  0x3a30,
+  0x3cab,
+  0xbb45,
+  0x3d6b,
+  0x3d68,
+  0x3ca0,
+  0x3cc1,
+  0x3cdf,
+  0x3b40,
+  0xbca9,
+  0x3d83,
+  0x3cbb,
+  0xbd36,
+  0x3d47,
+  0x3caf,
+  0x3d1d,
+  0x3754,
+  0xbce6,
+  0xbbdb,
+  0x3d3d,
+  0xbad4,
+  0x3d4c,
+  0xbd03,
+  0xbd7b,
+  0x3c26,
+  0x3b9f,
+  0x3cf8,
+  0x3d85,
+  0x3b35,
+  0x3d57,
+  0x3d03,
+  0x3d0c,
+  0xbbe6,
+  0xbbf6,
+  0xbac2,
+  0x3929,
+  0xbd0f,
+  0xbbf9,
+  0xbc86,
+  0x3c7c,
+  0xbba5,
+  0xbd31,
+  0xbd03,
+  0x3d1a,
+  0x3d25,
+  0xbd83,
+  0x3a5d,
+  0x3b95,
+  0xbcdf,
+  0xbc0e,
+  0x3b85,
+  0x3d42,
+  0xbcd8,
+  0x3d5c,
+  0xbc4f,
+  0x3c05,
+  0xbc70,
+  0xbd2a,
+  0xbd0b,
+  0x3c83,
+  0x3d21,
+  0x3c7d,
+  0x3c27,
+  0x3d07,
+  0xbd1b,
+  0x3cf5,
+  0x3c97,
+  0x3ca5,
+  0xbd2d,
+  0x39c2,
+  0xbd8d,
+  0xbc7c,
+  0xbaa7,
+  0x3997,
+  0x3ce1,
+  0x3c1c,
+  0x3c35,
+  0x3b39,
+  0xbb68,
+  0x3d8d,
+  0x3b8a,
+  0x3c9f,
+  0x3cde,
+  0xbbce,
+  0xbd05,
+  0x3d49,
+  0xbc93,
+  0xbc8b,
+  0xbbac,
+  0x3c96,
+  0xbd0c,
+  0x3cbe,
+  0x3cec,
+  0x3d48,
+  0xbc3d,
+  0xbd59,
+  0xbc88,
+  0xbc4b,
+  0x3c9b,
+  0xbce3,
+  0x3cff,
+  0x3d21,
+  0x3bdd,
+  0xbc4f,
+  0x3b3f,
+  0x3d8e,
+  0xbc11,
+  0xbc3c,
+  0xbd41,
+  0x3d0e,
+  0x3d38,
+  0xbbc3,
+  0x3cd9,
+  0x39cd,
+  0xbd3a,
+  0x3cb0,
+  0xbcd0,
+  0xbd0b,
+  0x3bc4,
+  0x3bed,
+  0xbcfe,
+  0xbd52,
+  0xbc9e,
+  0xbc99,
+  0x3d14,
+  0x3c9f,
+  0xba69,
+  0x3c72,
+  0xbcd7,
+  0x3d5b,
+  0x3d25,
+  0xbd12,
+  0x3c78,
+  0xbd2d,
+  0xbcfd,
+  0xbc1e,
+  0xbcfa,
+  0xbd58,
+  0xbc66,
+  0xbc04,
+  0x3d5d,
+  0xbd26,
+  0x3c83,
+  0x3cdf,
+  0x3d0d,
+  0x3a0b,
+  0x3c0d,
+  0x3cf2,
+  0x3ca9,
+  0xbc14,
+  0x3ce0,
+  0x3c2a,
+  0x3d3f,
+  0xbcdc,
+  0x3d3b,
+  0x3bed,
+  0xbc98,
+  0xbc53,
+  0xbd00,
+  0xbd5d,
+  0xbc81,
+  0x3cbb,
+  0x3cb8,
+  0xbd90,
+  0xba83,
+  0x3d0b,
+  0x3d29,
+  0x3d37,
+  0xbd92,
+  0x3cac,
+  0x3d0c,
+  0x3c69,
+  0x3caf,
+  0x3ceb,
+  0x3d02,
+  0xbd24,
+  0xbc3c,
+  0xbc83,
+  0x3ce4,
+  0x3d5f,
+  0x3d22,
+  0x3d33,
+  0x3d9d,
+  0xbd54,
+  0x3bba,
+  0xbd07,
+  0x3cf4,
+  0xbd0f,
+  0xbba2,
+  0x3d1e,
+  0xbcd6,
+  0xbd09,
+  0xbdaa,
+  0x3d4e,
+  0x3ce3,
+  0xbd98,
+  0xbb9f,
+  0xbcd9,
+  0xbb99,
+  0xbd61,
+  0x3d14,
+  0xbcc6,
+  0x3c91,
+  0x3aa3,
+  0x3c93,
+  0x3d0e,
+  0x3cab,
+  0xbc2e,
+  0xbcc0,
+  0x3c89,
+  0xbbe0,
+  0x3c35,
+  0xbbe4,
+  0x3cda,
+  0x3aa9,
+  0x3c1c,
+  0xbc55,
+  0x3d4f,
+  0xbd3a,
+  0x3cf4,
+  0x3d3c,
+  0x3d47,
+  0xbd59,
+  0xbce0,
+  0x3c03,
+  0x3ccc,
+  0x3c40,
+  0xbca6,
+  0xbc72,
+  0x3c95,
+  0x3d58,
+  0xbc1d,
+  0xbd1f,
+  0xbbca,
+  0xbcfb,
+  0x3cc7,
+  0x3c83,
+  0x3c8c,
+  0x3cdc,
+  0x3ccf,
+  0xbc2b,
+  0xbc0f,
+  0x3cde,
+  0x3cfb,
+  0xbd13,
+  0x3c3b,
+  0xbc7d,
+  0xbd1c,
+  0xbc7c,
+  0xbc99,
+  0xbc52,
+  0xbd32,
+  0xbc82,
+  0x3cdf,
+  0xbc35,
+  0x3d4d,
+  0xbd6a,
+  0x3ceb,
+  0x3cc1,
+  0xbb9b,
+  0xbcd0,
+  0xbcbe,
+  0xbc17,
+  0x3db4,
+  0xbb37,
+  0xbcd0,
+  0x3b83,
+  0xba8d,
+  0x3c86,
+  0x3ca5,
+  0x3c9a,
+  0xbc88,
+  0xbca0,
+  0x3ba3,
+  0x3cc5,
+  0xbbe3,
+  0xbcb1,
+  0xbd4d,
+  0x3bc2,
+  0x3d03,
+  0xbda5,
+  0xbd2d,
+  0x3c03,
+  0x3cd0,
+  0xbc4a,
+  0x3ab0,
+  0x3d15,
+  0xbcf8,
+  0xbcae,
+  0x3d28,
+  0x3b3b,
+  0xbcac,
+  0xbc31,
+  0x3b0e,
+  0x3d6d,
+  0xbbee,
+  0xbcdf,
+  0xb7a3,
+  0xbcd1,
+  0x3c46,
+  0x3c6c,
+  0x3d14,
+  0x3cd3,
+  0xbca1,
+  0x3c28,
+  0x3cd7,
+  0xbcf0,
+  0x3cb6,
+  0xbc8a,
+  0xbcf3,
+  0x3c9c,
+  0xbd40,
+  0x3c0b,
+  0xbd03,
+  0xbd3c,
+  0xbd5d,
+  0x3be1,
+  0xbc95,
+  0x3abb,
+  0xbaa7,
+  0xbcfd,
+  0xbca0,
+  0x3bf1,
+  0x3d82,
+  0x3c3a,
+  0xbd1b,
+  0x3d62,
+  0x3d81,
+  0x3c66,
+  0xbd25,
+  0x3cbf,
+  0x3c87,
+  0x3c37,
+  0xbd49,
+  0x3b2b,
+  0x3cee,
+  0x3b6b,
+  0x3d0d,
+  0x3d92,
+  0x3c51,
+  0x3d3c,
+  0xbc7c,
+  0x3b27,
+  0xbca7,
+  0xbd6c,
+  0x3bd5,
+  0xbcca,
+  0x3bf5,
+  0xbd27,
+  0x3d10,
+  0xbc41,
+  0x3d88,
+  0x3c03,
+  0xbc9c,
+  0x3c08,
+  0xbd08,
+  0xbd00,
+  0xbd84,
+  0xbc04,
+  0x3c03,
+  0xbc48,
+  0x3d4a,
+  0xbc67,
+  0x3c70,
+  0xbc15,
+  0xbc40,
+  0xbbe5,
+  0xbcb0,
+  0xbd5f,
+  0xbcbb,
+  0xbc9b,
+  0xbbbc,
+  0xbc21,
+  0x3c01,
+  0xbc55,
+  0x3c9a,
+  0xbc91,
+  0x3d1a,
+  0x3c4c,
+  0xbc44,
+  0x3ae1,
+  0xbc2d,
+  0xbcd6,
+  0xbadb,
+  0x3c69,
+  0xbc7e,
+  0x3c8b,
+  0xba91,
+  0x3d14,
+  0xbcd8,
+  0xbcf1,
+  0xbc95,
+  0xbcbe,
+  0x3c55,
+  0x3cba,
+  0x3c8e,
+  0x3d2a,
+  0xbca9,
+  0xbb8b,
+  0x3ba9,
+  0x3d17,
+  0x3c3c,
+  0xbbc7,
+  0x3d78,
+  0xbc5a,
+  0xbc76,
+  0x3dad,
+  0xbb90,
+  0xbd0a,
+  0xbd1c,
+  0xbce2,
+  0xbd01,
+  0x3cd5,
+  0xbd85,
+  0xbc5e,
+  0x3c2d,
+  0x3d2c,
+  0x3c00,
+  0xbce6,
+  0x3a93,
+  0xbc28,
+  0xbc5c,
+  0xbc09,
+  0xbbc3,
+  0x3c8b,
+  0x3c3c,
+  0x3cf7,
+  0xbd37,
+  0x3c5e,
+  0xbd6c,
+  0xbd78,
+  0x3cf7,
+  0x3d21,
+  0xbc7c,
+  0xbcaa,
+  0x3b5c,
+  0xbce6,
+  0xbc4a,
+  0xbc53,
+  0x3c97,
+  0x3d23,
+  0x3bb5,
+  0x3b77,
+  0xbbb1,
+  0xbc6f,
+  0xba9c,
+  0x3c0a,
+  0xbbcf,
+  0xbc72,
+  0x3d34,
+  0xbb5e,
+  0x3d5a,
+  0xbc78,
+  0x3c8a,
+  0x3ba3,
+  0xbc86,
+  0xbbcd,
+  0xbc70,
+  0x3d1c,
+  0xbcc5,
+  0x3d27,
+  0xbb83,
+  0xbcab,
+  0x3cae,
+  0xbb2f,
+  0xbd86,
+  0x3b64,
+  0x3ce0,
+  0xbd29,
+  0x3cf7,
+  0x3c35,
+  0x3cba,
+  0x3d08,
+  0xbc8f,
+  0xbbc9,
+  0x3c70,
+  0x3d03,
+  0x3c42,
+  0xbd05,
+  0x3be0,
+  0xbc96,
+  0x3cb8,
+  0xbd2c,
+  0x3c0b,
+  0xbcdf,
+  0x3dc1,
+  0x3d82,
+  0x3c6d,
+  0xbb4a,
+  0xbd1a,
+  0xbcdf,
+  0xbc3c,
+  0xbc9d,
+  0x3b96,
+  0xbc14,
+  0xbaa3,
+  0x3d2b,
+  0x3d7d,
+  0xbcf0,
+  0x3d63,
+  0xbc59,
+  0xbce3,
+  0xbcd8,
+  0x3d04,
+  0x3c83,
+  0x3d08,
+  0xbbe2,
+  0x3d34,
+  0x3c60,
+  0x3c1d,
+  0x3c89,
+  0x3d20,
+  0x3d94,
+  0x3dba,
+  0xbca1,
+  0xbd5c,
+  0xbcf9,
+  0xbc2a,
+  0x3c9f,
+  0x3c16,
+  0xbd44,
+  0xbc7f,
+  0xbb7f,
+  0x3c3e,
+  0x3c85,
+  0x3b0b,
+  0xba40,
+  0xbd40,
+  0x3c6f,
+  0x3a93,
+  0x3d0b,
+  0xbbb0,
+  0xbc28,
+  0xbc07,
+  0x3d82,
+  0xbd3f,
+  0xbca8,
+  0x3b66,
+  0x3c7a,
+  0xbc63,
+  0x3be7,
+  0x3a37,
+  0xbb93,
+  0xbbde,
+  0x3c53,
+  0xbd0b,
+  0x3c5a,
+  0x3c8c,
+  0x3d10,
+  0x3cc1,
+  0x3d82,
+  0xbabe,
+  0x3d20,
+  0x3c05,
+  0x3a8e,
+  0x3cc6,
+  0x3d10,
+  0xbd1b,
+  0xbc7b,
+  0xbc1f,
+  0x3b7d,
+  0x3d0c,
+  0xbcdc,
+  0xbc13,
+  0x3c9a,
+  0x3b99,
+  0x3b04,
+  0x3c56,
+  0xbd33,
+  0xbcee,
+  0xbcdd,
+  0xbcc2,
+  0xbd03,
+  0xbb48,
+  0x3c65,
+  0x3c39,
+  0x3bea,
+  0x3d24,
+  0xbd11,
+  0xbca4,
+  0xbcb8,
+  0x3aa8,
+  0x3cbb,
+  0x3b02,
+  0xbce0,
+  0xbc7a,
+  0x3d59,
+  0x3ad2,
+  0xbcf0,
+  0xbc00,
+  0xbbf6,
+  0x3ccf,
+  0x3c9e,
+  0xb91e,
+  0xbc8f,
+  0xbd2b,
+  0x3b88,
+  0xba84,
+  0xbc3c,
+  0xbb86,
+  0xbaf5,
+  0xbbc4,
+  0x3b1c,
+  0xbc19,
+  0xbc0b,
+  0x3c37,
+  0x3c06,
+  0x3a22,
+  0xbb64,
+  0x3b8c,
+  0x3d5f,
+  0x3a84,
+  0x3bf7,
+  0x3aa7,
+  0xbd0f,
+  0x3d5f,
+  0xbcb5,
+  0xbcbd,
+  0x3c86,
+  0x3be2,
+  0x3c6b,
+  0x3cb3,
+  0x3b62,
+  0xbcd1,
+  0xbbda,
+  0xbd3f,
+  0xbb74,
+  0xbbbc,
+  0x3c25,
+  0xbd11,
+  0x3b5c,
+  0x3d12,
+  0xbc08,
+  0x3d0b,
+  0x3c9d,
+  0x39a4,
+  0x3d0c,
+  0xbc7b,
+  0xbd01,
+  0xb9dc,
+  0x3c76,
+  0x3d39,
+  0xbd8a,
+  0x3ca3,
+  0x3c64,
+  0x3c6c,
+  0xbd96,
+  0xbbae,
+  0x3cac,
+  0xbd4a,
+  0xbc2a,
+  0xbd47,
+  0xbca4,
+  0xbd18,
+  0xbc36,
+  0xbd06,
+  0x3d0c,
+  0x3d16,
+  0x3c19,
+  0xbb0a,
+  0x3cf6,
+  0x3c8b,
+  0xbb44,
+  0x3b64,
+  0x3b8c,
+  0x3c76,
+  0xbc66,
+  0x3c65,
+  0x3da0,
+  0xbc59,
+  0xbba8,
+  0xbc8d,
+  0x38e5,
+  0x3c66,
+  0x3cf8,
+  0xbca3,
+  0xbd77,
+  0x3c5d,
+  0x3ca9,
+  0x3c37,
+  0xbd6d,
+  0xbd81,
+  0x3d64,
+  0xbc0f,
+  0x3dcf,
+  0x3ccb,
+  0xbc80,
+  0x3ca7,
+  0x3d4b,
+  0x3c4c,
+  0x3ac6,
+  0xbc9e,
+  0x3d0a,
+  0x3c93,
+  0xbc1c,
+  0xbd91,
+  0xbd16,
+  0x3ba3,
+  0x3cf5,
+  0x3ce2,
+  0x3dac,
+  0x3c9a,
+  0xbd00,
+  0x3d62,
+  0xbd17,
+  0x3d5b,
+  0xbd4d,
+  0x3d12,
+  0xbc70,
+  0x3c81,
+  0xbd3e,
+  0x3c77,
+  0x3d9a,
+  0x3c84,
+  0xbd32,
+  0xbd47,
+  0x3cae,
+  0xbbf7,
+  0xbcbc,
+  0xbc57,
+  0xbc59,
+  0xbc84,
+  0xbc1e,
+  0x3cdf,
+  0x3d47,
+  0x3d6b,
+  0x3b82,
+  0x3c9a,
+  0x3d41,
+  0x3c16,
+  0x3c8f,
+  0x3cc9,
+  0xbc58,
+  0x3cfb,
+  0x3b0b,
+  0xbc5a,
+  0x3ce5,
+  0xbd82,
+  0x3cd3,
+  0x3bcf,
+  0xbd2e,
+  0x3d6a,
+  0xbcf6,
+  0xbbec,
+  0xbd2c,
+  0xbd84,
+  0x3d27,
+  0xbc39,
+  0xbca4,
+  0x3c8e,
+  0x3d81,
+  0x3cdb,
+  0xb92f,
+  0x3c32,
+  0xbbc9,
+  0xbdc5,
+  0xbd0e,
+  0x3cc6,
+  0x3d0f,
+  0x3d1b,
+  0x3d2e,
+  0x3cec,
+  0xba18,
+  0x3c92,
+  0x3cc0,
+  0x3b3e,
+  0xbd59,
+  0xbd96,
+  0x3d36,
+  0xbc13,
+  0x3bdf,
+  0xbbc8,
+  0x3ca1,
+  0x3d0a,
+  0xbd92,
+  0x3cd6,
+  0x3d0e,
+  0x3c35,
+  0xbaa5,
+  0xbc70,
+  0x3be5,
+  0x3ce2,
+  0x3b1c,
+  0xbcb8,
+  0xbc0d,
+  0xbd33,
+  0x3d82,
+  0x3cb5,
+  0xbcd0,
+  0xbb07,
+  0xbb26,
+  0x3d08,
+  0x3ca0,
+  0xbbb2,
+  0xbcc9,
+  0x3d4d,
+  0xbbc1,
+  0x3d2d,
+  0x3cea,
+  0xbbd0,
+  0xbcf9,
+  0x3caf,
+  0x3d1d,
+  0x3aad,
+  0xbc8f,
+  0xb83a,
+  0x3d30,
+  0xbc89,
+  0xbae9,
+  0xbbf2,
+  0x3da2,
+  0x3c83,
+  0xbd49,
+  0xb8d8,
+  0x3d05,
+  0xbd01,
+  0x3c67,
+  0xbc0c,
+  0x3c5e,
+  0x3d19,
+  0x3ced,
+  0xbd1b,
+  0x3c6d,
+  0xbd42,
+  0x3cb8,
+  0xbc0e,
+  0xbc49,
+  0xbcd6,
+  0x3baa,
+  0x3c4e,
+  0x3caa,
+  0xbd18,
+  0x3aba,
+  0x3c73,
+  0x3d10,
+  0x3d40,
+  0x3c83,
+  0x3cc1,
+  0x3c37,
+  0x3cba,
+  0x3d7d,
+  0xbd21,
+  0xbb73,
+  0x3d60,
+  0xbd92,
+  0xbc13,
+  0xbc6e,
+  0xbbc7,
+  0xbb5c,
+  0xbcbf,
+  0xbcd0,
+  0xbca5,
+  0xbc9b,
+  0xbcf8,
+  0xbca8,
+  0xbc62,
+  0xbc9c,
+  0xbc3f,
+  0xbc36,
+  0xbd06,
+  0x3c2f,
+  0x3c3b,
+  0x3b87,
+  0x3d11,
+  0xbab1,
+  0x3c89,
+  0xbb49,
+  0xba2c,
+  0xbd15,
+  0xbb62,
+  0xbd80,
+  0x3c82,
+  0xbd26,
+  0xbc4e,
+  0x3c9f,
+  0x3cc5,
+  0xbc7a,
+  0x3d88,
+  0x3ce8,
+  0xbbe6,
+  0x3cab,
+  0xbc49,
+  0x3c84,
+  0xbcfa,
+  0x3d18,
+  0x3d27,
+  0x3d14,
+  0x3c6b,
+  0xbd0f,
+  0xbc2c,
+  0xbcee,
+  0x3c2e,
+  0xbc81,
+  0x3ca8,
+  0x3c71,
+  0xbb1f,
+  0x3d3c,
+  0xbd6b,
+  0xbbe3,
+  0xbcbf,
+  0x3cef,
+  0xbc83,
+  0xbb6e,
+  0x3c44,
+  0x3d1e,
+  0x3cff,
+  0x3cc2,
+  0x3c0b,
+  0x3c91,
+  0x3b9d,
+  0x3d06,
+  0x3c16,
+  0xbca8,
+  0x3d12,
+  0x3d44,
+  0xbc92,
+  0x3d91,
+  0xbda0,
+  0xbcf2,
+  0x3d1e,
+  0xbd05,
+  0xbd81,
+  0xbd35,
+  0x3cf5,
+  0x3c0f,
+  0xbd3f,
+  0x3add,
+  0x3d00,
+  0xbd33,
+  0x3da2,
+  0xbb85,
+  0x3c7a,
+  0x3d53,
+  0x3c82,
+  0xbcc5,
+  0xbd4f,
+  0xbd4d,
+  0x3b0b,
+  0x3d94,
+  0x3ca5,
+  0x3c47,
+  0x3cc3,
+  0x3c68,
+  0xbc09,
+  0xbd2c,
+  0xbd1c,
+  0xbc9d,
+  0xbcd2,
+  0x3d28,
+  0x3c06,
+  0x3c1f,
+  0x3be9,
+  0x3c8d,
+  0xbd2b,
+  0xbcda,
+  0xbcad,
+  0x3c6b,
+  0xbcea,
+  0x3bec,
+  0xbd95,
+  0x3d4c,
+  0xbd9a,
+  0xbaa2,
+  0xba43,
+  0x3d31,
+  0xbc47,
+  0xbd2a,
+  0xbcd8,
+  0x3c5d,
+  0x3965,
+  0x3c7d,
+  0x3cc5,
+  0xbc68,
+  0x3d0b,
+  0x3d37,
+  0x3d07,
+  0x3d47,
+  0x3d10,
+  0x3d31,
+  0x3d2f,
+  0xbca2,
+  0x3d1f,
+  0xbc46,
+  0x3d05,
+  0x3d05,
+  0x3d2e,
+  0xbd56,
+  0xbca3,
+  0x3c27,
+  0xbcfd,
+  0xbc1f,
+  0xbd00,
+  0xbcab,
+  0xbcee,
+  0xbcac,
+  0x3b75,
+  0xbcdf,
+  0x3d67,
+  0x3b80,
+  0x3d87,
+  0x3d25,
+  0x3bf2,
+  0x3c45,
+  0xbd03,
+  0xbd37,
+  0xbd60,
+  0xbb1f,
+  0x3d45,
+  0x3c56,
+  0x3cc7,
+  0x3ced,
+  0xbd1a,
+  0x3cf7,
+  0x3c55,
+  0xbc34,
+  0x3c02,
+  0x3c7d,
+  0x3cdf,
+  0xbd26,
+  0x3d03,
+  0xbb81,
+  0xbbd6,
+  0x3d05,
+  0x3d1e,
+  0xbd16,
+  0x3c1d,
+  0xbc7a,
+  0xbce0,
+  0x3c87,
+  0x3d02,
+  0xbd5c,
+  0x3aae,
+  0x3c86,
+  0xbb92,
+  0x3c1f,
+  0x3cba,
+  0xbd1b,
+  0x3d03,
+  0x3caa,
+  0x3c51,
+  0xbca3,
+  0x3cd2,
+  0xbd31,
+  0xbc58,
+  0x3d3e,
+  0x3cb6,
+  0x3ca7,
+  0x3cf6,
+  0x3b30,
+  0x3cc3,
+  0x3cbd,
+  0x3a8b,
+  0xbc72,
+  0xbc6f,
+  0x3ca8,
+  0x3c38,
+  0xbc92,
+  0xbb23,
+  0xbc95,
+  0x3c2c,
+  0xbcaf,
+  0x3ce5,
+  0x3b4b,
+  0x3c01,
+  0x3ca9,
+  0xba85,
+  0xbd98,
+  0x3c0a,
+  0x3cf4,
+  0xbc97,
+  0x3bf7,
+  0x3cb3,
+  0x3c74,
+  0xbd5d,
+  0x3c00,
+  0x3d38,
+  0xbc8a,
+  0xbc56,
+  0xbcae,
+  0x3bb6,
+  0x3d10,
+  0x3c0c,
+  0xbd1c,
+  0x3d97,
+  0xbcbe,
+  0xbd2b,
+  0xbcba,
+  0x3ce0,
+  0x3d48,
+  0xbd1d,
+  0x3d56,
+  0xbd3c,
+  0xbcb2,
+  0x3d97,
+  0x3bea,
+  0x3d3b,
+  0xbb6a,
+  0x3bcb,
+  0xbd77,
+  0x3c38,
+  0xbc6f,
+  0x3b84,
+  0xbcac,
+  0x3b8d,
+  0xbd23,
+  0x3d63,
+  0x3d24,
+  0xbbcb,
+  0x3cde,
+  0x3d22,
+  0x3d87,
+  0xbda7,
+  0xbcb3,
+  0xbbb5,
+  0xbc2e,
+  0x3d6c,
+  0x3d44,
+  0x3bb5,
+  0x3d4a,
+  0x3ce9,
+  0x3b57,
+  0xbc87,
+  0x3d10,
+  0xbc86,
+  0xbcf7,
+  0x3c6b,
+  0x3d33,
+  0xbd31,
+  0xbac2,
+  0xbc1e,
+  0xbc25,
+  0xbbc1,
+  0x3d0f,
+  0x3cb8,
+  0xbd7c,
+  0x3d52,
+  0x3c46,
+  0xbd51,
+  0xba8b,
+  0xbba8,
+  0x3bf1,
+  0xbd13,
+  0xbc92,
+  0xbda2,
+  0xbbe9,
+  0x3d41,
+  0xbcdc,
+  0xbcb2,
+  0x3b72,
+  0x3c01,
+  0xbd1e,
+  0xbce7,
+  0x3d29,
+  0x3bdd,
+  0xbd51,
+  0xbceb,
+  0xbd39,
+  0xbc58,
+  0xbc52,
+  0x3d69,
+  0x3cd4,
+  0x3d3b,
+  0xbc85,
+  0xbd02,
+  0xbd60,
+  0x3c99,
+  0xbdb2,
+  0x3bf0,
+  0xbc76,
+  0x3cdc,
+  0xbc8c,
+  0xbc50,
+  0x3d83,
+  0xbd12,
+  0x3d48,
+  0xbd24,
+  0x3c4c,
+  0x3d1a,
+  0x3c44,
+  0x3cbd,
+  0x3c07,
+  0xbc1d,
+  0x3d2d,
+  0x3d08,
+  0x3cc9,
+  0xbd36,
+  0xb9b0,
+  0x3c35,
+  0x3d75,
+  0x3cc6,
+  0xbdba,
+  0xbd27,
+  0x3cd3,
+  0x3c71,
+  0xbcaa,
+  0xbd1d,
+  0xbd22,
+  0x3b82,
+  0xbd1e,
+  0x3d89,
+  0x3c62,
+  0x3d03,
+  0xbd21,
+  0xbba5,
+  0xbc2e,
+  0x3cd6,
+  0xbcb0,
+  0xbc5d,
+  0x3c82,
+  0xbc5c,
+  0xbd12,
+  0x3d2d,
+  0xbc7d,
+  0xbd6a,
+  0xbce7,
+  0xbcfc,
+  0xbc5c,
+  0x3cce,
+  0x3d19,
+  0x3c7c,
+  0x3d1d,
+  0xbadb,
+  0xbc22,
+  0xbd1a,
+  0x3c07,
+  0x3d90,
+  0xbd14,
+  0xbd9c,
+  0xbd46,
+  0x3d45,
+  0xbcc7,
+  0xbb17,
+  0xbd8c,
+  0xbd22,
+  0x3b30,
+  0xbd13,
+  0x3c7d,
+  0xbc4b,
+  0x3c46,
+  0x3d44,
+  0x3c15,
+  0x3c0a,
+  0xbc97,
+  0x3d03,
+  0x3c01,
+  0xbd6a,
+  0x3d0e,
+  0x3c76,
+  0x3c14,
+  0xbcd0,
+  0xbd02,
+  0x3b8e,
+  0xbcaf,
+  0xbd12,
+  0xbb41,
+  0xbce2,
+  0x3c1c,
+  0x3d4c,
+  0x3d37,
+  0xbda9,
+  0xbd3b,
+  0xbc4a,
+  0xbd16,
+  0xbcb5,
+  0xbcd2,
+  0xbc44,
+  0x3c2e,
+  0x3cdf,
+  0x3c61,
+  0x3d02,
+  0xbbda,
+  0x3d10,
+  0x3cbd,
+  0xbc20,
+  0xbd21,
+  0x3d31,
+  0xba4b,
+  0x3d24,
+  0x3c97,
+  0x3d46,
+  0xbd0e,
+  0x3d25,
+  0x3cf5,
+  0x3c9a,
+  0xbd6b,
+  0x3da5,
+  0x3c8e,
+  0xba98,
+  0xbd24,
+  0x3d97,
+  0xbc43,
+  0xbc01,
+  0x3d04,
+  0x3d1c,
+  0x3d40,
+  0xbd02,
+  0x3d0f,
+  0xbd02,
+  0xbc08,
+  0xbcf4,
+  0x3d80,
+  0xbce1,
+  0x3d48,
+  0x3c22,
+  0xbcb7,
+  0x3ba2,
+  0xbd9a,
+  0x3d5c,
+  0x3c2a,
+  0xbdb7,
+  0xbc29,
+  0x3c35,
+  0xbca3,
+  0x3ce8,
+  0xbd6f,
+  0xbb89,
+  0x3c2a,
+  0x3c43,
+  0xbc49,
+  0x3d89,
+  0xbc92,
+  0xbc5f,
+  0xbcf5,
+  0xbc72,
+  0x38b1,
+  0xbc9b,
+  0x3c71,
+  0xbd31,
+  0xbc42,
+  0xbce5,
+  0x3beb,
+  0x3d65,
+  0x3c87,
+  0x3d45,
+  0x3c46,
+  0xbaf1,
+  0x3bd0,
+  0x3d2d,
+  0xb8e3,
+  0x3cc7,
+  0xbd0d,
+  0xbcba,
+  0xbcee,
+  0x3c21,
+  0x3c5b,
+  0xbbc7,
+  0x3c0d,
+  0x3d30,
+  0x3c0d,
+  0x3c70,
+  0xbc53,
+  0xbd0c,
+  0x3c86,
+  0x3d11,
+  0x3ccc,
+  0xbc63,
+  0xbb8d,
+  0xbd47,
+  0xbca1,
+  0x3c98,
+  0xbce5,
+  0x3d07,
+  0x3bb2,
+  0x3d53,
+  0x3ca2,
+  0xbc73,
+  0x3c85,
+  0x3cb3,
+  0x3ca4,
+  0x3ccc,
+  0xbcf7,
+  0x3cc0,
+  0xbc88,
+  0x3c9f,
+  0xba13,
+  0x3d9a,
+  0x3d4c,
+  0xbd15,
+  0x3cfd,
+  0x3d14,
+  0x3bff,
+  0xbcef,
+  0x3c83,
+  0x3d07,
+  0xbd14,
+  0x3ba6,
+  0x3be4,
+  0x3c82,
+  0x3d1b,
+  0x3c04,
+  0xbca9,
+  0xbc3f,
+  0xbd0c,
+  0x3c63,
+  0x3c70,
+  0xbda8,
+  0x3cfd,
+  0xbc43,
+  0x3d3f,
+  0x3cca,
+  0x3cc7,
+  0x3c23,
+  0x3d66,
+  0x3d3b,
+  0xbd1b,
+  0xbc02,
+  0xbd3f,
+  0x3c5d,
+  0xbaeb,
+  0x3d6f,
+  0xbd6c,
+  0x3c30,
+  0x3c43,
+  0xbafa,
+  0x3d44,
+  0xbd6b,
+  0xbd67,
+  0xbc45,
+  0xbd13,
+  0x3caf,
+  0x3ca9,
+  0xbc74,
+  0x3ca7,
+  0x3cd2,
+  0xbba6,
+  0xb9bb,
+  0x3c8b,
+  0x3c1d,
+  0xbd27,
+  0x3d45,
+  0x3d05,
+  0x3d16,
+  0xbcec,
+  0x3ba3,
+  0x3d3d,
+  0xbca9,
+  0x3bf1,
+  0x3cdb,
+  0xbd82,
+  0xbb97,
+  0xbc49,
+  0x3c9b,
+  0x3ce9,
+  0x3c05,
+  0x3cb8,
+  0x3cb4,
+  0x3ca6,
+  0xbd7f,
+  0x3a87,
+  0xbc67,
+  0xbd84,
+  0xbd0d,
+  0x3c9c,
+  0xbc09,
+  0xbd1f,
+  0x3bff,
+  0x3d6a,
+  0xb905,
+  0xbbf8,
+  0x3b2d,
+  0x3ce8,
+  0xbc09,
+  0xbd3b,
+  0xbd90,
+  0xbb95,
+  0xbc8b,
+  0xbc60,
+  0x3d82,
+  0xbd46,
+  0x3c5f,
+  0x3bdc,
+  0xbbb7,
+  0xbc10,
+  0xbc5b,
+  0x3bda,
+  0x3cb1,
+  0xbb13,
+  0xbb8c,
+  0x3d5f,
+  0xbd57,
+  0xbd40,
+  0xbc06,
+  0xbc31,
+  0xbc75,
+  0xbd8b,
+  0xbc82,
+  0xbcdc,
+  0xbb18,
+  0xbcc2,
+  0x3cbb,
+  0x3ca2,
+  0x3a87,
+  0x3cff,
+  0x3ca1,
+  0xbbb6,
+  0xbc9d,
+  0x3c34,
+  0xbc64,
+  0x3b09,
+  0x39a2,
+  0xbc81,
+  0xbcba,
+  0xbc85,
+  0x3d52,
+  0x3c20,
+  0xbcae,
+  0xbca9,
+  0xbcd9,
+  0xbcd6,
+  0x3c8a,
+  0x3c34,
+  0xbc16,
+  0x3d00,
+  0xbbb3,
+  0x3d21,
+  0xbd07,
+  0x3b0c,
+  0xbdcc,
+  0xbcc2,
+  0xbd0f,
+  0x3ccd,
+  0xbca0,
+  0x3c07,
+  0x39fa,
+  0xbc97,
+  0x3b14,
+  0xbcc5,
+  0x3d08,
+  0xbc7a,
+  0xbb9c,
+  0xbc86,
+  0xbd42,
+  0x3c8d,
+  0xbc5e,
+  0x3ced,
+  0xbd6b,
+  0x3ccb,
+  0xbd5a,
+  0x3dae,
+  0xbce0,
+  0xbc9d,
+  0xbcf4,
+  0xbb71,
+  0xbc2c,
+  0xbd51,
+  0xbd4f,
+  0x3c28,
+  0xbc3a,
+  0xbcf6,
+  0xbd50,
+  0x3be2,
+  0xbd0e,
+  0x3c79,
+  0x3c58,
+  0xbc8d,
+  0x3d0d,
+  0xbc74,
+  0xbccf,
+  0xbd3c,
+  0x3c88,
+  0x3c77,
+  0xbcfa,
+  0xbd6c,
+  0x3c3b,
+  0xbd1e,
+  0x3b38,
+  0xbd49,
+  0xba0e,
+  0x3d20,
+  0xbd18,
+  0xbcd3,
+  0x3c27,
+  0xbc67,
+  0xbd65,
+  0xbd12,
+  0xbc98,
+  0x3ccb,
+  0x3d86,
+  0xbb01,
+  0xbce5,
+  0xbce9,
+  0xba73,
+  0xbbb7,
+  0xbc66,
+  0xbce1,
+  0xbd41,
+  0xbb88,
+  0x3cf3,
+  0x3c92,
+  0xbcb3,
+  0xbd2a,
+  0xbcde,
+  0xbca3,
+  0x3d1b,
+  0x3b8f,
+  0x3d46,
+  0xbc76,
+  0x3c1a,
+  0x3b00,
+  0x3c57,
+  0xbc59,
+  0x3cef,
+  0x3ac0,
+  0x3ba3,
+  0x3a67,
+  0x3cb0,
+  0x3b07,
+  0x3d52,
+  0x3c55,
+  0x3cd6,
+  0x3c56,
+  0xbd3c,
+  0x3d5b,
+  0xbc12,
+  0x3c11,
+  0xbc2f,
+  0xbb85,
+  0xbd06,
+  0x3a70,
+  0xbcef,
+  0xbbc3,
+  0xbcc8,
+  0x3b95,
+  0xbc73,
+  0x3d37,
+  0x3cea,
+  0x3bd1,
+  0xbc9f,
+  0x3d79,
+  0x3cfd,
+  0xbc05,
+  0xbd1f,
+  0x3b7c,
+  0xbb33,
+  0x3cd5,
+  0x3bb2,
+  0x3c87,
+  0xbc37,
+  0xbd73,
+  0x3c75,
+  0xbd06,
+  0xbc35,
+  0x3c51,
+  0xbc3d,
+  0xbd77,
+  0x3d17,
+  0x3ca9,
+  0x3af1,
+  0x3caf,
+  0x3cbc,
+  0x3d42,
+  0xbda1,
+  0x3da4,
+  0xbca3,
+  0x3cbd,
+  0x3b8f,
+  0x3cc5,
+  0x3be5,
+  0x3a90,
+  0xbd06,
+  0x3cc2,
+  0x3d0c,
+  0xbdfd,
+  0xbc3d,
+  0xbca1,
+  0x3cb5,
+  0xbc2e,
+  0x3cf5,
+  0x3c86,
+  0xbcbe,
+  0xbcd0,
+  0xbc07,
+  0x3cf0,
+  0x3ce0,
+  0xb9b8,
+  0xbd0d,
+  0xbd39,
+  0x3c7f,
+  0x3c9b,
+  0x3d07,
+  0x3bf3,
+  0xbd33,
+  0xbd15,
+  0xbc2f,
+  0xbcea,
+  0xbd3a,
+  0xbcf6,
+  0x3d4d,
+  0x3c00,
+  0xbbed,
+  0x3d1c,
+  0xbb82,
+  0x3c8e,
+  0x3d74,
+  0xbc8c,
+  0xbd41,
+  0x3cf5,
+  0xbc02,
+  0x3d03,
+  0xbd54,
+  0x3cea,
+  0xbb6e,
+  0xbc56,
+  0x3d1f,
+  0x3bf4,
+  0x3c3b,
+  0x3b14,
+  0x3c3b,
+  0xbccb,
+  0xbb5d,
+  0xbd0f,
+  0xbc0b,
+  0x3c29,
+  0x3be3,
+  0xbd50,
+  0xbcdb,
+  0xbc8f,
+  0xbce2,
+  0xbd31,
+  0xbbd4,
+  0xbd31,
+  0xbcb8,
+  0x3c97,
+  0xbc9a,
+  0x3b70,
+  0xbc06,
+  0x3ca2,
+  0xbc49,
+  0x3cd9,
+  0x3d24,
+  0x3cbe,
+  0xbd2f,
+  0xbca4,
+  0xbd3b,
+  0x3d95,
+  0x3d19,
+  0xbcf4,
+  0x3c1f,
+  0xbd11,
+  0x3a1f,
+  0x3d3e,
+  0x3cfc,
+  0xbc7e,
+  0x3cbe,
+  0xbc2e,
+  0x3aba,
+  0x3c82,
+  0x3d18,
+  0x3d1c,
+  0x3cc3,
+  0xbc16,
+  0x3c72,
+  0x3d9d,
+  0x3cbb,
+  0xbbfa,
+  0x3c3d,
+  0xbcac,
+  0x3a05,
+  0xbd38,
+  0xbc9e,
+  0xbc89,
+  0xbce1,
+  0xbd00,
+  0xbd12,
+  0xbb40,
+  0x3d01,
+  0x3ca3,
+  0x3c55,
+  0x3c97,
+  0xbbbb,
+  0x3ba3,
+  0x3c95,
+  0xbc5b,
+  0xbceb,
+  0x3d56,
+  0x3ca8,
+  0xbcf4,
+  0xbc7c,
+  0xbc24,
+  0x3d6a,
+  0x3d91,
+  0x3c18,
+  0x39c1,
+  0x3bc8,
+  0x3cc4,
+  0xbc03,
+  0x3c0f,
+  0xbc1a,
+  0xbc25,
+  0xbd35,
+  0x3c39,
+  0xbd11,
+  0x3cb8,
+  0x3c51,
+  0x3ba7,
+  0x3d10,
+  0xbc3b,
+  0xbc4f,
+  0x3c8a,
+  0xbc30,
+  0x3d68,
+  0x3d34,
+  0xbd78,
+  0xbcd8,
+  0xbc8f,
+  0xbb85,
+  0x3c0a,
+  0x3b9b,
+  0xbc50,
+  0x3ac3,
+  0x3d16,
+  0xbb42,
+  0x3c9b,
+  0x3d45,
+  0x3c7f,
+  0xbcf2,
+  0xbd90,
+  0xbc82,
+  0xbc1a,
+  0xbad1,
+  0xbcfb,
+  0xbc83,
+  0xbca9,
+  0x3ceb,
+  0x3c33,
+  0x3b23,
+  0xb985,
+  0x3d15,
+  0x3cf1,
+  0x3c49,
+  0x3d57,
+  0xbc12,
+  0x3b86,
+  0x3c05,
+  0x3c7b,
+  0xbda2,
+  0xbc97,
+  0xbafe,
+  0x3c82,
+  0x3c99,
+  0xbb1f,
+  0xbc45,
+  0x3d07,
+  0xbd20,
+  0x3b08,
+  0xbcb7,
+  0x3b47,
+  0xbd10,
+  0xbc01,
+  0x3c90,
+  0x3d1b,
+  0xbd13,
+  0x3c71,
+  0xbd3a,
+  0xbcbe,
+  0x3ca8,
+  0x3d52,
+  0x3cfc,
+  0xbdb9,
+  0xbcfe,
+  0xbd47,
+  0xbd75,
+  0x3cbd,
+  0xbc5c,
+  0x3d41,
+  0x3c83,
+  0xbc17,
+  0xbb91,
+  0xbd41,
+  0xbcd6,
+  0xbdc9,
+  0xbceb,
+  0xbd0b,
+  0x3ccc,
+  0x3aee,
+  0x3ae9,
+  0x3c72,
+  0xbd3a,
+  0x3d2d,
+  0x3d44,
+  0xbbbc,
+  0xbc98,
+  0xbcdb,
+  0xbd5e,
+  0x3c42,
+  0xbcb6,
+  0xbd0a,
+  0xbbaa,
+  0xbd4a,
+  0xbd12,
+  0xbd21,
+  0x3d33,
+  0x3ca2,
+  0xbc21,
+  0xbd37,
+  0xbd2c,
+  0x3cdd,
+  0x3c63,
+  0xbb39,
+  0x3d24,
+  0xbd84,
+  0x3aee,
+  0xbd88,
+  0xbd0e,
+  0x3c3d,
+  0xbd46,
+  0x3cea,
+  0xbc20,
+  0xbd2d,
+  0x3c98,
+  0xbc36,
+  0x3d2d,
+  0xbd19,
+  0xbc3e,
+  0xbc5e,
+  0xbc68,
+  0x3d1c,
+  0xbd6b,
+  0xbd1d,
+  0xbd3b,
+  0x3d10,
+  0x3cdf,
+  0x3d41,
+  0x3d16,
+  0xbcd1,
+  0x3c63,
+  0xbd84,
+  0x3d6e,
+  0xbd41,
+  0xbd19,
+  0xbd2f,
+  0x3b57,
+  0xbd02,
+  0x3c94,
+  0x3d75,
+  0x3cbf,
+  0xbcbb,
+  0x3d55,
+  0x3cd0,
+  0xbc12,
+  0xbc53,
+  0x3bb6,
+  0xbcc4,
+  0xbca5,
+  0x3c00,
+  0xbd3a,
+  0xbcb6,
+  0xbc58,
+  0x3874,
+  0xbc3c,
+  0x3cf0,
+  0x3d1a,
+  0x3d1e,
+  0xbd51,
+  0xbd68,
+  0xbc3d,
+  0x3ca7,
+  0xbc25,
+  0xbc84,
+  0xbaba,
+  0xbc9f,
+  0xbb3c,
+  0x3cf8,
+  0xbd22,
+  0x3c94,
+  0xbb9f,
+  0x3993,
+  0x3d0c,
+  0x3c91,
+  0xbd4c,
+  0xbcef,
+  0xbc0e,
+  0x3ce3,
+  0xbbe3,
+  0xbd4a,
+  0x3bae,
+  0x3d58,
+  0x3a5e,
+  0x3d78,
+  0x3d49,
+  0xbc33,
+  0x3c89,
+  0x3c72,
+  0xbc8a,
+  0x3d0c,
+  0x3d69,
+  0xbd1b,
+  0xbcb3,
+  0x3cfc,
+  0x3c07,
+  0xbc33,
+  0x3c44,
+  0x3cee,
+  0x3b45,
+  0x37e6,
+  0x3d39,
+  0x3d24,
+  0xbcf0,
+  0x3d37,
+  0x3bc8,
+  0xbb6a,
+  0xbc10,
+  0x3cfd,
+  0x3c5d,
+  0x3beb,
+  0x3d22,
+  0xbcda,
+  0xbcb3,
+  0xbc8e,
+  0xbb7c,
+  0xbd1a,
+  0xbc50,
+  0xbcd6,
+  0x3be1,
+  0xbbdd,
+  0xba8d,
+  0x3d0f,
+  0xbaf1,
+  0x3c15,
+  0xbc27,
+  0x3d44,
+  0x3c5e,
+  0x3bde,
+  0x3c2f,
+  0x3a2f,
+  0x3c2e,
+  0x3c33,
+  0x3cd1,
+  0xbca3,
+  0x3c72,
+  0xbcd2,
+  0x3bf9,
+  0xbcc1,
+  0x3a3c,
+  0xbcc0,
+  0xbb4d,
+  0xbb4a,
+  0x3d0d,
+  0x3b7a,
+  0xbd26,
+  0xbd88,
+  0xbd10,
+  0x3cc3,
+  0x3d65,
+  0xbbbd,
+  0xbc9b,
+  0x3c26,
+  0xbc97,
+  0xbb83,
+  0xbc99,
+  0x3cb3,
+  0xbce7,
+  0xbcc7,
+  0x3ce4,
+  0x3b51,
+  0x3d18,
+  0x3b85,
+  0x3d33,
+  0x3d5f,
+  0x3dc5,
+  0xbb7e,
+  0xbcf1,
+  0x3d89,
+  0x3a94,
+  0x3d2d,
+  0xbd25,
+  0xbc55,
+  0x3c49,
+  0x3c1a,
+  0x3c63,
+  0x3c0e,
+  0xbc78,
+  0xbcb3,
+  0x3d02,
+  0x3ca2,
+  0x3d72,
+  0xbc74,
+  0xbb83,
+  0x3d56,
+  0x3d03,
+  0x3d3c,
+  0xbd29,
+  0xbd09,
+  0x3b65,
+  0xbd1f,
+  0x3d04,
+  0x3c83,
+  0xbcba,
+  0xbc2a,
+  0xbb50,
+  0xbd52,
+  0x3c82,
+  0x38fd,
+  0xbcf5,
+  0xbcaa,
+  0xbc6b,
+  0x3c65,
+  0xbc20,
+  0x3c84,
+  0xbc45,
+  0xbcf9,
+  0x3c1b,
+  0xbce7,
+  0xbcaa,
+  0xb9d0,
+  0xbd45,
+  0xbc8d,
+  0xbcf5,
+  0xbd84,
+  0xbb0f,
+  0xbc25,
+  0xbce0,
+  0x3c7f,
+  0x3d59,
+  0x3d82,
+  0x3bb7,
+  0x3d17,
+  0xba3e,
+  0x3ccf,
+  0x3c90,
+  0x3c50,
+  0xbc92,
+  0x3bf6,
+  0x3ca4,
+  0x3cbd,
+  0x3d40,
+  0xbc1a,
+  0xbb0b,
+  0x3d3e,
+  0x3d17,
+  0xbadb,
+  0x3d36,
+  0xbc65,
+  0x3d81,
+  0x3bc8,
+  0x3d10,
+  0xbd27,
+  0xbce4,
+  0xbd44,
+  0x3d14,
+  0x3c84,
+  0x3d3a,
+  0x3ceb,
+  0xbc87,
+  0xbba8,
+  0xbd49,
+  0x3b4a,
+  0xbbdd,
+  0x3d0f,
+  0xbd1f,
+  0x3d3f,
+  0x3cb1,
+  0x3c10,
+  0x3cd7,
+  0xbc52,
+  0x3d5a,
+  0x3cd0,
+  0xbd7c,
+  0x3bd3,
+  0xbc94,
+  0xbd4c,
+  0x3ab1,
+  0x3d1c,
+  0xbd45,
+  0x3cc2,
+  0x3c03,
+  0x3ca0,
+  0xbd2d,
+  0x3d6a,
+  0xbc9d,
+  0xbd27,
+  0xbd08,
+  0x3d25,
+  0x3c09,
+  0x3d08,
+  0x3cae,
+  0x3cbf,
+  0xbcf2,
+  0x3d2d,
+  0x3b89,
+  0xbbf1,
+  0x3c11,
+  0xbc26,
+  0x3c74,
+  0x3d0a,
+  0xbbb6,
+  0xb9cc,
+  0xbcdc,
+  0x3d33,
+  0x3d13,
+  0x3b34,
+  0xbcb2,
+  0x3ca1,
+  0x3bc9,
+  0xbc06,
+  0xbc81,
+  0x3cbe,
+  0xbd03,
+  0x3d2e,
+  0x3ce3,
+  0xbade,
+  0x3ce0,
+  0xbd05,
+  0xbc5e,
+  0xbcd4,
+  0xbd11,
+  0xbcd4,
+  0xbcaf,
+  0xbb96,
+  0xbc47,
+  0xba80,
+  0x3d6f,
+  0x3c67,
+  0xbd22,
+  0xbd4b,
+  0xbcc4,
+  0xbced,
+  0xbc8a,
+  0x3d0c,
+  0x3972,
+  0xbcdc,
+  0xbcdd,
+  0x3d54,
+  0x3c0c,
+  0x3d21,
+  0xbc4b,
+  0x3cac,
+  0x3d01,
+  0x3ce5,
+  0x3cca,
+  0xbd0f,
+  0xbcc2,
+  0xbd10,
+  0xbcc2,
+  0xbba0,
+  0xbac7,
+  0x3d2b,
+  0x3cda,
+  0x3c31,
+  0xbc84,
+  0x3bf3,
+  0x3c66,
+  0xbd89,
+  0x3b96,
+  0x3b8f,
+  0x3bae,
+  0xbd26,
+  0x3cbf,
+  0x3c6a,
+  0xbba7,
+  0x3c2e,
+  0x3c76,
+  0xba89,
+  0xbc6e,
+  0x3c36,
+  0xbacc,
+  0xbd24,
+  0xbd25,
+  0x398d,
+  0x3c6a,
+  0xbd0a,
+  0xbb52,
+  0x3d54,
+  0x3d33,
+  0x3cb4,
+  0xbd6a,
+  0x3c96,
+  0xbd16,
+  0xbbaf,
+  0xb94b,
+  0xbc8c,
+  0xbcc9,
+  0xbc7f,
+  0x3b33,
+  0x3cfc,
+  0x3cb9,
+  0x3d01,
+  0x3d17,
+  0x3c3a,
+  0xbc45,
+  0xbd30,
+  0x3c43,
+  0x3bc6,
+  0x3c73,
+  0x3d13,
+  0x3c23,
+  0xbd13,
+  0xba49,
+  0xbc69,
+  0xbc16,
+  0x3cc5,
+  0xbc37,
+  0xbca2,
+  0x3d44,
+  0xbc27,
+  0xbcf9,
+  0x3cd1,
+  0xbcf1,
+  0xbc2e,
+  0xbcd4,
+  0xbcb5,
+  0xbba5,
+  0x3db5,
+  0xbca8,
+  0x3cd6,
+  0xbc8d,
+  0x3c93,
+  0x3c5f,
+  0xbc25,
+  0x3c34,
+  0x3d20,
+  0x3d0f,
+  0xbcbb,
+  0x3cc9,
+  0xbcce,
+  0xbd13,
+  0xbcd9,
+  0xbb19,
+  0x3ccb,
+  0xbd8b,
+  0xbd4e,
+  0xbd38,
+  0xbd44,
+  0xbc59,
+  0x3d42,
+  0x3d61,
+  0x3c88,
+  0x3d26,
+  0xb9cd,
+  0x3aa5,
+  0x3c3e,
+  0xbc8b,
+  0xbc07,
+  0x3cb2,
+  0x3d23,
+  0x3cdb,
+  0xbc63,
+  0x3cb8,
+  0xbb8e,
+  0xbd15,
+  0x3d59,
+  0xbcd0,
+  0xba98,
+  0x3cd5,
+  0x3c42,
+  0x3d79,
+  0x3c10,
+  0x3cc4,
+  0xbcec,
+  0xbd7a,
+  0xbbd8,
+  0xbd1a,
+  0xbc93,
+  0x3cd1,
+  0xbcd4,
+  0xbcaf,
+  0xbcb2,
+  0x3c21,
+  0x3b76,
+  0x3d62,
+  0xbc6e,
+  0x3d62,
+  0xbbe4,
+  0x3c72,
+  0xbc1b,
+  0x3d2c,
+  0xbc25,
+  0x3c9d,
+  0xbca5,
+  0x3be4,
+  0xbc5e,
+  0xbccd,
+  0xbd2f,
+  0x3c91,
+  0x3ce6,
+  0xbc3b,
+  0xbcba,
+  0x3ce0,
+  0x39f1,
+  0xbd51,
+  0x3d4b,
+  0xbd25,
+  0xbd36,
+  0xbd2c,
+  0xbd90,
+  0xbae1,
+  0x3d09,
+  0x3d62,
+  0x3d25,
+  0xbc1f,
+  0xbd91,
+  0x3c98,
+  0x3c1e,
+  0xbcf0,
+  0x3cc7,
+  0xbca0,
+  0xbc0f,
+  0xbc30,
+  0xbca3,
+  0xbd56,
+  0x3c1d,
+  0x3d29,
+  0x3cd7,
+  0xbd58,
+  0xbc21,
+  0xbd5b,
+  0xbb43,
+  0xbcc0,
+  0xbcf9,
+  0x3bbd,
+  0x3d27,
+  0x3c38,
+  0xbcc9,
+  0xb932,
+  0x3d44,
+  0x3c75,
+  0xb98b,
+  0x3d53,
+  0x3b24,
+  0x3cf2,
+  0x3cfe,
+  0x3c7d,
+  0xbc09,
+  0x3d49,
+  0xbd6c,
+  0x3cab,
+  0xbd04,
+  0xbc0f,
+  0x39fc,
+  0x3b17,
+  0xbbb2,
+  0x3c9a,
+  0xbd95,
+  0x3b54,
+  0x3d03,
+  0x3d30,
+  0xbb9a,
+  0xbb86,
+  0xbd79,
+  0xbc41,
+  0xbd83,
+  0x3c8f,
+  0x3beb,
+  0xbc83,
+  0x3ba7,
+  0x3c95,
+  0xbd20,
+  0x3d64,
+  0xbc4a,
+  0xbd36,
+  0x3d26,
+  0x3cb1,
+  0x3d28,
+  0x3d4f,
+  0x3cc5,
+  0x39b2,
+  0x3d28,
+  0xbb8a,
+  0xbd64,
+  0xbd6e,
+  0x3703,
+  0xbc1e,
+  0xbd56,
+  0xbc9c,
+  0xbd3b,
+  0x3d4e,
+  0xbd10,
+  0x3907,
+  0xbd1e,
+  0xbd40,
+  0xbc72,
+  0xbbbd,
+  0xbcad,
+  0x3d62,
+  0xbd02,
+  0xbd20,
+  0xbbb8,
+  0x3d2e,
+  0xbcda,
+  0xbb18,
+  0xbcde,
+  0xbcd2,
+  0x3c73,
+  0x3c2a,
+  0xbd04,
+  0xbd24,
+  0x3b83,
+  0xbca3,
+  0xbcaf,
+  0x3bdf,
+  0xbb4e,
+  0x3c93,
+  0xbd61,
+  0x3a07,
+  0x3a0e,
+  0x3cf0,
+  0xbbe8,
+  0x3cea,
+  0xbaa9,
+  0x3b4b,
+  0x3d27,
+  0xbd42,
+  0xbcb0,
+  0xbd83,
+  0x3c05,
+  0xbc88,
+  0x3d39,
+  0x3cec,
+  0x3c7a,
+  0xbc2b,
+  0xbd31,
+  0xbc11,
+  0xbd30,
+  0xbd0e,
+  0x3d06,
+  0x3d2d,
+  0x3bfd,
+  0x3d03,
+  0x3ca5,
+  0xbb39,
+  0x3c23,
+  0xbc2a,
+  0xbc1a,
+  0x3cf6,
+  0xbca8,
+  0x3ccc,
+  0xbc49,
+  0x3ccc,
+  0x3d20,
+  0x3cb4,
+  0xbb61,
+  0x3c28,
+  0x3c8e,
+  0x3d04,
+  0x3a26,
+  0xbd0c,
+  0xbd4c,
+  0xbd89,
+  0x3d23,
+  0x3d23,
+  0xbc9d,
+  0xbc1f,
+  0xbd2f,
+  0x3ca4,
+  0x3cbc,
+  0x3cfe,
+  0xbcb3,
+  0x3d10,
+  0x3cf7,
+  0x3d3a,
+  0x3cc8,
+  0x3c3c,
+  0x3c92,
+  0xbd38,
+  0xbaca,
+  0xbd1e,
+  0x3c38,
+  0xbd62,
+  0xbd20,
+  0xbcad,
+  0x3cd7,
+  0x3b5f,
+  0xbb09,
+  0x3aa7,
+  0xbc82,
+  0xbc92,
+  0x3c28,
+  0x3d20,
+  0x3c01,
+  0xbcc2,
+  0xbd2a,
+  0xbc83,
+  0x3c92,
+  0xbbb9,
+  0xbcc5,
+  0xbbd4,
+  0x3b9f,
+  0xbd3f,
+  0xbbfe,
+  0xbb60,
+  0xbc24,
+  0xbc6d,
+  0xbcc1,
+  0x3d1a,
+  0xbcb5,
+  0xbc5f,
+  0x3724,
+  0x3ca1,
+  0x3d2d,
+  0x3d1c,
+  0xbd19,
+  0xbd52,
+  0x3b9e,
+  0x3cc1,
+  0x3d3f,
+  0x3ca6,
+  0x3a9e,
+  0xbc3e,
+  0x3caa,
+  0xbc72,
+  0x3ba4,
+  0x3cbe,
+  0x3c6e,
+  0xbb5e,
+  0xbd18,
+  0xbcc9,
+  0x3d54,
+  0xbc16,
+  0xbbdf,
+  0xbcac,
+  0xbd4e,
+  0xbd05,
+  0x3c8a,
+  0x3d37,
+  0xbc99,
+  0xbcad,
+  0xbd4c,
+  0xbc93,
+  0x3bca,
+  0xbc5d,
+  0x3c42,
+  0xbd49,
+  0xbce6,
+  0xbc5c,
+  0xbbed,
+  0xbd30,
+  0xbc95,
+  0x3c7f,
+  0xbd15,
+  0xbd51,
+  0xbc1a,
+  0xbc3d,
+  0x3c04,
+  0xbc6e,
+  0x3b1b,
+  0xbb7d,
+  0xbc48,
+  0xbb64,
+  0x3c0c,
+  0x3d24,
+  0x3c0c,
+  0xbd0e,
+  0x3cc7,
+  0xbd18,
+  0x3d35,
+  0xbc1c,
+  0x3ab0,
+  0x3c98,
+  0xbd0a,
+  0x3d14,
+  0xbd25,
+  0x3baa,
+  0x3c76,
+  0xbd1a,
+  0xbca6,
+  0xbbec,
+  0xbcf8,
+  0xbd4b,
+  0x3ba1,
+  0xbb86,
+  0xbbdf,
+  0x3bc6,
+  0xbd0c,
+  0xbc28,
+  0xbd6e,
+  0x3d0b,
+  0x3cb1,
+  0xbc4d,
+  0x3cb9,
+  0x3d1f,
+  0x3aae,
+  0x3cd3,
+  0xbc16,
+  0x3c20,
+  0x3d07,
+  0xbcd6,
+  0xbd35,
+  0xbc1e,
+  0x3cbd,
+  0x3ba4,
+  0xbc80,
+  0x3bcf,
+  0x3cdf,
+  0x3d21,
+  0x3c39,
+  0xbc8c,
+  0x3d29,
+  0xbc3a,
+  0xbca2,
+  0xbc98,
+  0x3cb7,
+  0xbce3,
+  0xbcd0,
+  0xbbc8,
+  0x3d13,
+  0x3d2e,
+  0xbcb4,
+  0xbc08,
+  0x3ce9,
+  0x3cce,
+  0x3b81,
+  0x3cb1,
+  0xbc79,
+  0xbca6,
+  0xbd5d,
+  0xbb8d,
+  0x3ca9,
+  0x3b3a,
+  0x3cad,
+  0xbd84,
+  0xbd83,
+  0x3c9d,
+  0x3d34,
+  0x3cd3,
+  0x3cac,
+  0xbc59,
+  0x3c15,
+  0x3cf2,
+  0xbd20,
+  0x3ca9,
+  0xba86,
+  0x3d1b,
+  0x3c75,
+  0xbc86,
+  0xbc22,
+  0xbd4d,
+  0xbd8a,
+  0xbd0d,
+  0xbb79,
+  0x3ccd,
+  0x3d05,
+  0x3b80,
+  0xbcb1,
+  0xbc42,
+  0x3b3d,
+  0xbcc5,
+  0xbd03,
+  0xbcac,
+  0x3ac9,
+  0x3b93,
+  0xbd48,
+  0xbcf5,
+  0xb8d3,
+  0x3d5b,
+  0x3a5f,
+  0x3d6b,
+  0xbd08,
+  0xbc96,
+  0x3bac,
+  0xbd93,
+  0x3ccb,
+  0xbbf6,
+  0xbb16,
+  0xbc7b,
+  0x3d03,
+  0x3cd8,
+  0x3bf1,
+  0x3c11,
+  0xbd1a,
+  0x3d4b,
+  0x3cb9,
+  0xbba7,
+  0xb7ea,
+  0xbc3d,
+  0xbbca,
+  0xbccc,
+  0xbcaf,
+  0xbc4e,
+  0x3b79,
+  0x3d2a,
+  0xbbf9,
+  0x3d62,
+  0xbd0d,
+  0xbd5d,
+  0x3c2d,
+  0x3ce5,
+  0x3c59,
+  0xbcdf,
+  0xbac8,
+  0x3d2e,
+  0x3d30,
+  0x3d26,
+  0xbd6d,
+  0xba21,
+  0xbd4f,
+  0xbc86,
+  0xbcab,
+  0x3c4f,
+  0xbb83,
+  0xbd24,
+  0x3b74,
+  0xbc9c,
+  0xbd7d,
+  0x3c0d,
+  0x3d3f,
+  0x3b61,
+  0xb9ba,
+  0xbcb5,
+  0x3d0d,
+  0x3d40,
+  0xbd02,
+  0xbca8,
+  0xbc2b,
+  0xbd00,
+  0xbbaa,
+  0x3d73,
+  0x3d0f,
+  0x3cc5,
+  0xbc13,
+  0xbbc6,
+  0xbbb9,
+  0x3aa9,
+  0xbd41,
+  0x3b2e,
+  0x3d11,
+  0x3cb5,
+  0x3c5d,
+  0xbcad,
+  0xbcab,
+  0x3b13,
+  0xbc67,
+  0x39a3,
+  0x3d0a,
+  0xbd7c,
+  0xbd35,
+  0x3bb7,
+  0xbcc9,
+  0x3adf,
+  0xba47,
+  0xbb88,
+  0x3a0f,
+  0x3c92,
+  0x3cdf,
+  0x3c85,
+  0x3d1b,
+  0x3cef,
+  0x3c58,
+  0xbca2,
+  0xbb93,
+  0xbd13,
+  0xbc83,
+  0x3c9c,
+  0x3c17,
+  0xbd5c,
+  0xbb91,
+  0xbd0d,
+  0xbb46,
+  0xbd16,
+  0xbd84,
+  0x3cd4,
+  0xbd06,
+  0xbc2b,
+  0x3cbe,
+  0xbd24,
+  0x3cf3,
+  0xbc9d,
+  0xbd03,
+  0x3c05,
+  0xbbd8,
+  0xba84,
+  0xbc01,
+  0xbca3,
+  0xbcad,
+  0xbbbe,
+  0x3d7a,
+  0x3c69,
+  0x3bc2,
+  0xbbf4,
+  0xbc27,
+  0x3c1c,
+  0xbc6e,
+  0xbcd7,
+  0xbc09,
+  0xbced,
+  0x3d7d,
+  0xbca3,
+  0x3d28,
+  0xbc93,
+  0x3c29,
+  0x3c4c,
+  0xbcc9,
+  0x3a53,
+  0xbcca,
+  0x3cda,
+  0x3d7e,
+  0x3ca8,
+  0x3cae,
+  0xbd1d,
+  0xbcf3,
+  0x3a8b,
+  0xbc71,
+  0x3be8,
+  0x3d57,
+  0x3b23,
+  0x3d6a,
+  0x3d13,
+  0x3bac,
+  0xbd11,
+  0x3b8d,
+  0xbd0b,
+  0x3d02,
+  0xbcdc,
+  0xbcac,
+  0x3c46,
+  0xbb95,
+  0x3d8d,
+  0x3ca7,
+  0xbd34,
+  0xbc8d,
+  0x3b7e,
+  0xbd3c,
+  0xbcde,
+  0xbc51,
+  0x3d65,
+  0x3c02,
+  0x3b38,
+  0xbd92,
+  0xbc1d,
+  0x3c09,
+  0xbd4d,
+  0xbcd1,
+  0xbd2c,
+  0x3c49,
+  0xbc8d,
+  0x3d20,
+  0x3d6b,
+  0xbcbf,
+  0xbd19,
+  0x3c8c,
+  0xbc21,
+  0xbd14,
+  0x3c1c,
+  0x3d6b,
+  0xbd35,
+  0x3d91,
+  0x3ca0,
+  0x3be3,
+  0x3cee,
+  0xbceb,
+  0xbbf7,
+  0x3d0f,
+  0x3cfb,
+  0x3c5d,
+  0xbcaa,
+  0xbbc1,
+  0x3c81,
+  0xbd3b,
+  0x3d78,
+  0x3c9a,
+  0x3ce4,
+  0x3cb6,
+  0x3b24,
+  0xbc83,
+  0x3cf9,
+  0xbd31,
+  0x3cf8,
+  0x3d5a,
+  0x3dcd,
+  0x3cdc,
+  0x3d33,
+  0x3c48,
+  0xbbff,
+  0x3d01,
+  0xbcd8,
+  0xb8f5,
+  0x3cf7,
+  0x3ca0,
+  0x3c3a,
+  0x3cb2,
+  0x3d52,
+  0x3d3e,
+  0x3c22,
+  0xbc5d,
+  0xbc60,
+  0xbc26,
+  0x3ced,
+  0xbcd4,
+  0xbcbe,
+  0x3d2c,
+  0xbd8a,
+  0x3c2e,
+  0x3d0f,
+  0x3c22,
+  0x3bd1,
+  0x3c32,
+  0xbcd0,
+  0x3a83,
+  0x3d1b,
+  0xbd17,
+  0xbc11,
+  0x3ce0,
+  0xbd34,
+  0xbd46,
+  0x3b7f,
+  0xbd10,
+  0xbc9d,
+  0xbc6e,
+  0xbcd9,
+  0xbc22,
+  0xbcd6,
+  0xbd86,
+  0xbbc0,
+  0xbcd1,
+  0x3d14,
+  0xbcf8,
+  0x3d0d,
+  0x3d0f,
+  0xba34,
+  0x3ce9,
+  0xbd2e,
+  0xbce0,
+  0x3d24,
+  0xbd16,
+  0x3d42,
+  0xbcee,
+  0x3b97,
+  0x3c2a,
+  0xbc77,
+  0xbcef,
+  0xbceb,
+  0xbd10,
+  0x3cca,
+  0xbcc4,
+  0xbd33,
+  0x3c21,
+  0x3d37,
+  0x3b40,
+  0x3be6,
+  0xbd82,
+  0x3bca,
+  0xbc40,
+  0xbd15,
+  0xbd57,
+  0xbd32,
+  0x3a12,
+  0xbc80,
+  0x3cca,
+  0xbcc9,
+  0xbcf1,
+  0x3a4c,
+  0xbcb6,
+  0x3cc2,
+  0x3cef,
+  0x3d4e,
+  0x3c5d,
+  0x3d51,
+  0x3d80,
+  0x3c7d,
+  0x3d01,
+  0x3d54,
+  0xbd61,
+  0xbba4,
+  0x3d0d,
+  0xbca7,
+  0x3c24,
+  0x3a2a,
+  0xbbf3,
+  0xbced,
+  0x3b61,
+  0x3d28,
+  0x3d9f,
+  0xbc09,
+  0x3c6b,
+  0x3c9e,
+  0x3c9c,
+  0xbd4e,
+  0xbce6,
+  0xbcbf,
+  0x3d3f,
+  0xbb9d,
+  0xbd56,
+  0xbd85,
+  0x3bbe,
+  0xbc4e,
+  0x3c74,
+  0x3d0a,
+  0x3c9f,
+  0xbcd8,
+  0xbcb8,
+  0x3d03,
+  0xbc59,
+  0xbc5d,
+  0xbb91,
+  0xbd66,
+  0xbccf,
+  0xbc63,
+  0xbd6b,
+  0xbc97,
+  0x3b2d,
+  0xbc21,
+  0x3d9c,
+  0xbcc3,
+  0xbba8,
+  0x3a45,
+  0x3d1b,
+  0x3bde,
+  0x39b7,
+  0xbc31,
+  0xbbe4,
+  0x3b58,
+  0xbd02,
+  0xbc57,
+  0x3c9a,
+  0x3d0a,
+  0xbd66,
+  0xbc9e,
+  0xbcd8,
+  0x3d98,
+  0xbd22,
+  0xbd09,
+  0x3d60,
+  0x3c1a,
+  0xbc05,
+  0x3bf6,
+  0xbb21,
+  0xbc19,
+  0x3d95,
+  0xbc8b,
+  0x39c4,
+  0xbd73,
+  0x3d3c,
+  0xbd2c,
+  0x3b8a,
+  0x3d0e,
+  0x3c31,
+  0x3a51,
+  0x3d27,
+  0x3cde,
+  0xbd0c,
+  0xbc8a,
+  0xbcc9,
+  0xbb92,
+  0xbd14,
+  0x38c7,
+  0xbd26,
+  0x3c98,
+  0x3d03,
+  0xbd03,
+  0xbcae,
+  0xbce9,
+  0xbcbb,
+  0xbd80,
+  0x3c05,
+  0x3cf4,
+  0x3d02,
+  0x3c99,
+  0x3d43,
+  0x3c89,
+  0x3baa,
+  0xbc8c,
+  0xbc46,
+  0x3c8b,
+  0x3ba7,
+  0x3d32,
+  0xbafa,
+  0xbd36,
+  0x3cca,
+  0xbd87,
+  0x3ce1,
+  0xb7dc,
+  0xbccd,
+  0x3d0f,
+  0xbc0c,
+  0x3d8b,
+  0xbc13,
+  0x3c58,
+  0xbd8e,
+  0x3cb9,
+  0x3d17,
+  0x3ce0,
+  0x3d6f,
+  0xbc96,
+  0xbada,
+  0xbbe6,
+  0x3d15,
+  0x3c5f,
+  0x3b99,
+  0x3b88,
+  0xbd1a,
+  0x3c56,
+  0x39fe,
+  0xbd61,
+  0xbcd9,
+  0x3b9d,
+  0xbb12,
+  0x3bb2,
+  0xbd1f,
+  0xbc0b,
+  0x3c66,
+  0x3cc3,
+  0xbc78,
+  0xbc00,
+  0xbcff,
+  0xbd38,
+  0xbb9f,
+  0xbc32,
+  0x3d17,
+  0xbbf0,
+  0x3bf0,
+  0xbca3,
+  0xbd88,
+  0x3ba4,
+  0x3da7,
+  0xbd01,
+  0xbd2c,
+  0xbcde,
+  0xbd07,
+  0x3dac,
+  0x3d21,
+  0xbd11,
+  0xbcc5,
+  0xbcab,
+  0x3d3e,
+  0xbc99,
+  0x3bcc,
+  0xbcef,
+  0xbd54,
+  0xbb2a,
+  0x3ce0,
+  0x3d70,
+  0x3d08,
+  0x3ce8,
+  0x3c81,
+  0x3ce3,
+  0x3d9c,
+  0x3ccf,
+  0x3d1c,
+  0xbbd6,
+  0x3b43,
+  0x3b4c,
+  0xbac7,
+  0xbc5c,
+  0x3c51,
+  0xbd31,
+  0xbc0b,
+  0xbb38,
+  0x3be2,
+  0xbb50,
+  0x3bc9,
+  0xbc43,
+  0x3bed,
+  0x3cf9,
+  0xbd82,
+  0xbd55,
+  0xbd09,
+  0xbca8,
+  0x3c79,
+  0x3c59,
+  0xbd4f,
+  0x3c38,
+  0xbd3f,
+  0x3cbd,
+  0x3ccb,
+  0x3c07,
+  0xbc86,
+  0x3cad,
+  0xbcd7,
+  0x3d7a,
+  0x3b1e,
+  0x3bcd,
+  0x3d54,
+  0xbca3,
+  0xbcb9,
+  0xbbcc,
+  0x3c0b,
+  0xbd79,
+  0xbc5d,
+  0xbb01,
+  0x3d11,
+  0xbc02,
+  0xbd27,
+  0xbc44,
+  0xbc8d,
+  0xbbc3,
+  0xbd2f,
+  0x3d82,
+  0x3c40,
+  0x3c23,
+  0x3d15,
+  0xbd06,
+  0xbd61,
+  0xbd40,
+  0x3c83,
+  0x3bc2,
+  0x3b95,
+  0x3bc0,
+  0xbc34,
+  0x3d01,
+  0xbcaf,
+  0xbd36,
+  0x3d57,
+  0x3cea,
+  0x3c3f,
+  0xbc66,
+  0xbd8a,
+  0xbd18,
+  0x3ca7,
+  0x3d13,
+  0xbb1a,
+  0xbb85,
+  0xbc8e,
+  0x3c57,
+  0x3c9b,
+  0x3d56,
+  0x3d1c,
+  0x3ce9,
+  0xbc76,
+  0x3d5c,
+  0xbcae,
+  0xbc5f,
+  0xbcbb,
+  0xbc0c,
+  0xbd87,
+  0xbd19,
+  0x3d81,
+  0xbd29,
+  0xbbf3,
+  0xbbf0,
+  0x3ca8,
+  0xbc77,
+  0x3d82,
+  0xbcd8,
+  0xbc94,
+  0x3b2d,
+  0xbc3c,
+  0xbd77,
+  0xbc72,
+  0xbb45,
+  0x3b46,
+  0xbd8d,
+  0x3c6f,
+  0xba82,
+  0x3cfe,
+  0x3b4c,
+  0xbb03,
+  0xbc94,
+  0xbcd6,
+  0xbcb2,
+  0x3c2b,
+  0xbbe7,
+  0x3cc2,
+  0x3c9d,
+  0x3c3a,
+  0x3cef,
+  0x3d30,
+  0xbcaf,
+  0x3d83,
+  0x3d48,
+  0x3d88,
+  0xbbb8,
+  0x3ab0,
+  0x3d2b,
+  0x3d44,
+  0xbc53,
+  0xbd4a,
+  0xbbce,
+  0x3c88,
+  0xbc0e,
+  0xbd22,
+  0x3c9e,
+  0x3ca5,
+  0x3a88,
+  0x3d8b,
+  0xbd0a,
+  0x385c,
+  0x3c99,
+  0x3c8b,
+  0xbcbb,
+  0xbc63,
+  0x3ae3,
+  0xbc62,
+  0x3d68,
+  0x3c8c,
+  0xbcb6,
+  0x3cc4,
+  0x3d2f,
+  0x3be3,
+  0xbd4f,
+  0x3d8d,
+  0xbd98,
+  0x3c31,
+  0x3c70,
+  0xbca3,
+  0xbcbd,
+  0xbcb3,
+  0x3d13,
+  0x3d11,
+  0x3a60,
+  0x3b04,
+  0xbce8,
+  0xbd4c,
+  0xbc6b,
+  0x3b89,
+  0x3ceb,
+  0xbcc6,
+  0xbca9,
+  0x3be2,
+  0x3d1b,
+  0x3d67,
+  0x3c82,
+  0xbbc7,
+  0xbcce,
+  0xbc4d,
+  0xbc3a,
+  0xbc6f,
+  0xbd1e,
+  0xbc6f,
+  0x3c77,
+  0x3cfc,
+  0xbc86,
+  0xbd04,
+  0xbc18,
+  0x3d20,
+  0x3c9b,
+  0x3d54,
+  0x3835,
+  0xbcda,
+  0x3cf0,
+  0xbd58,
+  0xbce4,
+  0xbd3c,
+  0xbc89,
+  0x3ce0,
+  0xbbcd,
+  0x3b2d,
+  0x3b9b,
+  0xbd32,
+  0x3cf2,
+  0xbcac,
+  0x3bae,
+  0xbd07,
+  0xbd88,
+  0x3d5b,
+  0x3aab,
+  0xbcba,
+  0xbc79,
+  0x3bc7,
+  0x3d75,
+  0xbbf5,
+  0xbc2e,
+  0xbcac,
+  0x3d40,
+  0xbc80,
+  0xbd8f,
+  0xbda2,
+  0x3d26,
+  0x3c43,
+  0xbcf9,
+  0xbd74,
+  0xbb24,
+  0x3d64,
+  0xbc95,
+  0x3d99,
+  0xbca7,
+  0x3cd8,
+  0x3c23,
+  0xbcd1,
+  0xbcea,
+  0xbd3d,
+  0xbd52,
+  0x3d2b,
+  0xbcd6,
+  0xbcd6,
+  0xbd0d,
+  0x3c3b,
+  0x3c37,
+  0x3c9c,
+  0xbc9e,
+  0x3d7d,
+  0x3c90,
+  0x3d10,
+  0x3d63,
+  0x3c10,
+  0xbc44,
+  0xbcd3,
+  0x3be6,
+  0x3d0b,
+  0x3c9b,
+  0xbc89,
+  0xbc98,
+  0x3cd8,
+  0xbd33,
+  0xbd5f,
+  0xbb54,
+  0x3cc5,
+  0x3c8c,
+  0xbd2e,
+  0xbc21,
+  0x3d4d,
+  0xba9d,
+  0xbca8,
+  0xbcdb,
+  0xbb40,
+  0xbcfe,
+  0xbc9c,
+  0xbb89,
+  0xbc27,
+  0xbd5e,
+  0xbd8f,
+  0x3d34,
+  0xbce6,
+  0xbca6,
+  0x3b7d,
+  0xbb51,
+  0xbd36,
+  0x3db1,
+  0x3c29,
+  0xbc1b,
+  0xbc76,
+  0xbcb2,
+  0xbd7a,
+  0xbda3,
+  0xbccd,
+  0xbb01,
+  0x3c0e,
+  0xbc95,
+  0x3cd8,
+  0x3b6f,
+  0xbdf4,
+  0xbca4,
+  0x3d87,
+  0xbcd9,
+  0xbd9d,
+  0x3b8e,
+  0x3bef,
+  0xbd0c,
+  0x3d3f,
+  0x3b71,
+  0xbca7,
+  0xbd20,
+  0xbd59,
+  0x3cad,
+  0x3d12,
+  0x3bcb,
+  0x3c40,
+  0x3c8e,
+  0xbc44,
+  0xbc8f,
+  0xbd57,
+  0xbca1,
+  0xbce9,
+  0x3d65,
+  0xbcc3,
+  0x3c81,
+  0x3ab0,
+  0xbc82,
+  0xbc3f,
+  0x3cd2,
+  0x3c99,
+  0x3c84,
+  0x3ba1,
+  0x3d2c,
+  0xbc64,
+  0x3ccc,
+  0xbc8b,
+  0xbca5,
+  0xbd25,
+  0xbce8,
+  0x3c18,
+  0xbd15,
+  0xbc5e,
+  0xbd72,
+  0xbceb,
+  0xbcdd,
+  0x3d33,
+  0xbd1e,
+  0x3cba,
+  0xbc81,
+  0xbb2a,
+  0xbcb9,
+  0x3d31,
+  0x3d53,
+  0x3bfd,
+  0x3cc2,
+  0xbd4e,
+  0xbd32,
+  0x3c52,
+  0xbd84,
+  0x3c54,
+  0x3c4a,
+  0xbb26,
+  0xbc95,
+  0x3cac,
+  0xbdf2,
+  0xbb41,
+  0xbc5b,
+  0xbd43,
+  0x3b7a,
+  0xbbef,
+  0xbd76,
+  0x3d45,
+  0xba62,
+  0xbc3b,
+  0xbd05,
+  0xbc96,
+  0xbcc4,
+  0x3d14,
+  0xbc9c,
+  0xbc1f,
+  0x3c4e,
+  0xbc18,
+  0xbd03,
+  0xbcb3,
+  0x3cf6,
+  0x3bb6,
+  0x3d20,
+  0x3d50,
+  0xbce6,
+  0xbaf9,
+  0x3d02,
+  0xbc9b,
+  0xbd12,
+  0xbcf7,
+  0xbd54,
+  0xbc14,
+  0x3d0b,
+  0xbc9d,
+  0x3d1b,
+  0xbc40,
+  0xbd5d,
+  0x3ca8,
+  0xbcfb,
+  0xbb9b,
+  0x3d90,
+  0xb876,
+  0xbb6f,
+  0xbd4c,
+  0x3c6e,
+  0xbd5e,
+  0xbc70,
+  0xbb97,
+  0x3b81,
+  0xbd2e,
+  0xbd4a,
+  0x3ca3,
+  0xbd78,
+  0x3b1d,
+  0x3be6,
+  0xbc35,
+  0xbd7a,
+  0xbc98,
+  0x3cc2,
+  0x3c70,
+  0xbc06,
+  0x3cdf,
+  0x3d52,
+  0xbcaf,
+  0xbd0d,
+  0x3d87,
+  0x3ba1,
+  0xbca8,
+  0x3d3a,
+  0xbb93,
+  0x3cc5,
+  0xba9b,
+  0x3cd6,
+  0xbaee,
+  0xbc93,
+  0xbb11,
+  0x3d50,
+  0x3b7b,
+  0xbc37,
+  0xbd4e,
+  0x3d3a,
+  0xbcc2,
+  0x3c91,
+  0xbc4f,
+  0x3c16,
+  0xbd42,
+  0x3c8b,
+  0xbd03,
+  0x3cb5,
+  0x3d7f,
+  0xbd28,
+  0x3cfc,
+  0x3cd8,
+  0xbcb8,
+  0xbc3d,
+  0xbcb6,
+  0x3c35,
+  0xbbfc,
+  0x3d84,
+  0xbcd5,
+  0xbcca,
+  0x3d88,
+  0x3d78,
+  0xbcb9,
+  0x3c82,
+  0xbc05,
+  0x3cc2,
+  0x3be0,
+  0xbc63,
+  0xbc66,
+  0xbd9b,
+  0xbb0c,
+  0x3c9a,
+  0xbcbb,
+  0x3c3e,
+  0x3c82,
+  0xbcc8,
+  0x3bf4
+};
+#endif
+#else
+const q15_t __in_weights_q15[] = {
+  -3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  -3277,
+  -3277,
+  3277,
+  -3277,
+  -3277,
+  3277,
+  3277,
+  -3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  -3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  -3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  3277,
+  -3277,
+  3277,
+  3277,
+  -3277,
+  -3277,
+  -3277,
+  3277,
+  3277,
+  -3277,
+  3277,
+  -3277,
+  -3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  -3277,
+  -3277,
+  3277,
+  -3277,
+  -3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  -3277,
+  3277,
+  3277,
+  -3277,
+  3277,
+  -3277,
+  3277,
+  -3277,
+  3277,
+  -3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  3277,
+  -3277,
+  -3277,
+  3277,
+  3277,
+  3277,
+  3277,
+  -3277,
+  -3277,
+  3277,
+  3277
+};
+const q15_t __res_weights_q15[] = {
+  8,
+  1764,
+  -727,
+  -513,
+  804,
+  518,
+  2523,
+  -1278,
+  58,
+  -943,
+  143,
+  1381,
+  1085,
+  341,
+  -2399,
+  -313,
+  1151,
+  536,
+  717,
+  -10,
+  24,
+  -796,
+  1488,
+  103,
+  -1507,
+  1144,
+  1784,
+  1238,
+  -190,
+  1064,
+  2638,
+  -492,
+  184,
+  -1383,
+  -2427,
+  2075,
+  -721,
+  -626,
+  1157,
+  -1223,
+  -401,
+  664,
+  1004,
+  155,
+  -2001,
+  -192,
+  403,
+  -542,
+  -66,
+  -1587,
+  -1503,
+  732,
+  99,
+  -117,
+  130,
+  1124,
+  914,
+  -1540,
+  -755,
+  779,
+  977,
+  -1474,
+  631,
+  683,
+  1290,
+  -792,
+  1188,
+  377,
+  -907,
+  -196,
+  615,
+  699,
+  -522,
+  242,
+  132,
+  1048,
+  -902,
+  326,
+  -743,
+  957,
+  -119,
+  1443,
+  60,
+  -288,
+  311,
+  896,
+  -165,
+  1355,
+  -1551,
+  761,
+  708,
+  -674,
+  -878,
+  -192,
+  -430,
+  164,
+  429,
+  -825,
+  -664,
+  -1050,
+  -454,
+  1040,
+  1229,
+  -270,
+  799,
+  138,
+  1363,
+  -887,
+  -153,
+  -1263,
+  378,
+  456,
+  293,
+  538,
+  -956,
+  1363,
+  -1795,
+  -1103,
+  348,
+  116,
+  -729,
+  -448,
+  88,
+  -33,
+  1053,
+  -1406,
+  -534,
+  -45,
+  -549,
+  -756,
+  -488,
+  62,
+  -1419,
+  -49,
+  1171,
+  -452,
+  673,
+  125,
+  -783,
+  168,
+  1160,
+  -505,
+  -1772,
+  465,
+  511,
+  -896,
+  -1055,
+  -326,
+  402,
+  1115,
+  321,
+  -98,
+  -195,
+  -623,
+  287,
+  950,
+  -275,
+  -360,
+  -615,
+  2030,
+  -759,
+  -726,
+  139,
+  -98,
+  221,
+  581,
+  844,
+  -199,
+  -863,
+  78,
+  -1025,
+  1258,
+  -119,
+  394,
+  -688,
+  -1285,
+  1602,
+  1837,
+  -532,
+  48,
+  -429,
+  -1983,
+  -2182,
+  1010,
+  -925,
+  -1062,
+  2901,
+  860,
+  -703,
+  476,
+  -498,
+  -343,
+  -688,
+  -837,
+  616,
+  2669,
+  621,
+  -410,
+  126,
+  -714,
+  910,
+  667,
+  1025,
+  -109,
+  -1120,
+  -944,
+  2413,
+  611,
+  1905,
+  -729,
+  45,
+  -538,
+  -963,
+  349,
+  1443,
+  743,
+  1475,
+  -1511,
+  -131,
+  524,
+  -671,
+  -58,
+  664,
+  -255,
+  -1043,
+  -1262,
+  -1280,
+  516,
+  -297,
+  -140,
+  -158,
+  -33,
+  390,
+  788,
+  -48,
+  -234,
+  307,
+  838,
+  -430,
+  -707,
+  985,
+  187,
+  265,
+  854,
+  984,
+  -687,
+  1092,
+  -644,
+  660,
+  679,
+  -1229,
+  -440,
+  -550,
+  460,
+  -2282,
+  147,
+  -1822,
+  -317,
+  1197,
+  294,
+  -710,
+  -266,
+  647,
+  1876,
+  -414,
+  41,
+  -644,
+  1987,
+  1055,
+  -306,
+  1807,
+  43,
+  392,
+  -1048,
+  141,
+  -165,
+  323,
+  1493,
+  1679,
+  163,
+  1274,
+  -863,
+  -1139,
+  441,
+  -681,
+  -443,
+  -671,
+  -1724,
+  -2088,
+  -111,
+  -663,
+  -1024,
+  396,
+  1184,
+  1103,
+  -1030,
+  1711,
+  -372,
+  -104,
+  984,
+  -927,
+  -1194,
+  -357,
+  -543,
+  -588,
+  522,
+  -1028,
+  -221,
+  283,
+  -466,
+  88,
+  -1190,
+  676,
+  1421,
+  483,
+  3009,
+  1208,
+  -798,
+  -271,
+  -329,
+  -195,
+  49,
+  -1300,
+  23,
+  -2025,
+  -942,
+  -1816,
+  659,
+  -1047,
+  -2360,
+  362,
+  -384,
+  -223,
+  -123,
+  778,
+  -82,
+  -127,
+  133,
+  -699,
+  -947,
+  2177,
+  1000,
+  677,
+  866,
+  199,
+  2472,
+  400,
+  -1081,
+  463,
+  -80,
+  -327,
+  -1090,
+  -440,
+  216,
+  -741,
+  1017,
+  -521,
+  -943,
+  -3330,
+  864,
+  148,
+  -719,
+  457,
+  1854,
+  96,
+  590,
+  336,
+  -435,
+  525,
+  -278,
+  -1210,
+  -573,
+  1267,
+  -1468,
+  -1300,
+  -349,
+  -731,
+  -1239,
+  319,
+  29,
+  244,
+  -573,
+  378,
+  235,
+  -13,
+  -849,
+  855,
+  -321,
+  267,
+  -1219,
+  -1772,
+  -170,
+  -149,
+  -992,
+  -1838,
+  -1374,
+  1250,
+  -479,
+  -1457,
+  182,
+  -435,
+  -595,
+  784,
+  132,
+  813,
+  512,
+  16,
+  747,
+  -1332,
+  -1763,
+  -166,
+  -292,
+  691,
+  1220,
+  236,
+  -602,
+  1832,
+  2359,
+  -53,
+  206,
+  -1773,
+  -1592,
+  282,
+  1105,
+  926,
+  1948,
+  -1415,
+  -53,
+  -82,
+  -1606,
+  994,
+  1770,
+  539,
+  -104,
+  -785,
+  -808,
+  79,
+  -1067,
+  1343,
+  -622,
+  1899,
+  286,
+  733,
+  -266,
+  -3300,
+  -745,
+  -972,
+  783,
+  2430,
+  576,
+  1192,
+  1179,
+  -489,
+  538,
+  562,
+  -1323,
+  -1306,
+  -489,
+  -2555,
+  -431,
+  499,
+  1747,
+  1018,
+  641,
+  2275,
+  1140,
+  859,
+  -493,
+  1089,
+  367,
+  1754,
+  -1,
+  1019,
+  -1792,
+  1817,
+  854,
+  162,
+  -260,
+  -696,
+  706,
+  374,
+  -133,
+  -1587,
+  1296,
+  -1579,
+  -1157,
+  -562,
+  -1750,
+  -543,
+  -802,
+  -141,
+  1945,
+  2261,
+  1128,
+  -630,
+  -888,
+  930,
+  -1265,
+  2826,
+  1278,
+  -12,
+  993,
+  -807,
+  -1751,
+  983,
+  59,
+  667,
+  -291,
+  1341,
+  -222,
+  370,
+  867,
+  -336,
+  -850,
+  -794,
+  89,
+  496,
+  -16,
+  -583,
+  -872,
+  -1699,
+  -62,
+  -387,
+  -1113,
+  384,
+  -561,
+  -141,
+  171,
+  -824,
+  1895,
+  -431,
+  1902,
+  -957,
+  -101,
+  394,
+  -1989,
+  -738,
+  -976,
+  333,
+  -1139,
+  854,
+  -767,
+  651,
+  1064,
+  701,
+  269,
+  -514,
+  53,
+  -1435,
+  1293,
+  -234,
+  66,
+  -764,
+  -826,
+  1002,
+  -974,
+  -136,
+  502,
+  -1169,
+  1491,
+  -1099,
+  342,
+  1208,
+  772,
+  -289,
+  686,
+  -962,
+  2761,
+  -226,
+  268,
+  -1641,
+  1409,
+  778,
+  -79,
+  1316,
+  -704,
+  -2458,
+  -1530,
+  -675,
+  67,
+  74,
+  276,
+  934,
+  -873,
+  -566,
+  -849,
+  589,
+  -98,
+  1478,
+  1692,
+  675,
+  1141,
+  668,
+  1146,
+  -863,
+  -1077,
+  -492,
+  -478,
+  337,
+  1667,
+  -127,
+  815,
+  1400,
+  -614,
+  1030,
+  534,
+  251,
+  -683,
+  1010,
+  -554,
+  1065,
+  -1320,
+  -1216,
+  -2337,
+  415,
+  -55,
+  -1736,
+  -797,
+  -1709,
+  -1382,
+  -727,
+  929,
+  -762,
+  1070,
+  -1424,
+  -787,
+  -312,
+  -1209,
+  -426,
+  -778,
+  -535,
+  99,
+  -337,
+  356,
+  -1371,
+  609,
+  811,
+  309,
+  -2229,
+  -46,
+  1427,
+  -282,
+  1528,
+  -1386,
+  294,
+  1750,
+  -538,
+  1606,
+  334,
+  -1911,
+  -237,
+  629,
+  -1259,
+  -301,
+  278,
+  -492,
+  163,
+  1089,
+  -25,
+  -1042,
+  -663,
+  -504,
+  -49,
+  893,
+  -375,
+  -348,
+  730,
+  -144,
+  1444,
+  20,
+  1171,
+  -548,
+  278,
+  1576,
+  -203,
+  -443,
+  1760,
+  441,
+  -869,
+  1681,
+  374,
+  155,
+  -320,
+  -714,
+  -980,
+  -701,
+  447,
+  -769,
+  944,
+  -301,
+  93,
+  786,
+  -1442,
+  -22,
+  2439,
+  2754,
+  1760,
+  495,
+  -310,
+  -922,
+  348,
+  -829,
+  -420,
+  -111,
+  1044,
+  -850,
+  -318,
+  -108,
+  -439,
+  256,
+  1136,
+  -1794,
+  343,
+  -392,
+  -1139,
+  -61,
+  -169,
+  -1448,
+  -1448,
+  197,
+  676,
+  -1280,
+  129,
+  -347,
+  327,
+  653,
+  -692,
+  8,
+  1519,
+  -818,
+  -265,
+  88,
+  -684,
+  939,
+  388,
+  470,
+  -708,
+  -958,
+  302,
+  -859,
+  692,
+  38,
+  -47,
+  -474,
+  123,
+  -572,
+  -499,
+  402,
+  1144,
+  -990,
+  -1136,
+  -385,
+  542,
+  1909,
+  68,
+  1608,
+  685,
+  -54,
+  -457,
+  203,
+  -989,
+  -128,
+  542,
+  96,
+  -1542,
+  -767,
+  -552,
+  -1106,
+  448,
+  -114,
+  -479,
+  -58,
+  579,
+  427,
+  889,
+  518,
+  340,
+  -59,
+  -855,
+  427,
+  -811,
+  -416,
+  -1384,
+  -568,
+  -2114,
+  -150,
+  -329,
+  -997,
+  500,
+  -223,
+  692,
+  -295,
+  -565,
+  934,
+  -1299,
+  1285,
+  -695,
+  1010,
+  -492,
+  -62,
+  -176,
+  -1897,
+  -447,
+  524,
+  -1405,
+  144,
+  1319,
+  -496,
+  -826,
+  1576,
+  -844,
+  1245,
+  1451,
+  1152,
+  -134,
+  409,
+  446,
+  718,
+  -1220,
+  616,
+  -547,
+  -182,
+  2074,
+  1125,
+  -1227,
+  -161,
+  -137,
+  -1320,
+  -2104,
+  -1534,
+  770,
+  -1067,
+  -444,
+  295,
+  -124,
+  1201,
+  -2991,
+  -912,
+  536,
+  1209,
+  545,
+  179,
+  -28,
+  -375,
+  296,
+  278,
+  265,
+  1892,
+  1525,
+  1534,
+  -1898,
+  371,
+  225,
+  55,
+  -874,
+  -878,
+  -1123,
+  989,
+  470,
+  1131,
+  -1098,
+  397,
+  55,
+  -674,
+  1135,
+  549,
+  -972,
+  -1249,
+  314,
+  140,
+  516,
+  -242,
+  157,
+  797,
+  1298,
+  -441,
+  -2932,
+  1916,
+  551,
+  858,
+  -111,
+  49,
+  607,
+  -126,
+  -71,
+  -398,
+  360,
+  189,
+  -343,
+  -689,
+  -2107,
+  -198,
+  127,
+  -1394,
+  -1098,
+  -1163,
+  -446,
+  -535,
+  -712,
+  1043,
+  1547,
+  -195,
+  789,
+  1161,
+  -801,
+  -1023,
+  1108,
+  -1384,
+  1054,
+  -1350,
+  -1258,
+  923,
+  1184,
+  1415,
+  1134,
+  -979,
+  -958,
+  1075,
+  26,
+  626,
+  -563,
+  286,
+  -801,
+  -679,
+  -754,
+  39,
+  45,
+  667,
+  -880,
+  733,
+  -24,
+  -1483,
+  619,
+  -1153,
+  763,
+  433,
+  -702,
+  -238,
+  668,
+  1305,
+  1122,
+  -806,
+  213,
+  968,
+  1529,
+  877,
+  -1648,
+  -646,
+  942,
+  204,
+  -849,
+  -16,
+  30,
+  -298,
+  -1398,
+  410,
+  -1168,
+  354,
+  73,
+  1566,
+  -835,
+  571,
+  -45,
+  2102,
+  1476,
+  -224,
+  622,
+  -904,
+  550,
+  1783,
+  -1522,
+  2592,
+  1073,
+  949,
+  2153,
+  -1166,
+  -338,
+  -1887,
+  360,
+  428,
+  -1140,
+  1199,
+  -364,
+  -1232,
+  -329,
+  -32,
+  1279,
+  1336,
+  -1415,
+  -1648,
+  -2093,
+  -185,
+  -1501,
+  -896,
+  1792,
+  -788,
+  -749,
+  -1053,
+  -2001,
+  -619,
+  1019,
+  -188,
+  735,
+  418,
+  -512,
+  695,
+  -1551,
+  -1774,
+  271,
+  -657,
+  105,
+  920,
+  889,
+  -206,
+  447,
+  -142,
+  -11,
+  -1987,
+  -25,
+  -1762,
+  283,
+  483,
+  333,
+  534,
+  952,
+  1477,
+  -1072,
+  -644,
+  -185,
+  -1397,
+  124,
+  634,
+  -895,
+  1324,
+  -493,
+  -925,
+  1451,
+  1691,
+  -616,
+  1195,
+  601,
+  -62,
+  414,
+  1571,
+  116,
+  -237,
+  1817,
+  311,
+  -1015,
+  -1921,
+  952,
+  -700,
+  -611,
+  82,
+  -1367,
+  -1340,
+  1149,
+  726,
+  -836,
+  -1284,
+  -1116,
+  1462,
+  916,
+  749,
+  -195,
+  362,
+  -1532,
+  -1032,
+  1280,
+  33,
+  494,
+  525,
+  301,
+  -1230,
+  -2667,
+  1380,
+  361,
+  351,
+  -299,
+  -1507,
+  -278,
+  -97,
+  1386,
+  -417,
+  -897,
+  1908,
+  1148,
+  367,
+  -291,
+  -1065,
+  627,
+  42,
+  -890,
+  1312,
+  307,
+  -685,
+  -281,
+  -305,
+  -2603,
+  -1164,
+  -1154,
+  158,
+  2234,
+  -699,
+  247,
+  361,
+  586,
+  -1267,
+  92,
+  -1179,
+  -550,
+  851,
+  2679,
+  -1379,
+  -1408,
+  -1830,
+  -348,
+  440,
+  -773,
+  -2259,
+  696,
+  59,
+  349,
+  -1013,
+  821,
+  -537,
+  -64,
+  1194,
+  -693,
+  703,
+  1175,
+  1288,
+  -842,
+  745,
+  -567,
+  65,
+  -60,
+  -1909,
+  1494,
+  -1082,
+  -383,
+  -761,
+  -28,
+  -2733,
+  1673,
+  -3084,
+  530,
+  221,
+  48,
+  30,
+  749,
+  -736,
+  57,
+  -395,
+  1820,
+  772,
+  282,
+  1027,
+  320,
+  -1005,
+  1427,
+  497,
+  913,
+  -1459,
+  868,
+  -228,
+  278,
+  853,
+  2376,
+  247,
+  2462,
+  -1608,
+  -671,
+  987,
+  -716,
+  -506,
+  -653,
+  390,
+  1024,
+  1756,
+  339,
+  620,
+  -1226,
+  -857,
+  511,
+  463,
+  -749,
+  -805,
+  -1407,
+  550,
+  1441,
+  -1544,
+  -418,
+  -1200,
+  -266,
+  1521,
+  -2157,
+  1277,
+  -820,
+  -987,
+  1547,
+  -1047,
+  -50,
+  1633,
+  1187,
+  -454,
+  758,
+  -244,
+  -515,
+  722,
+  -508,
+  -778,
+  -295,
+  880,
+  -1060,
+  -402,
+  -211,
+  -408,
+  1818,
+  1181,
+  123,
+  -865,
+  277,
+  -776,
+  -826,
+  -638,
+  -411,
+  -1107,
+  912,
+  -217,
+  321,
+  206,
+  -398,
+  2032,
+  -430,
+  1008,
+  -1508,
+  564,
+  411,
+  -979,
+  421,
+  927,
+  291,
+  877,
+  -647,
+  -642,
+  879,
+  -493,
+  487,
+  1097,
+  -479,
+  1393,
+  -107,
+  -948,
+  1497,
+  310,
+  -908,
+  597,
+  1123,
+  1348,
+  397,
+  1594,
+  516,
+  1595,
+  13,
+  873,
+  -1045,
+  -2126,
+  2979,
+  42,
+  528,
+  -3,
+  1170,
+  425,
+  -181,
+  -1872,
+  930,
+  -62,
+  -179,
+  -293,
+  227,
+  1578,
+  -379,
+  225,
+  1734,
+  -1294,
+  803,
+  -6,
+  -1134,
+  1461,
+  843,
+  87,
+  1834,
+  1555,
+  246,
+  -613,
+  -1223,
+  621,
+  -65,
+  -1695,
+  -622,
+  -586,
+  1585,
+  1082,
+  -788,
+  -92,
+  -187,
+  556,
+  -936,
+  -2098,
+  -778,
+  2529,
+  908,
+  2386,
+  -538,
+  2368,
+  2197,
+  -398,
+  1017,
+  -134,
+  623,
+  -1031,
+  -905,
+  -991,
+  177,
+  -480,
+  158,
+  741,
+  -1272,
+  1435,
+  92,
+  721,
+  815,
+  2299,
+  903,
+  231,
+  -364,
+  -825,
+  -838,
+  870,
+  -601,
+  1332,
+  1145,
+  280,
+  2061,
+  -3,
+  441,
+  616,
+  -275,
+  268,
+  -41,
+  -927,
+  -126,
+  -373,
+  248,
+  -1231,
+  1688,
+  1770,
+  1297,
+  -1293,
+  948,
+  489,
+  593,
+  699,
+  -1492,
+  42,
+  -1502,
+  -444,
+  -644,
+  -1144,
+  -1424,
+  1066,
+  1566,
+  -359,
+  -348,
+  -924,
+  -1909,
+  1565,
+  1289,
+  290,
+  -1660,
+  509,
+  -444,
+  -221,
+  2082,
+  -1624,
+  -825,
+  1569,
+  1075,
+  -611,
+  690,
+  1160,
+  260,
+  -953,
+  -80,
+  204,
+  2070,
+  1693,
+  284,
+  -295,
+  1037,
+  -900,
+  -2752,
+  -1542,
+  -199,
+  -1026,
+  777,
+  -1312,
+  783,
+  913,
+  -1211,
+  1597,
+  -349,
+  -1013,
+  1027,
+  -99,
+  -1108,
+  -993,
+  -450,
+  356,
+  830,
+  -728,
+  -923,
+  1792,
+  1850,
+  825,
+  -83,
+  -751,
+  -1330,
+  -186,
+  269,
+  3268,
+  -1450,
+  1760,
+  72,
+  180,
+  -396,
+  1088,
+  -1963,
+  -1700,
+  -1240,
+  -565,
+  -762,
+  731,
+  -1587,
+  47,
+  -1540,
+  -505,
+  -904,
+  -481,
+  -53,
+  328,
+  630,
+  2354,
+  -1288,
+  843,
+  -1468,
+  -215,
+  1371,
+  -145,
+  -788,
+  -1683,
+  -545,
+  1253,
+  704,
+  313,
+  -1766,
+  347,
+  -1760,
+  1785,
+  -1590,
+  -1034,
+  -583,
+  259,
+  1884,
+  -1010,
+  -137,
+  -1880,
+  -1081,
+  -349,
+  -877,
+  -970,
+  -465,
+  -35,
+  183,
+  -784,
+  -1178,
+  491,
+  1384,
+  -694,
+  -435,
+  723,
+  92,
+  151,
+  -306,
+  -956,
+  -1356,
+  1,
+  -597,
+  1111,
+  326,
+  -294,
+  -132,
+  -256,
+  -887,
+  630,
+  987,
+  -1220,
+  785,
+  525,
+  387,
+  717,
+  970,
+  586,
+  932,
+  981,
+  -567,
+  716,
+  66,
+  -466,
+  1716,
+  -174,
+  1046,
+  -541,
+  1144,
+  1433,
+  783,
+  -1368,
+  1114,
+  2026,
+  -218,
+  -143,
+  -219,
+  938,
+  -319,
+  -1540,
+  -551,
+  -74,
+  356,
+  772,
+  -299,
+  -1924,
+  -239,
+  84,
+  1251,
+  1467,
+  -1972,
+  -967,
+  -1091,
+  -1705,
+  -1955,
+  -1684,
+  -564,
+  -1825,
+  -360,
+  -321,
+  -402,
+  -1720,
+  597,
+  -691,
+  196,
+  -152,
+  85,
+  0,
+  -832,
+  -426,
+  225,
+  1372,
+  -995,
+  -726,
+  696,
+  462,
+  2317,
+  505,
+  1569,
+  -440,
+  340,
+  -1848,
+  70,
+  -133,
+  -573,
+  -2308,
+  1251,
+  1146,
+  1206,
+  -948,
+  -870,
+  -9,
+  253,
+  -1633,
+  297,
+  442,
+  -2330,
+  339,
+  2390,
+  -1693,
+  -243,
+  -872,
+  862,
+  -627,
+  -860,
+  -504,
+  -452,
+  893,
+  -1052,
+  -293,
+  -1690,
+  -19,
+  -49,
+  -414,
+  670,
+  -2140,
+  824,
+  -821,
+  84,
+  -1043,
+  -911,
+  768,
+  -491,
+  -83,
+  480,
+  -1198,
+  -570,
+  288,
+  -82,
+  13,
+  1409,
+  -352,
+  169,
+  -573,
+  28,
+  671,
+  -786,
+  916,
+  847,
+  36,
+  104,
+  -535,
+  1152,
+  -803,
+  -574,
+  -706,
+  517,
+  -610,
+  -223,
+  2408,
+  313,
+  2296,
+  -827,
+  442,
+  -1421,
+  -1023,
+  -641,
+  725,
+  620,
+  -2778,
+  -490,
+  -1510,
+  -1638,
+  935,
+  960,
+  -1816,
+  -894,
+  -922,
+  -1115,
+  1660,
+  -597,
+  256,
+  -340,
+  -757,
+  -247,
+  -279,
+  -2564,
+  891,
+  181,
+  824,
+  391,
+  -394,
+  -3269,
+  -1071,
+  -903,
+  -521,
+  -1876,
+  -60,
+  -24,
+  -551,
+  -76,
+  1690,
+  1050,
+  -588,
+  970,
+  -693,
+  -313,
+  -493,
+  -555,
+  -85,
+  -240,
+  962,
+  120,
+  1240,
+  -1306,
+  -281,
+  1794,
+  -1446,
+  -1001,
+  -1021,
+  -77,
+  156,
+  -2116,
+  -764,
+  -518,
+  -77,
+  -158,
+  1616,
+  658,
+  -2570,
+  -570,
+  -830,
+  -887,
+  -476,
+  105,
+  726,
+  -160,
+  -1400,
+  -356,
+  1092,
+  532,
+  1282,
+  -804,
+  1240,
+  719,
+  2857,
+  -980,
+  -983,
+  1148,
+  -715,
+  460,
+  127,
+  -1110,
+  -281,
+  1576,
+  1776,
+  181,
+  59,
+  790,
+  -511,
+  -1638,
+  1589,
+  955,
+  -659,
+  860,
+  559,
+  -752,
+  437,
+  -613,
+  1401,
+  908,
+  -1161,
+  88,
+  413,
+  1041,
+  885,
+  420,
+  -219,
+  196,
+  -1489,
+  47,
+  -919,
+  637,
+  537,
+  -751,
+  445,
+  -966,
+  -1325,
+  1617,
+  1226,
+  -403,
+  -1180,
+  -775,
+  30,
+  -1419,
+  -309,
+  -1256,
+  297,
+  828,
+  1116,
+  810,
+  82,
+  660,
+  202,
+  -1284,
+  -682,
+  274,
+  -955,
+  12,
+  897,
+  673,
+  -1725,
+  -3904,
+  -385,
+  1202,
+  1385,
+  -340,
+  -529,
+  -1448,
+  -643,
+  1444,
+  -951,
+  1379,
+  181,
+  205,
+  446,
+  1254,
+  975,
+  762,
+  -900,
+  584,
+  -766,
+  -781,
+  -1023,
+  -1792,
+  1874,
+  261,
+  359,
+  -719,
+  -804,
+  -1058,
+  -1034,
+  214,
+  2663,
+  34,
+  -863,
+  -1009,
+  77,
+  -732,
+  145,
+  2708,
+  -830,
+  -1044,
+  162,
+  480,
+  -639,
+  1440,
+  582,
+  931,
+  192,
+  1246,
+  921,
+  196,
+  -1115,
+  104,
+  -445,
+  1727,
+  1048,
+  -782,
+  -1141,
+  2042,
+  1207,
+  -519,
+  589,
+  1017,
+  148,
+  -244,
+  1514,
+  237,
+  975,
+  -42,
+  37,
+  300,
+  226,
+  -430,
+  1226,
+  1265,
+  1046,
+  933,
+  505,
+  2197,
+  700,
+  -1145,
+  -958,
+  -212,
+  -52,
+  -1499,
+  -334,
+  577,
+  8,
+  -2222,
+  969,
+  -92,
+  -441,
+  675,
+  73,
+  -1641,
+  -940,
+  -1944,
+  1921,
+  -494,
+  -913,
+  -657,
+  -1771,
+  -62,
+  970,
+  -935,
+  2573,
+  -629,
+  282,
+  -457,
+  -1746,
+  1499,
+  -1981,
+  141,
+  545,
+  -600,
+  -606,
+  2212,
+  -976,
+  994,
+  89,
+  588,
+  -1242,
+  -100,
+  453,
+  -1947,
+  1109,
+  1737,
+  -531,
+  708,
+  1629,
+  -638,
+  68,
+  163,
+  -509,
+  186,
+  15,
+  239,
+  -1826,
+  -1050,
+  727,
+  915,
+  1030,
+  135,
+  814,
+  225,
+  -328,
+  420,
+  -513,
+  1157,
+  -1002,
+  526,
+  -210,
+  977,
+  -919,
+  2322,
+  -1933,
+  -3135,
+  453,
+  956,
+  1264,
+  775,
+  464,
+  -2221,
+  -360,
+  -318,
+  -53,
+  -1015,
+  1504,
+  -1013,
+  -336,
+  -1572,
+  469,
+  -434,
+  949,
+  -1062,
+  -129,
+  107,
+  1257,
+  -583,
+  675,
+  822,
+  -195,
+  -1414,
+  -1004,
+  1154,
+  1565,
+  415,
+  -878,
+  -1650,
+  1015,
+  326,
+  388,
+  -33,
+  -463,
+  -834,
+  -1148,
+  1506,
+  1090,
+  2078,
+  -1504,
+  2160,
+  674,
+  891,
+  135,
+  520,
+  -328,
+  1222,
+  -587,
+  -446,
+  -1064,
+  172,
+  261,
+  79,
+  -1026,
+  1823,
+  -422,
+  966,
+  -265,
+  -430,
+  891,
+  633,
+  -1212,
+  349,
+  341,
+  -1314,
+  343,
+  -1140,
+  1065,
+  -1778,
+  -687,
+  428,
+  283,
+  -830,
+  207,
+  -1429,
+  1727,
+  -1067,
+  338,
+  294,
+  -881,
+  -491,
+  1170,
+  490,
+  629,
+  513,
+  2144,
+  186,
+  1073,
+  -1681,
+  2374,
+  -492,
+  -354,
+  -159,
+  -309,
+  -1072,
+  -236,
+  975,
+  -32,
+  1193,
+  -618,
+  -515,
+  -945,
+  568,
+  -699,
+  -1710,
+  1633,
+  -1683,
+  1593,
+  -639,
+  -439,
+  -510,
+  715,
+  -528,
+  -1238,
+  -2065,
+  -214,
+  -541,
+  -55,
+  -446,
+  -487,
+  -640,
+  -802,
+  -736,
+  -525,
+  891,
+  445,
+  -586,
+  -884,
+  -1475,
+  507,
+  -341,
+  -1607,
+  1241,
+  10,
+  -1378,
+  808,
+  -1377,
+  929,
+  -863,
+  -549,
+  -870,
+  -1004,
+  414,
+  1475,
+  337,
+  -681,
+  1242,
+  -2026,
+  937,
+  1449,
+  -2839,
+  642,
+  135,
+  -2499,
+  1886,
+  -1654,
+  -70,
+  -1512,
+  -282,
+  917,
+  697,
+  1610,
+  -437,
+  -1150,
+  722,
+  -1711,
+  -350,
+  -515,
+  -504,
+  -1014,
+  -12,
+  -305,
+  749,
+  -780,
+  -190,
+  112,
+  -145,
+  350,
+  1447,
+  456,
+  -19,
+  -1622,
+  -976,
+  754,
+  733,
+  1352,
+  801,
+  1141,
+  -91,
+  281,
+  122,
+  -283,
+  -779,
+  -2079,
+  649,
+  1553,
+  -375,
+  522,
+  -255,
+  1314,
+  -233,
+  -2065,
+  1970,
+  -690,
+  -1200,
+  -1049,
+  -632,
+  -1737,
+  241,
+  -275,
+  -127,
+  113,
+  -316,
+  473,
+  -1445,
+  1068,
+  1153,
+  -325,
+  -979,
+  667,
+  271,
+  149,
+  605,
+  -677,
+  1543,
+  222,
+  246,
+  1699,
+  -1571,
+  -275,
+  -308,
+  -922,
+  490,
+  1100,
+  403,
+  -784,
+  138,
+  515,
+  -593,
+  894,
+  -2518,
+  -155,
+  -343,
+  1406,
+  7,
+  1419,
+  -762,
+  603,
+  1030,
+  -837,
+  -940,
+  1083,
+  679,
+  -123,
+  -1009,
+  328,
+  233,
+  -653,
+  -2065,
+  -180,
+  -189,
+  -95,
+  -982,
+  440,
+  656,
+  -301,
+  2111,
+  -279,
+  -826,
+  -1650,
+  -180,
+  -831,
+  -2520,
+  -34,
+  -1955,
+  1648,
+  2056,
+  418,
+  -906,
+  770,
+  375,
+  -1326,
+  1315,
+  1508,
+  665,
+  -1192,
+  285,
+  74,
+  1316,
+  2093,
+  -627,
+  2445,
+  55,
+  -98,
+  -1668,
+  -121,
+  -1538,
+  -2214,
+  1122,
+  -610,
+  -172,
+  2403,
+  -22,
+  -1676,
+  -1243,
+  -2009,
+  -612,
+  -894,
+  2074,
+  -195,
+  379,
+  -837,
+  891,
+  -1552,
+  982,
+  1266,
+  -537,
+  -1232,
+  -483,
+  842,
+  16,
+  -487,
+  -615,
+  942,
+  1200,
+  351,
+  655,
+  281,
+  -434,
+  1604,
+  982,
+  -440,
+  -536,
+  -2018,
+  -564,
+  -1432,
+  1134,
+  909,
+  86,
+  -205,
+  142,
+  2309,
+  -954,
+  1304,
+  177,
+  1924,
+  -249,
+  777,
+  -1135,
+  940,
+  -1161,
+  29,
+  -1067,
+  139,
+  214,
+  -1704,
+  -683,
+  -500,
+  1805,
+  701,
+  806,
+  154,
+  387,
+  -1654,
+  168,
+  1026,
+  643,
+  41,
+  -546,
+  -433,
+  737,
+  -1187,
+  353,
+  1180,
+  144,
+  -812,
+  -1129,
+  419,
+  326,
+  904,
+  677,
+  -169,
+  -1159,
+  -287,
+  856,
+  1211,
+  -620,
+  841,
+  -503,
+  -223,
+  -2073,
+  672,
+  -358,
+  1375,
+  1524,
+  -585,
+  -350,
+  117,
+  -104,
+  1317,
+  1093,
+  557,
+  1062,
+  -1316,
+  -858,
+  333,
+  1186,
+  261,
+  372,
+  555,
+  533,
+  -218,
+  1595,
+  737,
+  286,
+  -1204,
+  -990,
+  269,
+  3,
+  -166,
+  -603,
+  1461,
+  120,
+  358,
+  -836,
+  22,
+  755,
+  1285,
+  1556,
+  -1890,
+  -671,
+  -237,
+  -324,
+  -1446,
+  1279,
+  322,
+  353,
+  2497,
+  -375,
+  86,
+  239,
+  -2,
+  447,
+  -640,
+  -241,
+  2000,
+  -2665,
+  -85,
+  -2363,
+  -535,
+  264,
+  -2028,
+  1785,
+  416,
+  785,
+  1018,
+  -1214,
+  182,
+  820,
+  -1310,
+  935,
+  974,
+  1382,
+  577,
+  679,
+  -312,
+  -1118,
+  -53,
+  -694,
+  -1453,
+  1165,
+  1546,
+  925,
+  881,
+  427,
+  -407,
+  -414,
+  1589,
+  359,
+  309,
+  -1882,
+  -648,
+  -1970,
+  1740,
+  -734,
+  1437,
+  -2122,
+  -2698,
+  -2294,
+  152,
+  598,
+  -3492,
+  735,
+  -881,
+  527,
+  108,
+  -3227,
+  166,
+  710,
+  1463,
+  -1315,
+  2002,
+  -777,
+  -856,
+  -78,
+  159,
+  635,
+  818,
+  -1236,
+  376,
+  70,
+  -1528,
+  1883,
+  -284,
+  -1524,
+  313,
+  471,
+  2308,
+  -622,
+  -12,
+  74,
+  935,
+  -267,
+  82,
+  453,
+  348,
+  1532,
+  -407,
+  1797,
+  684,
+  818,
+  -1406,
+  -1638,
+  183,
+  1877,
+  1461,
+  26,
+  828,
+  -1977,
+  155,
+  -1118,
+  -119,
+  583,
+  -1092,
+  389,
+  -425,
+  -379,
+  118,
+  565,
+  -1015,
+  1358,
+  -323,
+  -417,
+  65,
+  -1722,
+  1033,
+  829,
+  -1701,
+  -493,
+  396,
+  406,
+  568,
+  804,
+  1429,
+  -607,
+  1542,
+  -1479,
+  -932,
+  666,
+  -962,
+  -370,
+  1113,
+  1214,
+  -1214,
+  976,
+  63,
+  999,
+  -906,
+  -751,
+  -415,
+  -864,
+  -1140,
+  84,
+  1743,
+  99,
+  707,
+  -1167,
+  -242,
+  -347,
+  -616,
+  -645,
+  -1643,
+  1392,
+  -771,
+  424,
+  -473,
+  998,
+  1496,
+  -561,
+  315,
+  2502,
+  621,
+  -576,
+  -143,
+  -1002,
+  992,
+  -29,
+  385,
+  1811,
+  989,
+  -24,
+  -122,
+  130,
+  -402,
+  55,
+  -499,
+  1430,
+  -1183,
+  483,
+  555,
+  -786,
+  209,
+  647,
+  -8,
+  -2116,
+  358,
+  -308,
+  687,
+  545,
+  -1053,
+  -402,
+  -595,
+  -2206,
+  -803,
+  -765,
+  96,
+  1338,
+  1248,
+  -484,
+  -1425,
+  1524,
+  -1628,
+  -588,
+  1039,
+  -732,
+  280,
+  2245,
+  949,
+  234,
+  130,
+  1182,
+  -4,
+  -33,
+  -159,
+  -510,
+  -1421,
+  740,
+  -972,
+  -1261,
+  45,
+  744,
+  933,
+  917,
+  -224,
+  601,
+  -1383,
+  765,
+  -603,
+  -599,
+  -1812,
+  372,
+  148,
+  -38,
+  -506,
+  -761,
+  987,
+  1524,
+  1345,
+  243,
+  -150,
+  93,
+  -873,
+  1207,
+  -791,
+  -1233,
+  66,
+  1338,
+  -2838,
+  988,
+  -693,
+  335,
+  -2235,
+  -980,
+  584,
+  -1487,
+  17,
+  -479,
+  1227,
+  620,
+  487,
+  2729,
+  75,
+  1254,
+  1414,
+  904,
+  2122,
+  484,
+  -666,
+  2065,
+  -1460,
+  -1539,
+  -188,
+  615,
+  -854,
+  1028,
+  -897,
+  -1415,
+  -2495,
+  -1415,
+  314,
+  1088,
+  -635,
+  -401,
+  1195,
+  1908,
+  838,
+  -69,
+  1030,
+  1330,
+  -286,
+  816,
+  511,
+  -1126,
+  56,
+  -1223,
+  230,
+  888,
+  -214,
+  -98,
+  967,
+  120,
+  476,
+  703,
+  123,
+  375,
+  -295,
+  -351,
+  -1651,
+  173,
+  -814,
+  -359,
+  465,
+  -1906,
+  845,
+  573,
+  573,
+  -730,
+  2469,
+  436,
+  636,
+  768,
+  -1069,
+  -1498,
+  22,
+  1298,
+  583,
+  -654,
+  2070,
+  -277,
+  864,
+  -491,
+  154,
+  1584,
+  -919,
+  1313,
+  66,
+  -1059,
+  -2068,
+  126,
+  793,
+  696,
+  -778,
+  -69,
+  -420,
+  432,
+  493,
+  -881,
+  -369,
+  -1097,
+  685,
+  -289,
+  547,
+  -1870,
+  -734,
+  248,
+  -34,
+  368,
+  -1053,
+  60,
+  -2133,
+  746,
+  -1121,
+  -801,
+  1287,
+  -656,
+  90,
+  -860,
+  -484,
+  460,
+  445,
+  478,
+  330,
+  1543,
+  170,
+  -1432,
+  541,
+  -49,
+  -1587,
+  -389,
+  -1333,
+  -500,
+  1994,
+  869,
+  963,
+  -1546,
+  -651,
+  1522,
+  918,
+  -13,
+  16,
+  1278,
+  -1189,
+  -125,
+  -25,
+  560,
+  -2082,
+  -1117,
+  98,
+  99,
+  -689,
+  -667,
+  -1778,
+  379,
+  978,
+  -557,
+  -2277,
+  513,
+  -447,
+  117,
+  -322,
+  631,
+  78,
+  918,
+  1675,
+  32,
+  898,
+  991,
+  -1885,
+  140,
+  1056,
+  -334,
+  2632,
+  -1296,
+  1518,
+  -1378,
+  -109,
+  -500,
+  2156,
+  147,
+  220,
+  -1765,
+  -1760,
+  -2131,
+  -1069,
+  545,
+  -2322,
+  -77,
+  -407,
+  1426,
+  -915,
+  -2409,
+  1154,
+  1770,
+  -1735,
+  40,
+  -327,
+  -205,
+  -377,
+  -247,
+  1163,
+  770,
+  1088,
+  -2845,
+  -1112,
+  -696,
+  100,
+  -48,
+  2072,
+  -328,
+  818,
+  -316,
+  254,
+  -2767,
+  330,
+  1121,
+  1717,
+  1752,
+  596,
+  -1318,
+  -1887,
+  37,
+  -1158,
+  301,
+  411,
+  2590,
+  1039,
+  -316,
+  1573,
+  -916,
+  1578,
+  -156,
+  1011,
+  1314,
+  403,
+  -1220,
+  483,
+  1208,
+  807,
+  41,
+  76,
+  719,
+  -1674,
+  822,
+  -136,
+  -321,
+  202,
+  -550,
+  102,
+  -2250,
+  174,
+  -1279,
+  -480,
+  -232,
+  -965,
+  -438,
+  -506,
+  2243,
+  1120,
+  1145,
+  288,
+  767,
+  439,
+  -600,
+  557,
+  -547,
+  -291,
+  -2155,
+  -329,
+  1761,
+  1358,
+  178,
+  574,
+  -124,
+  329,
+  1337,
+  -808,
+  -629,
+  1385,
+  2226,
+  1162,
+  754,
+  -1406,
+  -171,
+  1585,
+  -155,
+  131,
+  329,
+  -1259,
+  -1921,
+  -882,
+  -349,
+  393,
+  648,
+  -1310,
+  -3156,
+  179,
+  -1298,
+  1149,
+  -1234,
+  332,
+  -2825,
+  560,
+  -420,
+  -212,
+  1533,
+  -1387,
+  -768,
+  371,
+  -291,
+  -1202,
+  -115,
+  940,
+  315,
+  -1977,
+  -923,
+  1050,
+  1319,
+  1725,
+  764,
+  -1984,
+  1113,
+  110,
+  570,
+  682,
+  -133,
+  -1762,
+  -330,
+  -797,
+  235,
+  1065,
+  -538,
+  -266,
+  760,
+  1716,
+  -1400,
+  -838,
+  -55,
+  -1146,
+  380,
+  -178,
+  -113,
+  -308,
+  1062,
+  18,
+  -1184,
+  -384,
+  -803,
+  -50,
+  477,
+  -1079,
+  -1734,
+  -151,
+  164,
+  -322,
+  -289,
+  -302,
+  1310,
+  -339,
+  -1515,
+  359,
+  -2716,
+  1391,
+  589,
+  238,
+  129,
+  -851,
+  10,
+  506,
+  -629,
+  364,
+  -1444,
+  2016,
+  -915,
+  757,
+  93,
+  -1304,
+  -706,
+  913,
+  -811,
+  526,
+  -2069,
+  1749,
+  1414,
+  741,
+  -796,
+  -847,
+  811,
+  1045,
+  -494,
+  975,
+  1630,
+  -390,
+  236,
+  1750,
+  485,
+  1781,
+  67,
+  48,
+  1550,
+  1235,
+  -482,
+  -1288,
+  1922,
+  538,
+  1464,
+  1793,
+  978,
+  -64,
+  -709,
+  935,
+  -313,
+  448,
+  2197,
+  1361,
+  674,
+  1121,
+  -1165,
+  -315,
+  542,
+  988,
+  -176,
+  1165,
+  804,
+  -1214,
+  500,
+  43,
+  -193,
+  -75,
+  1832,
+  1197,
+  -1549,
+  -1269,
+  -1402,
+  -292,
+  108,
+  249,
+  1452,
+  -776,
+  -557,
+  617,
+  336,
+  -378,
+  128,
+  585,
+  311,
+  -1196,
+  -146,
+  -440,
+  -33,
+  -2180,
+  694,
+  129,
+  43,
+  326,
+  -333,
+  1145,
+  -522,
+  437,
+  530,
+  -421,
+  -563,
+  -1182,
+  415,
+  -2495,
+  -548,
+  -587,
+  933,
+  1102,
+  1310,
+  477,
+  -396,
+  -1406,
+  -1168,
+  -1197,
+  772,
+  -372,
+  52,
+  -39,
+  -383,
+  -733,
+  -537,
+  -235,
+  -1185,
+  423,
+  -380,
+  -342,
+  -1102,
+  496,
+  709,
+  -948,
+  1129,
+  -17,
+  730,
+  2073,
+  -1582,
+  492,
+  303,
+  -150,
+  -289,
+  -224,
+  -1470,
+  254,
+  658,
+  -169,
+  -1000,
+  180,
+  -90,
+  -954,
+  -789,
+  -227,
+  44,
+  -521,
+  132,
+  1241,
+  1385,
+  -230,
+  497,
+  -1269,
+  366,
+  1285,
+  -336,
+  -272,
+  -432,
+  47,
+  1690,
+  534,
+  1145,
+  -2244,
+  539,
+  -944,
+  565,
+  126,
+  -657,
+  134,
+  -1040,
+  -773,
+  -458,
+  -1155,
+  -271,
+  -2381,
+  568,
+  265,
+  -708,
+  891,
+  1880,
+  -1719,
+  -1186,
+  418,
+  1017,
+  1753,
+  1166,
+  -1392,
+  -968,
+  -945,
+  -1410,
+  294,
+  -320,
+  -375,
+  -2453,
+  -1071,
+  -777,
+  -1025,
+  -404,
+  -1139,
+  604,
+  -1738,
+  -19,
+  1025,
+  -279,
+  354,
+  696,
+  -848,
+  586,
+  -1333,
+  -799,
+  -192,
+  -460,
+  1278,
+  -559,
+  -1050,
+  -1731,
+  -1481,
+  1259,
+  87,
+  1754,
+  -1249,
+  -328,
+  275,
+  -1869,
+  -209,
+  -1103,
+  -1335,
+  -161,
+  -1476,
+  571,
+  -1170,
+  -782,
+  -1146,
+  -1787,
+  227,
+  1124,
+  782,
+  -368,
+  1066,
+  -737,
+  -1602,
+  1224,
+  -889,
+  -335,
+  -895,
+  207,
+  792,
+  -199,
+  239,
+  65,
+  -246,
+  -1387,
+  -202,
+  -1605,
+  -504,
+  -271,
+  1115,
+  1002,
+  487,
+  518,
+  -146,
+  735,
+  -1299,
+  1574,
+  163,
+  -443,
+  -90,
+  -1498,
+  266,
+  594,
+  24,
+  2067,
+  -774,
+  713,
+  106,
+  1054,
+  -476,
+  -388,
+  530,
+  -1446,
+  -1420,
+  3,
+  -1415,
+  102,
+  43,
+  203,
+  -1619,
+  -1191,
+  -631,
+  748,
+  936,
+  313,
+  281,
+  946,
+  -1207,
+  -3131,
+  1623,
+  -1006,
+  123,
+  -36,
+  -103,
+  1271,
+  -172,
+  426,
+  -1598,
+  282,
+  1352,
+  1451,
+  1331,
+  521,
+  940,
+  1268,
+  -630,
+  544,
+  -1029,
+  746,
+  1098,
+  -243,
+  503,
+  1004,
+  -157,
+  921,
+  315,
+  -566,
+  1000,
+  685,
+  275,
+  -458,
+  -81,
+  520,
+  -386,
+  -1648,
+  -1103,
+  2285,
+  385,
+  -1390,
+  1195,
+  2017,
+  -900,
+  33,
+  623,
+  -144,
+  1269,
+  774,
+  -35,
+  539,
+  1393,
+  50,
+  -2502,
+  -395,
+  -48,
+  -1012,
+  -1005,
+  86,
+  -679,
+  2079,
+  630,
+  69,
+  1154,
+  -790,
+  318,
+  -2015,
+  88,
+  395,
+  1513,
+  948,
+  852,
+  2387,
+  501,
+  1959,
+  -767,
+  200,
+  -160,
+  1308,
+  1049,
+  21,
+  78,
+  95,
+  1240,
+  2320,
+  18,
+  -1330,
+  -279,
+  -66,
+  -743,
+  385,
+  650,
+  -730,
+  619,
+  -343,
+  559,
+  -2261,
+  -337,
+  778,
+  51,
+  603,
+  544,
+  1059,
+  1343,
+  1641,
+  994,
+  -959,
+  -893,
+  -607,
+  -322,
+  -11,
+  487,
+  566,
+  -911,
+  -1491,
+  417,
+  1974,
+  -1297,
+  -66,
+  -95,
+  759,
+  -467,
+  -35,
+  1678,
+  -173,
+  -1290,
+  344,
+  487,
+  3,
+  -2209,
+  19,
+  -1236,
+  234,
+  1230,
+  -299,
+  -1309,
+  -559,
+  -1270,
+  1333,
+  1580,
+  -437,
+  541,
+  565,
+  -673,
+  643,
+  842,
+  -767,
+  157,
+  105,
+  -925,
+  -356,
+  -294,
+  -916,
+  1279,
+  45,
+  5,
+  -315,
+  796,
+  953,
+  110,
+  -1532,
+  10,
+  -436,
+  1536,
+  -1659,
+  745,
+  1684,
+  -1178,
+  -60,
+  -677,
+  -1883,
+  178,
+  1223,
+  -2586,
+  764,
+  -102,
+  1155,
+  -50,
+  876,
+  1412,
+  -1118,
+  -126,
+  -788,
+  958,
+  638,
+  -513,
+  607,
+  -92,
+  -593,
+  -499,
+  570,
+  -1984,
+  1368,
+  941,
+  -902,
+  -72,
+  923,
+  -2540,
+  603,
+  7,
+  -947,
+  -1009,
+  1591,
+  -726,
+  -1017,
+  286,
+  1420,
+  1499,
+  234,
+  -885,
+  -431,
+  -1233,
+  -596,
+  143,
+  896,
+  -1855,
+  292,
+  -208,
+  851,
+  595,
+  -245,
+  -770,
+  605,
+  1157,
+  590,
+  535,
+  -476,
+  -1681,
+  -686,
+  13,
+  767,
+  868,
+  -828,
+  -1721,
+  1719,
+  845,
+  1293,
+  -1410,
+  1274,
+  273,
+  -294,
+  1364,
+  10,
+  611,
+  818,
+  -1003,
+  -366,
+  171,
+  -68,
+  1024,
+  223,
+  1634,
+  522,
+  3,
+  328,
+  -1146,
+  -1000,
+  526,
+  117,
+  -919,
+  -670,
+  1116,
+  918,
+  523,
+  -1643,
+  -1243,
+  396,
+  507,
+  208,
+  241,
+  811,
+  538,
+  -977,
+  -602,
+  -747,
+  -101,
+  -1333,
+  1371,
+  -454,
+  -154,
+  -1635,
+  -399,
+  -1050,
+  431,
+  227,
+  809,
+  1052,
+  226,
+  -855,
+  199,
+  -392,
+  78,
+  884,
+  280,
+  1381,
+  490,
+  -1315,
+  -1522,
+  -254,
+  -991,
+  2164,
+  2195,
+  23,
+  404,
+  682,
+  -1137,
+  -9,
+  1232,
+  -217,
+  -585,
+  1221,
+  550,
+  -966,
+  -1056,
+  -83,
+  296,
+  594,
+  1324,
+  -1538,
+  304,
+  528,
+  698,
+  437,
+  1944,
+  -454,
+  -789,
+  213,
+  -22,
+  201,
+  36,
+  341,
+  -750,
+  517,
+  979,
+  -99,
+  -967,
+  -1142,
+  1262,
+  -436,
+  -2301,
+  -2146,
+  905,
+  -883,
+  -1753,
+  824,
+  1598,
+  123,
+  818,
+  62,
+  1647,
+  2182,
+  -1002,
+  1271,
+  290,
+  -25,
+  -249,
+  -1727,
+  560,
+  1125,
+  -403,
+  115,
+  -501,
+  -2075,
+  770,
+  69,
+  1044,
+  -1672,
+  -405,
+  1381,
+  877,
+  -1747,
+  -366,
+  317,
+  -63,
+  1705,
+  1130,
+  -913,
+  871,
+  737,
+  -134,
+  -2187,
+  -114,
+  -690,
+  -646,
+  953,
+  -806,
+  -1051,
+  -104,
+  -711,
+  1959,
+  -570,
+  230,
+  220,
+  295,
+  349,
+  -1148,
+  -336,
+  -1604,
+  -648,
+  -421,
+  42,
+  1086,
+  2628,
+  568,
+  -528,
+  1731,
+  18,
+  586,
+  -1314,
+  422,
+  -1591,
+  1000,
+  -927,
+  129,
+  581,
+  -2170,
+  821,
+  479,
+  623,
+  -541,
+  644,
+  -1125,
+  1262,
+  -389,
+  639,
+  580,
+  1448,
+  -959,
+  -235,
+  -1404,
+  1179,
+  -782,
+  2424,
+  295,
+  -835,
+  -154,
+  288,
+  1230,
+  951,
+  -470,
+  144,
+  881,
+  2274,
+  -1303,
+  803,
+  -275,
+  -1084,
+  39,
+  -1358,
+  682,
+  -236,
+  205,
+  -85,
+  -424,
+  -1525,
+  -535,
+  -460,
+  879,
+  2331,
+  -422,
+  501,
+  -1032,
+  843,
+  365,
+  2372,
+  680,
+  -35,
+  396,
+  -4,
+  -2081,
+  2786,
+  -1946,
+  -1158,
+  519,
+  833,
+  125,
+  -1570,
+  353,
+  -142,
+  -1990,
+  1305,
+  280,
+  50,
+  -147,
+  -942,
+  -965,
+  -696,
+  201,
+  342,
+  -245,
+  -1718,
+  -361,
+  172,
+  -1919,
+  -1448,
+  502,
+  -328,
+  935,
+  343,
+  899,
+  -1200,
+  82,
+  -717,
+  17,
+  813,
+  1225,
+  -55,
+  -170,
+  671,
+  -282,
+  241,
+  -453,
+  -465,
+  1333,
+  849,
+  -1021,
+  873,
+  -542,
+  -1831,
+  33,
+  -130,
+  614,
+  937,
+  96,
+  -906,
+  1762,
+  -809,
+  -349,
+  -1516,
+  787,
+  338,
+  416,
+  1352,
+  -2172,
+  -353,
+  760,
+  464,
+  -583,
+  -50,
+  1280,
+  204,
+  -2262,
+  240,
+  1610,
+  479,
+  486,
+  502,
+  -328,
+  -449,
+  -1041,
+  -1149,
+  888,
+  1082,
+  402,
+  337,
+  504,
+  -264,
+  829,
+  419,
+  602,
+  -454,
+  -14,
+  207,
+  745,
+  661,
+  417,
+  -168,
+  1571,
+  797,
+  -151,
+  -896,
+  491,
+  20,
+  612,
+  -292,
+  -1325,
+  1185,
+  -529,
+  -1190,
+  -385,
+  1301,
+  1310,
+  147,
+  -1174,
+  -247,
+  25,
+  -933,
+  -391,
+  -231,
+  -348,
+  -643,
+  -1998,
+  -557,
+  933,
+  -393,
+  -707,
+  -1619,
+  710,
+  -1088,
+  -1392,
+  -1107,
+  -1153,
+  -294,
+  739,
+  607,
+  -373,
+  660,
+  155,
+  1200,
+  -247,
+  -548,
+  -520,
+  -1486,
+  -1768,
+  1327,
+  -1410,
+  226,
+  43,
+  -918,
+  -1557,
+  -600,
+  221,
+  -1501,
+  -738,
+  -817,
+  66,
+  -859,
+  -1543,
+  -1140,
+  292,
+  -1989,
+  2040,
+  1221,
+  -927,
+  -348,
+  -110,
+  389,
+  -1656,
+  800,
+  509,
+  408,
+  -2522,
+  666,
+  617,
+  -1829,
+  457,
+  154,
+  1612,
+  654,
+  1224,
+  2072,
+  -266,
+  -985,
+  -99,
+  247,
+  -165,
+  1764,
+  -341,
+  1508,
+  1308,
+  231,
+  492,
+  -1395,
+  2020,
+  398,
+  -651,
+  241,
+  298,
+  -1126,
+  -401,
+  -629,
+  -1072,
+  1520,
+  -80,
+  -422,
+  -2181,
+  528,
+  243,
+  1740,
+  -2102,
+  -627,
+  281,
+  -1597,
+  -526,
+  1145,
+  -727,
+  -747,
+  237,
+  777,
+  -689,
+  -933,
+  -606,
+  -180,
+  1357,
+  2386,
+  -283,
+  -329,
+  1507,
+  1442,
+  -1372,
+  724,
+  -1282,
+  -263,
+  949,
+  -1887,
+  -229,
+  -1244,
+  -682,
+  -372,
+  691,
+  1856,
+  364,
+  637,
+  219,
+  -2015,
+  332,
+  -262,
+  699,
+  -115,
+  -855,
+  775,
+  737,
+  -441,
+  -189,
+  199,
+  291,
+  -113,
+  -86,
+  -787,
+  594,
+  835,
+  965,
+  -882,
+  429,
+  -1087,
+  -842,
+  83,
+  -383,
+  -517,
+  268,
+  400,
+  -146,
+  -1308,
+  -1028,
+  238,
+  387,
+  -1441,
+  715,
+  867,
+  1131,
+  -185,
+  1420,
+  1130,
+  408,
+  546,
+  -1413,
+  -1326,
+  -286,
+  -505,
+  181,
+  23,
+  1482,
+  1874,
+  -1290,
+  782,
+  839,
+  -1172,
+  276,
+  -746,
+  621,
+  -975,
+  -362,
+  1007,
+  -395,
+  182,
+  -1150,
+  1484,
+  460,
+  -830,
+  571,
+  -318,
+  -1135,
+  -981,
+  623,
+  1006,
+  777,
+  -2044,
+  996,
+  629,
+  1534,
+  1828,
+  777,
+  305,
+  777,
+  -14,
+  548,
+  -623,
+  1380,
+  954,
+  -128,
+  -498,
+  406,
+  -352,
+  478,
+  -502,
+  -136,
+  -13,
+  -1322,
+  -1336,
+  531,
+  1125,
+  -488,
+  -664,
+  -807,
+  -50,
+  -437,
+  -812,
+  -187,
+  773,
+  2345,
+  -121,
+  -1198,
+  -1084,
+  -255,
+  1323,
+  625,
+  186,
+  -812,
+  186,
+  2077,
+  573,
+  461,
+  -1779,
+  -888,
+  208,
+  876,
+  -685,
+  -536,
+  -306,
+  2024,
+  -1542,
+  -1715,
+  226,
+  -161,
+  -654,
+  -1077,
+  977,
+  618,
+  977,
+  -147,
+  -498,
+  1119,
+  108,
+  791,
+  524,
+  -1048,
+  522,
+  889,
+  84,
+  123,
+  -147,
+  -2203,
+  -983,
+  -121,
+  463,
+  -1412,
+  -583,
+  -605,
+  -952,
+  931,
+  -121,
+  417,
+  -507,
+  1082,
+  -785,
+  779,
+  940,
+  -2189,
+  -38,
+  235,
+  -1399,
+  797,
+  -3,
+  303,
+  442,
+  954,
+  266,
+  -2073,
+  372,
+  -512,
+  -781,
+  479,
+  1704,
+  -3725,
+  -1453,
+  824,
+  -1175,
+  2226,
+  -2,
+  -519,
+  2051,
+  806,
+  -289,
+  290,
+  -209,
+  -1612,
+  -1218,
+  329,
+  -1582,
+  528,
+  -590,
+  1922,
+  -2900,
+  1082,
+  1511,
+  -1087,
+  491,
+  -1554,
+  1220,
+  256,
+  2057,
+  -120,
+  200,
+  252,
+  459,
+  570,
+  -517,
+  -151,
+  1399,
+  192,
+  153,
+  773,
+  -576,
+  54,
+  369,
+  -572,
+  1455,
+  -30,
+  32,
+  452,
+  311,
+  -2180,
+  -840,
+  -614,
+  353,
+  957,
+  1697,
+  -389,
+  -1996,
+  1598,
+  780,
+  -603,
+  -1769,
+  -1133,
+  1431,
+  1235,
+  890,
+  1003,
+  -668,
+  -177,
+  -222,
+  653,
+  -236,
+  1794,
+  -275,
+  -432,
+  -2591,
+  1050,
+  322,
+  267,
+  -344,
+  -378,
+  759,
+  -1276,
+  -662,
+  1830,
+  -539,
+  150,
+  851,
+  -526,
+  656,
+  -1218,
+  1750,
+  -1756,
+  -678,
+  1651,
+  976,
+  -1704,
+  957,
+  -2290,
+  515,
+  -269,
+  -257,
+  113,
+  2583,
+  1044,
+  428,
+  -606,
+  -2459,
+  211,
+  154,
+  -399,
+  642,
+  -2162,
+  -1215,
+  -8,
+  -616,
+  -1307,
+  -687,
+  -1924,
+  428,
+  -1424,
+  257,
+  -11,
+  1243,
+  -2,
+  2302,
+  135,
+  -96,
+  107,
+  461,
+  11,
+  1069,
+  2880,
+  -1994,
+  -1869,
+  -382,
+  293,
+  25,
+  -47,
+  -370,
+  553,
+  360,
+  -310,
+  -444,
+  -325,
+  -2906,
+  -627,
+  -573,
+  -914,
+  -233,
+  754,
+  -210,
+  606,
+  -961,
+  807,
+  -269,
+  -808,
+  -293,
+  340,
+  1134,
+  917,
+  -145,
+  -51,
+  693,
+  1323,
+  1130,
+  -1179,
+  -1890,
+  -477,
+  421,
+  456,
+  -1374,
+  -2332,
+  -1373,
+  1518,
+  -233,
+  259,
+  437,
+  737,
+  -1672,
+  -1978,
+  -349,
+  68,
+  257,
+  -189,
+  -168,
+  143,
+  389,
+  167,
+  752,
+  1449,
+  28,
+  -145,
+  -193,
+  442,
+  1042,
+  -1096,
+  1410,
+  -2591,
+  44,
+  892,
+  233,
+  -582,
+  954,
+  -887,
+  73,
+  -1505,
+  1527,
+  2796,
+  79,
+  -1137,
+  1009,
+  -1681,
+  -1381,
+  -612,
+  -926,
+  722,
+  -831,
+  2161,
+  -288,
+  -302,
+  2212,
+  -17,
+  1587,
+  -645,
+  981,
+  -808,
+  846,
+  -2072,
+  895,
+  33,
+  -563,
+  291,
+  -1590,
+  496,
+  -30,
+  -550,
+  -1804,
+  625,
+  -969,
+  514,
+  814,
+  -1098,
+  -346,
+  483,
+  1669,
+  -94,
+  -242,
+  24,
+  -548,
+  1057,
+  -611,
+  1484,
+  -706,
+  1833,
+  405,
+  -1414,
+  372,
+  -331,
+  450,
+  908,
+  2073,
+  -1261,
+  -1568,
+  -2089,
+  17,
+  374,
+  213,
+  -39,
+  -1114,
+  472,
+  -2106,
+  -294,
+  -1247,
+  729,
+  1546,
+  -1874,
+  -199,
+  722,
+  -1655,
+  1207,
+  46,
+  -731,
+  -1487,
+  -620,
+  -1610,
+  174,
+  1990,
+  597,
+  1016,
+  -312,
+  1883,
+  -1128,
+  517,
+  1670,
+  612,
+  -673,
+  -699,
+  1330,
+  -520,
+  1684,
+  816,
+  1015,
+  401,
+  613,
+  -750,
+  -574,
+  638,
+  -443,
+  -766,
+  719,
+  -631,
+  -1189,
+  -374,
+  -222,
+  2310,
+  2180,
+  728,
+  -888,
+  1920,
+  -1095,
+  799,
+  624,
+  153,
+  -1179,
+  362,
+  -735,
+  -91,
+  1319,
+  623,
+  650,
+  -374,
+  85,
+  -557,
+  -1102,
+  1693,
+  138,
+  616,
+  1071,
+  283,
+  483,
+  -338,
+  494,
+  4,
+  -541,
+  -3257,
+  -1107,
+  -6,
+  -585,
+  -1834,
+  -2353,
+  15,
+  -643,
+  -1279,
+  621,
+  -297,
+  -566,
+  1006,
+  -69,
+  -363,
+  -2168,
+  -362,
+  -653,
+  -1568,
+  28,
+  282,
+  -507,
+  -808,
+  277,
+  436,
+  -2408,
+  1334,
+  -477,
+  -627,
+  668,
+  -881,
+  1134,
+  282,
+  662,
+  337,
+  675,
+  520,
+  99,
+  -726,
+  332,
+  101,
+  -1330,
+  287,
+  -1278,
+  -715,
+  44,
+  -1092,
+  -99,
+  -1494,
+  2055,
+  1558,
+  499,
+  2089,
+  390,
+  -383,
+  -700,
+  -213,
+  -659,
+  296,
+  -1242,
+  482,
+  -1652,
+  823,
+  -1705,
+  -691,
+  66,
+  383,
+  1462,
+  1563,
+  50,
+  800,
+  401,
+  -82,
+  236,
+  -796,
+  -516,
+  1280,
+  -888,
+  -1717,
+  -947,
+  783,
+  829,
+  -876,
+  -993,
+  745,
+  300,
+  -120,
+  -331,
+  399,
+  -1869,
+  1738,
+  716,
+  -321,
+  185,
+  1225,
+  -1262,
+  -531,
+  -476,
+  1181,
+  -2398,
+  1482,
+  -2,
+  -607,
+  -643,
+  -336,
+  1126,
+  -235,
+  -64,
+  929,
+  329,
+  -1445,
+  -1455,
+  -337,
+  -462,
+  1021,
+  -426,
+  -1692,
+  845,
+  746,
+  149,
+  969,
+  -1251,
+  245,
+  -207,
+  558,
+  -174,
+  -369,
+  -199,
+  -840,
+  986,
+  -711,
+  492,
+  1408,
+  -2038,
+  -372,
+  60,
+  1218,
+  -1151,
+  -432,
+  -603,
+  -221,
+  766,
+  786,
+  1826,
+  1148,
+  608,
+  -602,
+  -1202,
+  1987,
+  507,
+  547,
+  433,
+  1601,
+  -995,
+  840,
+  -1124,
+  -300,
+  361,
+  -1410,
+  -313,
+  116,
+  -973,
+  -18,
+  971,
+  564,
+  -640,
+  462,
+  -725,
+  -1899,
+  1988,
+  1820,
+  572,
+  334,
+  1274,
+  1497,
+  982,
+  1321,
+  -873,
+  -86,
+  -645,
+  -1108,
+  -1963,
+  176,
+  -863,
+  1230,
+  -1221,
+  -1539,
+  1015,
+  -989,
+  719,
+  -1061,
+  545,
+  -819,
+  -134,
+  160,
+  -530,
+  -340,
+  -102,
+  -1561,
+  815,
+  -130,
+  -646,
+  -752,
+  1274,
+  424,
+  -906,
+  128,
+  1319,
+  -1412,
+  -460,
+  1839,
+  2428,
+  149,
+  1974,
+  81,
+  59,
+  -667,
+  -1706,
+  -817,
+  -891,
+  674,
+  -503,
+  -1334,
+  -485,
+  1152,
+  689,
+  -657,
+  -110,
+  1346,
+  88,
+  121,
+  297,
+  282,
+  34,
+  -984,
+  699,
+  1244,
+  -258,
+  2,
+  -131,
+  1142,
+  467,
+  -945,
+  -404,
+  989,
+  -1107,
+  172,
+  -2118,
+  616,
+  1031,
+  170,
+  -1655,
+  2172,
+  -1954,
+  610,
+  2157,
+  -159,
+  -195,
+  -242,
+  54,
+  499,
+  -1415,
+  -870,
+  1,
+  -43,
+  -792,
+  -1559,
+  -1243,
+  -27,
+  247,
+  -796,
+  1389,
+  -227,
+  1081,
+  -52,
+  633,
+  1206,
+  -2191,
+  -255,
+  576,
+  -588,
+  -1230,
+  192,
+  -969,
+  -204,
+  985,
+  -606,
+  999,
+  -111,
+  1148,
+  -888,
+  1322,
+  433,
+  -561,
+  1394,
+  242,
+  560,
+  -343,
+  1728,
+  403,
+  -1158,
+  1397,
+  -50,
+  -116,
+  -543,
+  814,
+  -106,
+  -905,
+  692,
+  -243,
+  -669,
+  671,
+  138,
+  -2245,
+  1129,
+  273,
+  -96,
+  117,
+  395,
+  -284,
+  -297,
+  -614,
+  1148,
+  1443,
+  770,
+  -1619,
+  570,
+  -765,
+  268,
+  778,
+  258,
+  -833,
+  480,
+  -463,
+  -1666,
+  754,
+  778,
+  577,
+  -376,
+  -611,
+  -1273,
+  -167,
+  -1997,
+  -1459,
+  1487,
+  1188,
+  -2351,
+  846,
+  913,
+  1698,
+  -561,
+  368,
+  -184,
+  -82,
+  529,
+  161,
+  657,
+  1946,
+  355,
+  930,
+  212,
+  -731,
+  -1457,
+  -1446,
+  585,
+  246,
+  -585,
+  74,
+  -1230,
+  -585,
+  -92,
+  330,
+  191,
+  -1282,
+  -562,
+  969,
+  -2859,
+  501,
+  30,
+  -256,
+  -1246,
+  2151,
+  -200,
+  -204,
+  1716,
+  -849,
+  -897,
+  350,
+  -232,
+  1158,
+  -673,
+  461,
+  -222,
+  -510,
+  505,
+  201,
+  -620,
+  -704,
+  743,
+  1479,
+  66,
+  -726,
+  673,
+  -349,
+  59,
+  -1303,
+  679,
+  683,
+  -654,
+  960,
+  438,
+  396,
+  -1383,
+  1220,
+  -409,
+  2683,
+  1063,
+  -24,
+  -1536,
+  133,
+  897,
+  -420,
+  -386,
+  -111,
+  2079,
+  -341,
+  2068,
+  -832,
+  317,
+  755,
+  -1263,
+  -1041,
+  -422,
+  -2115,
+  226,
+  1554,
+  -300,
+  1240,
+  958,
+  718,
+  1526,
+  348,
+  -216,
+  1328,
+  801,
+  -1323,
+  811,
+  -1072,
+  728,
+  -1799,
+  -397,
+  -1529,
+  44,
+  1825,
+  161,
+  -671,
+  -1303,
+  279,
+  175,
+  -1215,
+  875,
+  -200,
+  17,
+  215,
+  -2195,
+  -1254,
+  -838,
+  48,
+  -152,
+  -2211,
+  1707,
+  -1283,
+  -147,
+  -774,
+  9,
+  2553,
+  86,
+  -250,
+  -170,
+  1428,
+  397,
+  -562,
+  -159,
+  90,
+  467,
+  -1106,
+  -327,
+  -556,
+  261,
+  718,
+  3,
+  -1777,
+  465,
+  -80,
+  1189,
+  -747,
+  1632,
+  -428,
+  -369,
+  -883,
+  -1655,
+  -594,
+  1555,
+  341,
+  -1746,
+  1625,
+  97,
+  -31,
+  -713,
+  -624,
+  -1414,
+  -610,
+  -800,
+  1344,
+  1017,
+  -1258,
+  477,
+  -270,
+  2011,
+  1555,
+  340,
+  -1428,
+  2177,
+  1743,
+  -48,
+  -1596,
+  874,
+  -660,
+  233,
+  35,
+  -925,
+  142,
+  -1119,
+  -1130,
+  -1137,
+  -2569,
+  484,
+  -1175,
+  1235,
+  -923,
+  710,
+  492,
+  -1231,
+  708,
+  376,
+  170,
+  -246,
+  -342,
+  82,
+  -164,
+  556,
+  756,
+  1365,
+  -597,
+  1377,
+  1488,
+  -309,
+  -164,
+  226,
+  -394,
+  -3120,
+  1830,
+  -297,
+  -495,
+  -932,
+  939,
+  -184,
+  -803,
+  -1366,
+  1085,
+  -538,
+  560,
+  -681,
+  279,
+  422,
+  1313,
+  451,
+  250,
+  447,
+  411,
+  -959,
+  165,
+  -549,
+  -517,
+  617,
+  -237,
+  359,
+  -1601,
+  81,
+  -311,
+  -763,
+  -1289,
+  1252,
+  -824,
+  -183,
+  -87,
+  855,
+  1785,
+  199,
+  -316,
+  869,
+  -931,
+  20,
+  -3,
+  -528,
+  345,
+  -773,
+  -710,
+  -810,
+  165,
+  502,
+  -324,
+  715,
+  -924,
+  1052,
+  525,
+  84,
+  1119,
+  -1209,
+  -864,
+  1525,
+  -519,
+  263,
+  -495,
+  1276,
+  -657,
+  -5,
+  -621,
+  564,
+  -485,
+  1356,
+  -702,
+  537,
+  625,
+  497,
+  2617,
+  2507,
+  482,
+  1267,
+  -796,
+  288,
+  -34,
+  -590,
+  1344,
+  584,
+  493,
+  -75,
+  759,
+  -523,
+  1129,
+  167,
+  810,
+  1568,
+  2448,
+  -457,
+  -147,
+  1060,
+  376,
+  -246,
+  156,
+  -1284,
+  573,
+  25,
+  -1087,
+  -521,
+  -427,
+  1810,
+  1300,
+  -442,
+  19,
+  799,
+  881,
+  -375,
+  1510,
+  -937,
+  -1397,
+  907,
+  1833,
+  2710,
+  -705,
+  -173,
+  -1094,
+  -93,
+  116,
+  -1982,
+  136,
+  -1939,
+  -921,
+  972,
+  184,
+  201,
+  -868,
+  -908,
+  937,
+  384,
+  25,
+  183,
+  1165,
+  -490,
+  -1872,
+  1446,
+  -794,
+  1515,
+  -1328,
+  -1781,
+  -822,
+  -231,
+  -1230,
+  -759,
+  -1600,
+  -544,
+  -880,
+  127,
+  -515,
+  -12,
+  -1013,
+  -186,
+  1886,
+  1674,
+  1761,
+  -881,
+  893,
+  -625,
+  553,
+  265,
+  -1213,
+  357,
+  -990,
+  -1364,
+  -478,
+  221,
+  -1170,
+  1162,
+  -274,
+  433,
+  -652,
+  748,
+  -1486,
+  -1675,
+  913,
+  859,
+  -476,
+  834,
+  1654,
+  -1471,
+  -1232,
+  -503,
+  -1312,
+  997,
+  -669,
+  1423,
+  271,
+  -423,
+  -666,
+  816,
+  788,
+  289,
+  513,
+  -979,
+  426,
+  199,
+  970,
+  250,
+  2624,
+  -1300,
+  450,
+  411,
+  526,
+  -1581,
+  -1026,
+  581,
+  1163,
+  268,
+  -707,
+  1089,
+  -1928,
+  1148,
+  762,
+  1204,
+  -94,
+  -405,
+  135,
+  -1005,
+  45,
+  -84,
+  -1661,
+  293,
+  56,
+  694,
+  1361,
+  465,
+  -386,
+  -434,
+  -180,
+  -928,
+  255,
+  241,
+  489,
+  -1232,
+  -707,
+  -212,
+  1298,
+  582,
+  71,
+  -341,
+  166,
+  -44,
+  -45,
+  -79,
+  -901,
+  341,
+  -680,
+  -1401,
+  92,
+  464,
+  -420,
+  1465,
+  1181,
+  -427,
+  -414,
+  1497,
+  -362,
+  271,
+  163,
+  35,
+  -365,
+  -201,
+  -671,
+  -871,
+  671,
+  -1669,
+  -96,
+  815,
+  -1274,
+  -564,
+  756,
+  -250,
+  -760,
+  -1853,
+  104,
+  -419,
+  364,
+  -847,
+  789,
+  -50,
+  -662,
+  1045,
+  971,
+  -1416,
+  329,
+  -63,
+  -536,
+  -1612,
+  862,
+  -558,
+  -39,
+  545,
+  -717,
+  -1191,
+  -875,
+  172,
+  186,
+  404,
+  1006,
+  1628,
+  -574,
+  1010,
+  658,
+  -1373,
+  1191,
+  -18,
+  -270,
+  724,
+  1492,
+  -475,
+  700,
+  1299,
+  -210,
+  2023,
+  -1710,
+  592,
+  273,
+  -433,
+  38,
+  -605,
+  -975,
+  197,
+  -781,
+  -609,
+  487,
+  -1273,
+  -2042,
+  326,
+  -1307,
+  117,
+  668,
+  1287,
+  559,
+  750,
+  1478,
+  -1037,
+  2510,
+  -811,
+  224,
+  611,
+  464,
+  -694,
+  701,
+  -1126,
+  864,
+  1965,
+  -407,
+  -186,
+  -794,
+  1462,
+  781,
+  442,
+  659,
+  -1794,
+  266,
+  237,
+  1641,
+  -1090,
+  -535,
+  793,
+  -1076,
+  -3154,
+  -452,
+  -691,
+  368,
+  -940,
+  -903,
+  -454,
+  255,
+  1124,
+  143,
+  379,
+  670,
+  -378,
+  1217,
+  1746,
+  -51,
+  -700,
+  11,
+  -1265,
+  -236,
+  864,
+  -626,
+  993,
+  21,
+  -1453,
+  692,
+  -206,
+  327,
+  -658,
+  858,
+  -730,
+  -1546,
+  -1114,
+  1754,
+  236,
+  -1434,
+  -1049,
+  1214,
+  -2020,
+  962,
+  -372,
+  143,
+  852,
+  -164,
+  -1525,
+  120,
+  110,
+  -1713,
+  -1543,
+  -629,
+  -1222,
+  -867,
+  -2212,
+  -1562,
+  481,
+  2139,
+  -58,
+  189,
+  -425,
+  561,
+  -662,
+  451,
+  779,
+  -851,
+  1087,
+  3185,
+  -292,
+  -2047,
+  530,
+  1006,
+  -1769,
+  -659,
+  1435,
+  -1005,
+  -1139,
+  -1361,
+  -1845,
+  -1624,
+  -1259,
+  -280,
+  -509,
+  67,
+  1640,
+  918,
+  94,
+  -1109,
+  1283,
+  -221,
+  351,
+  -119,
+  1461,
+  -1334,
+  -544,
+  -481,
+  -610,
+  -1868,
+  -1027,
+  -205,
+  1151,
+  1122,
+  -1135,
+  -622,
+  470,
+  -584,
+  -1477,
+  311,
+  -141,
+  1875,
+  -487,
+  788,
+  -688,
+  1684,
+  668,
+  133,
+  832,
+  -1313,
+  -711,
+  1348,
+  368,
+  -994,
+  241,
+  -1047,
+  1745,
+  -243,
+  806,
+  -858,
+  544,
+  -836,
+  -1316,
+  -60,
+  306,
+  -1009,
+  -972,
+  -659,
+  -1404,
+  452,
+  251,
+  1564,
+  -909,
+  1926,
+  439,
+  -69,
+  -437,
+  271,
+  1823,
+  -1986,
+  26,
+  -174,
+  1051,
+  -2006,
+  -67,
+  180,
+  278,
+  -712,
+  687,
+  -777,
+  878,
+  1496,
+  384,
+  255,
+  -1880,
+  -2082,
+  -1443,
+  -492,
+  -1539,
+  247,
+  -366,
+  -611,
+  205,
+  353,
+  652,
+  1449,
+  -1351,
+  -1074,
+  156,
+  -13,
+  -416,
+  -154,
+  284,
+  1175,
+  -1843,
+  1075,
+  -1408,
+  -2041,
+  934,
+  896,
+  -339,
+  276,
+  723,
+  -669,
+  -364,
+  -1756,
+  256,
+  -1359,
+  -422,
+  941,
+  -2109,
+  -480,
+  -1237,
+  1199,
+  793,
+  -381,
+  -938,
+  -82,
+  -431,
+  1635,
+  -1590,
+  -4,
+  -827,
+  229,
+  17,
+  1008,
+  -329,
+  1434,
+  -2013,
+  -1323,
+  323,
+  -138,
+  -1807,
+  -1621,
+  290,
+  266,
+  3286,
+  -948,
+  -2153,
+  2001,
+  -284,
+  -938,
+  -929,
+  -587,
+  752,
+  1136,
+  -461,
+  553,
+  -659,
+  -375,
+  -433,
+  -537,
+  -907,
+  -940,
+  393,
+  -81,
+  -1252,
+  -1707,
+  589,
+  -1642,
+  792,
+  -301,
+  797,
+  172,
+  -451,
+  296,
+  506,
+  -1744,
+  874,
+  -790,
+  1379,
+  -522,
+  353,
+  -415,
+  413,
+  -1424,
+  1995,
+  -860,
+  788,
+  -875,
+  667,
+  -645,
+  427,
+  975,
+  -216,
+  431,
+  -1479,
+  -82,
+  -1160,
+  411,
+  -602,
+  184,
+  368,
+  558,
+  627,
+  -997,
+  510,
+  1342,
+  147,
+  -1056,
+  -487,
+  25,
+  -874,
+  1158,
+  -1474,
+  41,
+  1307,
+  -1109,
+  -1022,
+  771,
+  -264,
+  1247,
+  -501,
+  306,
+  1141,
+  -364,
+  236,
+  -597,
+  -420,
+  1466,
+  -645,
+  -248,
+  -1508,
+  36,
+  -1476,
+  -2953,
+  -530,
+  1785,
+  211,
+  9,
+  123,
+  -1826,
+  -1282,
+  161,
+  -1232,
+  -216,
+  881,
+  113,
+  900,
+  79,
+  -1300,
+  -1510,
+  304,
+  -73,
+  -518,
+  -110,
+  -2165,
+  669,
+  -2280,
+  504,
+  603,
+  868,
+  -857,
+  -880,
+  -871,
+  -726,
+  1344,
+  -1254,
+  677,
+  525,
+  1988,
+  402,
+  -7,
+  441,
+  -686,
+  -493,
+  -822,
+  123,
+  200,
+  1515,
+  -132,
+  1057,
+  509,
+  192,
+  46,
+  515,
+  -241,
+  659,
+  -1457,
+  1143,
+  1551,
+  512,
+  -224,
+  -413,
+  -1022,
+  859,
+  1060,
+  832,
+  -744,
+  1428,
+  1326,
+  -428,
+  -340,
+  949,
+  1869,
+  -549,
+  -442,
+  814,
+  -1568,
+  -328,
+  655,
+  418,
+  -846,
+  -405,
+  -94,
+  1649,
+  -1279,
+  524,
+  -1767,
+  -155,
+  263,
+  -786,
+  -318,
+  -69,
+  1238,
+  -1076,
+  -2391,
+  344,
+  1868,
+  -2709,
+  608,
+  86,
+  544,
+  -1068,
+  -633,
+  -1016,
+  -46,
+  3153,
+  -592,
+  468,
+  1809,
+  -1905,
+  -693,
+  -134,
+  1622,
+  -33,
+  1431,
+  1342,
+  -1,
+  205,
+  631,
+  -1678,
+  -1194,
+  1663,
+  1016,
+  538,
+  54,
+  -57,
+  1208,
+  -530,
+  313,
+  1179,
+  -835,
+  991,
+  -1051,
+  -74,
+  790,
+  308,
+  -230,
+  -2471,
+  105,
+  662,
+  714,
+  817,
+  907,
+  -997,
+  -392,
+  339,
+  1738,
+  125,
+  -210,
+  948,
+  685,
+  108,
+  1279,
+  1110,
+  -1053,
+  -697,
+  6,
+  -144,
+  871,
+  564,
+  501,
+  -1255,
+  -572,
+  -740,
+  1598,
+  -1239,
+  -1821,
+  -822,
+  1796,
+  -251,
+  537,
+  -1485,
+  166,
+  -638,
+  423,
+  507,
+  -1134,
+  450,
+  675,
+  -2136,
+  -899,
+  625,
+  -1652,
+  619,
+  403,
+  1291,
+  -516,
+  -832,
+  -399,
+  1335,
+  126,
+  986,
+  1395,
+  351,
+  1635,
+  -700,
+  847,
+  -1495,
+  -915,
+  928,
+  493,
+  776,
+  -548,
+  -1592,
+  -638,
+  -127,
+  -1630,
+  -1108,
+  -475,
+  0,
+  861,
+  -223,
+  742,
+  -258,
+  401,
+  2537,
+  -819,
+  1693,
+  661,
+  1367,
+  -444,
+  126,
+  97,
+  -926,
+  -510,
+  618,
+  -1763,
+  -1305,
+  82,
+  -2545,
+  71,
+  -2347,
+  -1245,
+  394,
+  1210,
+  538,
+  804,
+  -2605,
+  -1325,
+  -1405,
+  -1421,
+  -1917,
+  1276,
+  -2328,
+  187,
+  736,
+  509,
+  -1503,
+  1607,
+  -735,
+  890,
+  282,
+  -1382,
+  507,
+  191,
+  -713,
+  594,
+  137,
+  -692,
+  1784,
+  167,
+  -541,
+  -849,
+  -241,
+  1088,
+  1,
+  -437,
+  41,
+  -562,
+  -1611,
+  -1368,
+  -59,
+  760,
+  -1361,
+  -2693,
+  -1123,
+  1061,
+  464,
+  262,
+  164,
+  751,
+  -916,
+  -457,
+  327,
+  -218,
+  505,
+  747,
+  -762,
+  1616,
+  -131,
+  1121,
+  555,
+  942,
+  374,
+  -2459,
+  916,
+  1499,
+  -404,
+  1078,
+  -275,
+  -1000,
+  1119,
+  -899,
+  -1957,
+  -94,
+  -963,
+  44,
+  -105,
+  1811,
+  -315,
+  112,
+  198,
+  -167,
+  -652,
+  -255,
+  -275,
+  1140,
+  -654,
+  34,
+  -856,
+  -1932,
+  -366,
+  -329,
+  166,
+  1037,
+  -236,
+  -613,
+  1484,
+  2256,
+  -846,
+  527,
+  1640,
+  44,
+  90,
+  645,
+  738,
+  -64,
+  -1137,
+  -674,
+  329,
+  32,
+  1425,
+  -593,
+  237,
+  1412,
+  -65,
+  -61,
+  -639,
+  -1000,
+  -176,
+  -1947,
+  298,
+  -735,
+  509,
+  -331,
+  -259,
+  -894,
+  197,
+  741,
+  -2368,
+  443,
+  -723,
+  1413,
+  270,
+  -849,
+  -1248,
+  69,
+  -432,
+  1316,
+  -36,
+  1011,
+  851,
+  1051,
+  1812,
+  1164,
+  201,
+  -1351,
+  -558,
+  225,
+  817,
+  -1989,
+  1098,
+  -1516,
+  -1003,
+  807,
+  335,
+  737,
+  -302,
+  -461,
+  -683,
+  -882,
+  -98,
+  -19,
+  135,
+  -41,
+  101,
+  -530,
+  -1200,
+  178,
+  -1495,
+  -1888,
+  -4055,
+  -1025,
+  754,
+  993,
+  2196,
+  1245,
+  1693,
+  -228,
+  -1709,
+  -69,
+  -1117,
+  -1,
+  -692,
+  1029,
+  471,
+  -280,
+  -740,
+  2222,
+  -858,
+  -939,
+  -1649,
+  -864,
+  444,
+  -578,
+  -714,
+  1551,
+  -2288,
+  411,
+  -321,
+  779,
+  -508,
+  1404,
+  -189,
+  1460,
+  -926,
+  -630,
+  569,
+  -350,
+  1374,
+  1986,
+  697,
+  -266,
+  491,
+  144,
+  -488,
+  1568,
+  -306,
+  1258,
+  2518,
+  1575,
+  -67,
+  -1613,
+  126,
+  1548,
+  414,
+  -376,
+  325,
+  2616,
+  1627,
+  384,
+  -1510,
+  -499,
+  -1550,
+  -2020,
+  -622,
+  305,
+  -79,
+  -414,
+  757,
+  1439,
+  235,
+  392,
+  1422,
+  504,
+  -1196,
+  74,
+  285,
+  566,
+  -307,
+  -285,
+  565,
+  -51,
+  417,
+  -231,
+  1081,
+  -2298,
+  2874,
+  480,
+  695,
+  -293,
+  114,
+  584,
+  1161,
+  -24,
+  259,
+  -1043,
+  -723,
+  1692,
+  -2298,
+  374,
+  -378,
+  -1170,
+  -440,
+  -1292,
+  37,
+  -1579,
+  1435,
+  485,
+  -625,
+  42,
+  -336,
+  -377,
+  -190,
+  -864,
+  632,
+  2222,
+  -204,
+  -1107,
+  -1128,
+  -885,
+  1490,
+  1287,
+  -56,
+  996,
+  768,
+  -926,
+  -772,
+  1054,
+  -859,
+  301,
+  1554,
+  1605,
+  1994,
+  -605,
+  -738,
+  -363,
+  483,
+  18,
+  -839,
+  1605,
+  1657,
+  -945,
+  -798,
+  1352,
+  -546,
+  -1683,
+  487,
+  1304,
+  -41,
+  -345,
+  794,
+  -315,
+  -669,
+  -35,
+  -1624,
+  -468,
+  96,
+  -622,
+  -1514,
+  -1893,
+  -516,
+  733,
+  -2036,
+  1299,
+  48,
+  -988,
+  1736,
+  -555,
+  -1481,
+  -1689,
+  316,
+  428,
+  -331,
+  -1154,
+  995,
+  -1391,
+  -759,
+  -115,
+  2230,
+  80,
+  1880,
+  -662,
+  1638,
+  731,
+  -1239,
+  -33,
+  -92,
+  -298,
+  -87,
+  616,
+  140,
+  768,
+  -44,
+  1413,
+  677,
+  -1790,
+  -839,
+  649,
+  -149,
+  -1260,
+  -642,
+  -96,
+  1548,
+  592,
+  1384,
+  777,
+  719,
+  -310,
+  -1496,
+  -519,
+  -1900,
+  -202,
+  2002,
+  -4,
+  625,
+  -294,
+  278,
+  2,
+  374,
+  1435,
+  -776,
+  -1380,
+  -201,
+  -125,
+  -114,
+  -1330,
+  1222,
+  783,
+  -595,
+  1157,
+  -194,
+  660,
+  -241,
+  -706,
+  455,
+  -37,
+  -535,
+  -92,
+  -2402,
+  -583,
+  92,
+  1713,
+  -794,
+  264,
+  -526,
+  404,
+  -922,
+  631,
+  -550,
+  573,
+  -397,
+  -109,
+  543,
+  820,
+  -302,
+  283,
+  33,
+  -64,
+  -893,
+  900,
+  -786,
+  -215,
+  1425,
+  -281,
+  955,
+  -150,
+  -913,
+  -480,
+  175,
+  -38,
+  170,
+  1867,
+  1093,
+  -445,
+  -1845,
+  511,
+  1806,
+  -242,
+  325,
+  -665,
+  -692,
+  -1004,
+  -245,
+  -918,
+  981,
+  1116,
+  -831,
+  -383,
+  -2144,
+  153,
+  492,
+  95,
+  548,
+  -398,
+  -33,
+  611,
+  -392,
+  -486,
+  -558,
+  92,
+  724,
+  1035,
+  525,
+  -159,
+  -1318,
+  262,
+  -1873,
+  1379,
+  1650,
+  -584,
+  1111,
+  -815,
+  466,
+  986,
+  -1647,
+  432,
+  -1993,
+  612,
+  366,
+  -1263,
+  581,
+  319,
+  1311,
+  1102,
+  -1421,
+  -817,
+  950,
+  1166,
+  -332,
+  711,
+  -451,
+  -1038,
+  1740,
+  571,
+  764,
+  -2008,
+  -831,
+  -1901,
+  -175,
+  -157,
+  -496,
+  -12,
+  470,
+  -690,
+  -148,
+  -107,
+  2302,
+  67,
+  422,
+  1526,
+  895,
+  58,
+  959,
+  -971,
+  -891,
+  -1608,
+  822,
+  2141,
+  221,
+  1310,
+  -1325,
+  1220,
+  2355,
+  -152,
+  -272,
+  -302,
+  -1227,
+  -1773,
+  -298,
+  841,
+  -811,
+  57,
+  -92,
+  60,
+  35,
+  1683,
+  -720,
+  2238,
+  1628,
+  -2307,
+  -374,
+  774,
+  61,
+  107,
+  606,
+  1355,
+  131,
+  -229,
+  114,
+  66,
+  -460,
+  -1739,
+  -100,
+  -1358,
+  -2433,
+  -2855,
+  348,
+  531,
+  -448,
+  -1607,
+  -349,
+  652,
+  -302,
+  9,
+  -425,
+  642,
+  598,
+  -329,
+  -1155,
+  335,
+  707,
+  -701,
+  194,
+  640,
+  -921,
+  -2270,
+  -441,
+  555,
+  624,
+  745,
+  -414,
+  -251,
+  -619,
+  -1120,
+  -239,
+  1080,
+  90,
+  -1651,
+  -1025,
+  -1370,
+  -408,
+  -909,
+  -137,
+  220,
+  -1181,
+  -614,
+  1994,
+  -678,
+  -1143,
+  561,
+  -565,
+  185,
+  1254,
+  989,
+  1071,
+  2553,
+  174,
+  -811,
+  9,
+  -226,
+  -78,
+  -457,
+  -708,
+  53,
+  1589,
+  1129,
+  452,
+  2196,
+  236,
+  268,
+  -295,
+  -1326,
+  -275,
+  -998,
+  913,
+  -1402,
+  -745,
+  -892,
+  823,
+  -131,
+  -2051,
+  1501,
+  -965,
+  796,
+  452,
+  176,
+  510,
+  1353,
+  -208,
+  -470,
+  958,
+  602,
+  -514,
+  176,
+  660,
+  1463,
+  -35,
+  -704,
+  898,
+  428,
+  459,
+  -2393,
+  -22,
+  -862,
+  275,
+  240,
+  894,
+  715,
+  2074,
+  -18,
+  981,
+  425,
+  -145,
+  1119,
+  401,
+  -1382,
+  -1199,
+  630,
+  4,
+  1279,
+  -409,
+  -412,
+  -244,
+  372,
+  -762,
+  739,
+  -65,
+  -747,
+  -631,
+  -516,
+  300,
+  610,
+  -453,
+  219,
+  1194,
+  -474,
+  -411,
+  -194,
+  850,
+  -961,
+  1096,
+  233,
+  639,
+  127,
+  763,
+  -210,
+  -41,
+  466,
+  -793,
+  -1813,
+  -1223,
+  905,
+  1898,
+  895,
+  393,
+  -616,
+  761,
+  -1277,
+  -401,
+  766,
+  1311,
+  -2248,
+  299,
+  295,
+  453,
+  1760,
+  -335,
+  -2,
+  -1054,
+  -928,
+  1777,
+  184,
+  -2070,
+  -338,
+  1047,
+  1550,
+  -566,
+  633,
+  -138,
+  -806,
+  -69,
+  -574,
+  -125,
+  98,
+  -724,
+  -249,
+  -2111,
+  -487,
+  -438,
+  159,
+  526,
+  -11,
+  -1764,
+  441,
+  -1388,
+  -2331,
+  535,
+  -1788,
+  -1349,
+  -1435,
+  2564,
+  1453,
+  -1190,
+  441,
+  976,
+  -492,
+  449,
+  655,
+  -1584,
+  1282,
+  535,
+  604,
+  -1547,
+  579,
+  309,
+  1870,
+  -175,
+  -660,
+  -1265,
+  257,
+  739,
+  125,
+  -334,
+  713,
+  1527,
+  1204,
+  1159,
+  -453,
+  2025,
+  -85,
+  -1549,
+  748,
+  270,
+  1781,
+  934,
+  -1342,
+  906,
+  -1618,
+  -1810,
+  -1792,
+  405,
+  -1212,
+  -1431,
+  -1626,
+  220,
+  838,
+  -191,
+  -1438,
+  -1705,
+  864,
+  234,
+  -1585,
+  -3358,
+  -240,
+  858,
+  753,
+  657,
+  -299,
+  267,
+  -75,
+  1084,
+  -1929,
+  2532,
+  -534,
+  -1355,
+  -1085,
+  953,
+  -113,
+  1545,
+  117,
+  1141,
+  -222,
+  -726,
+  -1775,
+  877,
+  -507,
+  94,
+  -720,
+  -1316,
+  1133,
+  -232,
+  -169,
+  -1866,
+  155,
+  -1019,
+  -102,
+  -462,
+  -1140,
+  145,
+  -1128,
+  537,
+  -239,
+  1136,
+  1546,
+  12,
+  687,
+  660,
+  -747,
+  986,
+  -954,
+  -434,
+  -294,
+  -113,
+  7,
+  -603,
+  880,
+  1040,
+  816,
+  447,
+  -1215,
+  -760,
+  -187,
+  -856,
+  -1631,
+  453,
+  -627,
+  -6,
+  228,
+  -1537,
+  -775,
+  1269,
+  1361,
+  312,
+  1682,
+  -157,
+  898,
+  -261,
+  57,
+  575,
+  -739,
+  557,
+  56,
+  1027,
+  481,
+  -761,
+  -722,
+  1357,
+  -162,
+  238,
+  332,
+  -328,
+  -1085,
+  899,
+  1533,
+  40,
+  653,
+  -1301,
+  -406,
+  1694,
+  1360,
+  928,
+  239,
+  -315,
+  -1779,
+  727,
+  1840,
+  2,
+  -142,
+  -430,
+  -1600,
+  -1468,
+  -483,
+  721,
+  1847,
+  468,
+  606,
+  1531,
+  668,
+  569,
+  -392,
+  -919,
+  -1295,
+  321,
+  1796,
+  159,
+  -1340,
+  -1076,
+  -34,
+  457,
+  -2002,
+  202,
+  -1325,
+  -69,
+  -1013,
+  -2430,
+  257,
+  764,
+  -2162,
+  195,
+  -260,
+  1670,
+  2103,
+  -1255,
+  400,
+  -2250,
+  1120,
+  616,
+  -619,
+  361,
+  -886,
+  -168,
+  223,
+  -2054,
+  507,
+  247,
+  -558,
+  -218,
+  -989,
+  220,
+  -843,
+  -831,
+  163,
+  -3212,
+  -955,
+  285,
+  -1333,
+  -560,
+  -443,
+  -484,
+  -1360,
+  43,
+  -249,
+  -476,
+  1517,
+  -1714,
+  1909,
+  -1337,
+  -453,
+  1152,
+  1417,
+  -1047,
+  -1765,
+  627,
+  544,
+  -1033,
+  1079,
+  523,
+  1660,
+  545,
+  -945,
+  895,
+  -693,
+  1366,
+  -120,
+  346,
+  -527,
+  -840,
+  -1623,
+  1150,
+  682,
+  -1658,
+  1144,
+  435,
+  -370,
+  -1225,
+  -2632,
+  -2439,
+  -621,
+  462,
+  -2530,
+  -547,
+  -1438,
+  263,
+  123,
+  600,
+  143,
+  82,
+  2564,
+  -937,
+  1606,
+  144,
+  1692,
+  46,
+  357,
+  98,
+  -1143,
+  -655,
+  1645,
+  1377,
+  1460,
+  -677,
+  -205,
+  -890,
+  -113,
+  1479,
+  -1586,
+  393,
+  1490,
+  252,
+  444,
+  -2506,
+  844,
+  -18,
+  649,
+  -504,
+  465,
+  -546,
+  -188,
+  742,
+  -776,
+  -565,
+  -200,
+  520,
+  789,
+  717,
+  -416,
+  1149,
+  769,
+  -183,
+  334,
+  -271,
+  597,
+  -939,
+  -284,
+  -495,
+  -1089,
+  -804,
+  -822,
+  -189,
+  -524,
+  842,
+  1808,
+  -859,
+  324,
+  -2134,
+  -599,
+  -392,
+  1857,
+  1813,
+  1686,
+  723,
+  1285,
+  -671,
+  154,
+  -801,
+  292,
+  790,
+  -688,
+  193,
+  739,
+  172,
+  1962,
+  501,
+  -495,
+  -117,
+  -951,
+  1923,
+  662,
+  1224,
+  -882,
+  -277,
+  980,
+  -580,
+  2304,
+  -278,
+  -121,
+  -5,
+  -987,
+  -1948,
+  -3,
+  -1340,
+  739,
+  899,
+  -1159,
+  -885,
+  -333,
+  -2091,
+  463,
+  -760,
+  -1590,
+  -1020,
+  138,
+  808,
+  1857,
+  -34,
+  -199,
+  -9,
+  -1543,
+  -371,
+  -1680,
+  -1184,
+  473,
+  -1335,
+  1056,
+  1168,
+  1286,
+  160,
+  -908,
+  -69,
+  -569,
+  -572,
+  -1742,
+  -2215,
+  -30,
+  -42,
+  701,
+  -639,
+  -322,
+  1090,
+  -1050,
+  4,
+  644,
+  -1328,
+  -464,
+  487,
+  2104,
+  754,
+  -545,
+  -288,
+  -461,
+  959,
+  -437,
+  -1114,
+  908,
+  -715,
+  1321,
+  -510,
+  -1404,
+  -692,
+  584,
+  -300,
+  -1130,
+  -273,
+  -442,
+  190,
+  -55,
+  -563,
+  560,
+  287,
+  253,
+  2043,
+  343,
+  -1035,
+  422,
+  1,
+  1071,
+  741,
+  -1789,
+  1126,
+  373,
+  1879,
+  -980,
+  -267,
+  -752,
+  -640,
+  674,
+  184,
+  -1163,
+  -1261,
+  -1748,
+  -1033,
+  437,
+  2116,
+  -1025,
+  -363,
+  425,
+  443,
+  -810,
+  -1269,
+  373,
+  -688,
+  1956,
+  -567,
+  227,
+  528,
+  821,
+  127,
+  -1581,
+  -2000,
+  -726,
+  -496,
+  -549,
+  -1017,
+  1896,
+  -1372,
+  -1807,
+  -974,
+  -1504,
+  732,
+  -1646,
+  748,
+  1646,
+  806,
+  -719,
+  37,
+  -946,
+  22,
+  1075,
+  -117,
+  309,
+  115,
+  1861,
+  583,
+  -267,
+  9,
+  941,
+  163,
+  258,
+  -571,
+  -100,
+  460,
+  1102,
+  -411,
+  1110,
+  -1765,
+  -1171,
+  -321,
+  636,
+  -438,
+  -1834,
+  895,
+  -939,
+  816,
+  -227,
+  1039,
+  274,
+  90,
+  578,
+  1809,
+  -185,
+  320,
+  -1769,
+  -948,
+  -448,
+  -411,
+  -230,
+  -195,
+  -726,
+  -392,
+  775,
+  -1347,
+  -1264,
+  847,
+  -103,
+  919,
+  841,
+  1323,
+  414,
+  232,
+  -377,
+  127,
+  1838,
+  1267,
+  -156,
+  -769,
+  295,
+  1280,
+  1596,
+  1060,
+  -154,
+  699,
+  -1511,
+  -4,
+  -523,
+  366,
+  1264,
+  -778,
+  88,
+  437,
+  -923,
+  1950,
+  -2756,
+  1150,
+  838,
+  597,
+  72,
+  1766,
+  235,
+  -1542,
+  12,
+  875,
+  35,
+  -101,
+  331,
+  1158,
+  -1267,
+  94,
+  1890,
+  490,
+  -524,
+  -1071,
+  290,
+  -274,
+  1610,
+  -339,
+  292,
+  -1295,
+  -1474,
+  -738,
+  -540,
+  -1241,
+  -307,
+  -1181,
+  -101,
+  899,
+  1038,
+  789,
+  -426,
+  -201,
+  458,
+  993,
+  -2341,
+  638,
+  1467,
+  257,
+  1599,
+  -1289,
+  -18,
+  218,
+  -1170,
+  -12,
+  1712,
+  60,
+  -1617,
+  649,
+  1092,
+  1006,
+  920,
+  -1039,
+  -788,
+  1082,
+  346,
+  2024,
+  -333,
+  488,
+  1196,
+  -1401,
+  786,
+  -843,
+  -1650,
+  1009,
+  -1209,
+  610,
+  675,
+  192,
+  409,
+  -543,
+  965,
+  -224,
+  707,
+  -608,
+  3695,
+  54,
+  787,
+  2172,
+  -2291,
+  2189,
+  -251,
+  -641,
+  1548,
+  -587,
+  1407,
+  -564,
+  -452,
+  -673,
+  555,
+  -381,
+  -819,
+  1024,
+  -80,
+  -1506,
+  -13,
+  -641,
+  -1143,
+  2626,
+  -610,
+  -2490,
+  668,
+  789,
+  -1770,
+  1506,
+  -186,
+  784,
+  17,
+  -959,
+  3052,
+  -947,
+  134,
+  1231,
+  2588,
+  8,
+  2269,
+  834,
+  -1533,
+  -442,
+  -39,
+  198,
+  58,
+  986,
+  -1680,
+  -1034,
+  -398,
+  -102,
+  -753,
+  312,
+  -1312,
+  -227,
+  615,
+  481,
+  371,
+  -652,
+  857,
+  789,
+  1078,
+  1472,
+  -1314,
+  1416,
+  2462,
+  706,
+  -609,
+  -1131,
+  671,
+  58,
+  174,
+  1936,
+  697,
+  738,
+  -374,
+  -1278,
+  -212,
+  -856,
+  915,
+  -653,
+  947,
+  1103,
+  447,
+  2074,
+  1398,
+  230,
+  -1425,
+  862,
+  102,
+  2110,
+  -1635,
+  -930,
+  1684,
+  -155,
+  323,
+  -1461,
+  801,
+  -255,
+  1158,
+  -246,
+  -448,
+  596,
+  1029,
+  -793,
+  -1930,
+  -2570,
+  417,
+  2075,
+  1372,
+  878,
+  1274,
+  -153,
+  1668,
+  -174,
+  -1026,
+  -383,
+  766,
+  -202,
+  -666,
+  -154,
+  161,
+  354,
+  138,
+  565,
+  -213,
+  888,
+  -1053,
+  621,
+  910,
+  1321,
+  1975,
+  -493,
+  504,
+  1057,
+  2285,
+  1452,
+  -129,
+  1426,
+  -339,
+  -638,
+  -356,
+  752,
+  826,
+  -794,
+  245,
+  2473,
+  22,
+  -1198,
+  2651,
+  722,
+  645,
+  362,
+  -376,
+  -706,
+  -581,
+  1049,
+  234,
+  -1972,
+  1135,
+  -500,
+  1590,
+  -552,
+  407,
+  -25,
+  1633,
+  -73,
+  811,
+  -1483,
+  -978,
+  484,
+  1729,
+  -487,
+  766,
+  1029,
+  -744,
+  -184,
+  159,
+  -1446,
+  434,
+  1345,
+  -848,
+  634,
+  153,
+  384,
+  227,
+  1111,
+  419,
+  -734,
+  -68,
+  -1119,
+  461,
+  419,
+  343,
+  -3093,
+  182,
+  -138,
+  -1642,
+  -818,
+  1236,
+  -776,
+  1301,
+  1852,
+  301,
+  -879,
+  -39,
+  579,
+  393,
+  500,
+  -2287,
+  -1430,
+  719,
+  -150,
+  -1833,
+  229,
+  -996,
+  -344,
+  388,
+  352,
+  970,
+  836,
+  626,
+  1009,
+  1087,
+  -510,
+  354,
+  246,
+  378,
+  -631,
+  -170,
+  57,
+  -872,
+  491,
+  -518,
+  -354,
+  1383,
+  382,
+  931,
+  -120,
+  -582,
+  491,
+  -476,
+  357,
+  -90,
+  -117,
+  -1337,
+  -188,
+  1,
+  -128,
+  -1257,
+  29,
+  -1652,
+  93,
+  -524,
+  -1638,
+  1232,
+  388,
+  1315,
+  442,
+  362,
+  2182,
+  1149,
+  -427,
+  1235,
+  1313,
+  -1191,
+  -140,
+  2144,
+  509,
+  -503,
+  -1489,
+  28,
+  -131,
+  -966,
+  1212,
+  896,
+  1395,
+  -1526,
+  -315,
+  -890,
+  -590,
+  -759,
+  -862,
+  136,
+  326,
+  -1655,
+  622,
+  -2114,
+  -377,
+  -667,
+  485,
+  751,
+  231,
+  -916,
+  -771,
+  64,
+  -874,
+  -989,
+  -1566,
+  -16,
+  590,
+  372,
+  287,
+  -549,
+  -2263,
+  1060,
+  1632,
+  -78,
+  1753,
+  -1306,
+  -2467,
+  247,
+  -953,
+  180,
+  2222,
+  -527,
+  990,
+  -329,
+  -849,
+  1798,
+  452,
+  -487,
+  -268,
+  -705,
+  -371,
+  900,
+  1067,
+  -1366,
+  -1087,
+  611,
+  746,
+  828,
+  1573,
+  642,
+  -980,
+  -524,
+  -75,
+  593,
+  225,
+  1357,
+  1020,
+  1137,
+  242,
+  721,
+  -2709,
+  246,
+  352,
+  343,
+  -108,
+  422,
+  -422,
+  -1241,
+  -116,
+  912,
+  194,
+  408,
+  -1061,
+  -1159,
+  677,
+  -41,
+  927,
+  1419,
+  -694,
+  392,
+  605,
+  1012,
+  1781,
+  -65,
+  620,
+  -328,
+  1381,
+  1984,
+  1715,
+  1383,
+  373,
+  15,
+  -874,
+  -254,
+  755,
+  -50,
+  338,
+  1376,
+  -734,
+  -1235,
+  1191,
+  2253,
+  -550,
+  424,
+  -729,
+  355,
+  917,
+  -661,
+  1240,
+  771,
+  73,
+  8,
+  46,
+  -312,
+  872,
+  -90,
+  -161,
+  54,
+  -1513,
+  367,
+  1237,
+  -1844,
+  -560,
+  503,
+  305,
+  -478,
+  114,
+  397,
+  1091,
+  -1181,
+  -1805,
+  284,
+  -700,
+  -1261,
+  383,
+  -1392,
+  -148,
+  -2259,
+  -107,
+  303,
+  -152,
+  55,
+  -842,
+  293,
+  -227,
+  -458,
+  525,
+  709,
+  640,
+  394,
+  -157,
+  1182,
+  785,
+  -813,
+  -1090,
+  -1166,
+  -1261,
+  -90,
+  1278,
+  -52,
+  161,
+  -1129,
+  197,
+  -1457,
+  1486,
+  -237,
+  212,
+  -1398,
+  2252,
+  1783,
+  1050,
+  -392,
+  224,
+  -655,
+  366,
+  -479,
+  -230,
+  1399,
+  182,
+  757,
+  1585,
+  1186,
+  -1722,
+  -914,
+  1078,
+  1874,
+  1571,
+  1612,
+  1046,
+  137,
+  -395,
+  -1669,
+  -76,
+  -112,
+  164,
+  1392,
+  409,
+  -2203,
+  1048,
+  427,
+  -1071,
+  -2432,
+  -607,
+  404,
+  363,
+  -304,
+  1702,
+  66,
+  -254,
+  793,
+  -1856,
+  686,
+  109,
+  -1563,
+  1330,
+  1192,
+  -1367,
+  510,
+  -551,
+  -646,
+  -370,
+  -1257,
+  -950,
+  -1550,
+  1252,
+  -1741,
+  -270,
+  -334,
+  243,
+  666,
+  -299,
+  -1075,
+  -1029,
+  -789,
+  -480,
+  495,
+  681,
+  143,
+  -91,
+  -1554,
+  -526,
+  -1453,
+  -291,
+  -1075,
+  1037,
+  -1501,
+  1079,
+  -14,
+  -984,
+  -44,
+  -1791,
+  493,
+  -335,
+  -829,
+  1273,
+  321,
+  1100,
+  -804,
+  342,
+  876,
+  -1748,
+  1067,
+  319,
+  385,
+  -1936,
+  1458,
+  -1162,
+  -941,
+  138,
+  1299,
+  -2636,
+  56,
+  -599,
+  -737,
+  -1896,
+  229,
+  682,
+  -648,
+  1151,
+  269,
+  -1139,
+  255,
+  -1536,
+  -930,
+  243,
+  2320,
+  -188,
+  -358,
+  1501,
+  -241,
+  -1410,
+  1622,
+  -890,
+  -328,
+  -513,
+  1411,
+  -803,
+  348,
+  -434,
+  16,
+  -1797,
+  355,
+  863,
+  -83,
+  -252,
+  978,
+  1410,
+  2304,
+  1501,
+  -310,
+  189,
+  580,
+  460,
+  -946,
+  -586,
+  -1092,
+  443,
+  1264,
+  -559,
+  -270,
+  -639,
+  293,
+  13,
+  -809,
+  -70,
+  -1037,
+  550,
+  522,
+  19,
+  47,
+  -320,
+  -649,
+  -2569,
+  -148,
+  978,
+  -2240,
+  280,
+  -367,
+  660,
+  1028,
+  -220,
+  2579,
+  314,
+  645,
+  2198,
+  558,
+  1243,
+  1508,
+  46,
+  -74,
+  1064,
+  -417,
+  -275,
+  -798,
+  -1144,
+  1106,
+  -214,
+  660,
+  -1030,
+  -847,
+  883,
+  1697,
+  -978,
+  454,
+  -977,
+  -1802,
+  -553,
+  -583,
+  636,
+  1433,
+  -1380,
+  -346,
+  738,
+  42,
+  -2061,
+  904,
+  -403,
+  1272,
+  281,
+  -314,
+  1317,
+  -954,
+  -269,
+  -30,
+  -1432,
+  304,
+  -607,
+  549,
+  -1352,
+  289,
+  390,
+  -1322,
+  -839,
+  -475,
+  207,
+  1328,
+  26,
+  1143,
+  -443,
+  -1798,
+  -1540,
+  481,
+  -1434,
+  -598,
+  2116,
+  487,
+  582,
+  374,
+  -1101,
+  764,
+  93,
+  -1915,
+  -998,
+  -1210,
+  -267,
+  -1177,
+  -477,
+  2398,
+  515,
+  -47,
+  -85,
+  862,
+  -891,
+  -89,
+  1038,
+  1526,
+  -158,
+  406,
+  -269,
+  -502,
+  -1004,
+  -905,
+  53,
+  -618,
+  1964,
+  -2068,
+  2070,
+  359,
+  -141,
+  -1484,
+  464,
+  -981,
+  -1290,
+  311,
+  -346,
+  -1235,
+  -31,
+  -1060,
+  1674,
+  -30,
+  235,
+  -56,
+  1331,
+  745,
+  1065,
+  55,
+  -369,
+  581,
+  1346,
+  39,
+  113,
+  263,
+  2259,
+  -851,
+  -72,
+  -170,
+  898,
+  131,
+  889,
+  2510,
+  261,
+  -856,
+  -1377,
+  748,
+  1826,
+  78,
+  527,
+  -397,
+  -1251,
+  1386,
+  981,
+  523,
+  -355,
+  -183,
+  -1196,
+  12,
+  -874,
+  483,
+  -1093,
+  -332,
+  198,
+  -1460,
+  485,
+  -772,
+  891,
+  -1895,
+  -808,
+  323,
+  -145,
+  -867,
+  524,
+  -650,
+  -1782,
+  689,
+  -851,
+  781,
+  -411,
+  -493,
+  762,
+  -397,
+  -5,
+  -587,
+  197,
+  -1774,
+  -877,
+  394,
+  -921,
+  -252,
+  -391,
+  -337,
+  -439,
+  -1153,
+  -2164,
+  -1561,
+  -618,
+  -454,
+  -2040,
+  2011,
+  288,
+  234,
+  -1132,
+  1197,
+  1177,
+  -1072,
+  965,
+  -1006,
+  1538,
+  982,
+  -2240,
+  1474,
+  1361,
+  320,
+  -1200,
+  -86,
+  -489,
+  457,
+  -531,
+  -1001,
+  496,
+  249,
+  303,
+  -949,
+  1283,
+  1567,
+  885,
+  -1018,
+  -573,
+  -1756,
+  171,
+  -770,
+  -1357,
+  706,
+  1059,
+  276,
+  -797,
+  471,
+  -510,
+  -126,
+  -206,
+  -1696,
+  831,
+  -55,
+  279,
+  65,
+  -286,
+  -735,
+  -998,
+  1066,
+  2411,
+  1089,
+  618,
+  1078,
+  -490,
+  -460,
+  -350,
+  200,
+  -1772,
+  -551,
+  114,
+  488,
+  486,
+  -1375,
+  339,
+  1236,
+  1291,
+  -20,
+  871,
+  209,
+  -1838,
+  157,
+  194,
+  -757,
+  -106,
+  -3865,
+  -808,
+  517,
+  993,
+  24,
+  -430,
+  -1680,
+  -256,
+  -695,
+  -504,
+  6,
+  -615,
+  -594,
+  803,
+  -889,
+  17,
+  306,
+  162,
+  1749,
+  415,
+  -1333,
+  -325,
+  -2200,
+  -654,
+  -1943,
+  342,
+  540,
+  -1215,
+  31,
+  -680,
+  1216,
+  -522,
+  -47,
+  -6,
+  -799,
+  -952,
+  -714,
+  -246,
+  506,
+  373,
+  -539,
+  -830,
+  843,
+  682,
+  519,
+  1329,
+  701,
+  -681,
+  -1354,
+  1465,
+  1028,
+  -674,
+  544,
+  -295,
+  996,
+  -1066,
+  -1019,
+  -569,
+  -852,
+  -867,
+  350,
+  2061,
+  -911,
+  -807,
+  -304,
+  -1062,
+  186,
+  -405,
+  467,
+  -893,
+  -895,
+  3311,
+  -283,
+  1219,
+  1063,
+  -760,
+  804,
+  -1880,
+  -1184,
+  -2224,
+  -901,
+  -935,
+  785,
+  389,
+  1122,
+  -1270,
+  1103,
+  1177,
+  -2312,
+  -1058,
+  -722,
+  369,
+  -1653,
+  2032,
+  357,
+  -830,
+  -73,
+  149,
+  -717,
+  787,
+  -97,
+  2171,
+  93,
+  -1230,
+  942,
+  -373,
+  1749,
+  -790,
+  -345,
+  -498,
+  -1523,
+  957,
+  -1202,
+  -97,
+  -408,
+  2363,
+  -41,
+  520,
+  -118,
+  15,
+  660,
+  1054,
+  -660,
+  364,
+  790,
+  -523,
+  -654,
+  -167,
+  -324,
+  30,
+  1150,
+  -291,
+  1680,
+  1396,
+  226,
+  -2209,
+  1853,
+  -1029,
+  1817,
+  -259,
+  152,
+  1144,
+  -1944,
+  1017,
+  140,
+  -306,
+  -795,
+  -1088,
+  1442,
+  -1416,
+  294,
+  406,
+  -248,
+  -277,
+  -1580,
+  676,
+  436,
+  258,
+  493,
+  2683,
+  -1139,
+  809,
+  453,
+  -794,
+  -72,
+  1609,
+  -1082,
+  44,
+  -507,
+  3091,
+  -499,
+  810,
+  -1432,
+  1339,
+  1390,
+  -1370,
+  -1457,
+  2634,
+  166,
+  -518,
+  -1540,
+  -1485,
+  -262,
+  -730,
+  1862,
+  1057,
+  -182,
+  326,
+  -56,
+  -1311,
+  -446,
+  -558,
+  -537,
+  671,
+  -831,
+  -454,
+  178,
+  192,
+  1175,
+  559,
+  -437,
+  1982,
+  -309,
+  -2151,
+  -2501,
+  -633,
+  1338,
+  721,
+  -913,
+  536,
+  7,
+  -1052,
+  -2004,
+  97,
+  -1035,
+  -1239,
+  908,
+  -513,
+  -1379,
+  797,
+  -926,
+  986,
+  -66,
+  778,
+  166,
+  -385,
+  -762,
+  896,
+  1464,
+  -1844,
+  -152,
+  911,
+  2394,
+  716,
+  700,
+  -851,
+  -905,
+  -1557,
+  -174,
+  -384,
+  -896,
+  1228,
+  607,
+  306,
+  -1031,
+  187,
+  -181,
+  -162,
+  1872,
+  1763,
+  452,
+  -800,
+  -156,
+  667,
+  1149,
+  -168,
+  -672,
+  -336,
+  -593,
+  285,
+  -2291,
+  74,
+  1006,
+  1786,
+  -1571,
+  -587,
+  976,
+  1190,
+  555,
+  2079,
+  1732,
+  -513,
+  2076,
+  1186,
+  -1715,
+  -745,
+  -11,
+  568,
+  228,
+  -878,
+  -136,
+  -983,
+  286,
+  -1103,
+  -1244,
+  524,
+  -13,
+  -1179,
+  1093,
+  131,
+  0,
+  1350,
+  -685,
+  696,
+  33,
+  -1876,
+  -1274,
+  -360,
+  1157,
+  -1396,
+  -1560,
+  -741,
+  -1349,
+  782,
+  3278,
+  -2813,
+  -492,
+  1373,
+  796,
+  -603,
+  -200,
+  369,
+  -251,
+  296,
+  622,
+  -53,
+  297,
+  87,
+  227,
+  -368,
+  -1569,
+  779,
+  -959,
+  -82,
+  -1067,
+  2439,
+  -310,
+  -2128,
+  469,
+  -275,
+  1376,
+  167,
+  263,
+  135,
+  -300,
+  -974,
+  642,
+  -20,
+  141,
+  445,
+  -509,
+  -114,
+  1138,
+  -1022,
+  982,
+  870,
+  1626,
+  -2075,
+  2318,
+  -1090,
+  1537,
+  -200,
+  723,
+  -620,
+  -357,
+  1001,
+  -808,
+  1439,
+  678,
+  385,
+  -638,
+  392,
+  250,
+  -170,
+  774,
+  -557,
+  -1146,
+  -991,
+  -36,
+  473,
+  53,
+  670,
+  725,
+  470,
+  -653,
+  898,
+  362,
+  -38,
+  521,
+  -76,
+  972,
+  1639,
+  -308,
+  -170,
+  -718,
+  -746,
+  -881,
+  -25,
+  1809,
+  -652,
+  646,
+  -372,
+  414,
+  -1259,
+  1238,
+  -603,
+  -278,
+  1029,
+  28,
+  -321,
+  125,
+  519,
+  -108,
+  -331,
+  411,
+  -574,
+  -1825,
+  -1503,
+  -1108,
+  1339,
+  -739,
+  154,
+  -508,
+  722,
+  2042,
+  -176,
+  1678,
+  1581,
+  781,
+  -320,
+  1739,
+  -384,
+  -607,
+  -635,
+  -1848,
+  -110,
+  913,
+  -1326,
+  1416,
+  -135,
+  -957,
+  1604,
+  197,
+  -2197,
+  -204,
+  -565,
+  -1359,
+  -2075,
+  163,
+  -1025,
+  -77,
+  36,
+  -13,
+  -433,
+  23,
+  167,
+  -116,
+  542,
+  603,
+  374,
+  1211,
+  101,
+  700,
+  -1252,
+  1927,
+  -196,
+  -601,
+  -1881,
+  1455,
+  -1039,
+  -862,
+  161,
+  -667,
+  982,
+  -404,
+  -172,
+  -162,
+  -694,
+  1181,
+  -101,
+  -960,
+  1627,
+  -830,
+  -1145,
+  334,
+  1602,
+  1957,
+  -1313,
+  1238,
+  -774,
+  584,
+  257,
+  -331,
+  -1619,
+  1006,
+  -341,
+  1430,
+  -467,
+  1323,
+  -702,
+  1382,
+  -650,
+  -131,
+  -974,
+  -1206,
+  86,
+  461,
+  -701,
+  66,
+  1643,
+  -239,
+  -266,
+  -1190,
+  -862,
+  636,
+  359,
+  762,
+  378,
+  -1179,
+  1752,
+  -125,
+  1354,
+  615,
+  -1164,
+  -1200,
+  1883,
+  -106,
+  409,
+  -538,
+  -874,
+  1465,
+  -633,
+  -1650,
+  1266,
+  62,
+  988,
+  -1137,
+  -599,
+  507,
+  295,
+  -1975,
+  1321,
+  -1684,
+  1657,
+  1129,
+  1055,
+  1710,
+  35,
+  1008,
+  1410,
+  1757,
+  102,
+  -239,
+  1797,
+  -218,
+  805,
+  401,
+  27,
+  211,
+  1119,
+  -792,
+  984,
+  64,
+  -712,
+  284,
+  1049,
+  -377,
+  529,
+  995,
+  1003,
+  917,
+  278,
+  1122,
+  -830,
+  -1310,
+  599,
+  1261,
+  1343,
+  -866,
+  -1229,
+  -256,
+  407,
+  -68,
+  -344,
+  -1013,
+  -1253,
+  792,
+  2410,
+  265,
+  747,
+  -715,
+  -237,
+  -1446,
+  -1169,
+  270,
+  -104,
+  1176,
+  -299,
+  -318,
+  223,
+  1252,
+  -607,
+  -1315,
+  35,
+  -289,
+  -323,
+  780,
+  -1459,
+  -929,
+  -39,
+  -1970,
+  777,
+  98,
+  767,
+  -1100,
+  -1813,
+  -22,
+  -102,
+  -671,
+  -1034,
+  147,
+  -1073,
+  152,
+  335,
+  -1112,
+  30,
+  -589,
+  -657,
+  316,
+  -713,
+  365,
+  -1185,
+  1485,
+  -264,
+  -919,
+  -1194,
+  -167,
+  272,
+  -173,
+  1868,
+  -2299,
+  3081,
+  -985,
+  802,
+  559,
+  1167,
+  -363,
+  -721,
+  -379,
+  27,
+  404,
+  -721,
+  1021,
+  634,
+  -1095,
+  -1693,
+  777,
+  162,
+  -624,
+  -419,
+  824,
+  671,
+  -2315,
+  -310,
+  -2052,
+  581,
+  -899,
+  -1701,
+  -970,
+  -155,
+  -921,
+  1910,
+  -1225,
+  590,
+  -685,
+  -1119,
+  -857,
+  94,
+  -963,
+  -891,
+  -246,
+  50,
+  -83,
+  -952,
+  -318,
+  1709,
+  -2975,
+  -390,
+  -675,
+  650,
+  -1363,
+  1247,
+  370,
+  -1284,
+  -357,
+  -1684,
+  90,
+  788,
+  -2313,
+  -103,
+  -1221,
+  734,
+  122,
+  -483,
+  897,
+  2494,
+  -496,
+  1723,
+  -1631,
+  -671,
+  1579,
+  224,
+  2357,
+  -767,
+  1831,
+  -45,
+  1688,
+  906,
+  -86,
+  123,
+  -300,
+  224,
+  -1120,
+  -1770,
+  770,
+  175,
+  227,
+  718,
+  -618,
+  -531,
+  -5,
+  209,
+  993,
+  247,
+  1490,
+  -104,
+  -837,
+  1004,
+  270,
+  -2013,
+  1620,
+  -272,
+  -487,
+  1509,
+  1398,
+  -501,
+  -1175,
+  579,
+  -239,
+  2371,
+  -1071,
+  -1220,
+  -1847,
+  2913,
+  443,
+  -102,
+  -631,
+  291,
+  -54,
+  -30,
+  1062,
+  1145,
+  35,
+  1081,
+  -1560,
+  2006,
+  186,
+  242,
+  1627,
+  -2103,
+  1076,
+  1048,
+  193,
+  309,
+  -2389,
+  758,
+  -1093,
+  -689,
+  -598,
+  -377,
+  830,
+  -633,
+  1088,
+  348,
+  -1025,
+  -1507,
+  -1337,
+  -259,
+  -383,
+  34,
+  -889,
+  -130,
+  -1157,
+  1428,
+  392,
+  520,
+  -713,
+  -366,
+  608,
+  589,
+  -1677,
+  -907,
+  -623,
+  232,
+  -1437,
+  -780,
+  -256,
+  938,
+  -469,
+  -877,
+  -28,
+  -454,
+  44,
+  -299,
+  -389,
+  -1359,
+  -263,
+  144,
+  2062,
+  503,
+  -1757,
+  358,
+  854,
+  -2048,
+  -832,
+  -608,
+  825,
+  970,
+  1099,
+  -1324,
+  -67,
+  -166,
+  206,
+  -470,
+  -1376,
+  996,
+  -373,
+  -746,
+  54,
+  874,
+  -660,
+  657,
+  1929,
+  935,
+  -787,
+  -479,
+  309,
+  1138,
+  841,
+  677,
+  -313,
+  -600,
+  -2335,
+  2383,
+  -899,
+  1593,
+  600,
+  273,
+  365,
+  1206,
+  -589,
+  38,
+  -323,
+  -2813,
+  -1816,
+  -2103,
+  -947,
+  602,
+  -735,
+  -901,
+  -892,
+  915,
+  -727,
+  429,
+  -97,
+  944,
+  -2724,
+  -354,
+  -761,
+  -629,
+  634,
+  1103,
+  638,
+  -515,
+  -685,
+  -712,
+  843,
+  1056,
+  -1123,
+  1018,
+  -650,
+  566,
+  735,
+  647,
+  951,
+  4,
+  644,
+  -647,
+  316,
+  -1798,
+  158,
+  -832,
+  -2023,
+  1721,
+  -1584,
+  -168,
+  -1019,
+  382,
+  137,
+  -96,
+  -373,
+  -459,
+  1761,
+  -50,
+  -73,
+  -1793,
+  1493,
+  261,
+  -2259,
+  -544,
+  1630,
+  -2182,
+  1017,
+  -1606,
+  -1164,
+  141,
+  960,
+  377,
+  345,
+  105,
+  805,
+  -117,
+  967,
+  -246,
+  -70,
+  -2013,
+  207,
+  -939,
+  -704,
+  -507,
+  866,
+  1274,
+  288,
+  -1776,
+  -1212,
+  -562,
+  -877,
+  1001,
+  -1045,
+  -931,
+  247,
+  133,
+  -327,
+  617,
+  -1086,
+  144,
+  -552,
+  -245,
+  1416,
+  570,
+  597,
+  -684,
+  -297,
+  -101,
+  112,
+  -287,
+  -1688,
+  -159,
+  1374,
+  -855,
+  276,
+  -607,
+  240,
+  394,
+  -2229,
+  1596,
+  1645,
+  71,
+  425,
+  150,
+  -5,
+  589,
+  -178,
+  672,
+  -951,
+  2409,
+  483,
+  1245,
+  455,
+  643,
+  1241,
+  1949,
+  418,
+  -321,
+  98,
+  -982,
+  201,
+  1567,
+  -959,
+  17,
+  773,
+  -200,
+  283,
+  82,
+  127,
+  25,
+  -1475,
+  -460,
+  939,
+  -1018,
+  -1064,
+  -2484,
+  -452,
+  1459,
+  639,
+  557,
+  778,
+  886,
+  -1731,
+  1879,
+  -512,
+  -249,
+  1647,
+  -921,
+  -976,
+  310,
+  60,
+  134,
+  1600,
+  -766,
+  665,
+  63,
+  200,
+  655,
+  -173,
+  1867,
+  295,
+  -580,
+  1519,
+  -550,
+  835,
+  1268,
+  -1903,
+  -1074,
+  -1051,
+  270,
+  181,
+  -1436,
+  247,
+  685,
+  -278,
+  -13,
+  922,
+  -1476,
+  -233,
+  -696,
+  488,
+  -324,
+  -289,
+  -908,
+  1616,
+  -122,
+  1682,
+  674,
+  783,
+  968,
+  -645,
+  -969,
+  181,
+  1176,
+  -1696,
+  1682,
+  772,
+  2131,
+  1427,
+  -379,
+  910,
+  1893,
+  743,
+  -297,
+  -572,
+  -313,
+  -803,
+  483,
+  -687,
+  234,
+  -680,
+  1538,
+  480,
+  -182,
+  143,
+  -559,
+  167,
+  -1463,
+  1,
+  -682,
+  -267,
+  -334,
+  795,
+  18,
+  1531,
+  1178,
+  1529,
+  1870,
+  -1148,
+  1243,
+  -159,
+  -2202,
+  -793,
+  -626,
+  -600,
+  -70,
+  1611,
+  1745,
+  -2141,
+  -592,
+  2149,
+  20,
+  716,
+  -248,
+  -734,
+  -1183,
+  903,
+  -424,
+  1093,
+  1032,
+  593,
+  629,
+  514,
+  -1867,
+  -159,
+  1389,
+  -204,
+  140,
+  1037,
+  -59,
+  704,
+  569,
+  844,
+  1636,
+  451,
+  967,
+  -316,
+  -1233,
+  1866,
+  805,
+  -1377,
+  -1864,
+  -688,
+  448,
+  -1993,
+  -832,
+  -2287,
+  -17,
+  -448,
+  728,
+  71,
+  -31,
+  1986,
+  -1574,
+  1059,
+  528,
+  -2774,
+  -1104,
+  -91,
+  752,
+  741,
+  1217,
+  -221,
+  -2141,
+  -643,
+  547,
+  541,
+  1497,
+  256,
+  -1739,
+  -2436,
+  -238,
+  568,
+  -41,
+  -1370,
+  -2316,
+  1638,
+  -80,
+  122,
+  1498,
+  -1257,
+  -1039,
+  -2690,
+  -630,
+  1585,
+  -1542,
+  1148,
+  -1373,
+  1482,
+  -470,
+  -514,
+  -998,
+  -641,
+  960,
+  666,
+  1391,
+  113,
+  1174,
+  -628,
+  222,
+  -355,
+  -1217,
+  -677,
+  -137,
+  -782,
+  616,
+  863,
+  317,
+  -271,
+  114,
+  -258,
+  772,
+  -780,
+  1296,
+  -23,
+  -413,
+  229,
+  488,
+  -929,
+  -1434,
+  -472,
+  1194,
+  -119,
+  -561,
+  482,
+  83,
+  513,
+  -147,
+  731,
+  668,
+  282,
+  291,
+  -1393,
+  -1724,
+  -735,
+  1881,
+  1483,
+  -736,
+  402,
+  -67,
+  -487,
+  618,
+  -243,
+  1097,
+  -1119,
+  249,
+  634,
+  610,
+  336,
+  2420,
+  551,
+  1266,
+  2233,
+  -919,
+  -565,
+  935,
+  1994,
+  -574,
+  -1231,
+  -309,
+  -1088,
+  44,
+  1048,
+  844,
+  -831,
+  781,
+  -583,
+  -1224,
+  -589,
+  -544,
+  -159,
+  -890,
+  1364,
+  1369,
+  136,
+  -1197,
+  -193,
+  1508,
+  -893,
+  -117,
+  -1295,
+  1147,
+  1012,
+  360,
+  -491,
+  981,
+  -374,
+  884,
+  1315,
+  459,
+  761,
+  837,
+  -287,
+  -232,
+  39,
+  -719,
+  -12,
+  172,
+  -475,
+  11,
+  1211,
+  667,
+  226,
+  -333,
+  1182,
+  -750,
+  -446,
+  -491,
+  -56,
+  -473,
+  98,
+  -924,
+  -309,
+  -62,
+  1594,
+  -1916,
+  853,
+  -1083,
+  2104,
+  -108,
+  542,
+  -63,
+  1889,
+  1488,
+  777,
+  -2011,
+  159,
+  1258,
+  1829,
+  -178,
+  810,
+  -309,
+  684,
+  -1161,
+  1211,
+  139,
+  435,
+  -1157,
+  260,
+  1092,
+  1014,
+  -729,
+  -794,
+  518,
+  -1070,
+  984,
+  -1063,
+  1425,
+  -680,
+  272,
+  986,
+  -1796,
+  664,
+  16,
+  772,
+  -1085,
+  1056,
+  486,
+  -456,
+  -120,
+  1504,
+  -1809,
+  -556,
+  260,
+  984,
+  -48,
+  -202,
+  -894,
+  -761,
+  -406,
+  -870,
+  -1,
+  -677,
+  2023,
+  -33,
+  163,
+  1383,
+  -1878,
+  1850,
+  203,
+  130,
+  -1038,
+  -390,
+  -456,
+  308,
+  -259,
+  -414,
+  454,
+  -958,
+  -319,
+  -1050,
+  -964,
+  -353,
+  936,
+  -379,
+  -271,
+  -723,
+  -1159,
+  -868,
+  -355,
+  -240,
+  1179,
+  1240,
+  -1777,
+  -624,
+  380,
+  -2326,
+  1798,
+  -717,
+  -339,
+  311,
+  1266,
+  2553,
+  258,
+  -28,
+  83,
+  679,
+  -308,
+  -1603,
+  -427,
+  -165,
+  178,
+  877,
+  1421,
+  -1048,
+  -1809,
+  168,
+  109,
+  226,
+  -261,
+  1284,
+  401,
+  -584,
+  1367,
+  66,
+  15,
+  -918,
+  971,
+  266,
+  421,
+  281,
+  -1513,
+  1396,
+  -1144,
+  963,
+  561,
+  160,
+  -742,
+  251,
+  2616,
+  -337,
+  1425,
+  -1245,
+  -995,
+  -549,
+  1208,
+  808,
+  1235,
+  -1475,
+  280,
+  -630,
+  1375,
+  -1587,
+  -1999,
+  852,
+  -2011,
+  -165,
+  -550,
+  506,
+  619,
+  -153,
+  -835,
+  -139,
+  -961,
+  -376,
+  980,
+  937,
+  -227,
+  128,
+  -1980,
+  -1267,
+  -273,
+  1525,
+  68,
+  64,
+  1052,
+  550,
+  -92,
+  1461,
+  527,
+  1394,
+  -349,
+  -652,
+  -42,
+  678,
+  931,
+  1129,
+  141,
+  -324,
+  -228,
+  240,
+  -77,
+  1846,
+  -2293,
+  -318,
+  521,
+  -244,
+  -74,
+  90,
+  402,
+  1237,
+  -2377,
+  86,
+  425,
+  -408,
+  1356,
+  262,
+  54,
+  -1499,
+  1015,
+  -792,
+  77,
+  747,
+  -159,
+  -506,
+  133,
+  167,
+  792,
+  1267,
+  -484,
+  -337,
+  -1057,
+  1574,
+  -374,
+  -464,
+  -536,
+  393,
+  1151,
+  814,
+  -752,
+  589,
+  544,
+  -363,
+  1265,
+  -1552,
+  -712,
+  1050,
+  -91,
+  85,
+  -309,
+  1385,
+  101,
+  767,
+  -1914,
+  232,
+  -1119,
+  -613,
+  -1239,
+  -479,
+  -239,
+  -526,
+  -3015,
+  701,
+  -455,
+  572,
+  35,
+  1274,
+  -2833,
+  -2137,
+  -909,
+  -1801,
+  395,
+  169,
+  1814,
+  -134,
+  903,
+  -208,
+  -765,
+  2160,
+  368,
+  2194,
+  -977,
+  807,
+  10,
+  430,
+  -1694,
+  -352,
+  1312,
+  200,
+  -394,
+  907,
+  -849,
+  -1710,
+  102,
+  -485,
+  826,
+  1535,
+  -1112,
+  -856,
+  108,
+  -651,
+  -133,
+  521,
+  1437,
+  413,
+  -800,
+  812,
+  22,
+  -688,
+  1441,
+  1339,
+  -190,
+  1481,
+  444,
+  522,
+  292,
+  -354,
+  -808,
+  -19,
+  842,
+  -701,
+  66,
+  296,
+  714,
+  -522,
+  734,
+  599,
+  -225,
+  1537,
+  72,
+  1791,
+  -938,
+  952,
+  -8,
+  72,
+  1323,
+  51,
+  691,
+  -1089,
+  1001,
+  -787,
+  10,
+  362,
+  -137,
+  -633,
+  -25,
+  731,
+  250,
+  868,
+  -217,
+  1413,
+  -417,
+  -1255,
+  960,
+  -1087,
+  -1257,
+  -1303,
+  850,
+  -985,
+  452,
+  409,
+  -847,
+  142,
+  -1986,
+  -700,
+  -582,
+  -1168,
+  1544,
+  22,
+  1019,
+  1180,
+  473,
+  1208,
+  -435,
+  -61,
+  2753,
+  -997,
+  956,
+  1322,
+  -478,
+  451,
+  2051,
+  797,
+  -516,
+  -435,
+  934,
+  1853,
+  -2105,
+  -117,
+  -997,
+  -55,
+  -724,
+  314,
+  1333,
+  164,
+  129,
+  -1037,
+  1039,
+  -2149,
+  -1038,
+  -2171,
+  -570,
+  -199,
+  -920,
+  -305,
+  244
+};
+#endif
@@ -0,0 +1,11 @@
+#!/bin/bash
+
+TOP=`pwd`
+
+export APP_PATH=${TOP}/app
+export GCC_PATH=/usr/bin
+
+cd ${TOP}/qemu/mps2_an386
+make
+
+cd ${TOP}
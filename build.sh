@@ -62,4 +62,7 @@ case $BUILD_TARGET in
   stm32*)
     ./build.$BUILD_TARGET.sh
     ;;
+  qemu*)
+    ./build.$BUILD_TARGET.sh
+    ;;
 esac
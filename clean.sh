@@ -7,4 +7,7 @@ rm -fr ${TOP}/out.*
 cd ${TOP}/stm32_cubemx/nucleo_l476rg
 make clean
 
+cd ${TOP}/qemu/mps2_an386
+make clean
+
 cd ${TOP}
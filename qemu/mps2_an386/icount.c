@@ -0,0 +1,27 @@
+#include "mps2_an386.h"
+
+#include "prof.h"
+
+static volatile uint32_t _wraps = 0;
+
+void SysTick_Handler() {
+  _wraps++;
+}
+
+// free running 24 bit SysTick at the processor clock, wraps are counted in the interrupt
+void prof_init() {
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+  prof_reset();
+}
+
+// modulo 2^32, differences of nearby counts are exact
+uint32_t prof_count() {
+  uint32_t wraps, val;
+  do {
+    wraps = _wraps;
+    val = SysTick->VAL;
+  } while(wraps != _wraps);
+  return (wraps * (SysTick_LOAD_RELOAD_Msk + 1) + (SysTick_LOAD_RELOAD_Msk - val)) * MPS2_INSNS_PER_TICK;
+}
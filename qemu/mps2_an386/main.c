@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "prof.h"
+#include "reservoir.h"
+
+// same workload as app/generic/main.c, files are opened on the host through semihosting
+#define INPUT_FILE_NAME "training.txt"
+#define INPUT_FILE_LINE_MAX 32
+#define OUTPUT_FILE_NAME "predicted.txt"
+
+#define TRAINING_DATA_SIZE 960
+#define TRAINING_BATCH_SIZE 10
+#define PREDICTION_DATA_SIZE 640
+
+static VAL_T to_val(float v) {
+#if defined(PRECISION_Q15)
+  long q = lrintf(v * 32768.0f);
+  return q > 32767 ? 32767 : q < -32768 ? -32768 : q;
+#else
+  return v;
+#endif
+}
+
+int main() {
+  FILE *fp;
+  mat_memory_t mem = {
+      .memory_alloc = (void *(*)(unsigned)) malloc,
+      .memory_free = (void (*)(void *)) free,
+  };
+  reservoir_t res = {
+      .mem = &mem,
+      .n_in_nodes = 1,
+      .n_res_nodes = 100,
+      .n_out_nodes = 1,
+      .leak_rate = 0.02f,
+  };
+  PROF_INIT();
+  init(&res);
+  // load data + train
+  MAT_T training_data;
+  if(MAT_NEW(res.mem, &training_data, TRAINING_BATCH_SIZE, 1) < 0) {
+    return -1;
+  }
+  char buf[INPUT_FILE_LINE_MAX];
+  fp = fopen(INPUT_FILE_NAME, "r");
+  if(fp == NULL) {
+    printf("cannot open %s\n", INPUT_FILE_NAME);
+    return -1;
+  }
+  float data = 0.0f;
+  uint32_t train_count = 0;
+  for(unsigned i = 0; fgets(buf, sizeof(buf), fp);) {
+    data = strtof(buf, NULL);
+    *MAT(training_data, i, 0) = to_val(data);
+    if(++i >= TRAINING_BATCH_SIZE) {
+      uint32_t start = prof_count();
+      train_feed_data(&res, &training_data);
+      train_count += prof_count() - start;
+      i = 0;
+    }
+  }
+  fclose(fp);
+  uint32_t start = prof_count();
+  train_compute_weight(&res, RESET_XY);
+  train_count += prof_count() - start;
+  MAT_DESTROY(res.mem, &training_data);
+  // predict + save
+  MAT_T predicted_data, prev_data;
+  if(MAT_NEW(res.mem, &predicted_data, 1, 1) < 0) {
+    return -1;
+  }
+  if(MAT_NEW(res.mem, &prev_data, 1, 1) < 0) {
+    return -1;
+  }
+  *MAT(prev_data, 0, 0) = to_val(data);
+  fp = fopen(OUTPUT_FILE_NAME, "w");
+  if(fp == NULL) {
+    printf("cannot open %s\n", OUTPUT_FILE_NAME);
+    return -1;
+  }
+  uint32_t predict_count = 0;
+  for(unsigned i = 0; i < PREDICTION_DATA_SIZE; i++) {
+    start = prof_count();
+    predict(&res, &predicted_data, &prev_data);
+    predict_count += prof_count() - start;
+    fprintf(fp, "%f\n", VAL_TO_F32(*MAT(predicted_data, 0, 0)));
+    *MAT(prev_data, 0, 0) = *MAT(predicted_data, 0, 0);
+  }
+  fclose(fp);
+  printf("train: %u instructions\n", (unsigned) train_count);
+  printf("predict: %u instructions/step\n", (unsigned) (predict_count / PREDICTION_DATA_SIZE));
+  PROF_DUMP();
+  MAT_DESTROY(res.mem, &predicted_data);
+  MAT_DESTROY(res.mem, &prev_data);
+  deinit(&res);
+  return 0;
+}
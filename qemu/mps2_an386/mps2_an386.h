@@ -0,0 +1,29 @@
+#ifndef QEMU_MPS2_AN386_MPS2_AN386_H_
+#define QEMU_MPS2_AN386_MPS2_AN386_H_
+
+// the parts of a device header core_cm4.h needs, for the Cortex-M4 of the QEMU mps2-an386 machine
+typedef enum {
+  NonMaskableInt_IRQn = -14,
+  HardFault_IRQn = -13,
+  MemoryManagement_IRQn = -12,
+  BusFault_IRQn = -11,
+  UsageFault_IRQn = -10,
+  SVCall_IRQn = -5,
+  DebugMonitor_IRQn = -4,
+  PendSV_IRQn = -2,
+  SysTick_IRQn = -1,
+} IRQn_Type;
+
+#define __CM4_REV 0x0001
+#define __MPU_PRESENT 1
+#define __NVIC_PRIO_BITS 3
+#define __Vendor_SysTickConfig 0
+#define __FPU_PRESENT 1
+
+#include "core_cm4.h"
+
+// SysTick runs from the 25 MHz system clock, qemu -icount shift=0 retires one instruction per ns
+#define MPS2_SYSCLK (25000000)
+#define MPS2_INSNS_PER_TICK (1000000000 / MPS2_SYSCLK)
+
+#endif /* QEMU_MPS2_AN386_MPS2_AN386_H_ */
@@ -0,0 +1,53 @@
+#include "mps2_an386.h"
+
+#include <stdlib.h>
+
+extern uint32_t _estack;
+extern uint32_t _sbss;
+extern uint32_t _ebss;
+
+extern void initialise_monitor_handles();
+extern void __libc_init_array();
+extern int main();
+
+void Reset_Handler();
+void SysTick_Handler();
+
+static void Default_Handler() {
+  // semihosting exit, qemu reports the failure instead of hanging
+  exit(-1);
+}
+
+__attribute__((section(".isr_vector"), used))
+static void (*const vectors[16])() = {
+    (void (*)()) &_estack,
+    Reset_Handler,
+    Default_Handler, // NMI
+    Default_Handler, // HardFault
+    Default_Handler, // MemManage
+    Default_Handler, // BusFault
+    Default_Handler, // UsageFault
+    0,
+    0,
+    0,
+    0,
+    Default_Handler, // SVCall
+    Default_Handler, // DebugMonitor
+    0,
+    Default_Handler, // PendSV
+    SysTick_Handler,
+};
+
+// .data is loaded in place by qemu -kernel, only .bss is cleared
+void Reset_Handler() {
+  // the code is built for the fpv4-sp-d16 hard float ABI
+  SCB->CPACR |= (0xf << 20);
+  __DSB();
+  __ISB();
+  for(uint32_t *p = &_sbss; p < &_ebss; p++) {
+    *p = 0;
+  }
+  initialise_monitor_handles();
+  __libc_init_array();
+  exit(main());
+}
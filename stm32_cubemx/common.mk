@@ -5,6 +5,10 @@ $(wildcard $(APP_PATH)/cmsis/*.c)
 C_DEFS += \
 -DPRECISION_F32 \
 -DCONST_WEIGHTS
+# -DINFERENCE_ONLY
+# -DADAPT_ONLINE
+# -DPROFILE
+# -DLOW_POWER
 
 C_INCLUDES += \
 -I$(APP_PATH) \
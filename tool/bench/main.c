@@ -0,0 +1,190 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "reservoir.h"
+
+#if defined(PRECISION_Q15)
+#define BENCH_PRECISION "q15"
+#elif defined(PRECISION_F64)
+#define BENCH_PRECISION "f64"
+#else
+#define BENCH_PRECISION "f32"
+#endif
+
+#if defined(BENCH_CMSIS)
+#define BENCH_NAME "cmsis-" BENCH_PRECISION
+#else
+#define BENCH_NAME "generic-" BENCH_PRECISION
+#endif
+
+// same workload as app/generic/main.c
+#define INPUT_FILE_NAME "training.txt"
+#define INPUT_FILE_LINE_MAX 32
+#define OUTPUT_FILE_NAME "bench-" BENCH_NAME ".txt"
+#define TRAINING_DATA_SIZE 960
+#define TRAINING_BATCH_SIZE 10
+#define PREDICTION_DATA_SIZE 640
+// repeats of the training and of the free running prediction for stable timings
+#define TRAINING_REPEAT 10
+#define PREDICTION_REPEAT 100
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static VAL_T to_val(float v) {
+#if defined(PRECISION_Q15)
+  long q = lrintf(v * 32768.0f);
+  return q > 32767 ? 32767 : q < -32768 ? -32768 : q;
+#else
+  return v;
+#endif
+}
+
+static double bench_train(reservoir_t *res, float *samples) {
+  MAT_T training_data;
+  if(MAT_NEW(res->mem, &training_data, TRAINING_BATCH_SIZE, 1) < 0) {
+    return -1.0;
+  }
+  double start = now();
+  for(unsigned i = 0; i < TRAINING_DATA_SIZE; i += TRAINING_BATCH_SIZE) {
+    for(unsigned n = 0; n < TRAINING_BATCH_SIZE; n++) {
+      *MAT(training_data, n, 0) = to_val(samples[i + n]);
+    }
+    train_feed_data(res, &training_data);
+  }
+  train_compute_weight(res, RESET_XY);
+  double elapsed = now() - start;
+  MAT_DESTROY(res->mem, &training_data);
+  return elapsed;
+}
+
+// free running prediction from the state after training
+static double bench_predict(reservoir_t *res, float *predicted, float last, VAL_T *state) {
+  MAT_T predicted_data, prev_data;
+  MAT_NEW(res->mem, &predicted_data, 1, 1);
+  MAT_NEW(res->mem, &prev_data, 1, 1);
+  memcpy(res->res_nodes.data, state, sizeof(VAL_T) * res->n_res_nodes);
+  *MAT(prev_data, 0, 0) = to_val(last);
+  double start = now();
+  for(unsigned i = 0; i < PREDICTION_DATA_SIZE; i++) {
+    predict(res, &predicted_data, &prev_data);
+    predicted[i] = VAL_TO_F32(*MAT(predicted_data, 0, 0));
+    *MAT(prev_data, 0, 0) = *MAT(predicted_data, 0, 0);
+  }
+  double elapsed = now() - start;
+  MAT_DESTROY(res->mem, &predicted_data);
+  MAT_DESTROY(res->mem, &prev_data);
+  return elapsed;
+}
+
+// max abs error and NRMSE (by the std of the reference) of predicted against a previous bench output
+static int compare(const char *path, float *predicted) {
+  char buf[INPUT_FILE_LINE_MAX];
+  FILE *fp = fopen(path, "r");
+  if(fp == NULL) {
+    return -1;
+  }
+  double max_err = 0.0, sq_err = 0.0, sum = 0.0, sq_sum = 0.0;
+  unsigned n = 0;
+  for(; n < PREDICTION_DATA_SIZE && fgets(buf, sizeof(buf), fp); n++) {
+    double ref = strtod(buf, NULL);
+    double err = fabs(predicted[n] - ref);
+    max_err = err > max_err ? err : max_err;
+    sq_err += err * err;
+    sum += ref;
+    sq_sum += ref * ref;
+  }
+  fclose(fp);
+  if(n != PREDICTION_DATA_SIZE) {
+    return -1;
+  }
+  double var = sq_sum / n - (sum / n) * (sum / n);
+  printf("compare %s: max abs error %g, nrmse %g\n", path, max_err, var > 0.0 ? sqrt(sq_err / n / var) : 0.0);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  FILE *fp;
+  int ret = -1;
+  mat_memory_t mem = {
+      .memory_alloc = (void *(*)(unsigned)) malloc,
+      .memory_free = (void (*)(void *)) free,
+  };
+  reservoir_t res = {
+      .mem = &mem,
+      .n_in_nodes = 1,
+      .n_res_nodes = 100,
+      .n_out_nodes = 1,
+      .leak_rate = 0.02f,
+  };
+  static float samples[TRAINING_DATA_SIZE];
+  static float predicted[PREDICTION_DATA_SIZE];
+  VAL_T *state = malloc(sizeof(VAL_T) * res.n_res_nodes);
+  if(state == NULL) {
+    return -1;
+  }
+  // load data
+  char buf[INPUT_FILE_LINE_MAX];
+  fp = fopen(INPUT_FILE_NAME, "r");
+  if(fp == NULL) {
+    free(state);
+    return -1;
+  }
+  unsigned n_samples = 0;
+  for(; n_samples < TRAINING_DATA_SIZE && fgets(buf, sizeof(buf), fp); n_samples++) {
+    samples[n_samples] = strtod(buf, NULL);
+  }
+  fclose(fp);
+  if(n_samples != TRAINING_DATA_SIZE) {
+    free(state);
+    return -1;
+  }
+  // train, the last repeat is kept
+  double train_time = 0.0;
+  for(unsigned r = 0; r < TRAINING_REPEAT; r++) {
+    if(r > 0) {
+      deinit(&res);
+    }
+    init(&res);
+    double t = bench_train(&res, samples);
+    if(t < 0.0) {
+      goto error;
+    }
+    train_time += t;
+  }
+  memcpy(state, res.res_nodes.data, sizeof(VAL_T) * res.n_res_nodes);
+  // predict
+  double predict_time = 0.0;
+  for(unsigned r = 0; r < PREDICTION_REPEAT; r++) {
+    predict_time += bench_predict(&res, predicted, samples[TRAINING_DATA_SIZE - 1], state);
+  }
+  printf("%s: train %.3f ms, predict %.1f ns/step (%.0f steps/s)\n", BENCH_NAME,
+      train_time / TRAINING_REPEAT * 1e3,
+      predict_time / PREDICTION_REPEAT / PREDICTION_DATA_SIZE * 1e9,
+      PREDICTION_REPEAT * PREDICTION_DATA_SIZE / predict_time);
+  fp = fopen(OUTPUT_FILE_NAME, "w");
+  if(fp == NULL) {
+    goto error;
+  }
+  for(unsigned i = 0; i < PREDICTION_DATA_SIZE; i++) {
+    fprintf(fp, "%f\n", predicted[i]);
+  }
+  fclose(fp);
+  // compare against the output of the other backend (or a previous run)
+  if(argc > 1 && compare(argv[1], predicted) < 0) {
+    goto error;
+  }
+  ret = 0;
+error:
+  deinit(&res);
+  free(state);
+  return ret;
+}
@@ -23,7 +23,7 @@ void main() {
     return;
   }
   fprintf(fp, "#include \"reservoir.h\"\n");
-  fprintf(fp, "const VAL_T __training_data[] = {\n");
+  fprintf(fp, "const f32_t __training_data[] = {\n");
   for(unsigned i = 0; i < 960; i++) {
     if(i > 0) {
       fprintf(fp, ",\n");
@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "reservoir.h"
+#include "model.h"
+
+// rows with at most this many non-zero weights (of n_res_nodes / STEP_GEN_SPARSE_DIV) become straight-line code
+#define STEP_GEN_SPARSE_DIV 4
+// partial sums of the generic dot product, a multiple of the SIMD width so the compiler can vectorise without
+// reassociating (no -ffast-math needed)
+#define STEP_GEN_LANES 8
+
+#define TARGET_GENERIC 0
+#define TARGET_CMSIS 1
+
+// enough digits to round trip, always with an exponent so the f suffix is valid
+static void print_val(FILE *fp, double v) {
+  fprintf(fp, "%.9ef", v);
+}
+
+static unsigned row_nonzeros(reservoir_t *res, unsigned m) {
+  unsigned n = 0;
+  for(unsigned j = 0; j < res->n_res_nodes; j++) {
+    if(RES_WEIGHT(res, j, m) != 0.0f) {
+      n++;
+    }
+  }
+  return n;
+}
+
+static int gen_header(reservoir_t *res, const char *path, const char *model_path) {
+  FILE *fp = fopen(path, "w");
+  if(fp == NULL) {
+    return -1;
+  }
+  fprintf(fp, "#ifndef RESERVOIR_STEP_H_\n");
+  fprintf(fp, "#define RESERVOIR_STEP_H_\n\n");
+  fprintf(fp, "// generated by tool/step-gen from %s, do not edit\n\n", model_path);
+  fprintf(fp, "#define RESERVOIR_STEP_N_IN_NODES (%u)\n", res->n_in_nodes);
+  fprintf(fp, "#define RESERVOIR_STEP_N_RES_NODES (%u)\n", res->n_res_nodes);
+  fprintf(fp, "#define RESERVOIR_STEP_N_OUT_NODES (%u)\n\n", res->n_out_nodes);
+  fprintf(fp, "// res_nodes of the model\n");
+  fprintf(fp, "extern const float reservoir_step_init[RESERVOIR_STEP_N_RES_NODES];\n\n");
+  fprintf(fp, "// predict of the model with everything known at generation time folded in:\n");
+  fprintf(fp, "// state is updated in place, out gets the readout of the new state\n");
+  fprintf(fp, "void reservoir_step(float *state, const float *in, float *out);\n\n");
+  fprintf(fp, "#endif /* RESERVOIR_STEP_H_ */\n");
+  return fclose(fp) == 0 ? 0 : -1;
+}
+
+static int gen_source(reservoir_t *res, const char *path, const char *header, int target) {
+  unsigned n_res = res->n_res_nodes;
+  unsigned sparse_max = n_res / STEP_GEN_SPARSE_DIV;
+  float leak = res->leak_rate;
+  FILE *fp = fopen(path, "w");
+  if(fp == NULL) {
+    return -1;
+  }
+  const char *base = strrchr(header, '/');
+  fprintf(fp, "#include \"%s\"\n\n", base ? base + 1 : header);
+  if(target == TARGET_CMSIS) {
+    fprintf(fp, "#include <arm_math.h>\n");
+  } else {
+    fprintf(fp, "#include <math.h>\n");
+  }
+  fprintf(fp, "#include <string.h>\n\n");
+  // leak_rate * res_weights, transposed so the rows that stay dense are contiguous
+  unsigned n_dense = 0;
+  for(unsigned m = 0; m < n_res; m++) {
+    n_dense += row_nonzeros(res, m) > sparse_max;
+  }
+  if(n_dense > 0) {
+    fprintf(fp, "// leak_rate * res_weights of the dense nodes, transposed\n");
+    fprintf(fp, "static const float _res[%u][%u] = {\n", n_dense, n_res);
+    for(unsigned m = 0; m < n_res; m++) {
+      if(row_nonzeros(res, m) <= sparse_max) {
+        continue;
+      }
+      fprintf(fp, "  {\n");
+      for(unsigned j = 0; j < n_res; j++) {
+        fprintf(fp, "    ");
+        print_val(fp, leak * RES_WEIGHT(res, j, m));
+        fprintf(fp, ",\n");
+      }
+      fprintf(fp, "  },\n");
+    }
+    fprintf(fp, "};\n\n");
+  }
+  fprintf(fp, "// out_weights, transposed\n");
+  fprintf(fp, "static const float _out[%u][%u] = {\n", res->n_out_nodes, n_res);
+  for(unsigned k = 0; k < res->n_out_nodes; k++) {
+    fprintf(fp, "  {\n");
+    for(unsigned m = 0; m < n_res; m++) {
+      fprintf(fp, "    ");
+      print_val(fp, *MAT(res->out_weights, m, k));
+      fprintf(fp, ",\n");
+    }
+    fprintf(fp, "  },\n");
+  }
+  fprintf(fp, "};\n\n");
+  fprintf(fp, "const float reservoir_step_init[%u] = {\n", n_res);
+  for(unsigned m = 0; m < n_res; m++) {
+    fprintf(fp, "  ");
+    print_val(fp, *MAT(res->res_nodes, 0, m));
+    fprintf(fp, ",\n");
+  }
+  fprintf(fp, "};\n\n");
+  // dot product over n_res_nodes
+  if(target == TARGET_CMSIS) {
+    fprintf(fp, "static inline float _dot(const float *x, const float *w) {\n");
+    fprintf(fp, "  float acc;\n");
+    fprintf(fp, "  arm_dot_prod_f32(x, w, %u, &acc);\n", n_res);
+    fprintf(fp, "  return acc;\n");
+    fprintf(fp, "}\n\n");
+  } else {
+    fprintf(fp, "static inline float _dot(const float *x, const float *w) {\n");
+    fprintf(fp, "  float acc[%u] = { 0.0f };\n", STEP_GEN_LANES);
+    fprintf(fp, "  for(unsigned j = 0; j < %u; j += %u) {\n", n_res / STEP_GEN_LANES * STEP_GEN_LANES, STEP_GEN_LANES);
+    fprintf(fp, "    for(unsigned l = 0; l < %u; l++) {\n", STEP_GEN_LANES);
+    fprintf(fp, "      acc[l] += x[j + l] * w[j + l];\n");
+    fprintf(fp, "    }\n");
+    fprintf(fp, "  }\n");
+    fprintf(fp, "  float sum = 0.0f;\n");
+    for(unsigned j = n_res / STEP_GEN_LANES * STEP_GEN_LANES; j < n_res; j++) {
+      fprintf(fp, "  sum += x[%u] * w[%u];\n", j, j);
+    }
+    fprintf(fp, "  for(unsigned l = 0; l < %u; l++) {\n", STEP_GEN_LANES);
+    fprintf(fp, "    sum += acc[l];\n");
+    fprintf(fp, "  }\n");
+    fprintf(fp, "  return sum;\n");
+    fprintf(fp, "}\n\n");
+  }
+  // one statement per node: leak folded into the weights and the carried state
+  fprintf(fp, "void reservoir_step(float *state, const float *in, float *out) {\n");
+  fprintf(fp, "  float next[%u];\n", n_res);
+  for(unsigned m = 0, d = 0; m < n_res; m++) {
+    fprintf(fp, "  next[%u] = tanhf(", m);
+    if(row_nonzeros(res, m) > sparse_max) {
+      fprintf(fp, "_dot(state, _res[%u])", d++);
+    } else {
+      fprintf(fp, "0.0f");
+      for(unsigned j = 0; j < n_res; j++) {
+        float w = leak * RES_WEIGHT(res, j, m);
+        if(w != 0.0f) {
+          fprintf(fp, "\n      + state[%u] * ", j);
+          print_val(fp, w);
+        }
+      }
+    }
+    for(unsigned n = 0; n < res->n_in_nodes; n++) {
+      float w = leak * IN_WEIGHT(res, n, m);
+      if(w != 0.0f) {
+        fprintf(fp, "\n      + in[%u] * ", n);
+        print_val(fp, w);
+      }
+    }
+    fprintf(fp, "\n      + state[%u] * ", m);
+    print_val(fp, 1.0f - leak);
+    fprintf(fp, ");\n");
+  }
+  for(unsigned k = 0; k < res->n_out_nodes; k++) {
+    fprintf(fp, "  out[%u] = _dot(next, _out[%u]);\n", k, k);
+  }
+  fprintf(fp, "  memcpy(state, next, sizeof(next));\n");
+  fprintf(fp, "}\n");
+  return fclose(fp) == 0 ? 0 : -1;
+}
+
+static void usage(const char *name) {
+  fprintf(stderr, "usage: %s [-t generic|cmsis] <model> <output .c>\n", name);
+  fprintf(stderr, "  writes the specialised step function of the model and its header (.h next to the .c)\n");
+}
+
+int main(int argc, char **argv) {
+  int target = TARGET_GENERIC;
+  int opt;
+  while((opt = getopt(argc, argv, "t:")) != -1) {
+    switch(opt) {
+    case 't':
+      if(strcmp(optarg, "cmsis") == 0) {
+        target = TARGET_CMSIS;
+      } else if(strcmp(optarg, "generic") != 0) {
+        usage(argv[0]);
+        return -1;
+      }
+      break;
+    default:
+      usage(argv[0]);
+      return -1;
+    }
+  }
+  if(argc - optind != 2) {
+    usage(argv[0]);
+    return -1;
+  }
+  const char *model_path = argv[optind];
+  const char *source_path = argv[optind + 1];
+  size_t len = strlen(source_path);
+  if(len < 2 || strcmp(source_path + len - 2, ".c") != 0) {
+    usage(argv[0]);
+    return -1;
+  }
+  char *header_path = strdup(source_path);
+  if(header_path == NULL) {
+    return -1;
+  }
+  header_path[len - 1] = 'h';
+  mat_memory_t mem = {
+      .memory_alloc = (void *(*)(unsigned)) malloc,
+      .memory_free = (void (*)(void *)) free,
+  };
+  reservoir_t res = {
+      .mem = &mem,
+  };
+  model_t model;
+  if(model_load(&res, &model, model_path) < 0) {
+    fprintf(stderr, "cannot load %s\n", model_path);
+    free(header_path);
+    return -1;
+  }
+  int ret = 0;
+  if(gen_header(&res, header_path, model_path) < 0 || gen_source(&res, source_path, header_path, target) < 0) {
+    fprintf(stderr, "cannot write %s\n", source_path);
+    ret = -1;
+  }
+  model_unload(&res, &model);
+  free(header_path);
+  return ret;
+}
@@ -1,8 +1,46 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include "reservoir.h"
 
+static void print_f32(FILE *fp, const char *type, const char *name, MAT_T *a) {
+  fprintf(fp, "const %s %s[] = {\n", type, name);
+  for(unsigned i = 0; i < a->n * a->m; i++) {
+    if(i > 0) {
+      fprintf(fp, ",\n");
+    }
+    fprintf(fp, "  %f", *(a->data + i));
+  }
+  fprintf(fp, "\n};\n");
+}
+
+static void print_h16(FILE *fp, const char *type, const char *name, MAT_T *a, uint16_t (*conv)(f32_t)) {
+  fprintf(fp, "const %s %s[] = {\n", type, name);
+  for(unsigned i = 0; i < a->n * a->m; i++) {
+    if(i > 0) {
+      fprintf(fp, ",\n");
+    }
+    fprintf(fp, "  0x%04x", conv(*(a->data + i)));
+  }
+  fprintf(fp, "\n};\n");
+}
+
+// q15, stored transposed
+static void print_q15_t(FILE *fp, const char *name, MAT_T *a) {
+  fprintf(fp, "const q15_t %s[] = {\n", name);
+  for(unsigned m = 0; m < a->m; m++) {
+    for(unsigned n = 0; n < a->n; n++) {
+      long v = lrintf(*_MAT(*a, n, m) * 32768.0f);
+      if(m > 0 || n > 0) {
+        fprintf(fp, ",\n");
+      }
+      fprintf(fp, "  %ld", v > 32767 ? 32767 : v < -32768 ? -32768 : v);
+    }
+  }
+  fprintf(fp, "\n};\n");
+}
+
 void main() {
   FILE *fp;
   mat_memory_t mem = {
@@ -19,23 +57,40 @@ void main() {
   init(&res);
   fp = fopen("weights.c", "w");
   fprintf(fp, "#include \"reservoir.h\"\n");
+  fprintf(fp, "#if !defined(PRECISION_Q15)\n");
   // in_weights
-  fprintf(fp, "const VAL_T __in_weights[] = {\n");
-  for(unsigned i = 0; i < res.in_weights.n * res.in_weights.m; i++) {
-    if(i > 0) {
-      fprintf(fp, ",\n");
+  print_f32(fp, "VAL_T", "__in_weights", &res.in_weights);
+  // in_weights packed as sign bits (SIGN_IN_WEIGHTS)
+  fprintf(fp, "const uint32_t __in_sign_weights[] = {\n");
+  for(unsigned n = 0; n < res.in_weights.n; n++) {
+    for(unsigned w = 0; w < MAT_SIGN_WORDS(res.in_weights.m); w++) {
+      uint32_t sign = 0;
+      for(unsigned m = w * 32; m < res.in_weights.m && m < (w + 1) * 32; m++) {
+        if(*_MAT(res.in_weights, n, m) < 0.0) {
+          sign |= (uint32_t) 1 << (m % 32);
+        }
+      }
+      if(n > 0 || w > 0) {
+        fprintf(fp, ",\n");
+      }
+      fprintf(fp, "  0x%08x", sign);
     }
-    fprintf(fp, "  %f", *(res.in_weights.data + i));
   }
   fprintf(fp, "\n};\n");
   // res_weights
-  fprintf(fp, "const VAL_T __res_weights[] = {\n");
-  for(unsigned i = 0; i < res.res_weights.n * res.res_weights.m; i++) {
-    if(i > 0) {
-      fprintf(fp, ",\n");
-    }
-    fprintf(fp, "  %f", *(res.res_weights.data + i));
-  }
-  fprintf(fp, "\n};\n");
+  print_f32(fp, "VAL_T", "__res_weights", &res.res_weights);
+  // in_weights and res_weights in half precision storage (STORAGE_F16, STORAGE_BF16)
+  fprintf(fp, "#if defined(STORAGE_F16)\n");
+  print_h16(fp, "f16_t", "__in_weights_f16", &res.in_weights, f32_to_f16);
+  print_h16(fp, "f16_t", "__res_weights_f16", &res.res_weights, f32_to_f16);
+  fprintf(fp, "#elif defined(STORAGE_BF16)\n");
+  print_h16(fp, "bf16_t", "__in_weights_bf16", &res.in_weights, f32_to_bf16);
+  print_h16(fp, "bf16_t", "__res_weights_bf16", &res.res_weights, f32_to_bf16);
+  fprintf(fp, "#endif\n");
+  // in_weights and res_weights in q15 (PRECISION_Q15)
+  fprintf(fp, "#else\n");
+  print_q15_t(fp, "__in_weights_q15", &res.in_weights);
+  print_q15_t(fp, "__res_weights_q15", &res.res_weights);
+  fprintf(fp, "#endif\n");
   fclose(fp);
 }